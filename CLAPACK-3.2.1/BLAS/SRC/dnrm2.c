@@ -13,18 +13,27 @@
 #include "f2c.h"
 #include "blaswrap.h"
 
+/* Blue's scaling constants for IEEE double precision: */
+/* TSML = 2**-511, TBIG = 2**486, SSML = 2**537, SBIG = 2**-538. */
+
+static doublereal tsml = 1.4916681462400413e-154;
+static doublereal tbig = 1.997919072202235e+146;
+static doublereal ssml = 4.4989137945431964e+161;
+static doublereal sbig = 1.1113793747425387e-162;
+
 doublereal dnrm2_(integer *n, doublereal *x, integer *incx)
 {
     /* System generated locals */
-    integer i__1, i__2;
+    integer i__1;
     doublereal ret_val, d__1;
 
     /* Builtin functions */
     double sqrt(doublereal);
 
     /* Local variables */
-    integer ix;
-    doublereal ssq, norm, scale, absxi;
+    integer i__, k, ix, nb;
+    doublereal ax, ymin, ymax, asml[4], amed[4], abig[4], xk[4], sml, med, 
+	    big, norm;
 
 /*     .. Scalar Arguments .. */
 /*     .. */
@@ -39,6 +48,13 @@ doublereal dnrm2_(integer *n, doublereal *x, integer *incx)
 
 /*     DNRM2 := sqrt( x'*x ) */
 
+/*  The squares are accumulated with Blue's algorithm in three ranges */
+/*  (small, medium, big) using power-of-two scaling, so there is no */
+/*  division in the loop and no overflow or harmful underflow.  The */
+/*  elements are dealt cyclically to four accumulators that are */
+/*  combined in a fixed order, so the result does not depend on */
+/*  whether the loop is vectorized. */
+
 
 /*  -- This version written on 25-October-1982. */
 /*     Modified on 14-October-1993 to inline the call to DLASSQ. */
@@ -56,35 +72,89 @@ doublereal dnrm2_(integer *n, doublereal *x, integer *incx)
 
     /* Function Body */
     if (*n < 1 || *incx < 1) {
-	norm = 0.;
+	ret_val = 0.;
+	return ret_val;
     } else if (*n == 1) {
-	norm = abs(x[1]);
-    } else {
-	scale = 0.;
-	ssq = 1.;
-/*        The following loop is equivalent to this call to the LAPACK */
-/*        auxiliary routine: */
-/*        CALL DLASSQ( N, X, INCX, SCALE, SSQ ) */
-
-	i__1 = (*n - 1) * *incx + 1;
-	i__2 = *incx;
-	for (ix = 1; i__2 < 0 ? ix >= i__1 : ix <= i__1; ix += i__2) {
-	    if (x[ix] != 0.) {
-		absxi = (d__1 = x[ix], abs(d__1));
-		if (scale < absxi) {
+	ret_val = abs(x[1]);
+	return ret_val;
+    }
+
+    for (k = 0; k < 4; ++k) {
+	asml[k] = 0.;
+	amed[k] = 0.;
+	abig[k] = 0.;
+/* L10: */
+    }
+    ix = 1;
+    nb = *n - *n % 4;
+    i__1 = nb;
+    for (i__ = 1; i__ <= i__1; i__ += 4) {
+	for (k = 0; k < 4; ++k) {
+	    xk[k] = x[ix + k * *incx];
+/* L20: */
+	}
+	for (k = 0; k < 4; ++k) {
+	    ax = abs(xk[k]);
+	    big = ax > tbig ? ax * sbig : 0.;
+	    sml = ax < tsml ? ax * ssml : 0.;
+	    med = ax > tbig || ax < tsml ? 0. : ax;
+	    abig[k] += big * big;
+	    asml[k] += sml * sml;
+	    amed[k] += med * med;
+/* L30: */
+	}
+	ix += *incx << 2;
+/* L40: */
+    }
+    i__1 = *n;
+    for (i__ = nb + 1; i__ <= i__1; ++i__) {
+	k = i__ - nb - 1;
+	ax = (d__1 = x[ix], abs(d__1));
+	if (ax > tbig) {
 /* Computing 2nd power */
-		    d__1 = scale / absxi;
-		    ssq = ssq * (d__1 * d__1) + 1.;
-		    scale = absxi;
-		} else {
+	    d__1 = ax * sbig;
+	    abig[k] += d__1 * d__1;
+	} else if (ax < tsml) {
 /* Computing 2nd power */
-		    d__1 = absxi / scale;
-		    ssq += d__1 * d__1;
-		}
+	    d__1 = ax * ssml;
+	    asml[k] += d__1 * d__1;
+	} else {
+	    amed[k] += ax * ax;
+	}
+	ix += *incx;
+/* L50: */
+    }
+    abig[0] = abig[0] + abig[1] + (abig[2] + abig[3]);
+    asml[0] = asml[0] + asml[1] + (asml[2] + asml[3]);
+    amed[0] = amed[0] + amed[1] + (amed[2] + amed[3]);
+
+/*     Combine abig and amed or amed and asml if more than one */
+/*     accumulator was used. */
+
+    if (abig[0] > 0.) {
+	if (amed[0] > 0. || amed[0] != amed[0]) {
+	    abig[0] += amed[0] * sbig * sbig;
+	}
+	norm = sqrt(abig[0]) / sbig;
+    } else if (asml[0] > 0.) {
+	if (amed[0] > 0. || amed[0] != amed[0]) {
+	    amed[0] = sqrt(amed[0]);
+	    asml[0] = sqrt(asml[0]) / ssml;
+	    if (asml[0] > amed[0]) {
+		ymin = amed[0];
+		ymax = asml[0];
+	    } else {
+		ymin = asml[0];
+		ymax = amed[0];
 	    }
-/* L10: */
+/* Computing 2nd power */
+	    d__1 = ymin / ymax;
+	    norm = ymax * sqrt(d__1 * d__1 + 1.);
+	} else {
+	    norm = sqrt(asml[0]) / ssml;
 	}
-	norm = scale * sqrt(ssq);
+    } else {
+	norm = sqrt(amed[0]);
     }
 
     ret_val = norm;
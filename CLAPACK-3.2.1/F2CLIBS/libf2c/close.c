@@ -35,6 +35,7 @@ integer f_clos(cllist *a)
 	b= &f__units[a->cunit];
 	if(b->ufd==NULL)
 		goto done;
+	f__unmap(b);
 	if (b->uscrtch == 1)
 		goto Delete;
 	if (!a->csta)
@@ -48,7 +49,7 @@ integer f_clos(cllist *a)
 				t_runc((alist *)a);
 			if(b->ufnm) {
 				fclose(b->ufd);
-				free(b->ufnm);
+				F77_free(b->ufnm);
 				}
 			break;
 		case 'd':
@@ -57,7 +58,7 @@ integer f_clos(cllist *a)
 			fclose(b->ufd);
 			if(b->ufnm) {
 				unlink(b->ufnm); /*SYSDEP*/
-				free(b->ufnm);
+				F77_free(b->ufnm);
 				}
 		}
 	b->ufd=NULL;
@@ -11,7 +11,7 @@ y_rsk(Void)
 	if(f__curunit->uend || f__curunit->url <= f__recpos
 		|| f__curunit->url == 1) return 0;
 	do {
-		getc(f__cf);
+		FGETC(f__cf);
 	} while(++f__recpos < f__curunit->url);
 	return 0;
 }
@@ -21,7 +21,7 @@ y_getc(Void)
 {
 	int ch;
 	if(f__curunit->uend) return(-1);
-	if((ch=getc(f__cf))!=EOF)
+	if((ch=FGETC(f__cf))!=EOF)
 	{
 		f__recpos++;
 		if(f__curunit->url>=f__recpos ||
@@ -44,8 +44,7 @@ y_rev(Void)
 	if (f__recpos < f__hiwater)
 		f__recpos = f__hiwater;
 	if (f__curunit->url > 1)
-		while(f__recpos < f__curunit->url)
-			(*f__putn)(' ');
+		f__putfill(' ', f__curunit->url - f__recpos);
 	if (f__recpos)
 		f__putbuf(0);
 	f__recpos = 0;
@@ -127,6 +126,7 @@ integer s_wdfe(cilist *a)
 	if(f__curunit->uwrt != 1 && f__nowwriting(f__curunit))
 		err(a->cierr,errno,"startwrt");
 	f__putn = x_putc;
+	f__putsn = x_putsn;
 	f__doed = w_ed;
 	f__doned= w_ned;
 	f__dorevert = y_err;
@@ -1,4 +1,5 @@
 #include "f2c.h"
+#include "fio.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -7,11 +8,11 @@ extern "C" {
 extern "C" {
 #endif
 #ifdef KR_headers
-extern int (*f__lioproc)();
+extern F2C_TLS int (*f__lioproc)();
 
 integer do_lio(type,number,ptr,len) ftnint *number,*type; char *ptr; ftnlen len;
 #else
-extern int (*f__lioproc)(ftnint*, char*, ftnlen, ftnint);
+extern F2C_TLS int (*f__lioproc)(ftnint*, char*, ftnlen, ftnint);
 
 integer do_lio(ftnint *type, ftnint *number, char *ptr, ftnlen len)
 #endif
@@ -9,11 +9,24 @@
 #define REAL double
 #endif
 
+/* By default, times come from getrusage, to microseconds; compile */
+/* with -DUSE_TIMES to use times() (clock ticks) instead, or with */
+/* -DUSE_CLOCK to use clock() (no system time). */
+
 #ifndef USE_CLOCK
+#ifndef USE_TIMES
+#define USE_GETRUSAGE
+#endif
 #define _INCLUDE_POSIX_SOURCE	/* for HP-UX */
 #define _INCLUDE_XOPEN_SOURCE	/* for HP-UX */
 #include "sys/types.h"
+#ifdef USE_GETRUSAGE
+#include "sys/time.h"
+#include "sys/resource.h"
+#define Tsec(x) ((double)(x).tv_sec + 1e-6*(double)(x).tv_usec)
+#else
 #include "sys/times.h"
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -47,6 +60,20 @@ dtime_(float *tarray)
 	tarray[0] = (t - t0) / CLOCKS_PER_SECOND;
 	t0 = t;
 	return tarray[0];
+#else
+#ifdef USE_GETRUSAGE
+	struct rusage r;
+	double u, s;
+	static double u0, s0;
+
+	getrusage(RUSAGE_SELF, &r);
+	u = Tsec(r.ru_utime);
+	s = Tsec(r.ru_stime);
+	tarray[0] = u - u0;
+	tarray[1] = s - s0;
+	u0 = u;
+	s0 = s;
+	return tarray[0] + tarray[1];
 #else
 	struct tms t;
 	static struct tms t0;
@@ -56,6 +83,7 @@ dtime_(float *tarray)
 	tarray[1] = (double)(t.tms_stime - t0.tms_stime) / Hz;
 	t0 = t;
 	return tarray[0] + tarray[1];
+#endif
 #endif
 	}
 #ifdef __cplusplus
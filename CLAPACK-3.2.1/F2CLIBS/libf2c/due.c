@@ -14,6 +14,9 @@ c_due(cilist *a)
 	if(!f__init) f_init();
 	f__sequential=f__formatted=f__recpos=0;
 	f__external=1;
+#ifdef F2C_MMAP
+	f__mptr = 0;
+#endif
 	f__curunit = &f__units[a->ciunit];
 	if(a->ciunit>=MXUNIT || a->ciunit<0)
 		err(a->cierr,101,"startio");
@@ -25,6 +28,16 @@ c_due(cilist *a)
 	if(f__curunit->ufd==NULL) err(a->cierr,114,"cdue")
 	if(a->cirec <= 0)
 		err(a->cierr,130,"due")
+#ifdef F2C_MMAP
+	/* Reads come from the mapping, and the file position is left */
+	/* alone (every direct-access statement starts with FSEEK). */
+	/* After a write, FSEEK first so the data reach the file. */
+	if (f__reading && !f__curunit->uwrt
+	 && f__mapunit(f__curunit, (OFF_T)a->cirec*f__curunit->url))
+		f__mptr = f__curunit->umap
+			+ (OFF_T)(a->cirec-1)*f__curunit->url;
+	else
+#endif
 	FSEEK(f__cf,(OFF_T)(a->cirec-1)*f__curunit->url,SEEK_SET);
 	f__curunit->uend = 0;
 	return(0);
@@ -59,6 +72,10 @@ integer e_rdue(Void)
 {
 	if(f__curunit->url==1 || f__recpos==f__curunit->url)
 		return(0);
+#ifdef F2C_MMAP
+	if (f__mptr)
+		return(0);
+#endif
 	FSEEK(f__cf,(OFF_T)(f__curunit->url-f__recpos),SEEK_CUR);
 	if(FTELL(f__cf)%f__curunit->url)
 		err(f__elist->cierr,200,"syserr");
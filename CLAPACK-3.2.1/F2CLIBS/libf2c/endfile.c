@@ -90,6 +90,7 @@ t_runc(alist *a)
 	b = &f__units[a->aunit];
 	if(b->url)
 		return(0);	/*don't truncate direct files*/
+	f__unmap(b);
 	loc=FTELL(bf = b->ufd);
 	FSEEK(bf,(OFF_T)0,SEEK_END);
 	len=FTELL(bf);
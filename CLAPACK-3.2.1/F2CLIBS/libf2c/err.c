@@ -20,6 +20,9 @@ extern char *malloc();
 #else
 #include <unistd.h>
 #endif
+#ifdef F2C_THREADS
+#include <pthread.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,32 +30,34 @@ extern "C" {
 
 /*global definitions*/
 unit f__units[MXUNIT];	/*unit table*/
-flag f__init;	/*0 on entry, 1 after initializations*/
-cilist *f__elist;	/*active external io list*/
-icilist *f__svic;	/*active internal io list*/
-flag f__reading;	/*1 if reading, 0 if writing*/
-flag f__cplus,f__cblank;
-Const char *f__fmtbuf;
-flag f__external;	/*1 if external io, 0 if internal */
+F2C_TLS flag f__init;	/*0 on entry, 1 after initializations*/
+F2C_TLS cilist *f__elist;	/*active external io list*/
+F2C_TLS icilist *f__svic;	/*active internal io list*/
+F2C_TLS flag f__reading;	/*1 if reading, 0 if writing*/
+F2C_TLS flag f__cplus,f__cblank;
+F2C_TLS Const char *f__fmtbuf;
+F2C_TLS flag f__external;	/*1 if external io, 0 if internal */
 #ifdef KR_headers
-int (*f__doed)(),(*f__doned)();
-int (*f__doend)(),(*f__donewrec)(),(*f__dorevert)();
-int (*f__getn)();	/* for formatted input */
-void (*f__putn)();	/* for formatted output */
+F2C_TLS int (*f__doed)(),(*f__doned)();
+F2C_TLS int (*f__doend)(),(*f__donewrec)(),(*f__dorevert)();
+F2C_TLS int (*f__getn)();	/* for formatted input */
+F2C_TLS void (*f__putn)();	/* for formatted output */
+F2C_TLS void (*f__putsn)();	/* for formatted output of n chars */
 #else
-int (*f__getn)(void);	/* for formatted input */
-void (*f__putn)(int);	/* for formatted output */
-int (*f__doed)(struct syl*, char*, ftnlen),(*f__doned)(struct syl*);
-int (*f__dorevert)(void),(*f__donewrec)(void),(*f__doend)(void);
+F2C_TLS int (*f__getn)(void);	/* for formatted input */
+F2C_TLS void (*f__putn)(int);	/* for formatted output */
+F2C_TLS void (*f__putsn)(const char*, int);	/* for formatted output of n chars */
+F2C_TLS int (*f__doed)(struct syl*, char*, ftnlen),(*f__doned)(struct syl*);
+F2C_TLS int (*f__dorevert)(void),(*f__donewrec)(void),(*f__doend)(void);
 #endif
-flag f__sequential;	/*1 if sequential io, 0 if direct*/
-flag f__formatted;	/*1 if formatted io, 0 if unformatted*/
-FILE *f__cf;	/*current file*/
-unit *f__curunit;	/*current unit*/
-int f__recpos;	/*place in current record*/
-OFF_T f__cursor, f__hiwater;
-int f__scale;
-char *f__icptr;
+F2C_TLS flag f__sequential;	/*1 if sequential io, 0 if direct*/
+F2C_TLS flag f__formatted;	/*1 if formatted io, 0 if unformatted*/
+F2C_TLS FILE *f__cf;	/*current file*/
+F2C_TLS unit *f__curunit;	/*current unit*/
+F2C_TLS int f__recpos;	/*place in current record*/
+F2C_TLS OFF_T f__cursor, f__hiwater;
+F2C_TLS int f__scale;
+F2C_TLS char *f__icptr;
 
 /*error messages*/
 Const char *F_err[] =
@@ -177,11 +182,10 @@ f__fatal(int n, const char *s)
 	sig_die(" IO", 1);
 }
 /*initialization routine*/
- VOID
-f_init(Void)
+ static VOID
+units_init(Void)
 {	unit *p;
 
-	f__init=1;
 	p= &f__units[0];
 	p->ufd=stderr;
 	p->useek=f__canseek(stderr);
@@ -199,6 +203,21 @@ f_init(Void)
 	p->uwrt=1;
 }
 
+/* With F2C_THREADS, f__init is per thread, so each thread comes */
+/* here once, but the shared units are set up only by the first. */
+
+ VOID
+f_init(Void)
+{
+#ifdef F2C_THREADS
+	static pthread_once_t once = PTHREAD_ONCE_INIT;
+	pthread_once(&once, units_init);
+#else
+	units_init();
+#endif
+	f__init=1;
+}
+
  int
 #ifdef KR_headers
 f__nowreading(x) unit *x;
@@ -243,6 +262,7 @@ f__nowwriting(unit *x)
 	int ufmt;
 	extern char *f__w_mode[];
 
+	f__unmap(x);
 	if (x->urw & 2) {
 		if (x->urw & 1)
 			FSEEK(x->ufd, (OFF_T)0, SEEK_CUR);
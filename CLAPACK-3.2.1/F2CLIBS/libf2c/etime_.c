@@ -9,11 +9,24 @@
 #define REAL double
 #endif
 
+/* By default, times come from getrusage, to microseconds; compile */
+/* with -DUSE_TIMES to use times() (clock ticks) instead, or with */
+/* -DUSE_CLOCK to use clock() (no system time). */
+
 #ifndef USE_CLOCK
+#ifndef USE_TIMES
+#define USE_GETRUSAGE
+#endif
 #define _INCLUDE_POSIX_SOURCE	/* for HP-UX */
 #define _INCLUDE_XOPEN_SOURCE	/* for HP-UX */
 #include "sys/types.h"
+#ifdef USE_GETRUSAGE
+#include "sys/time.h"
+#include "sys/resource.h"
+#define Tsec(x) ((double)(x).tv_sec + 1e-6*(double)(x).tv_usec)
+#else
 #include "sys/times.h"
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -44,12 +57,20 @@ etime_(float *tarray)
 	double t = clock();
 	tarray[1] = 0;
 	return tarray[0] = t / CLOCKS_PER_SECOND;
+#else
+#ifdef USE_GETRUSAGE
+	struct rusage r;
+
+	getrusage(RUSAGE_SELF, &r);
+	return	  (tarray[0] = Tsec(r.ru_utime))
+		+ (tarray[1] = Tsec(r.ru_stime));
 #else
 	struct tms t;
 
 	times(&t);
 	return	  (tarray[0] = (double)t.tms_utime/Hz)
 		+ (tarray[1] = (double)t.tms_stime/Hz);
+#endif
 #endif
 	}
 #ifdef __cplusplus
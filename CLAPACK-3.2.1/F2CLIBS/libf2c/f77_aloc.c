@@ -3,42 +3,201 @@
 #undef min
 #undef max
 #include "stdio.h"
+#include "fio.h"	/* for F2C_TLS */
 
 static integer memfailure = 3;
 
+/* All of libf2c's storage comes from F77_malloc and goes back through */
+/* F77_free, which call malloc and free unless a program embedding */
+/* libf2c supplies its own pair with F77_set_aloc (before any I/O or */
+/* other libf2c calls, and not while other threads use libf2c). */
+/* F77_aloc is F77_malloc that gives up with an error message. */
+
+/* Short-lived temporaries (e.g., in s_cat) come from a bump arena, */
+/* one per thread with -DF2C_THREADS: F77_atmp(n) returns n bytes on */
+/* top of the arena, and F77_arelease(m), with m an earlier result of */
+/* F77_amark(), pops everything obtained since.  Chunks of the arena */
+/* are kept for reuse; F77_afree returns them to F77_free. */
+
 #ifdef KR_headers
 extern char *malloc();
+extern VOID free();
 extern void exit_();
 
- char *
-F77_aloc(Len, whence) integer Len; char *whence;
+ static char *
+m_aloc(n) ftnlen n;
+{ return malloc((unsigned int)n); }
+
+ static VOID
+m_free(p) char *p;
+{ free(p); }
+
+static char *(*f__aloc)() = m_aloc;
+static VOID (*f__free)() = m_free;
 #else
 #include "stdlib.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
-#ifdef __cplusplus
-extern "C" {
-#endif
 extern void exit_(integer*);
-#ifdef __cplusplus
+
+ static char *
+m_aloc(ftnlen n)
+{ return (char*)malloc((size_t)n); }
+
+ static void
+m_free(char *p)
+{ free(p); }
+
+static char *(*f__aloc)(ftnlen) = m_aloc;
+static void (*f__free)(char*) = m_free;
+#endif
+
+ void
+#ifdef KR_headers
+F77_set_aloc(a, f) char *(*a)(); void (*f)();
+#else
+F77_set_aloc(char *(*a)(ftnlen), void (*f)(char*))
+#endif
+{
+	f__aloc = a ? a : m_aloc;
+	f__free = f ? f : m_free;
+	}
+
+ char *
+#ifdef KR_headers
+F77_malloc(n) ftnlen n;
+#else
+F77_malloc(ftnlen n)
+#endif
+{
+	return (*f__aloc)(n > 0 ? n : 1);
 	}
+
+ void
+#ifdef KR_headers
+F77_free(p) char *p;
+#else
+F77_free(char *p)
 #endif
+{
+	if (p)
+		(*f__free)(p);
+	}
 
  char *
+#ifdef KR_headers
+F77_aloc(Len, whence) integer Len; char *whence;
+#else
 F77_aloc(integer Len, const char *whence)
 #endif
 {
 	char *rv;
 	unsigned int uLen = (unsigned int) Len;	/* for K&R C */
 
-	if (!(rv = (char*)malloc(uLen))) {
+	if (!(rv = F77_malloc((ftnlen)Len))) {
 		fprintf(stderr, "malloc(%u) failure in %s\n",
 			uLen, whence);
 		exit_(&memfailure);
 		}
 	return rv;
 	}
+
+/* Arena chunks; base is the arena offset of the chunk's first byte. */
+
+typedef struct Achunk Achunk;
+struct Achunk {
+	Achunk *prev, *next;
+	ftnlen base, size;
+	double align[1];	/* data start here */
+	};
+
+#ifndef ACHUNK
+#define ACHUNK 4096
+#endif
+#define Adata(c) ((char*)(c)->align)
+
+static F2C_TLS Achunk *a_first, *a_cur;
+static F2C_TLS ftnlen a_top;	/* bytes used in a_cur */
+
+ ftnlen
+F77_amark(Void)
+{
+	return a_cur ? a_cur->base + a_top : 0;
+	}
+
+ char *
+#ifdef KR_headers
+F77_atmp(n, whence) ftnlen n; char *whence;
+#else
+F77_atmp(ftnlen n, const char *whence)
+#endif
+{
+	Achunk *c, *c1;
+	ftnlen size;
+	char *rv;
+
+	n = (n + sizeof(double) - 1) & ~(ftnlen)(sizeof(double) - 1);
+	if (!a_cur || a_top + n > a_cur->size) {
+		c = a_cur ? a_cur->next : a_first;
+		if (c && c->size < n) {
+			/* too small: discard it and those after it */
+			for(; c; c = c1) {
+				c1 = c->next;
+				F77_free((char*)c);
+				}
+			if (a_cur)
+				a_cur->next = 0;
+			else
+				a_first = 0;
+			}
+		if (!c) {
+			size = a_cur ? 2*a_cur->size : ACHUNK;
+			if (size < n)
+				size = n;
+			c = (Achunk*)F77_aloc((integer)(sizeof(Achunk) + size),
+				whence);
+			c->size = size;
+			c->next = 0;
+			if (c->prev = a_cur)
+				a_cur->next = c;
+			else
+				a_first = c;
+			}
+		c->base = a_cur ? a_cur->base + a_cur->size : 0;
+		a_cur = c;
+		a_top = 0;
+		}
+	rv = Adata(a_cur) + a_top;
+	a_top += n;
+	return rv;
+	}
+
+ void
+#ifdef KR_headers
+F77_arelease(m) ftnlen m;
+#else
+F77_arelease(ftnlen m)
+#endif
+{
+	while(a_cur && a_cur->base > m && a_cur->prev)
+		a_cur = a_cur->prev;
+	if (a_cur)
+		a_top = m - a_cur->base;
+	}
+
+ void
+F77_afree(Void)
+{
+	Achunk *c, *c1;
+
+	for(c = a_first; c; c = c1) {
+		c1 = c->next;
+		F77_free((char*)c);
+		}
+	a_first = a_cur = 0;
+	a_top = 0;
+	}
 #ifdef __cplusplus
 }
 #endif
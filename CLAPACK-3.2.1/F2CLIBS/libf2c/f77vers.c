@@ -94,4 +94,10 @@ _libf77_version_f2c[] = "\n@(#) LIBF77 VERSION (f2c) 20051004\n";
 			precision alone rather than forcing it to 53 bits;
 			compile with -DUNINIT_F2C_PRECISION_53 to get the
 			former behavior.
+	18 Oct. 2026: dtime_.c, etime_.c: use getrusage (microseconds)
+			rather than times (clock ticks) unless compiled
+			with -DUSE_TIMES.
+	18 Oct. 2026: add z_vec.c: array forms z_vdiv, z_vabs, z_vsqrt,
+			z_vexp, z_vlog and pow_vzz of the double complex
+			intrinsics, using SSE2 where available.
 */
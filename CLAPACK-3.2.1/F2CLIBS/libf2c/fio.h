@@ -14,6 +14,50 @@
 #define SEEK_END 2
 #endif
 
+/* Compile with -DF2C_THREADS (and whatever your compiler needs for */
+/* threads, e.g., -pthread) to give each thread its own I/O state, */
+/* so several threads may do Fortran I/O at once provided no two of */
+/* them use the same unit at the same time.  The unit table itself */
+/* is shared.  F2C_TLS is the storage-class keyword for thread-local */
+/* data; supply -DF2C_TLS=_Thread_local or the like if __thread is */
+/* not understood. */
+
+#ifdef F2C_THREADS
+#ifndef F2C_TLS
+#define F2C_TLS __thread
+#endif
+#else
+#undef F2C_TLS
+#define F2C_TLS /*nothing*/
+#endif
+
+/* Formatted and list-directed input read characters with FGETC, */
+/* which is getc_unlocked (a unit is only read by one thread at a */
+/* time) unless you compile with -DNO_GETC_UNLOCKED. */
+
+#ifndef FGETC
+#ifdef NO_GETC_UNLOCKED
+#define FGETC getc
+#else
+#define FGETC getc_unlocked
+#endif
+#endif
+
+/* Unformatted reads from a file take their data from a read-only */
+/* mmap of the file rather than from fread: all direct-access reads, */
+/* and sequential reads of records of at least MMAP_MIN bytes.  The */
+/* mapping is dropped when the unit is written, truncated or closed. */
+/* Compile with -DNO_MMAP if sys/mman.h or mmap is not available. */
+
+#if !defined(NO_MMAP) && !defined(MSDOS) && !defined(NON_UNIX_STDIO)
+#ifndef F2C_MMAP
+#define F2C_MMAP
+#endif
+#ifndef MMAP_MIN
+#define MMAP_MIN 65536
+#endif
+#endif
+
 #ifndef FOPEN
 #define FOPEN fopen
 #endif
@@ -74,26 +118,39 @@ typedef struct
 	flag uend;
 	flag uwrt;	/*last io was write*/
 	flag uscrtch;
+#ifdef F2C_MMAP
+	char *umap;	/* mapping of the file, or 0 */
+	OFF_T umaplen;	/* bytes mapped */
+#endif
 } unit;
 
 #undef Void
 #ifdef KR_headers
 #define Void /*void*/
-extern int (*f__getn)();	/* for formatted input */
-extern void (*f__putn)();	/* for formatted output */
-extern void x_putc();
+extern F2C_TLS int (*f__getn)();	/* for formatted input */
+extern F2C_TLS void (*f__putn)();	/* for formatted output */
+extern F2C_TLS void (*f__putsn)();	/* for formatted output of n chars */
+extern void x_putc(), x_putsn();
 extern long f__inode();
 extern VOID sig_die();
-extern int (*f__donewrec)(), t_putc(), x_wSL();
+extern F2C_TLS int (*f__donewrec)();
+extern int t_putc(), x_wSL();
 extern int c_sfe(), err__fl(), xrd_SL(), f__putbuf();
+extern char *F77_malloc();
+extern VOID F77_free();
+#ifdef F2C_MMAP
+extern int f__mapunit();
+extern void f__unmap();
+#endif
 #else
 #define Void void
 #ifdef __cplusplus
 extern "C" {
 #endif
-extern int (*f__getn)(void);	/* for formatted input */
-extern void (*f__putn)(int);	/* for formatted output */
-extern void x_putc(int);
+extern F2C_TLS int (*f__getn)(void);	/* for formatted input */
+extern F2C_TLS void (*f__putn)(int);	/* for formatted output */
+extern F2C_TLS void (*f__putsn)(const char*, int);	/* for formatted output of n chars */
+extern void x_putc(int), x_putsn(const char*, int);
 extern long f__inode(char*,int*);
 extern void sig_die(const char*,int);
 extern void f__fatal(int, const char*);
@@ -102,29 +159,41 @@ extern int f__nowreading(unit*), f__nowwriting(unit*);
 extern int fk_open(int,int,ftnint);
 extern int en_fio(void);
 extern void f_init(void);
-extern int (*f__donewrec)(void), t_putc(int), x_wSL(void);
+extern F2C_TLS int (*f__donewrec)(void);
+extern int t_putc(int), x_wSL(void);
 extern void b_char(const char*,char*,ftnlen), g_char(const char*,ftnlen,char*);
 extern int c_sfe(cilist*), z_rnew(void);
 extern int err__fl(int,int,const char*);
 extern int xrd_SL(void);
 extern int f__putbuf(int);
-#endif
-extern flag f__init;
-extern cilist *f__elist;	/*active external io list*/
-extern flag f__reading,f__external,f__sequential,f__formatted;
-extern int (*f__doend)(Void);
-extern FILE *f__cf;	/*current file*/
-extern unit *f__curunit;	/*current unit*/
+extern char *F77_malloc(ftnlen);
+extern void F77_free(char*);
+#ifdef F2C_MMAP
+extern int f__mapunit(unit*, OFF_T);
+extern void f__unmap(unit*);
+#endif
+#endif
+extern F2C_TLS flag f__init;
+extern F2C_TLS cilist *f__elist;	/*active external io list*/
+extern F2C_TLS flag f__reading,f__external,f__sequential,f__formatted;
+extern F2C_TLS int (*f__doend)(Void);
+extern F2C_TLS FILE *f__cf;	/*current file*/
+extern F2C_TLS unit *f__curunit;	/*current unit*/
 extern unit f__units[];
+#ifdef F2C_MMAP
+extern F2C_TLS char *f__mptr;	/* mapped record being read, or 0 */
+#else
+#define f__unmap(x) /*nothing*/
+#endif
 #define err(f,m,s) {if(f) errno= m; else f__fatal(m,s); return(m);}
 #define errfl(f,m,s) return err__fl((int)f,m,s)
 
 /*Table sizes*/
 #define MXUNIT 100
 
-extern int f__recpos;	/*position in current record*/
-extern OFF_T f__cursor;	/* offset to move to */
-extern OFF_T f__hiwater;	/* so TL doesn't confuse us */
+extern F2C_TLS int f__recpos;	/*position in current record*/
+extern F2C_TLS OFF_T f__cursor;	/* offset to move to */
+extern F2C_TLS OFF_T f__hiwater;	/* so TL doesn't confuse us */
 #ifdef __cplusplus
 	}
 #endif
@@ -1,6 +1,15 @@
 #include "f2c.h"
 #include "fio.h"
 #include "fmt.h"
+#include "string.h"
+#ifdef KR_headers
+extern char *malloc();
+#else
+#undef abs
+#undef min
+#undef max
+#include "stdlib.h"
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,9 +28,27 @@ extern "C" {
 #endif
 #define GLITCH '\2'
 	/* special quote character for stu */
-extern flag f__cblank,f__cplus;	/*blanks in I and compulsory plus*/
-static struct syl f__syl[SYLMX];
-int f__parenlvl,f__pc,f__revloc;
+extern F2C_TLS flag f__cblank,f__cplus;	/*blanks in I and compulsory plus*/
+static F2C_TLS struct syl f__syl[SYLMX], *f__sylp;
+F2C_TLS int f__parenlvl,f__pc,f__revloc;
+
+/* Parsed formats are remembered by address in a direct-mapped cache of */
+/* FMTCACHE entries, so that a FORMAT used repeatedly (e.g., in a loop) */
+/* is parsed once.  The text is saved too: formats held in character */
+/* variables, or changed by H editing on input, are parsed afresh when */
+/* their text differs.  Compile with -DFMTCACHE=0 to parse every time. */
+
+#ifndef FMTCACHE
+#define FMTCACHE 64
+#endif
+#if FMTCACHE > 0
+static F2C_TLS struct fmtcache {
+	const char *s;		/* the format */
+	char *text;		/* its text when parsed */
+	struct syl *syl;	/* the parsed program */
+	int len, pc, parenlvl, revloc;
+	} f__fmtcache[FMTCACHE];
+#endif
 #ifdef KR_headers
 #define Const /*nothing*/
 #else
@@ -373,16 +400,52 @@ pars_f(s) char *s;
 pars_f(const char *s)
 #endif
 {
+	Const char *se;
+#if FMTCACHE > 0
+	struct fmtcache *c;
+	struct syl *sp;
+	char *t;
+
+	c = &f__fmtcache[(unsigned long)s / sizeof(char*) % FMTCACHE];
+	if (c->s == s && !strncmp(s, c->text, c->len)) {
+		f__sylp = c->syl;
+		f__pc = c->pc;
+		f__parenlvl = c->parenlvl;
+		f__revloc = c->revloc;
+		return(0);
+		}
+#endif
+	f__sylp = f__syl;
 	f__parenlvl=f__revloc=f__pc=0;
-	if(f_s(s,0) == NULL)
+	if((se = f_s(s,0)) == NULL)
 	{
 		return(-1);
 	}
+#if FMTCACHE > 0
+	t = F77_malloc((ftnlen)(se - s + 1));
+	sp = (struct syl*)F77_malloc((ftnlen)(f__pc*sizeof(struct syl)));
+	if (!t || !sp) {
+		F77_free(t);
+		F77_free((char*)sp);
+		return(0);
+		}
+	F77_free(c->text);
+	F77_free((char*)c->syl);
+	c->s = s;
+	c->len = se - s;
+	memcpy(c->text = t, s, c->len);
+	t[c->len] = 0;
+	memcpy(c->syl = sp, f__syl, f__pc*sizeof(struct syl));
+	c->pc = f__pc;
+	c->parenlvl = f__parenlvl;
+	c->revloc = f__revloc;
+	f__sylp = sp;
+#endif
 	return(0);
 }
 #define STKSZ 10
-int f__cnt[STKSZ],f__ret[STKSZ],f__cp,f__rp;
-flag f__workdone, f__nonl;
+F2C_TLS int f__cnt[STKSZ],f__ret[STKSZ],f__cp,f__rp;
+F2C_TLS flag f__workdone, f__nonl;
 
  static int
 #ifdef KR_headers
@@ -426,7 +489,7 @@ integer do_fio(ftnint *number, char *ptr, ftnlen len)
 	int n,i;
 	for(i=0;i<*number;i++,ptr+=len)
 	{
-loop:	switch(type_f((p= &f__syl[f__pc])->op))
+loop:	switch(type_f((p= &f__sylp[f__pc])->op))
 	{
 	default:
 		fprintf(stderr,"unknown code in do_fio: %d\n%s\n",
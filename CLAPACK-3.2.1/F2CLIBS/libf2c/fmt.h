@@ -55,12 +55,13 @@ typedef union
 #endif
 } Uint;
 #ifdef KR_headers
-extern int (*f__doed)(),(*f__doned)();
-extern int (*f__dorevert)();
+extern F2C_TLS int (*f__doed)(),(*f__doned)();
+extern F2C_TLS int (*f__dorevert)();
 extern int rd_ed(),rd_ned();
 extern int w_ed(),w_ned();
 extern int signbit_f2c();
-extern char *f__fmtbuf;
+extern void f__putfill();
+extern F2C_TLS char *f__fmtbuf;
 #else
 #ifdef __cplusplus
 extern "C" {
@@ -68,27 +69,29 @@ extern "C" {
 #else
 #define Cextern extern
 #endif
-extern const char *f__fmtbuf;
-extern int (*f__doed)(struct syl*, char*, ftnlen),(*f__doned)(struct syl*);
-extern int (*f__dorevert)(void);
+extern F2C_TLS const char *f__fmtbuf;
+extern F2C_TLS int (*f__doed)(struct syl*, char*, ftnlen),(*f__doned)(struct syl*);
+extern F2C_TLS int (*f__dorevert)(void);
 extern void fmt_bg(void);
 extern int pars_f(const char*);
 extern int rd_ed(struct syl*, char*, ftnlen),rd_ned(struct syl*);
 extern int signbit_f2c(double*);
+extern void f__putfill(int, int);
 extern int w_ed(struct syl*, char*, ftnlen),w_ned(struct syl*);
 extern int wrt_E(ufloat*, int, int, int, ftnlen);
 extern int wrt_F(ufloat*, int, int, ftnlen);
 extern int wrt_L(Uint*, int, ftnlen);
 #endif
-extern int f__pc,f__parenlvl,f__revloc;
-extern flag f__cblank,f__cplus,f__workdone, f__nonl;
-extern int f__scale;
+extern F2C_TLS int f__pc,f__parenlvl,f__revloc;
+extern F2C_TLS flag f__cblank,f__cplus,f__workdone, f__nonl;
+extern F2C_TLS int f__scale;
 #ifdef __cplusplus
 	}
 #endif
 #define GET(x) if((x=(*f__getn)())<0) return(x)
 #define VAL(x) (x!='\n'?x:' ')
 #define PUT(x) (*f__putn)(x)
+#define PUTS(s,n) (*f__putsn)(s,n)
 
 #undef TYQUAD
 #ifndef Allow_TYQUAD
@@ -100,6 +103,10 @@ extern int f__scale;
 
 #ifdef KR_headers
 extern char *f__icvt();
+extern int f__dtoa();
+extern double f__strtod();
 #else
 Cextern char *f__icvt(longint, int*, int*, int);
+Cextern int f__dtoa(double, int, int, int, char*, int*);
+Cextern double f__strtod(char*, int, long);
 #endif
@@ -2,6 +2,7 @@
 #define MAXINTLENGTH 23
 
 #include "f2c.h"
+#include "fio.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -19,7 +20,7 @@ char *f__icvt(value,ndigit,sign, base) longint value; int *ndigit,*sign;
 char *f__icvt(longint value, int *ndigit, int *sign, int base)
 #endif
 {
-	static char buf[MAXINTLENGTH+1];
+	static F2C_TLS char buf[MAXINTLENGTH+1];
 	register int i;
 	ulongint uvalue;
 
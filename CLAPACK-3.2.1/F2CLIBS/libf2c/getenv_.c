@@ -2,6 +2,7 @@
 #undef abs
 #ifdef KR_headers
 extern char *F77_aloc(), *getenv();
+extern VOID F77_free();
 #else
 #include <stdlib.h>
 #include <string.h>
@@ -9,6 +10,7 @@ extern char *F77_aloc(), *getenv();
 extern "C" {
 #endif
 extern char *F77_aloc(ftnlen, const char*);
+extern void F77_free(char*);
 #endif
 
 /*
@@ -48,7 +50,7 @@ getenv_(char *fname, char *value, ftnlen flen, ftnlen vlen)
 	strncpy(fp = F77_aloc(i+1, "getenv_"), fname, (int)i);
 	fp[i] = 0;
 	ep = getenv(fp);
-	free(fp);
+	F77_free(fp);
  have_ep:
 	if (ep)
 		while(*ep && vlen-- > 0)
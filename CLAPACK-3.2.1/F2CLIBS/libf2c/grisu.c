@@ -0,0 +1,634 @@
+/* Decimal digits of doubles for the E, F, G and list-directed edit
+ * descriptors, and doubles from decimal digits on input.  Digits come
+ * from Grisu (F. Loitsch, "Printing floating-point numbers quickly and
+ * accurately with integers", PLDI 2010): the number is scaled by a
+ * cached power of ten to a 64-bit fixed-point value with a known error
+ * bound, and its digits are produced with integer arithmetic.  Input
+ * (f__strtod) goes the other way with the same cached powers.  When
+ * the error bound leaves the correctly rounded (or shortest) result in
+ * doubt, which happens for well under one percent of inputs, sprintf
+ * or atof supplies it, so the result is always exact.
+ */
+
+#include "f2c.h"
+#include "fio.h"
+#include "arith.h"
+
+#ifndef KR_headers
+#undef abs
+#undef min
+#undef max
+#include "stdlib.h"
+#include "string.h"
+#endif
+
+#include "fmt.h"
+#include "fp.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (defined(IEEE_8087) || defined(IEEE_MC68k)) && !defined(NO_LONG_LONG)
+#define Use_Grisu
+
+typedef unsigned long long ULLong;
+typedef unsigned int ULong;
+
+typedef struct { ULLong f; int e; } Diyfp;	/* f * 2^e */
+
+/* 10^k, k = -348, -340, ..., 340, as 64-bit significands rounded to */
+/* nearest, with their binary exponents. */
+
+static struct { ULLong f; short e, k; } pow10c[87] = {
+	{ 0xfa8fd5a0081c0288ULL, -1220, -348 },
+	{ 0xbaaee17fa23ebf76ULL, -1193, -340 },
+	{ 0x8b16fb203055ac76ULL, -1166, -332 },
+	{ 0xcf42894a5dce35eaULL, -1140, -324 },
+	{ 0x9a6bb0aa55653b2dULL, -1113, -316 },
+	{ 0xe61acf033d1a45dfULL, -1087, -308 },
+	{ 0xab70fe17c79ac6caULL, -1060, -300 },
+	{ 0xff77b1fcbebcdc4fULL, -1034, -292 },
+	{ 0xbe5691ef416bd60cULL, -1007, -284 },
+	{ 0x8dd01fad907ffc3cULL, -980, -276 },
+	{ 0xd3515c2831559a83ULL, -954, -268 },
+	{ 0x9d71ac8fada6c9b5ULL, -927, -260 },
+	{ 0xea9c227723ee8bcbULL, -901, -252 },
+	{ 0xaecc49914078536dULL, -874, -244 },
+	{ 0x823c12795db6ce57ULL, -847, -236 },
+	{ 0xc21094364dfb5637ULL, -821, -228 },
+	{ 0x9096ea6f3848984fULL, -794, -220 },
+	{ 0xd77485cb25823ac7ULL, -768, -212 },
+	{ 0xa086cfcd97bf97f4ULL, -741, -204 },
+	{ 0xef340a98172aace5ULL, -715, -196 },
+	{ 0xb23867fb2a35b28eULL, -688, -188 },
+	{ 0x84c8d4dfd2c63f3bULL, -661, -180 },
+	{ 0xc5dd44271ad3cdbaULL, -635, -172 },
+	{ 0x936b9fcebb25c996ULL, -608, -164 },
+	{ 0xdbac6c247d62a584ULL, -582, -156 },
+	{ 0xa3ab66580d5fdaf6ULL, -555, -148 },
+	{ 0xf3e2f893dec3f126ULL, -529, -140 },
+	{ 0xb5b5ada8aaff80b8ULL, -502, -132 },
+	{ 0x87625f056c7c4a8bULL, -475, -124 },
+	{ 0xc9bcff6034c13053ULL, -449, -116 },
+	{ 0x964e858c91ba2655ULL, -422, -108 },
+	{ 0xdff9772470297ebdULL, -396, -100 },
+	{ 0xa6dfbd9fb8e5b88fULL, -369, -92 },
+	{ 0xf8a95fcf88747d94ULL, -343, -84 },
+	{ 0xb94470938fa89bcfULL, -316, -76 },
+	{ 0x8a08f0f8bf0f156bULL, -289, -68 },
+	{ 0xcdb02555653131b6ULL, -263, -60 },
+	{ 0x993fe2c6d07b7facULL, -236, -52 },
+	{ 0xe45c10c42a2b3b06ULL, -210, -44 },
+	{ 0xaa242499697392d3ULL, -183, -36 },
+	{ 0xfd87b5f28300ca0eULL, -157, -28 },
+	{ 0xbce5086492111aebULL, -130, -20 },
+	{ 0x8cbccc096f5088ccULL, -103, -12 },
+	{ 0xd1b71758e219652cULL, -77, -4 },
+	{ 0x9c40000000000000ULL, -50, 4 },
+	{ 0xe8d4a51000000000ULL, -24, 12 },
+	{ 0xad78ebc5ac620000ULL, 3, 20 },
+	{ 0x813f3978f8940984ULL, 30, 28 },
+	{ 0xc097ce7bc90715b3ULL, 56, 36 },
+	{ 0x8f7e32ce7bea5c70ULL, 83, 44 },
+	{ 0xd5d238a4abe98068ULL, 109, 52 },
+	{ 0x9f4f2726179a2245ULL, 136, 60 },
+	{ 0xed63a231d4c4fb27ULL, 162, 68 },
+	{ 0xb0de65388cc8ada8ULL, 189, 76 },
+	{ 0x83c7088e1aab65dbULL, 216, 84 },
+	{ 0xc45d1df942711d9aULL, 242, 92 },
+	{ 0x924d692ca61be758ULL, 269, 100 },
+	{ 0xda01ee641a708deaULL, 295, 108 },
+	{ 0xa26da3999aef774aULL, 322, 116 },
+	{ 0xf209787bb47d6b85ULL, 348, 124 },
+	{ 0xb454e4a179dd1877ULL, 375, 132 },
+	{ 0x865b86925b9bc5c2ULL, 402, 140 },
+	{ 0xc83553c5c8965d3dULL, 428, 148 },
+	{ 0x952ab45cfa97a0b3ULL, 455, 156 },
+	{ 0xde469fbd99a05fe3ULL, 481, 164 },
+	{ 0xa59bc234db398c25ULL, 508, 172 },
+	{ 0xf6c69a72a3989f5cULL, 534, 180 },
+	{ 0xb7dcbf5354e9beceULL, 561, 188 },
+	{ 0x88fcf317f22241e2ULL, 588, 196 },
+	{ 0xcc20ce9bd35c78a5ULL, 614, 204 },
+	{ 0x98165af37b2153dfULL, 641, 212 },
+	{ 0xe2a0b5dc971f303aULL, 667, 220 },
+	{ 0xa8d9d1535ce3b396ULL, 694, 228 },
+	{ 0xfb9b7cd9a4a7443cULL, 720, 236 },
+	{ 0xbb764c4ca7a44410ULL, 747, 244 },
+	{ 0x8bab8eefb6409c1aULL, 774, 252 },
+	{ 0xd01fef10a657842cULL, 800, 260 },
+	{ 0x9b10a4e5e9913129ULL, 827, 268 },
+	{ 0xe7109bfba19c0c9dULL, 853, 276 },
+	{ 0xac2820d9623bf429ULL, 880, 284 },
+	{ 0x80444b5e7aa7cf85ULL, 907, 292 },
+	{ 0xbf21e44003acdd2dULL, 933, 300 },
+	{ 0x8e679c2f5e44ff8fULL, 960, 308 },
+	{ 0xd433179d9c8cb841ULL, 986, 316 },
+	{ 0x9e19db92b4e31ba9ULL, 1013, 324 },
+	{ 0xeb96bf6ebadf77d9ULL, 1039, 332 },
+	{ 0xaf87023b9bf0ee6bULL, 1066, 340 }
+	};
+
+static ULong pow10s[11] = { 0, 1, 10, 100, 1000, 10000, 100000, 1000000,
+	10000000, 100000000, 1000000000 };
+
+ static Diyfp
+#ifdef KR_headers
+dmul(a, b) Diyfp a, b;
+#else
+dmul(Diyfp a, Diyfp b)
+#endif
+{
+	/* the 64 leading bits of the 128-bit product, rounded */
+	ULLong ah, al, bh, bl, t;
+	Diyfp r;
+
+	ah = a.f >> 32;
+	al = a.f & 0xffffffffULL;
+	bh = b.f >> 32;
+	bl = b.f & 0xffffffffULL;
+	t = ((al*bl) >> 32) + ((ah*bl) & 0xffffffffULL)
+		+ ((al*bh) & 0xffffffffULL) + (1ULL << 31);
+	r.f = ah*bh + ((ah*bl) >> 32) + ((al*bh) >> 32) + (t >> 32);
+	r.e = a.e + b.e + 64;
+	return r;
+	}
+
+ static Diyfp
+#ifdef KR_headers
+dnorm(a) Diyfp a;
+#else
+dnorm(Diyfp a)
+#endif
+{
+	while(!(a.f & 0xffc0000000000000ULL)) {
+		a.f <<= 10;
+		a.e -= 10;
+		}
+	while(!(a.f & 0x8000000000000000ULL)) {
+		a.f <<= 1;
+		a.e--;
+		}
+	return a;
+	}
+
+/* Split x (finite, > 0) into f * 2^e; for sgl, use the float nearest */
+/* x.  Set *lc if the gap below x is half the gap above it. */
+
+ static Diyfp
+#ifdef KR_headers
+dsplit(x, sgl, lc) double x; int sgl, *lc;
+#else
+dsplit(double x, int sgl, int *lc)
+#endif
+{
+	ULLong b;
+	ULong fb;
+	float xf;
+	int be;
+	Diyfp r;
+
+	if (sgl) {
+		xf = (float)x;
+		memcpy(&fb, &xf, sizeof(fb));
+		be = (int)(fb >> 23) & 0xff;
+		r.f = fb & 0x7fffff;
+		if (be) {
+			r.f |= 0x800000;
+			r.e = be - 150;
+			}
+		else
+			r.e = -149;
+		*lc = (fb & 0x7fffff) == 0 && be > 1;
+		}
+	else {
+		memcpy(&b, &x, sizeof(b));
+		be = (int)(b >> 52) & 0x7ff;
+		r.f = b & 0xfffffffffffffULL;
+		if (be) {
+			r.f |= 0x10000000000000ULL;
+			r.e = be - 1075;
+			}
+		else
+			r.e = -1074;
+		*lc = (b & 0xfffffffffffffULL) == 0 && be > 1;
+		}
+	return r;
+	}
+
+/* Choose the cached power c = 10^k such that the product of c with a */
+/* normalized Diyfp with exponent e has exponent in [-60,-32]; return k. */
+
+ static int
+#ifdef KR_headers
+pow10k(e, c) int e; Diyfp *c;
+#else
+pow10k(int e, Diyfp *c)
+#endif
+{
+	double t;
+	int i, k;
+
+	t = (-60 - (e + 64) + 63) * 0.30102999566398114;
+	k = (int)t;
+	if (k < t)
+		k++;
+	i = (348 + k - 1) / 8 + 1;
+	c->f = pow10c[i].f;
+	c->e = pow10c[i].e;
+	return pow10c[i].k;
+	}
+
+/* Largest power of 10 <= n, for n < 2^nbits; set *kappa to its */
+/* exponent plus one. */
+
+ static ULong
+#ifdef KR_headers
+bigp10(n, nbits, kappa) ULong n; int nbits, *kappa;
+#else
+bigp10(ULong n, int nbits, int *kappa)
+#endif
+{
+	int k;
+
+	k = ((nbits + 1) * 1233 >> 12) + 1;
+	if (k > 10)
+		k = 10;
+	while(k > 0 && n < pow10s[k])
+		k--;
+	*kappa = k;
+	return pow10s[k];
+	}
+
+ static int
+#ifdef KR_headers
+weed(buf, n, dist, delta, rest, tenk, unit)
+	char *buf; int n; ULLong dist, delta, rest, tenk, unit;
+#else
+weed(char *buf, int n, ULLong dist, ULLong delta, ULLong rest, ULLong tenk,
+	ULLong unit)
+#endif
+{
+	ULLong lo, hi;
+
+	lo = dist - unit;
+	hi = dist + unit;
+	while(rest < lo && delta - rest >= tenk
+	   && (rest + tenk < lo || lo - rest >= rest + tenk - lo)) {
+		buf[n-1]--;
+		rest += tenk;
+		}
+	if (rest < hi && delta - rest >= tenk
+	 && (rest + tenk < hi || hi - rest > rest + tenk - hi))
+		return 0;
+	return 2*unit <= rest && rest <= delta - 4*unit;
+	}
+
+/* Shortest digits that read back as x (as a float if sgl). */
+
+ static int
+#ifdef KR_headers
+g_short(x, sgl, buf, decpt) double x; int sgl; char *buf; int *decpt;
+#else
+g_short(double x, int sgl, char *buf, int *decpt)
+#endif
+{
+	Diyfp c, w, lo, hi, one;
+	ULLong fr, rest, delta, unit, dist;
+	ULong in, div;
+	int k, kappa, lc, n;
+
+	w = dsplit(x, 0, &lc);
+	lo = dsplit(x, sgl, &lc);
+	hi.f = (lo.f << 1) + 1;
+	hi.e = lo.e - 1;
+	hi = dnorm(hi);
+	if (lc) {
+		lo.f = (lo.f << 2) - 1;
+		lo.e -= 2;
+		}
+	else {
+		lo.f = (lo.f << 1) - 1;
+		lo.e--;
+		}
+	lo.f <<= lo.e - hi.e;
+	lo.e = hi.e;
+	w = dnorm(w);
+	k = pow10k(w.e, &c);
+	w = dmul(w, c);
+	lo = dmul(lo, c);
+	hi = dmul(hi, c);
+
+	/* digits of hi + 1 while they stay within (lo - 1, hi + 1) */
+	unit = 1;
+	lo.f -= unit;
+	hi.f += unit;
+	delta = hi.f - lo.f;
+	dist = hi.f - w.f;
+	one.e = w.e;
+	one.f = 1ULL << -one.e;
+	in = (ULong)(hi.f >> -one.e);
+	fr = hi.f & (one.f - 1);
+	div = bigp10(in, 64 + one.e, &kappa);
+	n = 0;
+	while(kappa > 0) {
+		buf[n++] = '0' + in / div;
+		in %= div;
+		kappa--;
+		rest = ((ULLong)in << -one.e) + fr;
+		if (rest < delta) {
+			if (!weed(buf, n, dist, delta, rest,
+					(ULLong)div << -one.e, unit))
+				return -1;
+			goto ret;
+			}
+		div /= 10;
+		}
+	for(;;) {
+		fr *= 10;
+		unit *= 10;
+		delta *= 10;
+		buf[n++] = '0' + (int)(fr >> -one.e);
+		fr &= one.f - 1;
+		kappa--;
+		if (fr < delta) {
+			if (!weed(buf, n, dist*unit, delta, fr, one.f, unit))
+				return -1;
+			break;
+			}
+		}
+ ret:
+	*decpt = kappa - k + n;
+	return n;
+	}
+
+/* Digits rounded at the ndig-th significant digit (mode 1) or at the */
+/* position 10^-ndig (mode 2). */
+
+ static int
+#ifdef KR_headers
+g_count(x, mode, ndig, buf, decpt) double x; int mode, ndig; char *buf;
+	int *decpt;
+#else
+g_count(double x, int mode, int ndig, char *buf, int *decpt)
+#endif
+{
+	Diyfp c, w, one;
+	ULLong fr, rest, tenk, unit;
+	ULong in, div;
+	int i, k, kappa, lc, n, req;
+
+	w = dnorm(dsplit(x, 0, &lc));
+	k = pow10k(w.e, &c);
+	w = dmul(w, c);
+	one.e = w.e;
+	one.f = 1ULL << -one.e;
+	in = (ULong)(w.f >> -one.e);
+	fr = w.f & (one.f - 1);
+	div = bigp10(in, 64 + one.e, &kappa);
+	req = ndig;
+	if (mode == 2) {
+		req = kappa - k + ndig;
+		if (req <= 0) {
+			/* x < 10^(1-ndig)/10: only zero is certain */
+			if (req < 0) {
+				*decpt = -ndig;
+				return 0;
+				}
+			return -1;
+			}
+		}
+	if (req > 17)
+		return -1;
+	n = 0;
+	unit = 1;
+	while(kappa > 0) {
+		buf[n++] = '0' + in / div;
+		in %= div;
+		kappa--;
+		if (--req == 0)
+			break;
+		div /= 10;
+		}
+	if (req == 0) {
+		rest = ((ULLong)in << -one.e) + fr;
+		tenk = (ULLong)div << -one.e;
+		}
+	else {
+		while(req > 0 && fr > unit) {
+			fr *= 10;
+			unit *= 10;
+			buf[n++] = '0' + (int)(fr >> -one.e);
+			fr &= one.f - 1;
+			kappa--;
+			req--;
+			}
+		if (req)
+			return -1;
+		rest = fr;
+		tenk = one.f;
+		}
+
+	/* round, unless rest +- unit straddles the midpoint */
+	if (unit >= tenk || tenk - unit <= unit)
+		return -1;
+	if (tenk - rest <= rest || tenk - 2*rest < 2*unit) {
+		if (rest <= unit || tenk - (rest - unit) > rest - unit)
+			return -1;
+		for(i = n - 1; i > 0 && buf[i] == '9'; i--)
+			buf[i] = '0';
+		if (buf[i] == '9') {
+			buf[i] = '1';
+			kappa++;
+			if (mode == 2) {
+				/* keep the last digit at 10^-ndig */
+				buf[n++] = '0';
+				kappa--;
+				}
+			}
+		else
+			buf[i]++;
+		}
+	*decpt = kappa - k + n;
+	return n;
+	}
+
+/* Input: the digits times 10^exp (as an integer w < 10^19) is w times */
+/* a cached power of ten, computed as in the Eisel-Lemire algorithm, */
+/* but with 64-bit rather than 128-bit powers, so with an error of at */
+/* most 5 units in the last place of the normalized 64-bit product. */
+/* Return 0 when that leaves the rounding to 53 bits in doubt, or the */
+/* result would be denormal or overflow. */
+
+ static int
+#ifdef KR_headers
+g_strtod(s, nd, exp, x) char *s; int nd; long exp; double *x;
+#else
+g_strtod(const char *s, int nd, long exp, double *x)
+#endif
+{
+	Diyfp c, t, w;
+	ULLong b, m;
+	int be, i, lo, r;
+
+	if (nd > 19 || exp < -348 || exp > 308)
+		return 0;
+	w.f = 0;
+	for(i = 0; i < nd; i++)
+		w.f = 10*w.f + (s[i] - '0');
+	w.e = 0;
+	w = dnorm(w);
+	i = (int)(exp + 348) >> 3;
+	c.f = pow10c[i].f;
+	c.e = pow10c[i].e;
+	if (r = (int)exp - pow10c[i].k) {
+		t.f = pow10s[r+1];
+		t.e = 0;
+		c = dnorm(dmul(c, dnorm(t)));
+		}
+	w = dnorm(dmul(w, c));
+	be = w.e + 1086;
+	lo = (int)(w.f & 0x7ff);
+	if (be < 1 || be > 2046 || (lo > 1024 - 8 && lo < 1024 + 8))
+		return 0;
+	m = w.f >> 11;
+	if (lo > 1024 && ++m >> 53) {
+		m >>= 1;
+		if (++be > 2046)
+			return 0;
+		}
+	b = (ULLong)be << 52 | (m & 0xfffffffffffffULL);
+	memcpy(x, &b, sizeof(b));
+	return 1;
+	}
+#endif /*Use_Grisu*/
+
+/* The double nearest d1 d2 ... dn times 10^exp, for the n >= 1 digits */
+/* (d1 != 0) at s, which must have room after them for "e" and exp: */
+/* when the rounding is in doubt, the number is passed to atof. */
+
+ double
+#ifdef KR_headers
+f__strtod(s, nd, exp) char *s; int nd; long exp;
+#else
+f__strtod(char *s, int nd, long exp)
+#endif
+{
+#ifdef Use_Grisu
+	double x;
+
+	if (g_strtod(s, nd, exp, &x))
+		return x;
+#endif
+	if (exp)
+		sprintf(s + nd, "e%ld", exp);
+	else
+		s[nd] = 0;
+	return atof(s);
+	}
+
+/* The same digits from sprintf. */
+
+ static int
+#ifdef KR_headers
+s_digits(x, mode, ndig, sgl, buf, decpt) double x; int mode, ndig, sgl;
+	char *buf; int *decpt;
+#else
+s_digits(double x, int mode, int ndig, int sgl, char *buf, int *decpt)
+#endif
+{
+	char *s, *t;
+	double h;
+	int i, n;
+
+	switch(mode) {
+	  case 0:
+		for(i = sgl ? 5 : 14; i < (sgl ? 8 : 16); i++) {
+			sprintf(buf, "%.*e", i, x);
+			if (sgl ? (float)strtod(buf, (char **)0) == (float)x
+				: strtod(buf, (char **)0) == x)
+				break;
+			}
+		if (i == (sgl ? 8 : 16))
+			sprintf(buf, "%.*e", i, x);
+		break;
+	  case 2:
+		if (ndig >= 0) {
+			/* buf = ddd.ddd; drop the point and leading 0s */
+			sprintf(buf, "%.*f", ndig, x);
+			*decpt = ndig ? strchr(buf, '.') - buf : strlen(buf);
+			for(s = t = buf; *s; s++)
+				if (*s == '.')
+					;
+				else if (*s != '0' || t > buf)
+					*t++ = *s;
+				else
+					--*decpt;
+			if ((n = t - buf) == 0)
+				*decpt = -ndig;
+			return n;
+			}
+		sprintf(buf, "%.16e", x);
+		n = atoi(buf + 19) + 1 + ndig;
+		if (n <= 0) {
+			h = 5.;
+			for(i = -ndig; --i > 0; )
+				h *= 10.;
+			*decpt = 1 - ndig;
+			if (n == 0 && x > h) {
+				buf[0] = '1';
+				return 1;
+				}
+			*decpt = -ndig;
+			return 0;
+			}
+		sprintf(buf, "%.*e", n - 1, x);
+		break;
+	  default:
+		sprintf(buf, "%.*e", ndig - 1, x);
+	  }
+
+	/* buf = d.ddde+xx */
+	for(s = t = buf; *s != 'e'; s++)
+		if (*s != '.')
+			*t++ = *s;
+	n = t - buf;
+	*decpt = atoi(s + 1) + 1;
+	if (mode == 0)
+		while(n > 1 && buf[n-1] == '0')
+			n--;
+	else if (mode == 2 && *decpt + ndig > n) {
+		buf[n++] = '0';	/* 9.9 rounded up to 10. */
+		}
+	return n;
+	}
+
+/* Decimal digits d1 d2 ... dn of x > 0, finite, with x ~= 0.d1d2...dn */
+/* times 10^*decpt.  Mode 0: the shortest digits that read back as x (as */
+/* a float if sgl); mode 1: ndig >= 1 significant digits; mode 2: the */
+/* digits down to 10^-ndig.  Modes 1 and 2 round correctly.  Returns n */
+/* (0 if mode 2 rounds x to zero). */
+
+ int
+#ifdef KR_headers
+f__dtoa(x, mode, ndig, sgl, buf, decpt) double x; int mode, ndig, sgl;
+	char *buf; int *decpt;
+#else
+f__dtoa(double x, int mode, int ndig, int sgl, char *buf, int *decpt)
+#endif
+{
+#ifdef Use_Grisu
+	int n;
+
+	if (mode == 0)
+		n = g_short(x, sgl, buf, decpt);
+	else
+		n = g_count(x, mode, ndig, buf, decpt);
+	if (n >= 0)
+		return n;
+#endif
+	return s_digits(x, mode, ndig, sgl, buf, decpt);
+	}
+#ifdef __cplusplus
+}
+#endif
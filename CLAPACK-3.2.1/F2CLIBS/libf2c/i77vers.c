@@ -1,5 +1,5 @@
  char
-_libi77_version_f2c[] = "\n@(#) LIBI77 VERSION (f2c) pjw,dmg-mods 20030321\n";
+_libi77_version_f2c[] = "\n@(#) LIBI77 VERSION (f2c) pjw,dmg-mods 20261018\n";
 
 /*
 2.01	$ format added
@@ -341,3 +341,41 @@ wrtfmt.c:
 /*		namelists, e.g., &nl a(2) = 3*1.0, 2*2.0, 3*3.0 /  */
 /* 21 March 2003: err.c: before writing to a file after reading from it, */
 /*		f_seek(file, 0, SEEK_CUR) to make writing legal in ANSI C. */
+/* 18 Oct. 2026: fmt.h lio.h lwrite.c wref.c and (new) grisu.c: get the */
+/*		digits for E, F, G and D editing and list-directed output */
+/*		from f__dtoa (Grisu, with sprintf as a fallback) rather */
+/*		than from sprintf.  Scale factors on F editing no longer */
+/*		round x*10**k before conversion, and list-directed output */
+/*		shows the fewest digits that read back as the value (up to */
+/*		9 for REAL, 17 for DOUBLE PRECISION) rather than 9. */
+/* 18 Oct. 2026: fmt.c: remember parsed formats (by address, checked */
+/*		against the saved text) in a cache of FMTCACHE entries, */
+/*		64 by default; -DFMTCACHE=0 restores parsing every time. */
+/* 18 Oct. 2026: dfe.c err.c fio.h fmt.h iio.c ilnw.c lwrite.c open.c */
+/*		wref.c wrtfmt.c wsfe.c wsle.c wsne.c: new f__putsn (and */
+/*		PUTS and f__putfill) for writing runs of characters with */
+/*		one call rather than one f__putn call per character; */
+/*		f__putbuf writes the record with one fwrite. */
+/* 18 Oct. 2026: most libI77 source files and fio.h fmt.h lio.h: */
+/*		compiling with -DF2C_THREADS makes the I/O statement */
+/*		state, format cache and buffers thread-local (F2C_TLS) */
+/*		and has f_init set up units 0, 5 and 6 via pthread_once, */
+/*		so threads may do I/O on distinct units concurrently. */
+/* 18 Oct. 2026: fio.h fmt.h grisu.c lread.c rdfmt.c: numeric input */
+/*		converts its digits with f__strtod, which uses Grisu's */
+/*		cached powers of ten and falls back on atof only when */
+/*		the rounding is in doubt; dfe.c lread.c rsfe.c: read */
+/*		characters with FGETC (getc_unlocked unless compiled */
+/*		with -DNO_GETC_UNLOCKED). */
+/* 18 Oct. 2026: f77_aloc.c: new F77_malloc, F77_free and F77_set_aloc */
+/*		(replaceable allocator) and a bump arena for temporaries */
+/*		(F77_amark, F77_atmp, F77_arelease, F77_afree); close.c */
+/*		fmt.c open.c rsne.c getenv_.c system_.c: allocate through */
+/*		them; s_cat.c: use the arena; lread.c: keep the buffer for */
+/*		list-directed character input from one item to the next. */
+/* 18 Oct. 2026: fio.h uio.c due.c sue.c: unformatted direct-access */
+/*		reads, and sequential reads of records of at least */
+/*		MMAP_MIN bytes, copy from an mmap of the file (large items */
+/*		with pread) unless compiled with -DNO_MMAP; close.c */
+/*		endfile.c err.c: drop the mapping on close, ENDFILE and */
+/*		the switch to writing. */
@@ -1,13 +1,14 @@
 #include "f2c.h"
 #include "fio.h"
 #include "fmt.h"
+#include "string.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
-extern char *f__icptr;
-char *f__icend;
-extern icilist *f__svic;
-int f__icnum;
+extern F2C_TLS char *f__icptr;
+F2C_TLS char *f__icend;
+extern F2C_TLS icilist *f__svic;
+F2C_TLS int f__icnum;
 
  int
 z_getc(Void)
@@ -30,6 +31,33 @@ z_putc(int c)
 		*f__icptr++ = c;
 }
 
+ void
+#ifdef KR_headers
+z_putsn(s, n) char *s; int n;
+#else
+z_putsn(const char *s, int n)
+#endif
+{
+	int k;
+
+	/* as n calls on z_putc */
+	k = f__svic->icirlen - f__recpos;
+	if (k > n)
+		k = n;
+	if (k > f__icend - f__icptr)
+		k = f__icend - f__icptr;
+	if (k > 0) {
+		memcpy(f__icptr, s, k);
+		f__icptr += k;
+		}
+	else
+		k = 0;
+	if (f__icptr < f__icend)
+		f__recpos += n;
+	else
+		f__recpos += k;
+}
+
  int
 z_rnew(Void)
 {
@@ -125,6 +153,7 @@ integer s_wsfi(icilist *a)
 	f__doed=w_ed;
 	f__doned=w_ned;
 	f__putn=z_putc;
+	f__putsn=z_putsn;
 	f__dorevert = iw_rev;
 	f__donewrec = z_wnew;
 	f__doend = z_endp;
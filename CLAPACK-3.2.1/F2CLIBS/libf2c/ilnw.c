@@ -4,14 +4,14 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-extern char *f__icptr;
-extern char *f__icend;
-extern icilist *f__svic;
-extern int f__icnum;
+extern F2C_TLS char *f__icptr;
+extern F2C_TLS char *f__icend;
+extern F2C_TLS icilist *f__svic;
+extern F2C_TLS int f__icnum;
 #ifdef KR_headers
-extern void z_putc();
+extern void z_putc(), z_putsn();
 #else
-extern void z_putc(int);
+extern void z_putc(int), z_putsn(const char*, int);
 #endif
 
  static int
@@ -33,6 +33,7 @@ c_liw(icilist *a)
 	f__external = 0;
 	f__formatted = 1;
 	f__putn = z_putc;
+	f__putsn = z_putsn;
 	L_len = a->icirlen;
 	f__donewrec = z_wSL;
 	f__svic = a;
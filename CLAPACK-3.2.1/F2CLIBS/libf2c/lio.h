@@ -38,8 +38,8 @@
 #else
 #define	LGFMT	"%.9G"
 #endif
-/* LEFBL 20 should suffice; 24 overcomes a NeXT bug. */
-#define	LEFBL	24
+/* LEFBL 28 should suffice for 17 digits; 32 leaves some slack. */
+#define	LEFBL	32
 
 typedef union
 {
@@ -53,22 +53,23 @@ typedef union
 	doublereal	fldouble;
 } flex;
 #ifdef KR_headers
-extern int (*f__lioproc)(), (*l_getc)(), (*l_ungetc)();
+extern F2C_TLS int (*f__lioproc)(), (*l_getc)(), (*l_ungetc)();
 extern int l_read(), l_write();
 #else
 #ifdef __cplusplus
 extern "C" {
 #endif
-extern int (*f__lioproc)(ftnint*, char*, ftnlen, ftnint);
+extern F2C_TLS int (*f__lioproc)(ftnint*, char*, ftnlen, ftnint);
 extern int l_write(ftnint*, char*, ftnlen, ftnint);
 extern void x_wsne(cilist*);
-extern int c_le(cilist*), (*l_getc)(void), (*l_ungetc)(int,FILE*);
+extern int c_le(cilist*);
+extern F2C_TLS int (*l_getc)(void), (*l_ungetc)(int,FILE*);
 extern int l_read(ftnint*,char*,ftnlen,ftnint);
 extern integer e_rsle(void), e_wsle(void), s_wsne(cilist*);
 extern int z_rnew(void);
 #endif
-extern ftnint L_len;
-extern int f__scale;
+extern F2C_TLS ftnint L_len;
+extern F2C_TLS int f__scale;
 #ifdef __cplusplus
 	}
 #endif
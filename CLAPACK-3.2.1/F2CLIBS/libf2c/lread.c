@@ -7,13 +7,12 @@
 
 
 #ifdef Allow_TYQUAD
-static longint f__llx;
+static F2C_TLS longint f__llx;
 #endif
 
 #ifdef KR_headers
-extern double atof();
 extern char *malloc(), *realloc();
-int (*f__lioproc)(), (*l_getc)(), (*l_ungetc)();
+F2C_TLS int (*f__lioproc)(), (*l_getc)(), (*l_ungetc)();
 #else
 #undef abs
 #undef min
@@ -24,20 +23,21 @@ int (*f__lioproc)(), (*l_getc)(), (*l_ungetc)();
 #include "fmt.h"
 #include "lio.h"
 #include "ctype.h"
+#include "string.h"
 #include "fp.h"
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #ifdef KR_headers
-extern char *f__fmtbuf;
+extern F2C_TLS char *f__fmtbuf;
 #else
-extern const char *f__fmtbuf;
-int (*f__lioproc)(ftnint*, char*, ftnlen, ftnint), (*l_getc)(void),
+extern F2C_TLS const char *f__fmtbuf;
+F2C_TLS int (*f__lioproc)(ftnint*, char*, ftnlen, ftnint), (*l_getc)(void),
 	(*l_ungetc)(int,FILE*);
 #endif
 
-int l_eof;
+F2C_TLS int l_eof;
 
 #define isblnk(x) (f__ltab[x+1]&B)
 #define issep(x) (f__ltab[x+1]&SX)
@@ -84,7 +84,7 @@ extern int ungetc(int, FILE*);	/* for systems with a buggy stdio.h */
 t_getc(Void)
 {	int ch;
 	if(f__curunit->uend) return(EOF);
-	if((ch=getc(f__cf))!=EOF) return(ch);
+	if((ch=FGETC(f__cf))!=EOF) return(ch);
 	if(feof(f__cf))
 		f__curunit->uend = l_eof = 1;
 	return(EOF);
@@ -102,10 +102,10 @@ integer e_rsle(Void)
 	return(0);
 }
 
-flag f__lquit;
-int f__lcount,f__ltype,nml_read;
-char *f__lchar;
-double f__lx,f__ly;
+F2C_TLS flag f__lquit;
+F2C_TLS int f__lcount,f__ltype,nml_read;
+F2C_TLS char *f__lchar;
+F2C_TLS double f__lx,f__ly;
 #define ERR(x) if(n=(x)) return(n)
 #define GETC(x) (x=(*l_getc)())
 #define Ungetc(x,y) (*l_ungetc)(x,y)
@@ -216,11 +216,9 @@ bad:
 		++havenum;
 		while(*--sp == '0')
 			++exp;
-		if (exp)
-			sprintf(sp+1, "e%ld", exp);
-		else
-			sp[1] = 0;
-		f__lx = atof(s);
+		f__lx = f__strtod(sp1, sp + 1 - sp1, exp);
+		if (sp1 > s)
+			f__lx = -f__lx;
 #ifdef Allow_TYQUAD
 		if (reqint&2 && (se = sp - sp1 + exp) > 14 && se < 20) {
 			/* Assuming 64-bit longint and 32-bit long. */
@@ -341,8 +339,8 @@ l_C(Void)
 	return(0);
 }
 
- static char nmLbuf[256], *nmL_next;
- static int (*nmL_getc_save)(Void);
+ static F2C_TLS char nmLbuf[256], *nmL_next;
+ static F2C_TLS int (*nmL_getc_save)(Void);
 #ifdef KR_headers
  static int (*nmL_ungetc_save)(/* int, FILE* */);
 #else
@@ -481,6 +479,27 @@ l_L(Void)
 
 #define BUFSIZE	128
 
+/* f__lchar is kept from one character item to the next, and grows */
+/* by BUFSIZE at a time. */
+
+static F2C_TLS int lchar_size;
+
+ static char *
+#ifdef KR_headers
+l_grow(size) int *size;
+#else
+l_grow(int *size)
+#endif
+{
+	char *s;
+
+	if (s = F77_malloc((ftnlen)(*size + BUFSIZE)))
+		memcpy(s, f__lchar, *size);
+	F77_free(f__lchar);
+	*size = lchar_size = s ? *size + BUFSIZE : 0;
+	return f__lchar = s;
+	}
+
  static int
 l_CHAR(Void)
 {	int ch,size,i;
@@ -488,11 +507,14 @@ l_CHAR(Void)
 	char quote,*p;
 	if(f__lcount>0) return(0);
 	f__ltype=0;
-	if(f__lchar!=NULL) free(f__lchar);
-	size=BUFSIZE;
-	p=f__lchar = (char *)malloc((unsigned int)size);
+	if(f__lchar == NULL) {
+		f__lchar = F77_malloc((ftnlen)BUFSIZE);
+		lchar_size = BUFSIZE;
+		}
 	if(f__lchar == NULL)
 		errfl(f__elist->cierr,113,"no space");
+	size = lchar_size;
+	p = f__lchar;
 
 	GETC(ch);
 	if(isdigit(ch)) {
@@ -539,8 +561,7 @@ l_CHAR(Void)
 			*p++ = ch;
 			f__lcount = 10*f__lcount + ch - '0';
 			if (++i == size) {
-				f__lchar = (char *)realloc(f__lchar,
-					(unsigned int)(size += BUFSIZE));
+				l_grow(&size);
 				if(f__lchar == NULL)
 					errfl(f__elist->cierr,113,rafail);
 				p = f__lchar + i;
@@ -580,8 +601,7 @@ l_CHAR(Void)
  noquote:
 			*p++ = ch;
 			if (++i == size) {
-				f__lchar = (char *)realloc(f__lchar,
-					(unsigned int)(size += BUFSIZE));
+				l_grow(&size);
 				if(f__lchar == NULL)
 					errfl(f__elist->cierr,113,rafail);
 				p = f__lchar + i;
@@ -595,8 +615,7 @@ l_CHAR(Void)
 		if(i==size)
 		{
 		newone:
-			f__lchar= (char *)realloc(f__lchar,
-					(unsigned int)(size += BUFSIZE));
+			l_grow(&size);
 			if(f__lchar == NULL)
 				errfl(f__elist->cierr,113,rafail);
 			p=f__lchar+i-1;
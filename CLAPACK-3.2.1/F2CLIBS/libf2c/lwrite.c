@@ -6,8 +6,8 @@
 extern "C" {
 #endif
 
-ftnint L_len;
-int f__Aquote;
+F2C_TLS ftnint L_len;
+F2C_TLS int f__Aquote;
 
  static VOID
 donewrec(Void)
@@ -32,8 +32,7 @@ lwrt_I(longint n)
 	PUT(' ');
 	if (sign)
 		PUT('-');
-	while(*p)
-		PUT(*p++);
+	PUTS(p, ndigit);
 }
  static VOID
 #ifdef KR_headers
@@ -79,23 +78,23 @@ lwrt_A(char *p, ftnlen len)
 		PUT(' ');
 	if (a) {
 		PUT('\'');
-		while(p < pe) {
-			if (*p == '\'')
-				PUT('\'');
-			PUT(*p++);
-			}
+		for(p1 = p; p < pe; )
+			if (*p++ == '\'') {
+				PUTS(p1, p - p1);	/* double the quote */
+				p1 = p - 1;
+				}
+		PUTS(p1, p - p1);
 		PUT('\'');
 		}
 	else
-		while(p < pe)
-			PUT(*p++);
+		PUTS(p, pe - p);
 }
 
  static int
 #ifdef KR_headers
-l_g(buf, n) char *buf; double n;
+l_g(buf, n, sgl) char *buf; double n; int sgl;
 #else
-l_g(char *buf, double n)
+l_g(char *buf, double n, int sgl)
 #endif
 {
 #ifdef Old_list_output
@@ -115,6 +114,8 @@ l_g(char *buf, double n)
 
 #else
 	register char *b, c, c1;
+	char dig[32], *s;
+	int i, nd, x;
 
 	b = buf;
 	*b++ = ' ';
@@ -134,7 +135,37 @@ l_g(char *buf, double n)
 		*b = 0;
 		goto f__ret;
 		}
-	sprintf(b, LGFMT, n);
+	if (n - n != 0.)	/* Infinity or NaN */
+		sprintf(b, LGFMT, n);
+	else {
+		/* as LGFMT would give it, but with the fewest digits */
+		/* that read back as n (as a REAL if sgl) */
+		nd = f__dtoa(n, 0, 0, sgl, dig, &x);
+		s = b;
+		if (--x < -4 || x >= 9) {
+			*s++ = dig[0];
+			if (nd > 1) {
+				*s++ = '.';
+				for(i = 1; i < nd; i++)
+					*s++ = dig[i];
+				}
+			sprintf(s, "E%+.2d", x);
+			}
+		else {
+			if (x < 0) {
+				*s++ = '0';
+				*s++ = '.';
+				for(i = x; ++i < 0; )
+					*s++ = '0';
+				}
+			for(i = 0; i < nd || i <= x; i++) {
+				if (i == x + 1 && i)
+					*s++ = '.';
+				*s++ = i < nd ? dig[i] : '0';
+				}
+			*s = 0;
+			}
+		}
 	switch(*b) {
 #ifndef WANT_LEAD_0
 		case '0':
@@ -180,44 +211,39 @@ l_put(s) register char *s;
 l_put(register char *s)
 #endif
 {
-#ifdef KR_headers
-	register void (*pn)() = f__putn;
-#else
-	register void (*pn)(int) = f__putn;
-#endif
-	register int c;
+	register int n;
 
-	while(c = *s++)
-		(*pn)(c);
+	for(n = 0; s[n]; n++);
+	PUTS(s, n);
 	}
 
  static VOID
 #ifdef KR_headers
-lwrt_F(n) double n;
+lwrt_F(n, sgl) double n; int sgl;
 #else
-lwrt_F(double n)
+lwrt_F(double n, int sgl)
 #endif
 {
 	char buf[LEFBL];
 
-	if(f__recpos + l_g(buf,n) >= L_len)
+	if(f__recpos + l_g(buf,n,sgl) >= L_len)
 		donewrec();
 	l_put(buf);
 }
  static VOID
 #ifdef KR_headers
-lwrt_C(a,b) double a,b;
+lwrt_C(a,b,sgl) double a,b; int sgl;
 #else
-lwrt_C(double a, double b)
+lwrt_C(double a, double b, int sgl)
 #endif
 {
 	char *ba, *bb, bufa[LEFBL], bufb[LEFBL];
 	int al, bl;
 
-	al = l_g(bufa, a);
+	al = l_g(bufa, a, sgl);
 	for(ba = bufa; *ba == ' '; ba++)
 		--al;
-	bl = l_g(bufb, b) + 1;	/* intentionally high by 1 */
+	bl = l_g(bufb, b, sgl) + 1;	/* intentionally high by 1 */
 	for(bb = bufb; *bb == ' '; bb++)
 		--bl;
 	if(f__recpos + al + bl + 3 >= L_len)
@@ -277,7 +303,7 @@ l_write(ftnint *number, char *ptr, ftnlen len, ftnint type)
 			goto xfloat;
 		case TYDREAL:
 			y=Ptr->fldouble;
-		xfloat: lwrt_F(y);
+		xfloat: lwrt_F(y, type == TYREAL);
 			break;
 		case TYCOMPLEX:
 			xx= &Ptr->flreal;
@@ -289,7 +315,7 @@ l_write(ftnint *number, char *ptr, ftnlen len, ftnint type)
 			y= *yy++;
 			z = *yy;
 		xcomplex:
-			lwrt_C(y,z);
+			lwrt_C(y, z, type == TYCOMPLEX);
 			break;
 		case TYLOGICAL1:
 			x = Ptr->flchar;
@@ -37,8 +37,15 @@ Const char *f__r_mode[2] = {"rb", "r"};
 Const char *f__w_mode[4] = {"wb", "w", "r+b", "r+"};
 #endif
 
+#ifdef F2C_THREADS
+ /* f__buf cannot start out pointing at a thread's own f__buf0, */
+ /* so f__bufadj does that the first time the thread writes. */
+ static F2C_TLS char f__buf0[400], *f__buf;
+ F2C_TLS int f__buflen;
+#else
  static char f__buf0[400], *f__buf = f__buf0;
  int f__buflen = (int)sizeof(f__buf0);
+#endif
 
  static void
 #ifdef KR_headers
@@ -50,12 +57,17 @@ f__bufadj(int n, int c)
 	unsigned int len;
 	char *nbuf, *s, *t, *te;
 
+	if (!f__buf) {
+		f__buf = f__buf0;
+		if (n < (f__buflen = (int)sizeof(f__buf0)))
+			return;
+		}
 	if (f__buf == f__buf0)
 		f__buflen = 1024;
 	while(f__buflen <= n)
 		f__buflen <<= 1;
 	len = (unsigned int)f__buflen;
-	if (len != f__buflen || !(nbuf = (char*)malloc(len)))
+	if (len != f__buflen || !(nbuf = F77_malloc((ftnlen)len)))
 		f__fatal(113, "malloc failure");
 	s = nbuf;
 	t = f__buf;
@@ -63,7 +75,7 @@ f__bufadj(int n, int c)
 	while(t < te)
 		*s++ = *t++;
 	if (f__buf != f__buf0)
-		free(f__buf);
+		F77_free(f__buf);
 	f__buf = nbuf;
 	}
 
@@ -86,14 +98,7 @@ f__putbuf(int c)
 	se = s + f__recpos;
 	if (c)
 		*se++ = c;
-	*se = 0;
-	for(;;) {
-		fputs(s, f__cf);
-		s += strlen(s);
-		if (s >= se)
-			break;	/* normally happens the first time */
-		putc(*s++, f__cf);
-		}
+	fwrite(s, 1, se - s, f__cf);
 	return 0;
 	}
 
@@ -109,6 +114,19 @@ x_putc(int c)
 	f__buf[f__recpos++] = c;
 	}
 
+ void
+#ifdef KR_headers
+x_putsn(s, n) char *s; int n;
+#else
+x_putsn(const char *s, int n)
+#endif
+{
+	if (f__recpos + n >= f__buflen)
+		f__bufadj(f__recpos + n, f__buflen);
+	memcpy(f__buf + f__recpos, s, n);
+	f__recpos += n;
+	}
+
 #define opnerr(f,m,s) {if(f) errno= m; else opn_err(m,s,a); return(m);}
 
  static void
@@ -247,7 +265,7 @@ integer f_open(olist *a)
 			fclose(tf);
 	}
 
-	b->ufnm=(char *) malloc((unsigned int)(strlen(buf)+1));
+	b->ufnm = F77_malloc((ftnlen)(strlen(buf)+1));
 	if(b->ufnm==NULL) opnerr(a->oerr,113,"no space");
 	(void) strcpy(b->ufnm,buf);
 	if ((s = a->oacc) && b->url)
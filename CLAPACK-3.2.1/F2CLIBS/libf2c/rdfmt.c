@@ -2,7 +2,6 @@
 #include "fio.h"
 
 #ifdef KR_headers
-extern double atof();
 #define Const /*nothing*/
 #else
 #define Const const
@@ -30,7 +29,7 @@ rd_Z(Uint *n, int w, ftnlen len)
 	char *s, *s0, *s1, *se, *t;
 	Const char *sc;
 	int ch, i, w1, w2;
-	static char hex[256];
+	static F2C_TLS char hex[256];
 	static int one = 1;
 	int bad = 0;
 
@@ -378,11 +377,9 @@ done:
 	if (sp > sp1) {
 		while(*--sp == '0')
 			++exp;
-		if (exp -= scale1)
-			sprintf(sp+1, "e%ld", exp);
-		else
-			sp[1] = 0;
-		x = atof(s);
+		x = f__strtod(sp1, sp + 1 - sp1, exp - scale1);
+		if (sp1 > s)
+			x = -x;
 		}
 zero:
 	if (len == sizeof(real))
@@ -469,7 +466,7 @@ rd_ed(struct syl *p, char *ptr, ftnlen len)
 	{	if(f__recpos+f__cursor < 0) /*err(elist->cierr,110,"fmt")*/
 			f__cursor = -f__recpos;	/* is this in the standard? */
 		if(f__external == 0) {
-			extern char *f__icptr;
+			extern F2C_TLS char *f__icptr;
 			f__icptr += f__cursor;
 		}
 		else if(f__curunit && f__curunit->useek)
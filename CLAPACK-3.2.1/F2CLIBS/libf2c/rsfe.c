@@ -10,7 +10,7 @@ extern "C" {
 xrd_SL(Void)
 {	int ch;
 	if(!f__curunit->uend)
-		while((ch=getc(f__cf))!='\n')
+		while((ch=FGETC(f__cf))!='\n')
 			if (ch == EOF) {
 				f__curunit->uend = 1;
 				break;
@@ -23,7 +23,7 @@ xrd_SL(Void)
 x_getc(Void)
 {	int ch;
 	if(f__curunit->uend) return(EOF);
-	ch = getc(f__cf);
+	ch = FGETC(f__cf);
 	if(ch!=EOF && ch!='\n')
 	{	f__recpos++;
 		return(ch);
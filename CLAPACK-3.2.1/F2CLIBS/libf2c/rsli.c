@@ -6,12 +6,12 @@
 extern "C" {
 #endif
 
-extern flag f__lquit;
-extern int f__lcount;
-extern char *f__icptr;
-extern char *f__icend;
-extern icilist *f__svic;
-extern int f__icnum, f__recpos;
+extern F2C_TLS flag f__lquit;
+extern F2C_TLS int f__lcount;
+extern F2C_TLS char *f__icptr;
+extern F2C_TLS char *f__icend;
+extern F2C_TLS icilist *f__svic;
+extern F2C_TLS int f__icnum, f__recpos;
 
 static int i_getc(Void)
 {
@@ -48,7 +48,7 @@ c_lir(a) icilist *a;
 c_lir(icilist *a)
 #endif
 {
-	extern int l_eof;
+	extern F2C_TLS int l_eof;
 	f__reading = 1;
 	f__external = 0;
 	f__formatted = 1;
@@ -93,7 +93,7 @@ extern int x_rsne(cilist*);
 integer s_rsni(icilist *a)
 #endif
 {
-	extern int nml_read;
+	extern F2C_TLS int nml_read;
 	integer rv;
 	cilist ca;
 	ca.ciend = a->iciend;
@@ -28,14 +28,14 @@
 	};
  typedef struct hashtab hashtab;
 
- static hashtab *nl_cache;
- static int n_nlcache;
- static hashentry **zot;
- static int colonseen;
+ static F2C_TLS hashtab *nl_cache;
+ static F2C_TLS int n_nlcache;
+ static F2C_TLS hashentry **zot;
+ static F2C_TLS int colonseen;
  extern ftnlen f__typesize[];
 
- extern flag f__lquit;
- extern int f__lcount, nml_read;
+ extern F2C_TLS flag f__lquit;
+ extern F2C_TLS int f__lcount, nml_read;
  extern int t_getc(Void);
 
 #ifdef KR_headers
@@ -110,7 +110,7 @@ mk_hashtab(Namelist *nl)
 	if (n_nlcache >= MAX_NL_CACHE) {
 		/* discard least recently used namelist hash table */
 		y = *x0;
-		free((char *)y->next);
+		F77_free((char *)y->next);
 		y->next = 0;
 		}
 	else
@@ -122,8 +122,8 @@ mk_hashtab(Namelist *nl)
 		for(nht = 1; nht < nv; nht <<= 1);
 		nht += nht - 1;
 		}
-	ht = (hashtab *)malloc(sizeof(hashtab) + (nht-1)*sizeof(hashentry *)
-				+ nv*sizeof(hashentry));
+	ht = (hashtab *)F77_malloc((ftnlen)(sizeof(hashtab) + (nht-1)*sizeof(hashentry *)
+				+ nv*sizeof(hashentry)));
 	if (!ht)
 		return 0;
 	he = (hashentry *)&ht->tab[nht];
@@ -147,7 +147,7 @@ mk_hashtab(Namelist *nl)
 	return ht;
 	}
 
-static char Alpha[256], Alphanum[256];
+static F2C_TLS char Alpha[256], Alphanum[256];
 
  static VOID
 nl_init(Void) {
@@ -595,7 +595,7 @@ s_rsne(a) cilist *a;
 s_rsne(cilist *a)
 #endif
 {
-	extern int l_eof;
+	extern F2C_TLS int l_eof;
 	int n;
 
 	f__external=1;
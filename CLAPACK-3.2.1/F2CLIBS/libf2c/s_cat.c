@@ -8,9 +8,9 @@
 #include "stdio.h"
 #undef abs
 #ifdef KR_headers
- extern char *F77_aloc();
- extern void free();
- extern void exit_();
+ extern char *F77_atmp();
+ extern ftnlen F77_amark();
+ extern void F77_arelease();
 #else
 #undef min
 #undef max
@@ -19,7 +19,17 @@ extern
 #ifdef __cplusplus
 	"C"
 #endif
-	char *F77_aloc(ftnlen, const char*);
+	char *F77_atmp(ftnlen, const char*);
+extern
+#ifdef __cplusplus
+	"C"
+#endif
+	ftnlen F77_amark(void);
+extern
+#ifdef __cplusplus
+	"C"
+#endif
+	void F77_arelease(ftnlen);
 #endif
 #include "string.h"
 #endif /* NO_OVERWRITE */
@@ -39,7 +49,7 @@ s_cat(char *lp, char *rpp[], ftnint rnp[], ftnint *np, ftnlen ll)
 	char *rp;
 	ftnlen n = *np;
 #ifndef NO_OVERWRITE
-	ftnlen L, m;
+	ftnlen L, m, mark;
 	char *lp0, *lp1;
 
 	lp0 = 0;
@@ -57,8 +67,10 @@ s_cat(char *lp, char *rpp[], ftnint rnp[], ftnint *np, ftnlen ll)
 			lp1 += m;
 			continue;
 			}
+		/* the copy comes from the arena (see f77_aloc.c) */
 		lp0 = lp;
-		lp = lp1 = F77_aloc(L = ll, "s_cat");
+		mark = F77_amark();
+		lp = lp1 = F77_atmp(L = ll, "s_cat");
 		break;
 		}
 	lp1 = lp;
@@ -77,7 +89,7 @@ s_cat(char *lp, char *rpp[], ftnint rnp[], ftnint *np, ftnlen ll)
 #ifndef NO_OVERWRITE
 	if (lp0) {
 		memcpy(lp0, lp1, L);
-		free(lp1);
+		F77_arelease(mark);
 		}
 #endif
 	}
@@ -6,9 +6,9 @@ extern "C" {
 #endif
 
 #ifdef KR_headers
-extern char *f__fmtbuf;
+extern F2C_TLS char *f__fmtbuf;
 #else
-extern const char *f__fmtbuf;
+extern F2C_TLS const char *f__fmtbuf;
 #endif
 
 integer e_rsfe(Void)
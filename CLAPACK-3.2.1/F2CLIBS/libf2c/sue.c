@@ -3,8 +3,8 @@
 #ifdef __cplusplus
 extern "C" {
 #endif
-extern uiolen f__reclen;
-OFF_T f__recloc;
+extern F2C_TLS uiolen f__reclen;
+F2C_TLS OFF_T f__recloc;
 
  int
 #ifdef KR_headers
@@ -15,6 +15,9 @@ c_sue(cilist *a)
 {
 	f__external=f__sequential=1;
 	f__formatted=0;
+#ifdef F2C_MMAP
+	f__mptr = 0;
+#endif
 	f__curunit = &f__units[a->ciunit];
 	if(a->ciunit >= MXUNIT || a->ciunit < 0)
 		err(a->cierr,101,"startio");
@@ -48,6 +51,13 @@ integer s_rsue(cilist *a)
 		clearerr(f__cf);
 		err(a->cierr, errno, "start");
 	}
+#ifdef F2C_MMAP
+	if (f__reclen >= MMAP_MIN) {
+		OFF_T loc = FTELL(f__cf);
+		if (f__mapunit(f__curunit, loc + f__reclen))
+			f__mptr = f__curunit->umap + loc;
+	}
+#endif
 	return(0);
 }
 #ifdef KR_headers
@@ -82,6 +92,13 @@ integer e_wsue(Void)
 }
 integer e_rsue(Void)
 {
+#ifdef F2C_MMAP
+	if (f__mptr) {
+		FSEEK(f__cf, (OFF_T)(f__mptr - f__curunit->umap)
+			+ f__reclen + sizeof(uiolen), SEEK_SET);
+		return(0);
+	}
+#endif
 	FSEEK(f__cf,(OFF_T)(f__reclen-f__recpos+sizeof(uiolen)),SEEK_CUR);
 	return(0);
 }
@@ -4,6 +4,7 @@
 
 #ifdef KR_headers
 extern char *F77_aloc();
+extern VOID F77_free();
 
  integer
 system_(s, n) register char *s; ftnlen n;
@@ -16,6 +17,7 @@ system_(s, n) register char *s; ftnlen n;
 extern "C" {
 #endif
 extern char *F77_aloc(ftnlen, const char*);
+extern void F77_free(char*);
 
  integer
 system_(register char *s, ftnlen n)
@@ -34,7 +36,7 @@ system_(register char *s, ftnlen n)
 	*bp = 0;
 	rv = system(buff);
 	if (buff != buff0)
-		free(buff);
+		F77_free(buff);
 	return rv;
 	}
 #ifdef __cplusplus
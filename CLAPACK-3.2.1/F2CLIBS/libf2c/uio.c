@@ -1,9 +1,87 @@
 #include "f2c.h"
 #include "fio.h"
+#ifdef F2C_MMAP
+#include "string.h"
+#include "sys/mman.h"
+#include "unistd.h"
+#endif
 #ifdef __cplusplus
 extern "C" {
 #endif
-uiolen f__reclen;
+F2C_TLS uiolen f__reclen;
+
+#ifdef F2C_MMAP
+F2C_TLS char *f__mptr;
+
+/* Make sure the first need bytes of the file connected to u are */
+/* mapped; return 0 if they cannot be (not a regular file, file too */
+/* short, or mmap fails), in which case the caller uses stdio. */
+
+ int
+#ifdef KR_headers
+f__mapunit(u, need) unit *u; OFF_T need;
+#else
+f__mapunit(unit *u, OFF_T need)
+#endif
+{
+	struct STAT_ST x;
+	size_t len;
+	char *p;
+
+	if (u->umap && need <= u->umaplen)
+		return 1;
+	f__unmap(u);
+	if (FSTAT(fileno(u->ufd), &x) < 0
+	 || !S_ISREG(x.st_mode) || x.st_size < need || x.st_size <= 0)
+		return 0;
+	len = (size_t)x.st_size;
+	if ((OFF_T)len != x.st_size)
+		return 0;	/* too big for the address space */
+	p = (char*)mmap(0, len, PROT_READ, MAP_SHARED, fileno(u->ufd), 0);
+	if (p == (char*)MAP_FAILED)
+		return 0;
+#ifdef MADV_SEQUENTIAL
+	if (!u->url)
+		madvise(p, len, MADV_SEQUENTIAL);
+#endif
+	u->umap = p;
+	u->umaplen = x.st_size;
+	return 1;
+}
+
+ void
+#ifdef KR_headers
+f__unmap(u) unit *u;
+#else
+f__unmap(unit *u)
+#endif
+{
+	if (u->umap) {
+		munmap(u->umap, (size_t)u->umaplen);
+		u->umap = 0;
+		u->umaplen = 0;
+	}
+}
+
+/* Copy n bytes at s in the mapping to ptr.  Blocks of MMAP_MIN */
+/* bytes or more are read with pread, which copies them just once */
+/* and lets the kernel read ahead, rather than faulting them in. */
+
+ static void
+#ifdef KR_headers
+m_copy(ptr, s, n) char *ptr, *s; ftnlen n;
+#else
+m_copy(char *ptr, char *s, ftnlen n)
+#endif
+{
+	unit *u = f__curunit;
+
+	if (n >= MMAP_MIN && pread(fileno(u->ufd), ptr, (size_t)n,
+			(OFF_T)(s - u->umap)) == n)
+		return;
+	memcpy(ptr, s, n);
+}
+#endif /* F2C_MMAP */
 
  int
 #ifdef KR_headers
@@ -17,6 +95,13 @@ do_us(ftnint *number, char *ptr, ftnlen len)
 		f__recpos += (int)(*number * len);
 		if(f__recpos>f__reclen)
 			err(f__elist->cierr, 110, "do_us");
+#ifdef F2C_MMAP
+		if (f__mptr) {
+			ftnlen n = *number * len;
+			m_copy(ptr, f__mptr + f__recpos - n, n);
+			return(0);
+		}
+#endif
 		if (fread(ptr,(int)len,(int)(*number),f__cf) != *number)
 			err(f__elist->ciend, EOF, "do_us");
 		return(0);
@@ -39,6 +124,20 @@ integer do_ud(ftnint *number, char *ptr, ftnlen len)
 		err(f__elist->cierr,110,"do_ud");
 	if(f__reading)
 	{
+#ifdef F2C_MMAP
+		if (f__mptr) {
+			unit *u = f__curunit;
+			ftnlen n = *number * len;
+			if (f__mptr + f__recpos <= u->umap + u->umaplen) {
+				m_copy(ptr, f__mptr + f__recpos - n, n);
+				return(0);
+			}
+			/* past the end of the mapping: let fread deal with it */
+			FSEEK(f__cf, (OFF_T)(f__mptr - u->umap)
+				+ f__recpos - n, SEEK_SET);
+			f__mptr = 0;
+		}
+#endif
 #ifdef Pad_UDread
 #ifdef KR_headers
 	int i;
@@ -26,7 +26,7 @@ wrt_E(ufloat *p, int w, int d, int e, ftnlen len)
 #endif
 {
 	char buf[FMAX+EXPMAXDIGS+4], *s, *se;
-	int d1, delta, e1, i, sign, signspace;
+	int d1, delta, e1, i, sign, signspace, x;
 	double dd;
 #ifdef WANT_LEAD_0
 	int insert0 = 0;
@@ -75,8 +75,7 @@ wrt_E(ufloat *p, int w, int d, int e, ftnlen len)
 #endif
 	if (delta < 0) {
 nogood:
-		while(--w >= 0)
-			PUT('*');
+		f__putfill('*', w);
 		return(0);
 		}
 	if (f__scale < 0)
@@ -87,10 +86,10 @@ nogood:
 		}
 	else
 		d1 = 0;
-	sprintf(buf,"%#.*E", d, dd);
 #ifndef VAX
 	/* check for NaN, Infinity */
-	if (!isdigit(buf[0])) {
+	if (dd - dd != 0.) {
+		sprintf(buf,"%#.*E", d, dd);
 		switch(buf[0]) {
 			case 'n':
 			case 'N':
@@ -99,25 +98,40 @@ nogood:
 		delta = w - strlen(buf) - signspace;
 		if (delta < 0)
 			goto nogood;
-		while(--delta >= 0)
-			PUT(' ');
+		f__putfill(' ', delta);
 		if (signspace)
 			PUT(sign ? '-' : '+');
-		for(s = buf; *s; s++)
-			PUT(*s);
+		PUTS(buf, strlen(buf));
 		return 0;
 		}
 #endif
+	if (d < 0)	/* Ew.0 with no scale factor */
+		goto nogood;
+	/* buf = d.ddd...E+xx */
+	if (dd) {
+		f__dtoa(dd, 1, d + 1, 0, buf + 1, &x);
+		x -= f__scale;
+		}
+	else {
+		memset(buf + 1, '0', d + 1);
+		x = 0;
+		}
+	buf[0] = buf[1];
+	buf[1] = '.';
+	buf[d+2] = 'E';
 	se = buf + d + 3;
-#ifdef GOOD_SPRINTF_EXPONENT /* When possible, exponent has 2 digits. */
-	if (f__scale != 1 && dd)
-		sprintf(se, "%+.2d", atoi(se) + 1 - f__scale);
-#else
-	if (dd)
-		sprintf(se, "%+.2d", atoi(se) + 1 - f__scale);
+	if (x < 0) {
+		*se = '-';
+		x = -x;
+		}
 	else
-		strcpy(se, "+00");
-#endif
+		*se = '+';
+	s = se + 1;
+	if (x >= 100)
+		*s++ = '0' + x / 100;
+	*s++ = '0' + x / 10 % 10;
+	*s++ = '0' + x % 10;
+	*s = 0;
 	s = ++se;
 	if (e < 2) {
 		if (*s != '0')
@@ -157,8 +171,7 @@ nogood:
 		for(s += 2, e1 = 2; *s; ++e1, ++s)
 			if (e1 >= e)
 				goto nogood;
-	while(--delta >= 0)
-		PUT(' ');
+	f__putfill(' ', delta);
 	if (signspace)
 		PUT(sign ? '-' : '+');
 	s = buf;
@@ -169,33 +182,31 @@ nogood:
 			PUT('0');
 #endif
 		PUT('.');
-		for(; i < 0; ++i)
-			PUT('0');
+		f__putfill('0', -i);
 		PUT(*s);
 		s += 2;
 		}
 	else if (f__scale > 1) {
 		PUT(*s);
 		s += 2;
-		while(--i > 0)
-			PUT(*s++);
+		PUTS(s, i - 1);
+		s += i - 1;
 		PUT('.');
 		}
 	if (d1) {
 		se -= 2;
-		while(s < se) PUT(*s++);
+		PUTS(s, se - s);
+		s = se;
 		se += 2;
-		do PUT('0'); while(--d1 > 0);
+		f__putfill('0', d1);
 		}
-	while(s < se)
-		PUT(*s++);
+	PUTS(s, se - s);
+	s = se;
 	if (e < 2)
 		PUT(s[1]);
 	else {
-		while(++e1 <= e)
-			PUT('0');
-		while(*s)
-			PUT(*s++);
+		f__putfill('0', e - e1);
+		PUTS(s, strlen(s));
 		}
 	return 0;
 	}
@@ -207,9 +218,10 @@ wrt_F(p,w,d,len) ufloat *p; ftnlen len;
 wrt_F(ufloat *p, int w, int d, ftnlen len)
 #endif
 {
-	int d1, sign, n;
+	int d1, decpt, i, k, nd, sign, n;
 	double x;
-	char *b, buf[MAXINTDIGS+MAXFRACDIGS+4], *s;
+	char *b, buf[MAXINTDIGS+MAXFRACDIGS+4], dig[MAXINTDIGS+MAXFRACDIGS+4];
+	char *s;
 
 	x= (len==sizeof(real)?p->pf:p->pd);
 	if (d < MAXFRACDIGS)
@@ -233,18 +245,40 @@ wrt_F(ufloat *p, int w, int d, ftnlen len)
 #endif
 		}
 
-	if (n = f__scale)
-		if (n > 0)
-			do x *= 10.; while(--n > 0);
-		else
-			do x *= 0.1; while(++n < 0);
-
+	k = f__scale;
+	if (x - x != 0. || k > MAXFRACDIGS - d) {
+		/* NaN, Infinity, or digits beyond MAXFRACDIGS */
+		if (n = k)
+			if (n > 0)
+				do x *= 10.; while(--n > 0);
+			else
+				do x *= 0.1; while(++n < 0);
 #ifdef USE_STRLEN
-	sprintf(b = buf, "%#.*f", d, x);
-	n = strlen(b) + d1;
+		sprintf(b = buf, "%#.*f", d, x);
+		n = strlen(b) + d1;
 #else
-	n = sprintf(b = buf, "%#.*f", d, x) + d1;
+		n = sprintf(b = buf, "%#.*f", d, x) + d1;
 #endif
+		}
+	else {
+		/* buf = x * 10^k as "%#.*f" would give it, without */
+		/* the rounding error of scaling x */
+		nd = x ? f__dtoa(x, 2, d + k, 0, dig, &decpt) : 0;
+		if (nd)
+			decpt += k;
+		else
+			decpt = 0;
+		s = buf;
+		if (decpt <= 0)
+			*s++ = '0';
+		for(i = 0; i < decpt; i++)
+			*s++ = i < nd ? dig[i] : '0';
+		*s++ = '.';
+		for(i = decpt; i < decpt + d; i++)
+			*s++ = i >= 0 && i < nd ? dig[i] : '0';
+		*s = 0;
+		n = s - (b = buf) + d1;
+		}
 
 #ifndef WANT_LEAD_0
 	if (buf[0] == '0' && d)
@@ -272,21 +306,17 @@ wrt_F(ufloat *p, int w, int d, ftnlen len)
 		else
 #endif
 		{
-			while(--w >= 0)
-				PUT('*');
+			f__putfill('*', w);
 			return 0;
 			}
 		}
-	for(w -= n; --w >= 0; )
-		PUT(' ');
+	f__putfill(' ', w - n);
 	if (sign)
 		PUT('-');
 	else if (f__cplus)
 		PUT('+');
-	while(n = *b++)
-		PUT(n);
-	while(--d1 >= 0)
-		PUT('0');
+	PUTS(b, strlen(b));
+	f__putfill('0', d1);
 	return 0;
 	}
 #ifdef __cplusplus
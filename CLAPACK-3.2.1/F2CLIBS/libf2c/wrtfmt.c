@@ -5,8 +5,34 @@
 extern "C" {
 #endif
 
-extern icilist *f__svic;
-extern char *f__icptr;
+extern F2C_TLS icilist *f__svic;
+extern F2C_TLS char *f__icptr;
+
+/* Write n copies of c. */
+
+ void
+#ifdef KR_headers
+f__putfill(c, n) int c, n;
+#else
+f__putfill(int c, int n)
+#endif
+{
+	char b[64];
+	int i, k;
+
+	if (n <= 0)
+		return;
+	k = n < (int)sizeof(b) ? n : (int)sizeof(b);
+	for(i = 0; i < k; i++)
+		b[i] = c;
+	for(;;) {
+		PUTS(b, k);
+		if ((n -= k) <= 0)
+			break;
+		if (k > n)
+			k = n;
+		}
+	}
 
  static int
 mv_cur(Void)	/* shouldn't use fseek because it insists on calling fflush */
@@ -27,14 +53,12 @@ mv_cur(Void)	/* shouldn't use fseek because it insists on calling fflush */
 			if(f__recpos + cursor >= f__svic->icirlen)
 				err(f__elist->cierr, 110, "recend");
 			if(f__hiwater <= f__recpos)
-				for(; cursor > 0; cursor--)
-					(*f__putn)(' ');
+				f__putfill(' ', cursor);
 			else if(f__hiwater <= f__recpos + cursor) {
 				cursor -= f__hiwater - f__recpos;
 				f__icptr += f__hiwater - f__recpos;
 				f__recpos = f__hiwater;
-				for(; cursor > 0; cursor--)
-					(*f__putn)(' ');
+				f__putfill(' ', cursor);
 			}
 			else {
 				f__icptr += cursor;
@@ -45,12 +69,11 @@ mv_cur(Void)	/* shouldn't use fseek because it insists on calling fflush */
 	}
 	if (cursor > 0) {
 		if(f__hiwater <= f__recpos)
-			for(;cursor>0;cursor--) (*f__putn)(' ');
+			f__putfill(' ', cursor);
 		else if(f__hiwater <= f__recpos + cursor) {
 			cursor -= f__hiwater - f__recpos;
 			f__recpos = f__hiwater;
-			for(; cursor > 0; cursor--)
-				(*f__putn)(' ');
+			f__putfill(' ', cursor);
 		}
 		else {
 			f__recpos += cursor;
@@ -97,15 +120,12 @@ wrt_Z(Uint *n, int w, int minlen, ftnlen len)
 	if (*s & 0xf0)
 		w1++;
 	if (w1 > w)
-		for(i = 0; i < w; i++)
-			(*f__putn)('*');
+		f__putfill('*', w);
 	else {
 		if ((minlen -= w1) > 0)
 			w1 += minlen;
-		while(--w >= w1)
-			(*f__putn)(' ');
-		while(--minlen >= 0)
-			(*f__putn)('0');
+		f__putfill(' ', w - w1);
+		f__putfill('0', minlen);
 		if (!(*s & 0xf0)) {
 			(*f__putn)(hex[*s & 0xf]);
 			if (s == se)
@@ -128,7 +148,7 @@ wrt_I(n,w,len, base) Uint *n; ftnlen len; register int base;
 #else
 wrt_I(Uint *n, int w, ftnlen len, register int base)
 #endif
-{	int ndigit,sign,spare,i;
+{	int ndigit,sign,spare;
 	longint x;
 	char *ans;
 	if(len==sizeof(integer)) x=n->il;
@@ -141,12 +161,12 @@ wrt_I(Uint *n, int w, ftnlen len, register int base)
 	spare=w-ndigit;
 	if(sign || f__cplus) spare--;
 	if(spare<0)
-		for(i=0;i<w;i++) (*f__putn)('*');
+		f__putfill('*', w);
 	else
-	{	for(i=0;i<spare;i++) (*f__putn)(' ');
+	{	f__putfill(' ', spare);
 		if(sign) (*f__putn)('-');
 		else if(f__cplus) (*f__putn)('+');
-		for(i=0;i<ndigit;i++) (*f__putn)(*ans++);
+		PUTS(ans, ndigit);
 	}
 	return(0);
 }
@@ -156,7 +176,7 @@ wrt_IM(n,w,m,len,base) Uint *n; ftnlen len; int base;
 #else
 wrt_IM(Uint *n, int w, int m, ftnlen len, int base)
 #endif
-{	int ndigit,sign,spare,i,xsign;
+{	int ndigit,sign,spare,xsign;
 	longint x;
 	char *ans;
 	if(sizeof(integer)==len) x=n->il;
@@ -169,22 +189,22 @@ wrt_IM(Uint *n, int w, int m, ftnlen len, int base)
 	if(sign || f__cplus) xsign=1;
 	else xsign=0;
 	if(ndigit+xsign>w || m+xsign>w)
-	{	for(i=0;i<w;i++) (*f__putn)('*');
+	{	f__putfill('*', w);
 		return(0);
 	}
 	if(x==0 && m==0)
-	{	for(i=0;i<w;i++) (*f__putn)(' ');
+	{	f__putfill(' ', w);
 		return(0);
 	}
 	if(ndigit>=m)
 		spare=w-ndigit-xsign;
 	else
 		spare=w-m-xsign;
-	for(i=0;i<spare;i++) (*f__putn)(' ');
+	f__putfill(' ', spare);
 	if(sign) (*f__putn)('-');
 	else if(f__cplus) (*f__putn)('+');
-	for(i=0;i<m-ndigit;i++) (*f__putn)('0');
-	for(i=0;i<ndigit;i++) (*f__putn)(*ans++);
+	f__putfill('0', m-ndigit);
+	PUTS(ans, ndigit);
 	return(0);
 }
  static int
@@ -193,17 +213,19 @@ wrt_AP(s) char *s;
 #else
 wrt_AP(char *s)
 #endif
-{	char quote;
+{	char quote, *t;
 	int i;
 
 	if(f__cursor && (i = mv_cur()))
 		return i;
 	quote = *s++;
-	for(;*s;s++)
-	{	if(*s!=quote) (*f__putn)(*s);
-		else if(*++s==quote) (*f__putn)(*s);
-		else return(1);
+	for(t = s;*s;s++)
+	{	if(*s!=quote) continue;
+		PUTS(t, s - t);	/* up to the quote */
+		if(*++s!=quote) return(1);
+		t = s;		/* a doubled quote: keep one */
 	}
+	PUTS(t, s - t);
 	return(1);
 }
  static int
@@ -217,7 +239,7 @@ wrt_H(int a, char *s)
 
 	if(f__cursor && (i = mv_cur()))
 		return i;
-	while(a--) (*f__putn)(*s++);
+	PUTS(s, a);
 	return(1);
 }
 
@@ -227,13 +249,11 @@ wrt_L(n,len, sz) Uint *n; ftnlen sz;
 #else
 wrt_L(Uint *n, int len, ftnlen sz)
 #endif
-{	int i;
-	long x;
+{	long x;
 	if(sizeof(long)==sz) x=n->il;
 	else if(sz == sizeof(char)) x = n->ic;
 	else x=n->is;
-	for(i=0;i<len-1;i++)
-		(*f__putn)(' ');
+	f__putfill(' ', len-1);
 	if(x) (*f__putn)('T');
 	else (*f__putn)('F');
 	return(0);
@@ -245,7 +265,8 @@ wrt_A(p,len) char *p; ftnlen len;
 wrt_A(char *p, ftnlen len)
 #endif
 {
-	while(len-- > 0) (*f__putn)(*p++);
+	if (len > 0)
+		PUTS(p, (int)len);
 	return(0);
 }
  static int
@@ -255,12 +276,12 @@ wrt_AW(p,w,len) char * p; ftnlen len;
 wrt_AW(char * p, int w, ftnlen len)
 #endif
 {
-	while(w>len)
-	{	w--;
-		(*f__putn)(' ');
+	if(w>len)
+	{	f__putfill(' ', w - (int)len);
+		w = len;
 	}
-	while(w-- > 0)
-		(*f__putn)(*p++);
+	if(w > 0)
+		PUTS(p, w);
 	return(0);
 }
 
@@ -271,7 +292,7 @@ wrt_G(p,w,d,e,len) ufloat *p; ftnlen len;
 wrt_G(ufloat *p, int w, int d, int e, ftnlen len)
 #endif
 {	double up = 1,x;
-	int i=0,oldscale,n,j;
+	int i=0,oldscale,n;
 	x = len==sizeof(real)?p->pf:p->pd;
 	if(x < 0 ) x = -x;
 	if(x<.1) {
@@ -288,7 +309,7 @@ wrt_G(ufloat *p, int w, int d, int e, ftnlen len)
 		if(e==0) n=4;
 		else	n=e+2;
 		i=wrt_F(p,w-n,d-i,len);
-		for(j=0;j<n;j++) (*f__putn)(' ');
+		f__putfill(' ', n);
 		f__scale=oldscale;
 		return(i);
 	}
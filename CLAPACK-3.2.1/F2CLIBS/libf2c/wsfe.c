@@ -61,6 +61,7 @@ integer s_wsfe(cilist *a)	/*start*/
 	f__cf=f__curunit->ufd;
 	if(pars_f(f__fmtbuf)<0) err(a->cierr,100,"startio");
 	f__putn= x_putc;
+	f__putsn= x_putsn;
 	f__doed= w_ed;
 	f__doned= w_ned;
 	f__doend=xw_end;
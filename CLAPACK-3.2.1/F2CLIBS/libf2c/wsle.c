@@ -19,6 +19,7 @@ integer s_wsle(cilist *a)
 	f__external=1;
 	f__formatted=1;
 	f__putn = x_putc;
+	f__putsn = x_putsn;
 	f__lioproc = l_write;
 	L_len = LINE;
 	f__donewrec = x_wSL;
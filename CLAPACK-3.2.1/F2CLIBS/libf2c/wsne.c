@@ -20,6 +20,7 @@ s_wsne(cilist *a)
 	f__external=1;
 	f__formatted=1;
 	f__putn = x_putc;
+	f__putsn = x_putsn;
 	L_len = LINE;
 	f__donewrec = x_wSL;
 	if(f__curunit->uwrt != 1 && f__nowwriting(f__curunit))
@@ -3,7 +3,7 @@
 #include "lio.h"
 #include "fmt.h"
 
-extern int f__Aquote;
+extern F2C_TLS int f__Aquote;
 
  static VOID
 nl_donewrec(Void)
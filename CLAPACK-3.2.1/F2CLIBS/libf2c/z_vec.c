@@ -0,0 +1,295 @@
+#include "f2c.h"
+
+/* Array forms of z_div, z_abs, z_sqrt, z_exp, z_log and pow_zz; */
+/* see f2c_vec.h.  z_vdiv, z_vabs and z_vsqrt do the operations of */
+/* z_div.c, cabs.c and z_sqrt.c in the same order, but evaluate */
+/* both sides of each test and select between them, so the loops */
+/* have no branches; with SSE2 (unless compiled with -DNO_SSE2) */
+/* they handle two elements per step.  An output array may be the */
+/* same as an input array. */
+
+#ifdef KR_headers
+double sqrt();
+extern VOID sig_die(), z_exp(), z_log(), pow_zz();
+#else
+#undef abs
+#include "math.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern void sig_die(const char*, int);
+extern void z_exp(doublecomplex*, doublecomplex*);
+extern void z_log(doublecomplex*, doublecomplex*);
+extern void pow_zz(doublecomplex*, doublecomplex*, doublecomplex*);
+#endif
+
+#if defined(__SSE2__) && !defined(NO_SSE2) && !defined(KR_headers)
+#define Z_SSE2
+#include <emmintrin.h>
+
+#define Vsel(m,x,y) _mm_or_pd(_mm_and_pd(m,x), _mm_andnot_pd(m,y))
+#define Vneg(x) _mm_xor_pd(x, _mm_set1_pd(-0.))
+
+/* Load z[0] and z[1] as vectors of real and imaginary parts. */
+#define Vload(z,re,im) { __m128d z0_ = _mm_loadu_pd(&(z)[0].r),\
+	z1_ = _mm_loadu_pd(&(z)[1].r);\
+	re = _mm_unpacklo_pd(z0_, z1_); im = _mm_unpackhi_pd(z0_, z1_); }
+#define Vstore(z,re,im) { _mm_storeu_pd(&(z)[0].r, _mm_unpacklo_pd(re,im));\
+	_mm_storeu_pd(&(z)[1].r, _mm_unpackhi_pd(re,im)); }
+
+/* f__cabs(re, im) for two elements at once */
+
+ static __m128d
+v_cabs(__m128d re, __m128d im)
+{
+	__m128d zero = _mm_setzero_pd(), m, hi, lo, t;
+
+	re = Vsel(_mm_cmplt_pd(re, zero), Vneg(re), re);
+	im = Vsel(_mm_cmplt_pd(im, zero), Vneg(im), im);
+	m = _mm_cmpgt_pd(im, re);
+	hi = Vsel(m, im, re);
+	lo = Vsel(m, re, im);
+	t = _mm_div_pd(lo, hi);
+	t = _mm_mul_pd(hi, _mm_sqrt_pd(_mm_add_pd(_mm_set1_pd(1.0),
+		_mm_mul_pd(t, t))));
+	return Vsel(_mm_cmpeq_pd(_mm_add_pd(hi, lo), hi), hi, t);
+	}
+#endif /*Z_SSE2*/
+
+/* f__cabs(re, im), as in cabs.c */
+
+ static double
+#ifdef KR_headers
+s_cabs(re, im) double re, im;
+#else
+s_cabs(double re, double im)
+#endif
+{
+	double hi, lo, t;
+	int m;
+
+	re = re < 0 ? -re : re;
+	im = im < 0 ? -im : im;
+	m = im > re;
+	hi = m ? im : re;
+	lo = m ? re : im;
+	t = lo/hi;
+	t = hi*sqrt(1.0 + t*t);
+	return hi + lo == hi ? hi : t;
+	}
+
+/* Smith's method, as in z_div.c.  With s = |b.r| <= |b.i|, p is the */
+/* larger and q the smaller part of b.  The numerators are a.r*ratio */
+/* + a.i and a.i*ratio - a.r (s) or a.r + a.i*ratio and a.i -        */
+/* a.r*ratio (!s); the operands of each + and - are selected rather  */
+/* than the sums, so the operations (and hence the NaN that one of   */
+/* them may return) are those of z_div.c.  If b == 0, the result is  */
+/* that of -DIEEE_COMPLEX_DIVIDE: (a != 0 ? 1 : |b.i|) / |b.r|.      */
+
+ static int
+#ifdef KR_headers
+s_div(c, a, b) doublecomplex *c, *a, *b;
+#else
+s_div(doublecomplex *c, doublecomplex *a, doublecomplex *b)
+#endif
+{
+	double abi, abr, ar, ai, br, bi, den, p, pi, pr, q, ratio, v, w, x, y;
+	int s, z;
+
+	ar = a->r;
+	ai = a->i;
+	br = b->r;
+	bi = b->i;
+	abr = br < 0. ? -br : br;
+	abi = bi < 0. ? -bi : bi;
+	s = abr <= abi;
+	z = s & (abi == 0);
+	p = s ? bi : br;
+	q = s ? br : bi;
+	ratio = q / p;
+	den = p * (1 + ratio*ratio);
+	pr = ar*ratio;
+	pi = ai*ratio;
+	x = s ? pr : ar;
+	y = s ? ai : pi;
+	w = s ? pi : ai;
+	v = s ? ar : pr;
+	x = x + y;
+	w = w - v;
+	p = ai != 0 || ar != 0 ? 1. : abi;
+	x = z ? p : x;
+	w = z ? p : w;
+	den = z ? abr : den;
+	c->r = x / den;
+	c->i = w / den;
+	return z;
+	}
+
+/* z_sqrt, as in z_sqrt.c */
+
+ static void
+#ifdef KR_headers
+s_sqrt(r, z) doublecomplex *r, *z;
+#else
+s_sqrt(doublecomplex *r, doublecomplex *z)
+#endif
+{
+	double big, mag, q, sb, u, zi = z->i, zr = z->r;
+	int pos;
+
+	mag = s_cabs(zr, zi);
+	pos = zr > 0;
+	u = pos ? mag + zr : mag - zr;
+	big = sqrt(0.5 * u);
+	sb = !pos && zi < 0 ? -big : big;
+	q = zi / sb / 2;
+	r->r = mag == 0. ? 0. : pos ? big : q;
+	r->i = mag == 0. ? 0. : pos ? q : sb;
+	}
+
+ void
+#ifdef KR_headers
+z_vdiv(n, c, a, b) integer n; doublecomplex *c, *a, *b;
+#else
+z_vdiv(integer n, doublecomplex *c, doublecomplex *a, doublecomplex *b)
+#endif
+{
+	integer k = 0;
+	int zero = 0;
+#ifdef Z_SSE2
+	__m128d abi, abr, ai, ar, bi, br, den, m, p, pi, pr, q, ratio, s;
+	__m128d w, x;
+	__m128d one = _mm_set1_pd(1.), vzero = _mm_setzero_pd();
+	__m128d t, z;
+
+	for(; k + 2 <= n; k += 2) {
+		Vload(a + k, ar, ai);
+		Vload(b + k, br, bi);
+		abr = Vsel(_mm_cmplt_pd(br, vzero), Vneg(br), br);
+		abi = Vsel(_mm_cmplt_pd(bi, vzero), Vneg(bi), bi);
+		s = _mm_cmple_pd(abr, abi);
+		z = _mm_and_pd(s, _mm_cmpeq_pd(abi, vzero));
+		p = Vsel(s, bi, br);
+		q = Vsel(s, br, bi);
+		ratio = _mm_div_pd(q, p);
+		den = _mm_mul_pd(p, _mm_add_pd(one, _mm_mul_pd(ratio, ratio)));
+		pr = _mm_mul_pd(ar, ratio);
+		pi = _mm_mul_pd(ai, ratio);
+		x = _mm_add_pd(Vsel(s, pr, ar), Vsel(s, ai, pi));
+		w = _mm_sub_pd(Vsel(s, pi, ai), Vsel(s, ar, pr));
+		/* b == 0: numerators (a != 0 ? 1 : |b.i|), denominator |b.r| */
+		m = _mm_or_pd(_mm_cmpneq_pd(ar, vzero),
+			_mm_cmpneq_pd(ai, vzero));
+		t = Vsel(m, one, abi);
+		x = Vsel(z, t, x);
+		w = Vsel(z, t, w);
+		den = Vsel(z, abr, den);
+		x = _mm_div_pd(x, den);
+		w = _mm_div_pd(w, den);
+		Vstore(c + k, x, w);
+		zero |= _mm_movemask_pd(z);
+		}
+#endif
+	for(; k < n; k++)
+		zero |= s_div(c + k, a + k, b + k);
+#ifndef IEEE_COMPLEX_DIVIDE
+	if (zero)
+		sig_die("complex division by zero", 1);
+#endif
+	}
+
+ void
+#ifdef KR_headers
+z_vabs(n, d, z) integer n; doublereal *d; doublecomplex *z;
+#else
+z_vabs(integer n, doublereal *d, doublecomplex *z)
+#endif
+{
+	integer k = 0;
+#ifdef Z_SSE2
+	__m128d re, im;
+
+	for(; k + 2 <= n; k += 2) {
+		Vload(z + k, re, im);
+		_mm_storeu_pd(d + k, v_cabs(re, im));
+		}
+#endif
+	for(; k < n; k++)
+		d[k] = s_cabs(z[k].r, z[k].i);
+	}
+
+ void
+#ifdef KR_headers
+z_vsqrt(n, r, z) integer n; doublecomplex *r, *z;
+#else
+z_vsqrt(integer n, doublecomplex *r, doublecomplex *z)
+#endif
+{
+	integer k = 0;
+#ifdef Z_SSE2
+	__m128d big, mag, nz, pos, q, sb, zi, zr;
+	__m128d vzero = _mm_setzero_pd();
+
+	for(; k + 2 <= n; k += 2) {
+		Vload(z + k, zr, zi);
+		mag = v_cabs(zr, zi);
+		pos = _mm_cmpgt_pd(zr, vzero);
+		big = _mm_sqrt_pd(_mm_mul_pd(_mm_set1_pd(0.5), Vsel(pos,
+			_mm_add_pd(mag, zr), _mm_sub_pd(mag, zr))));
+		sb = Vsel(_mm_andnot_pd(pos, _mm_cmplt_pd(zi, vzero)),
+			Vneg(big), big);
+		q = _mm_div_pd(_mm_div_pd(zi, sb), _mm_set1_pd(2.));
+		nz = _mm_cmpneq_pd(mag, vzero);
+		zr = _mm_and_pd(nz, Vsel(pos, big, q));
+		zi = _mm_and_pd(nz, Vsel(pos, q, sb));
+		Vstore(r + k, zr, zi);
+		}
+#endif
+	for(; k < n; k++)
+		s_sqrt(r + k, z + k);
+	}
+
+/* No vector forms of exp, log, sin and cos are at hand, so the */
+/* rest just call the scalar routines. */
+
+ void
+#ifdef KR_headers
+z_vexp(n, r, z) integer n; doublecomplex *r, *z;
+#else
+z_vexp(integer n, doublecomplex *r, doublecomplex *z)
+#endif
+{
+	integer k;
+
+	for(k = 0; k < n; k++)
+		z_exp(r + k, z + k);
+	}
+
+ void
+#ifdef KR_headers
+z_vlog(n, r, z) integer n; doublecomplex *r, *z;
+#else
+z_vlog(integer n, doublecomplex *r, doublecomplex *z)
+#endif
+{
+	integer k;
+
+	for(k = 0; k < n; k++)
+		z_log(r + k, z + k);
+	}
+
+ void
+#ifdef KR_headers
+pow_vzz(n, r, a, b) integer n; doublecomplex *r, *a, *b;
+#else
+pow_vzz(integer n, doublecomplex *r, doublecomplex *a, doublecomplex *b)
+#endif
+{
+	integer k;
+
+	for(k = 0; k < n; k++)
+		pow_zz(r + k, a + k, b + k);
+	}
+#ifdef __cplusplus
+}
+#endif
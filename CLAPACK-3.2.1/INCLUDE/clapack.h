@@ -2059,6 +2059,8 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	integer *ldvt, doublereal *u, integer *ldu, doublereal *c__, integer *
 	ldc, doublereal *work, integer *info);
 
+/* Subroutine */ int dcombssq_(doublereal *v1, doublereal *v2);
+
 /* Subroutine */ int ddisna_(char *job, integer *m, integer *n, doublereal *
 	d__, doublereal *sep, integer *info);
 
@@ -2138,6 +2140,10 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	lda, doublereal *d__, doublereal *e, doublereal *tauq, doublereal *
 	taup, doublereal *work, integer *info);
 
+/* Subroutine */ int dgebnd_(integer *m, integer *n, integer *nb, 
+	doublereal *a, integer *lda, doublereal *tauq, doublereal *taup, 
+	doublereal *work, integer *lwork, integer *info);
+
 /* Subroutine */ int dgebrd_(integer *m, integer *n, doublereal *a, integer *
 	lda, doublereal *d__, doublereal *e, doublereal *tauq, doublereal *
 	taup, doublereal *work, integer *lwork, integer *info);
@@ -2146,6 +2152,10 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	lda, doublereal *anorm, doublereal *rcond, doublereal *work, integer *
 	iwork, integer *info);
 
+/* Subroutine */ int dgeconb_(char *norm, integer *n, doublereal *a, integer *
+	lda, doublereal *anorm, doublereal *rcond, doublereal *work, integer *
+	iwork, integer *info);
+
 /* Subroutine */ int dgeequ_(integer *m, integer *n, doublereal *a, integer *
 	lda, doublereal *r__, doublereal *c__, doublereal *rowcnd, doublereal 
 	*colcnd, doublereal *amax, integer *info);
@@ -2203,6 +2213,9 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	doublereal *v, integer *ldv, doublereal *work, integer *lwork, 
 	integer *iwork, integer *info);
 
+/* Subroutine */ int dgeldet_(char *fact, integer *n, doublereal *a, integer *
+	lda, integer *ipiv, doublereal *sgn, doublereal *logdet, integer *info);
+
 /* Subroutine */ int dgelq2_(integer *m, integer *n, doublereal *a, integer *
 	lda, doublereal *tau, doublereal *work, integer *info);
 
@@ -2218,6 +2231,21 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	s, doublereal *rcond, integer *rank, doublereal *work, integer *lwork, 
 	 integer *iwork, integer *info);
 
+/* Subroutine */ int dgelsdf_(integer *m, integer *n, doublereal *a, integer 
+	*lda, doublereal *rcond, integer *rank, doublereal *tau, doublereal *
+	s, doublereal *u, integer *ldu, doublereal *vt, integer *ldvt, 
+	doublereal *work, integer *lwork, integer *iwork, integer *info);
+
+/* Subroutine */ int dgelsds_(integer *m, integer *n, integer *nrhs, 
+	doublereal *a, integer *lda, integer *rank, doublereal *tau, 
+	doublereal *s, doublereal *u, integer *ldu, doublereal *vt, integer *
+	ldvt, doublereal *b, integer *ldb, doublereal *work, integer *lwork, 
+	integer *info);
+
+/* Subroutine */ int dgelsqs_(char *trans, integer *m, integer *n, integer *
+	nrhs, doublereal *a, integer *lda, doublereal *tau, doublereal *b, 
+	integer *ldb, doublereal *work, integer *lwork, integer *info);
+
 /* Subroutine */ int dgelss_(integer *m, integer *n, integer *nrhs, 
 	doublereal *a, integer *lda, doublereal *b, integer *ldb, doublereal *
 	s, doublereal *rcond, integer *rank, doublereal *work, integer *lwork, 
@@ -2233,6 +2261,25 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	jpvt, doublereal *rcond, integer *rank, doublereal *work, integer *
 	lwork, integer *info);
 
+/* Subroutine */ int dgelsyf_(integer *m, integer *n, doublereal *a, integer 
+	*lda, integer *jpvt, doublereal *rcond, integer *rank, doublereal *
+	tau, doublereal *work, integer *lwork, integer *info);
+
+/* Subroutine */ int dgelsys_(integer *m, integer *n, integer *nrhs, 
+	doublereal *a, integer *lda, integer *jpvt, integer *rank, 
+	doublereal *tau, doublereal *b, integer *ldb, doublereal *work, 
+	integer *lwork, integer *info);
+
+/* Subroutine */ int dgelyp_(char *fact, char *trana, integer *n, doublereal 
+	*a, integer *lda, doublereal *u, integer *ldu, doublereal *c__, 
+	integer *ldc, doublereal *scale, doublereal *wr, doublereal *wi, 
+	doublereal *work, integer *lwork, integer *info);
+
+/* Subroutine */ int dgephi_(char *fact, char *balanc, integer *n, integer *
+	p, doublereal *t, doublereal *a, integer *lda, doublereal *phi, 
+	integer *ldphi, doublereal *work, integer *lwork, integer *iwork, 
+	integer *info);
+
 /* Subroutine */ int dgeql2_(integer *m, integer *n, doublereal *a, integer *
 	lda, doublereal *tau, doublereal *work, integer *info);
 
@@ -2246,6 +2293,11 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 /* Subroutine */ int dgeqpf_(integer *m, integer *n, doublereal *a, integer *
 	lda, integer *jpvt, doublereal *tau, doublereal *work, integer *info);
 
+/* Subroutine */ int dgeqpr_(integer *m, integer *n, doublereal *a, integer *
+	lda, integer *jpvt, doublereal *tau, doublereal *tol, integer *rank, 
+	integer *iseed, doublereal *work, integer *lwork, integer *iwork, 
+	integer *info);
+
 /* Subroutine */ int dgeqr2_(integer *m, integer *n, doublereal *a, integer *
 	lda, doublereal *tau, doublereal *work, integer *info);
 
@@ -2280,6 +2332,16 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	doublereal *vt, integer *ldvt, doublereal *work, integer *lwork, 
 	integer *iwork, integer *info);
 
+/* Subroutine */ int dgesdd2_(char *jobz, integer *m, integer *n, 
+	doublereal *a, integer *lda, doublereal *s, doublereal *u, integer *
+	ldu, doublereal *vt, integer *ldvt, doublereal *work, integer *lwork, 
+	integer *iwork, integer *info);
+
+/* Subroutine */ int dgestn_(char *fact, char *trana, integer *n, doublereal 
+	*a, integer *lda, doublereal *u, integer *ldu, doublereal *c__, 
+	integer *ldc, doublereal *scale, doublereal *wr, doublereal *wi, 
+	doublereal *work, integer *lwork, integer *info);
+
 /* Subroutine */ int dgesv_(integer *n, integer *nrhs, doublereal *a, integer 
 	*lda, integer *ipiv, doublereal *b, integer *ldb, integer *info);
 
@@ -2293,6 +2355,17 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	 doublereal *v, integer *ldv, doublereal *work, integer *lwork, 
 	integer *info);
 
+/* Subroutine */ int dgesvdr_(char *jobz, integer *m, integer *n, integer *k, 
+	integer *p, integer *niter, doublereal *a, integer *lda, doublereal *
+	s, doublereal *u, integer *ldu, doublereal *vt, integer *ldvt, 
+	integer *iseed, doublereal *errest, doublereal *work, integer *lwork, 
+	integer *iwork, integer *info);
+
+/* Subroutine */ int dgesvjb_(char *jobu, char *jobv, integer *m, integer *n, 
+	integer *nb, doublereal *a, integer *lda, doublereal *sva, 
+	doublereal *v, integer *ldv, doublereal *work, integer *lwork, 
+	integer *info);
+
 /* Subroutine */ int dgesvx_(char *fact, char *trans, integer *n, integer *
 	nrhs, doublereal *a, integer *lda, doublereal *af, integer *ldaf, 
 	integer *ipiv, char *equed, doublereal *r__, doublereal *c__, 
@@ -2318,6 +2391,10 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 /* Subroutine */ int dgetrf_(integer *m, integer *n, doublereal *a, integer *
 	lda, integer *ipiv, integer *info);
 
+/* Subroutine */ int dgetrfc_(char *norm, integer *n, doublereal *a, 
+	integer *lda, integer *ipiv, doublereal *rcond, doublereal *work, 
+	integer *iwork, integer *info);
+
 /* Subroutine */ int dgetri_(integer *n, doublereal *a, integer *lda, integer 
 	*ipiv, doublereal *work, integer *lwork, integer *info);
 
@@ -2325,6 +2402,10 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	doublereal *a, integer *lda, integer *ipiv, doublereal *b, integer *
 	ldb, integer *info);
 
+/* Subroutine */ int dgexpm_(char *fact, char *balanc, integer *n, 
+	doublereal *t, doublereal *a, integer *lda, doublereal *e, integer *
+	lde, doublereal *work, integer *lwork, integer *iwork, integer *info);
+
 /* Subroutine */ int dggbak_(char *job, char *side, integer *n, integer *ilo, 
 	integer *ihi, doublereal *lscale, doublereal *rscale, integer *m, 
 	doublereal *v, integer *ldv, integer *info);
@@ -2413,6 +2494,11 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 	*sfmin, doublereal *tol, integer *nsweep, doublereal *work, integer *
 	lwork, integer *info);
 
+/* Subroutine */ int dgsvjb_(char *jobv, integer *m, integer *mv, integer *
+	n1, integer *n2, doublereal *a1, doublereal *a2, integer *lda, 
+	doublereal *v1, doublereal *v2, integer *ldv, doublereal *tol, 
+	doublereal *off, doublereal *work, integer *lwork, integer *info);
+
 /* Subroutine */ int dgtcon_(char *norm, integer *n, doublereal *dl, 
 	doublereal *d__, doublereal *du, doublereal *du2, integer *ipiv, 
 	doublereal *anorm, doublereal *rcond, doublereal *work, integer *
@@ -2466,6 +2552,12 @@ doublereal clantr_(char *norm, char *uplo, char *diag, integer *m, integer *n,
 
 logical disnan_(doublereal *din);
 
+/* Subroutine */ int dla_ddaxpy__(integer *n, doublereal *sh, doublereal *
+	sl, doublereal *x, doublereal *yh, doublereal *yl);
+
+/* Subroutine */ int dla_dddot__(integer *n, doublereal *x, doublereal *yh,
+	 doublereal *yl, doublereal *sh, doublereal *sl);
+
 /* Subroutine */ int dla_gbamv__(integer *trans, integer *m, integer *n, 
 	integer *kl, integer *ku, doublereal *alpha, doublereal *ab, integer *
 	ldab, doublereal *x, integer *incx, doublereal *beta, doublereal *y, 
@@ -2486,6 +2578,10 @@ doublereal dla_gbrcond__(char *trans, integer *n, integer *kl, integer *ku,
 	y_tail__, doublereal *rcond, integer *ithresh, doublereal *rthresh, 
 	doublereal *dz_ub__, logical *ignore_cwise__, integer *info);
 
+/* Subroutine */ int dla_gbresdd__(integer *trans, integer *n, integer *kl, 
+	integer *ku, doublereal *ab, integer *ldab, doublereal *y, doublereal 
+	*y_tail__, doublereal *r__, doublereal *w);
+
 doublereal dla_gbrpvgrw__(integer *n, integer *kl, integer *ku, integer *
 	ncols, doublereal *ab, integer *ldab, doublereal *afb, integer *ldafb);
 
@@ -2493,6 +2589,10 @@ doublereal dla_gbrpvgrw__(integer *n, integer *kl, integer *ku, integer *
 	doublereal *alpha, doublereal *a, integer *lda, doublereal *x, 
 	integer *incx, doublereal *beta, doublereal *y, integer *incy);
 
+/* Subroutine */ int dla_geresdd__(integer *trans, integer *n, doublereal *
+	a, integer *lda, doublereal *y, doublereal *y_tail__, doublereal *
+	r__, doublereal *w);
+
 doublereal dla_gercond__(char *trans, integer *n, doublereal *a, integer *lda,
 	 doublereal *af, integer *ldaf, integer *ipiv, integer *cmode, 
 	doublereal *c__, integer *info, doublereal *work, integer *iwork, 
@@ -2550,6 +2650,10 @@ doublereal dla_syrcond__(char *uplo, integer *n, doublereal *a, integer *lda,
 	*rthresh, doublereal *dz_ub__, logical *ignore_cwise__, integer *info,
 	 ftnlen uplo_len);
 
+/* Subroutine */ int dla_syresdd__(integer *uplo, integer *n, doublereal *a,
+	 integer *lda, doublereal *y, doublereal *y_tail__, doublereal *r__, 
+	doublereal *w);
+
 doublereal dla_syrpvgrw__(char *uplo, integer *n, integer *info, doublereal *
 	a, integer *lda, doublereal *af, integer *ldaf, integer *ipiv, 
 	doublereal *work, ftnlen uplo_len);
@@ -2564,6 +2668,11 @@ doublereal dla_syrpvgrw__(char *uplo, integer *n, integer *info, doublereal *
 	doublereal *taup, doublereal *x, integer *ldx, doublereal *y, integer 
 	*ldy);
 
+/* Subroutine */ int dlacn1_(integer *n, integer *t, doublereal *v, 
+	doublereal *x, integer *ldx, doublereal *xold, integer *ldxold, 
+	doublereal *h__, integer *ind, integer *indh, doublereal *est, 
+	integer *kase, integer *iseed, integer *isave);
+
 /* Subroutine */ int dlacn2_(integer *n, doublereal *v, doublereal *x, 
 	integer *isgn, doublereal *est, integer *kase, integer *isave);
 
@@ -2836,6 +2945,39 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 	ldv, doublereal *u, integer *ldu, integer *nv, doublereal *wv, 
 	integer *ldwv, integer *nh, doublereal *wh, integer *ldwh);
 
+/* Subroutine */ int dlaqz0_(char *wants, char *wantq, char *wantz, integer *
+	n, integer *ilo, integer *ihi, doublereal *a, integer *lda, 
+	doublereal *b, integer *ldb, doublereal *alphar, doublereal *alphai, 
+	doublereal *beta, doublereal *q, integer *ldq, doublereal *z__, 
+	integer *ldz, doublereal *work, integer *lwork, integer *rec, 
+	integer *info);
+
+/* Subroutine */ int dlaqz1_(doublereal *a, integer *lda, doublereal *b, 
+	integer *ldb, doublereal *sr1, doublereal *sr2, doublereal *si, 
+	doublereal *beta1, doublereal *beta2, doublereal *v);
+
+/* Subroutine */ int dlaqz2_(logical *ilq, logical *ilz, integer *k, 
+	integer *istartm, integer *istopm, integer *ihi, doublereal *a, 
+	integer *lda, doublereal *b, integer *ldb, integer *nq, integer *
+	qstart, doublereal *q, integer *ldq, integer *nz, integer *zstart, 
+	doublereal *z__, integer *ldz);
+
+/* Subroutine */ int dlaqz3_(logical *ilschur, logical *ilq, logical *ilz, 
+	integer *n, integer *ilo, integer *ihi, integer *nw, doublereal *a, 
+	integer *lda, doublereal *b, integer *ldb, doublereal *q, integer *
+	ldq, doublereal *z__, integer *ldz, integer *ns, integer *nd, 
+	doublereal *alphar, doublereal *alphai, doublereal *beta, doublereal *
+	qc, integer *ldqc, doublereal *zc, integer *ldzc, doublereal *work, 
+	integer *lwork, integer *rec, integer *info);
+
+/* Subroutine */ int dlaqz4_(logical *ilschur, logical *ilq, logical *ilz, 
+	integer *n, integer *ilo, integer *ihi, integer *nshifts, integer *
+	nblock_desired__, doublereal *sr, doublereal *si, doublereal *ss, 
+	doublereal *a, integer *lda, doublereal *b, integer *ldb, doublereal *
+	q, integer *ldq, doublereal *z__, integer *ldz, doublereal *qc, 
+	integer *ldqc, doublereal *zc, integer *ldzc, doublereal *work, 
+	integer *lwork, integer *info);
+
 /* Subroutine */ int dlaqsb_(char *uplo, integer *n, integer *kd, doublereal *
 	ab, integer *ldab, doublereal *s, doublereal *scond, doublereal *amax, 
 	 char *equed);
@@ -2948,6 +3090,8 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 /* Subroutine */ int dlarscl2_(integer *m, integer *n, doublereal *d__, 
 	doublereal *x, integer *ldx);
 
+/* Subroutine */ int dlarsk_(integer *iseed, integer *n);
+
 /* Subroutine */ int dlartg_(doublereal *f, doublereal *g, doublereal *cs, 
 	doublereal *sn, doublereal *r__);
 
@@ -3277,6 +3421,9 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 	nrhs, doublereal *ab, integer *ldab, doublereal *b, integer *ldb, 
 	integer *info);
 
+/* Subroutine */ int dpfsv_(char *transr, char *uplo, integer *n, integer *
+	nrhs, doublereal *a, doublereal *b, integer *ldb, integer *info);
+
 /* Subroutine */ int dpftrf_(char *transr, char *uplo, integer *n, doublereal 
 	*a, integer *info);
 
@@ -3296,6 +3443,9 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 /* Subroutine */ int dpoequb_(integer *n, doublereal *a, integer *lda, 
 	doublereal *s, doublereal *scond, doublereal *amax, integer *info);
 
+/* Subroutine */ int dpoldet_(char *fact, char *uplo, integer *n, doublereal *
+	a, integer *lda, doublereal *logdet, integer *info);
+
 /* Subroutine */ int dporfs_(char *uplo, integer *n, integer *nrhs, 
 	doublereal *a, integer *lda, doublereal *af, integer *ldaf, 
 	doublereal *b, integer *ldb, doublereal *x, integer *ldx, doublereal *
@@ -3355,6 +3505,10 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 /* Subroutine */ int dppsv_(char *uplo, integer *n, integer *nrhs, doublereal 
 	*ap, doublereal *b, integer *ldb, integer *info);
 
+/* Subroutine */ int dppsvf_(char *uplo, integer *n, integer *nrhs, 
+	doublereal *ap, doublereal *b, integer *ldb, integer *iwork, integer *
+	info);
+
 /* Subroutine */ int dppsvx_(char *fact, char *uplo, integer *n, integer *
 	nrhs, doublereal *ap, doublereal *afp, char *equed, doublereal *s, 
 	doublereal *b, integer *ldb, doublereal *x, integer *ldx, doublereal *
@@ -3710,6 +3864,9 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 /* Subroutine */ int dtfttp_(char *transr, char *uplo, integer *n, doublereal 
 	*arf, doublereal *ap, integer *info);
 
+/* Subroutine */ int dtfttpi_(char *transr, char *uplo, integer *n, 
+	doublereal *a, integer *iwork, integer *info);
+
 /* Subroutine */ int dtfttr_(char *transr, char *uplo, integer *n, doublereal 
 	*arf, doublereal *a, integer *lda, integer *info);
 
@@ -3782,6 +3939,9 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 /* Subroutine */ int dtpttf_(char *transr, char *uplo, integer *n, doublereal 
 	*ap, doublereal *arf, integer *info);
 
+/* Subroutine */ int dtpttfi_(char *transr, char *uplo, integer *n, 
+	doublereal *a, integer *iwork, integer *info);
+
 /* Subroutine */ int dtpttr_(char *uplo, integer *n, doublereal *ap, 
 	doublereal *a, integer *lda, integer *info);
 
@@ -3815,10 +3975,20 @@ doublereal dlapy3_(doublereal *x, doublereal *y, doublereal *z__);
 	integer *mm, integer *m, doublereal *work, integer *ldwork, integer *
 	iwork, integer *info);
 
+/* Subroutine */ int dtrstn_(char *trana, char *tranb, integer *m, integer *
+	n, doublereal *a, integer *lda, doublereal *b, integer *ldb, 
+	doublereal *c__, integer *ldc, doublereal *scale, doublereal *work, 
+	integer *info);
+
 /* Subroutine */ int dtrsyl_(char *trana, char *tranb, integer *isgn, integer 
 	*m, integer *n, doublereal *a, integer *lda, doublereal *b, integer *
 	ldb, doublereal *c__, integer *ldc, doublereal *scale, integer *info);
 
+/* Subroutine */ int dtrsylr_(char *trana, char *tranb, integer *isgn, 
+	integer *m, integer *n, doublereal *a, integer *lda, doublereal *b, 
+	integer *ldb, doublereal *c__, integer *ldc, doublereal *scale, 
+	integer *info);
+
 /* Subroutine */ int dtrti2_(char *uplo, char *diag, integer *n, doublereal *
 	a, integer *lda, integer *info);
 
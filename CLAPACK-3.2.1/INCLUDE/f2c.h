@@ -220,4 +220,12 @@ typedef doublereal E_f;	/* real function with -R not specified */
 #undef unix
 #undef vax
 #endif
+
+/* Compile with -DF2C_INLINE to expand the commonest intrinsics */
+/* (pow_di, d_sign, i_dnnt, s_copy, s_cmp, z_div, z_abs, ...) inline */
+/* rather than calling libf2c; see f2c_inline.h. */
+
+#ifdef F2C_INLINE
+#include "f2c_inline.h"
+#endif
 #endif
@@ -0,0 +1,48 @@
+/* f2c_alloc.h -- storage allocation in libf2c (see f77_aloc.c).
+
+   All storage that libf2c obtains (I/O buffers, file names, the
+   format and namelist caches, list-input character strings) and the
+   arrays that lawsp pools own come from F77_malloc and go back through
+   F77_free.  These call malloc and free unless F77_set_aloc has
+   installed another pair (a NULL argument restores the default); call
+   it before any other libf2c routine and not while other threads are
+   using the library.  F77_aloc is F77_malloc that prints a message and
+   stops the program on failure.
+
+   Short-lived temporaries, such as the copy s_cat makes when the
+   target of a concatenation appears on its right-hand side, come from
+   a bump arena (one per thread with -DF2C_THREADS):
+
+	ftnlen m = F77_amark();
+	char *t = F77_atmp(n, "me");	(n bytes, aligned for double)
+	...
+	F77_arelease(m);		(pops everything since F77_amark)
+
+   The arena keeps its chunks for reuse; F77_afree hands them back to
+   F77_free, e.g. before a thread exits.
+
+   Include after f2c.h.
+*/
+
+#ifndef F2C_ALLOC_H
+#define F2C_ALLOC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern void F77_set_aloc(char *(*aloc)(ftnlen), void (*fre)(char *));
+extern char *F77_malloc(ftnlen n);
+extern void F77_free(char *p);
+extern char *F77_aloc(integer n, const char *whence);
+
+extern ftnlen F77_amark(void);
+extern char *F77_atmp(ftnlen n, const char *whence);
+extern void F77_arelease(ftnlen mark);
+extern void F77_afree(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* F2C_ALLOC_H */
@@ -0,0 +1,316 @@
+/* f2c_inline.h -- inline versions of the libf2c intrinsics that
+ * translated LAPACK and BLAS routines call most often.
+ *
+ * Included by f2c.h when compiling with -DF2C_INLINE.  Each function
+ * here is a static definition with the same name and type as the
+ * declaration f2c writes in the routines' "Builtin functions" lists,
+ * which then refers to it rather than to libf2c, so no source needs
+ * editing.  The arithmetic is that of libf2c (same operations in the
+ * same order), so results agree bit for bit with the library; fabs,
+ * copysign, hypot or fma would differ for signed zeros, NaNs or in
+ * the last bit, and are not used.
+ *
+ * s_copy returns int, as in the f2c-generated declarations, rather
+ * than void as in libf2c.
+ *
+ * For whole arrays, libf2c's z_vdiv, z_vabs, z_vsqrt, ... (see
+ * f2c_vec.h) do the same operations two elements at a time.
+ */
+
+#ifndef F2C_INLINE_INCLUDE
+#define F2C_INLINE_INCLUDE
+
+#include <string.h>
+
+#ifndef F2C_INLINE_DECL
+#if defined(__GNUC__)
+#define F2C_INLINE_DECL static __inline__
+#elif defined(_MSC_VER)
+#define F2C_INLINE_DECL static __inline
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L
+#define F2C_INLINE_DECL static inline
+#else
+#define F2C_INLINE_DECL static
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern double sqrt(double), exp(double), cos(double), sin(double);
+extern void sig_die(const char*, int);
+
+/* x**n by repeated squaring, as in pow_di.c */
+
+F2C_INLINE_DECL double pow_di(doublereal *ap, integer *bp)
+{
+	double pow = 1, x = *ap;
+	integer n = *bp;
+	unsigned long u;
+
+	if (n != 0) {
+		if (n < 0) {
+			n = -n;
+			x = 1/x;
+			}
+		for(u = n; ; ) {
+			if (u & 01)
+				pow *= x;
+			if (u >>= 1)
+				x *= x;
+			else
+				break;
+			}
+		}
+	return pow;
+	}
+
+F2C_INLINE_DECL double pow_ri(real *ap, integer *bp)
+{
+	doublereal x = *ap;
+	return pow_di(&x, bp);
+	}
+
+F2C_INLINE_DECL integer pow_ii(integer *ap, integer *bp)
+{
+	integer pow, x = *ap, n = *bp;
+	unsigned long u;
+
+	if (n <= 0) {
+		if (n == 0 || x == 1)
+			return 1;
+		if (x != -1)
+			return x == 0 ? 1/x : 0;
+		n = -n;
+		}
+	u = n;
+	for(pow = 1; ; ) {
+		if (u & 01)
+			pow *= x;
+		if (u >>= 1)
+			x *= x;
+		else
+			break;
+		}
+	return pow;
+	}
+
+F2C_INLINE_DECL double d_sign(doublereal *a, doublereal *b)
+{
+	double x = *a >= 0 ? *a : - *a;
+	return *b >= 0 ? x : -x;
+	}
+
+F2C_INLINE_DECL double r_sign(real *a, real *b)
+{
+	double x = *a >= 0 ? *a : - *a;
+	return *b >= 0 ? x : -x;
+	}
+
+/* Nearest integer.  floor(y) is the integer part of y >= 0, so the */
+/* conversion alone does what i_dnnt.c does with floor. */
+
+F2C_INLINE_DECL integer i_dnnt(doublereal *x)
+{
+	return *x >= 0. ? (integer)(*x + .5) : -(integer)(.5 - *x);
+	}
+
+F2C_INLINE_DECL integer i_nint(real *x)
+{
+	return *x >= 0 ? (integer)(*x + .5) : -(integer)(.5 - *x);
+	}
+
+/* a = b, blank padded; overlapping a and b are allowed, as in s_copy.c */
+/* compiled without -DNO_OVERWRITE. */
+
+F2C_INLINE_DECL int s_copy(char *a, char *b, ftnlen la, ftnlen lb)
+{
+	if (la <= lb)
+		memmove(a, b, la);
+	else {
+		memmove(a, b, lb);
+		memset(a + lb, ' ', la - lb);
+		}
+	return 0;
+	}
+
+/* Compare a and b, the shorter one blank padded; the result is the */
+/* difference of the first unequal characters, as in s_cmp.c. */
+
+F2C_INLINE_DECL integer s_cmp(char *a0, char *b0, ftnlen la, ftnlen lb)
+{
+	unsigned char *a = (unsigned char *)a0, *b = (unsigned char *)b0;
+	ftnlen i, n = la <= lb ? la : lb;
+
+	for(i = 0; i < n; i++)
+		if (a[i] != b[i])
+			return a[i] - b[i];
+	for(; i < lb; i++)
+		if (b[i] != ' ')
+			return ' ' - b[i];
+	for(; i < la; i++)
+		if (a[i] != ' ')
+			return a[i] - ' ';
+	return 0;
+	}
+
+F2C_INLINE_DECL double d_imag(doublecomplex *z)
+{
+	return z->i;
+	}
+
+F2C_INLINE_DECL double r_imag(complex *z)
+{
+	return z->i;
+	}
+
+F2C_INLINE_DECL void d_cnjg(doublecomplex *r, doublecomplex *z)
+{
+	doublereal zi = z->i;
+	r->r = z->r;
+	r->i = -zi;
+	}
+
+F2C_INLINE_DECL void r_cnjg(complex *r, complex *z)
+{
+	real zi = z->i;
+	r->r = z->r;
+	r->i = -zi;
+	}
+
+/* |re + i*im| without undue overflow, as f__cabs in cabs.c */
+
+F2C_INLINE_DECL double f__cabs_inline(double re, double im)
+{
+	double t;
+
+	if (re < 0)
+		re = -re;
+	if (im < 0)
+		im = -im;
+	if (im > re) {
+		t = re;
+		re = im;
+		im = t;
+		}
+	if (re + im == re)
+		return re;
+	t = im/re;
+	return re*sqrt(1.0 + t*t);
+	}
+
+F2C_INLINE_DECL double z_abs(doublecomplex *z)
+{
+	return f__cabs_inline(z->r, z->i);
+	}
+
+F2C_INLINE_DECL double c_abs(complex *z)
+{
+	return f__cabs_inline(z->r, z->i);
+	}
+
+/* c = a/b by Smith's method, as in z_div.c and c_div.c */
+
+F2C_INLINE_DECL void z_div(doublecomplex *c, doublecomplex *a,
+	doublecomplex *b)
+{
+	double abr, abi, cr, den, ratio;
+
+	if ((abr = b->r) < 0.)
+		abr = - abr;
+	if ((abi = b->i) < 0.)
+		abi = - abi;
+	if (abr <= abi) {
+		if (abi == 0) {
+#ifdef IEEE_COMPLEX_DIVIDE
+			if (a->i != 0 || a->r != 0)
+				abi = 1.;
+			c->i = c->r = abi / abr;
+			return;
+#else
+			sig_die("complex division by zero", 1);
+#endif
+			}
+		ratio = b->r / b->i;
+		den = b->i * (1 + ratio*ratio);
+		cr = (a->r*ratio + a->i) / den;
+		c->i = (a->i*ratio - a->r) / den;
+		}
+	else {
+		ratio = b->i / b->r;
+		den = b->r * (1 + ratio*ratio);
+		cr = (a->r + a->i*ratio) / den;
+		c->i = (a->i - a->r*ratio) / den;
+		}
+	c->r = cr;
+	}
+
+F2C_INLINE_DECL void c_div(complex *c, complex *a, complex *b)
+{
+	double abr, abi, cr, den, ratio;
+
+	if ((abr = b->r) < 0.)
+		abr = - abr;
+	if ((abi = b->i) < 0.)
+		abi = - abi;
+	if (abr <= abi) {
+		if (abi == 0) {
+#ifdef IEEE_COMPLEX_DIVIDE
+			float af, bf;
+			af = bf = abr;
+			if (a->i != 0 || a->r != 0)
+				af = 1.;
+			c->i = c->r = af / bf;
+			return;
+#else
+			sig_die("complex division by zero", 1);
+#endif
+			}
+		ratio = (double)b->r / b->i;
+		den = b->i * (1 + ratio*ratio);
+		cr = (a->r*ratio + a->i) / den;
+		c->i = (a->i*ratio - a->r) / den;
+		}
+	else {
+		ratio = (double)b->i / b->r;
+		den = b->r * (1 + ratio*ratio);
+		cr = (a->r + a->i*ratio) / den;
+		c->i = (a->i - a->r*ratio) / den;
+		}
+	c->r = cr;
+	}
+
+/* as in z_sqrt.c */
+
+F2C_INLINE_DECL void z_sqrt(doublecomplex *r, doublecomplex *z)
+{
+	double mag, zi = z->i, zr = z->r;
+
+	if ((mag = f__cabs_inline(zr, zi)) == 0.)
+		r->r = r->i = 0.;
+	else if (zr > 0) {
+		r->r = sqrt(0.5 * (mag + zr));
+		r->i = zi / r->r / 2;
+		}
+	else {
+		r->i = sqrt(0.5 * (mag - zr));
+		if (zi < 0)
+			r->i = - r->i;
+		r->r = zi / r->i / 2;
+		}
+	}
+
+F2C_INLINE_DECL void z_exp(doublecomplex *r, doublecomplex *z)
+{
+	double expx, zi = z->i;
+
+	expx = exp(z->r);
+	r->r = expx * cos(zi);
+	r->i = expx * sin(zi);
+	}
+
+#ifdef __cplusplus
+	}
+#endif
+#endif /* F2C_INLINE_INCLUDE */
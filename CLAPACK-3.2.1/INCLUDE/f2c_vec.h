@@ -0,0 +1,50 @@
+/* f2c_vec.h -- array forms of the double complex intrinsics (see
+   z_vec.c in libf2c).
+
+	z_vdiv(n, c, a, b)	c[k] = a[k] / b[k]
+	z_vabs(n, d, z)		d[k] = |z[k]|	(d is doublereal)
+	z_vsqrt(n, r, z)	r[k] = sqrt(z[k])
+	z_vexp(n, r, z)		r[k] = exp(z[k])
+	z_vlog(n, r, z)		r[k] = log(z[k])
+	pow_vzz(n, r, a, b)	r[k] = a[k] ** b[k]
+
+   for k = 0, ..., n-1.  An output array may be the same as an input
+   array.  Each element gets the same result, bit for bit, as the
+   scalar routine (z_div, z_abs, ...) would give it, with one
+   exception: when two NaNs meet in one operation (e.g., a NaN input
+   and the NaN of Infinity/Infinity), the sign and payload of the NaN
+   returned depend on the order in which the compiler placed the
+   operands, in z_vec.c and in the scalar routine alike, so the two
+   may return NaNs that differ in sign.  z_vdiv, z_vabs and
+   z_vsqrt compute two elements at a time with SSE2 where available;
+   a zero divisor in z_vdiv gives the -DIEEE_COMPLEX_DIVIDE results
+   (+-Infinity or NaN), after which, as with z_div, libf2c compiled
+   without -DIEEE_COMPLEX_DIVIDE stops with "complex division by zero".
+
+   For single calls, f2c.h with -DF2C_INLINE expands z_div, z_abs,
+   z_sqrt and z_exp inline (see f2c_inline.h).
+
+   Include after f2c.h.
+*/
+
+#ifndef F2C_VEC_H
+#define F2C_VEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern void z_vdiv(integer n, doublecomplex *c, doublecomplex *a,
+	doublecomplex *b);
+extern void z_vabs(integer n, doublereal *d, doublecomplex *z);
+extern void z_vsqrt(integer n, doublecomplex *r, doublecomplex *z);
+extern void z_vexp(integer n, doublecomplex *r, doublecomplex *z);
+extern void z_vlog(integer n, doublecomplex *r, doublecomplex *z);
+extern void pow_vzz(integer n, doublecomplex *r, doublecomplex *a,
+	doublecomplex *b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* F2C_VEC_H */
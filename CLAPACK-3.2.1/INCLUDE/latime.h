@@ -0,0 +1,327 @@
+/* latime.h -- call counts, times and flop rates of LAPACK and BLAS calls.
+
+   Compile a program with -DLAPACK_TIMING and include this header after
+   f2c.h and clapack.h (or the program's own declarations, and after
+   blaswrap.h if that is used): its calls to the routines below then go
+   to latime_ wrappers that count each call, add its elapsed time and
+   an estimate of its floating-point operations to a per-routine entry,
+   and call the routine.  The library itself is unchanged, so calls made
+   inside LAPACK (to BLAS or other LAPACK routines) are not counted
+   separately: the time of a call includes all the work it does, and
+   the report adds up to the time the program spent in linear algebra.
+
+   A report sorted by time is printed on stderr at exit (unless
+   latime_atexit(0) was called); latime_report prints it on demand and
+   latime_reset clears the counts.  Workspace queries (LWORK = -1) are
+   not counted.  Flop counts are the usual operation counts of the
+   algorithms (complex operations as four real ones); routines whose
+   count depends on convergence (eigenvalue and SVD drivers) get none.
+
+   Other sections of a program can be timed the same way:
+
+	static latime_ent e = LATIME_ENT("MYSTEP");
+	doublereal t = latime_now();
+	...
+	latime_end(&e, t, flops);
+
+   The entries are not locked: time calls from one thread at a time.
+*/
+
+#ifndef LATIME_H
+#define LATIME_H
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct latime_ent {
+	const char *name;
+	struct latime_ent *next;	/* entries seen so far */
+	int listed;			/* on that list */
+	long calls;
+	doublereal secs, flops;
+} latime_ent;
+
+#define LATIME_ENT(name) { name, 0, 0, 0L, 0., 0. }
+
+extern doublereal latime_now(void);
+extern void latime_end(latime_ent *e, doublereal t0, doublereal flops);
+extern void latime_report(FILE *f);
+extern void latime_reset(void);
+extern void latime_atexit(int on);
+
+/* Operation counts used by the wrappers: an LU factorization of an
+   m-by-n matrix (half that of QR), and a triangular product or solve
+   with an m-by-n B (side "L" or "R"). */
+
+extern doublereal latime_lu(integer m, integer n);
+extern doublereal latime_tr(char *side, integer m, integer n);
+
+extern int latime_dgemm(char *transa, char *transb, integer *m, integer *n,
+	integer *k, doublereal *alpha, doublereal *a, integer *lda,
+	doublereal *b, integer *ldb, doublereal *beta, doublereal *c__,
+	integer *ldc);
+extern int latime_dsymm(char *side, char *uplo, integer *m, integer *n,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *beta, doublereal *c__, integer *ldc);
+extern int latime_dsyrk(char *uplo, char *trans, integer *n, integer *k,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *beta,
+	doublereal *c__, integer *ldc);
+extern int latime_dsyr2k(char *uplo, char *trans, integer *n, integer *k,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *beta, doublereal *c__, integer *ldc);
+extern int latime_dtrmm(char *side, char *uplo, char *transa, char *diag,
+	integer *m, integer *n, doublereal *alpha, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb);
+extern int latime_dtrsm(char *side, char *uplo, char *transa, char *diag,
+	integer *m, integer *n, doublereal *alpha, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb);
+extern int latime_dgemv(char *trans, integer *m, integer *n,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *x,
+	integer *incx, doublereal *beta, doublereal *y, integer *incy);
+extern int latime_dger(integer *m, integer *n, doublereal *alpha,
+	doublereal *x, integer *incx, doublereal *y, integer *incy,
+	doublereal *a, integer *lda);
+extern int latime_dtrsv(char *uplo, char *trans, char *diag, integer *n,
+	doublereal *a, integer *lda, doublereal *x, integer *incx);
+extern int latime_dsymv(char *uplo, integer *n, doublereal *alpha,
+	doublereal *a, integer *lda, doublereal *x, integer *incx,
+	doublereal *beta, doublereal *y, integer *incy);
+extern int latime_dgesv(integer *n, integer *nrhs, doublereal *a,
+	integer *lda, integer *ipiv, doublereal *b, integer *ldb,
+	integer *info);
+extern int latime_dgetrf(integer *m, integer *n, doublereal *a,
+	integer *lda, integer *ipiv, integer *info);
+extern int latime_dgetrs(char *trans, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, integer *ipiv, doublereal *b,
+	integer *ldb, integer *info);
+extern int latime_dgetri(integer *n, doublereal *a, integer *lda,
+	integer *ipiv, doublereal *work, integer *lwork, integer *info);
+extern int latime_dposv(char *uplo, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	integer *info);
+extern int latime_dpotrf(char *uplo, integer *n, doublereal *a,
+	integer *lda, integer *info);
+extern int latime_dpotrs(char *uplo, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	integer *info);
+extern int latime_dpotri(char *uplo, integer *n, doublereal *a,
+	integer *lda, integer *info);
+extern int latime_dtrtri(char *uplo, char *diag, integer *n, doublereal *a,
+	integer *lda, integer *info);
+extern int latime_dsysv(char *uplo, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, integer *ipiv, doublereal *b,
+	integer *ldb, doublereal *work, integer *lwork, integer *info);
+extern int latime_dsytrf(char *uplo, integer *n, doublereal *a,
+	integer *lda, integer *ipiv, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_dgeqrf(integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_dgelqf(integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_dorgqr(integer *m, integer *n, integer *k, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_dormqr(char *side, char *trans, integer *m, integer *n,
+	integer *k, doublereal *a, integer *lda, doublereal *tau,
+	doublereal *c__, integer *ldc, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_dgels(char *trans, integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *work, integer *lwork, integer *info);
+extern int latime_dgelsd(integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *s, doublereal *rcond, integer *rank, doublereal *work,
+	integer *lwork, integer *iwork, integer *info);
+extern int latime_dsytrd(char *uplo, integer *n, doublereal *a,
+	integer *lda, doublereal *d__, doublereal *e, doublereal *tau,
+	doublereal *work, integer *lwork, integer *info);
+extern int latime_dgehrd(integer *n, integer *ilo, integer *ihi,
+	doublereal *a, integer *lda, doublereal *tau, doublereal *work,
+	integer *lwork, integer *info);
+extern int latime_dgebrd(integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *d__, doublereal *e, doublereal *tauq,
+	doublereal *taup, doublereal *work, integer *lwork, integer *info);
+extern int latime_dsyev(char *jobz, char *uplo, integer *n, doublereal *a,
+	integer *lda, doublereal *w, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_dsyevd(char *jobz, char *uplo, integer *n, doublereal *a,
+	integer *lda, doublereal *w, doublereal *work, integer *lwork,
+	integer *iwork, integer *liwork, integer *info);
+extern int latime_dsyevr(char *jobz, char *range, char *uplo, integer *n,
+	doublereal *a, integer *lda, doublereal *vl, doublereal *vu,
+	integer *il, integer *iu, doublereal *abstol, integer *m,
+	doublereal *w, doublereal *z__, integer *ldz, integer *isuppz,
+	doublereal *work, integer *lwork, integer *iwork, integer *liwork,
+	integer *info);
+extern int latime_dgesvd(char *jobu, char *jobvt, integer *m, integer *n,
+	doublereal *a, integer *lda, doublereal *s, doublereal *u,
+	integer *ldu, doublereal *vt, integer *ldvt, doublereal *work,
+	integer *lwork, integer *info);
+extern int latime_dgesdd(char *jobz, integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *s, doublereal *u, integer *ldu,
+	doublereal *vt, integer *ldvt, doublereal *work, integer *lwork,
+	integer *iwork, integer *info);
+extern int latime_dgeev(char *jobvl, char *jobvr, integer *n, doublereal *a,
+	integer *lda, doublereal *wr, doublereal *wi, doublereal *vl,
+	integer *ldvl, doublereal *vr, integer *ldvr, doublereal *work,
+	integer *lwork, integer *info);
+extern int latime_dggev(char *jobvl, char *jobvr, integer *n, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, doublereal *alphar,
+	doublereal *alphai, doublereal *beta, doublereal *vl, integer *ldvl,
+	doublereal *vr, integer *ldvr, doublereal *work, integer *lwork,
+	integer *info);
+extern int latime_zgemm(char *transa, char *transb, integer *m, integer *n,
+	integer *k, doublecomplex *alpha, doublecomplex *a, integer *lda,
+	doublecomplex *b, integer *ldb, doublecomplex *beta,
+	doublecomplex *c__, integer *ldc);
+extern int latime_zherk(char *uplo, char *trans, integer *n, integer *k,
+	doublereal *alpha, doublecomplex *a, integer *lda, doublereal *beta,
+	doublecomplex *c__, integer *ldc);
+extern int latime_ztrsm(char *side, char *uplo, char *transa, char *diag,
+	integer *m, integer *n, doublecomplex *alpha, doublecomplex *a,
+	integer *lda, doublecomplex *b, integer *ldb);
+extern int latime_zgemv(char *trans, integer *m, integer *n,
+	doublecomplex *alpha, doublecomplex *a, integer *lda,
+	doublecomplex *x, integer *incx, doublecomplex *beta,
+	doublecomplex *y, integer *incy);
+extern int latime_zgesv(integer *n, integer *nrhs, doublecomplex *a,
+	integer *lda, integer *ipiv, doublecomplex *b, integer *ldb,
+	integer *info);
+extern int latime_zgetrf(integer *m, integer *n, doublecomplex *a,
+	integer *lda, integer *ipiv, integer *info);
+extern int latime_zgetrs(char *trans, integer *n, integer *nrhs,
+	doublecomplex *a, integer *lda, integer *ipiv, doublecomplex *b,
+	integer *ldb, integer *info);
+extern int latime_zposv(char *uplo, integer *n, integer *nrhs,
+	doublecomplex *a, integer *lda, doublecomplex *b, integer *ldb,
+	integer *info);
+extern int latime_zpotrf(char *uplo, integer *n, doublecomplex *a,
+	integer *lda, integer *info);
+extern int latime_zgeqrf(integer *m, integer *n, doublecomplex *a,
+	integer *lda, doublecomplex *tau, doublecomplex *work,
+	integer *lwork, integer *info);
+extern int latime_zheev(char *jobz, char *uplo, integer *n,
+	doublecomplex *a, integer *lda, doublereal *w, doublecomplex *work,
+	integer *lwork, doublereal *rwork, integer *info);
+extern int latime_zgesvd(char *jobu, char *jobvt, integer *m, integer *n,
+	doublecomplex *a, integer *lda, doublereal *s, doublecomplex *u,
+	integer *ldu, doublecomplex *vt, integer *ldvt, doublecomplex *work,
+	integer *lwork, doublereal *rwork, integer *info);
+extern int latime_zgeev(char *jobvl, char *jobvr, integer *n,
+	doublecomplex *a, integer *lda, doublecomplex *w, doublecomplex *vl,
+	integer *ldvl, doublecomplex *vr, integer *ldvr,
+	doublecomplex *work, integer *lwork, doublereal *rwork,
+	integer *info);
+
+#ifdef LAPACK_TIMING
+#undef dgemm_
+#define dgemm_ latime_dgemm
+#undef dsymm_
+#define dsymm_ latime_dsymm
+#undef dsyrk_
+#define dsyrk_ latime_dsyrk
+#undef dsyr2k_
+#define dsyr2k_ latime_dsyr2k
+#undef dtrmm_
+#define dtrmm_ latime_dtrmm
+#undef dtrsm_
+#define dtrsm_ latime_dtrsm
+#undef dgemv_
+#define dgemv_ latime_dgemv
+#undef dger_
+#define dger_ latime_dger
+#undef dtrsv_
+#define dtrsv_ latime_dtrsv
+#undef dsymv_
+#define dsymv_ latime_dsymv
+#undef zgemm_
+#define zgemm_ latime_zgemm
+#undef zherk_
+#define zherk_ latime_zherk
+#undef ztrsm_
+#define ztrsm_ latime_ztrsm
+#undef zgemv_
+#define zgemv_ latime_zgemv
+#undef dgesv_
+#define dgesv_ latime_dgesv
+#undef dgetrf_
+#define dgetrf_ latime_dgetrf
+#undef dgetrs_
+#define dgetrs_ latime_dgetrs
+#undef dgetri_
+#define dgetri_ latime_dgetri
+#undef dposv_
+#define dposv_ latime_dposv
+#undef dpotrf_
+#define dpotrf_ latime_dpotrf
+#undef dpotrs_
+#define dpotrs_ latime_dpotrs
+#undef dpotri_
+#define dpotri_ latime_dpotri
+#undef dtrtri_
+#define dtrtri_ latime_dtrtri
+#undef dsysv_
+#define dsysv_ latime_dsysv
+#undef dsytrf_
+#define dsytrf_ latime_dsytrf
+#undef dgeqrf_
+#define dgeqrf_ latime_dgeqrf
+#undef dgelqf_
+#define dgelqf_ latime_dgelqf
+#undef dorgqr_
+#define dorgqr_ latime_dorgqr
+#undef dormqr_
+#define dormqr_ latime_dormqr
+#undef dgels_
+#define dgels_ latime_dgels
+#undef dgelsd_
+#define dgelsd_ latime_dgelsd
+#undef dsytrd_
+#define dsytrd_ latime_dsytrd
+#undef dgehrd_
+#define dgehrd_ latime_dgehrd
+#undef dgebrd_
+#define dgebrd_ latime_dgebrd
+#undef dsyev_
+#define dsyev_ latime_dsyev
+#undef dsyevd_
+#define dsyevd_ latime_dsyevd
+#undef dsyevr_
+#define dsyevr_ latime_dsyevr
+#undef dgesvd_
+#define dgesvd_ latime_dgesvd
+#undef dgesdd_
+#define dgesdd_ latime_dgesdd
+#undef dgeev_
+#define dgeev_ latime_dgeev
+#undef dggev_
+#define dggev_ latime_dggev
+#undef zgesv_
+#define zgesv_ latime_zgesv
+#undef zgetrf_
+#define zgetrf_ latime_zgetrf
+#undef zgetrs_
+#define zgetrs_ latime_zgetrs
+#undef zposv_
+#define zposv_ latime_zposv
+#undef zpotrf_
+#define zpotrf_ latime_zpotrf
+#undef zgeqrf_
+#define zgeqrf_ latime_zgeqrf
+#undef zheev_
+#define zheev_ latime_zheev
+#undef zgesvd_
+#define zgesvd_ latime_zgesvd
+#undef zgeev_
+#define zgeev_ latime_zgeev
+#endif /* LAPACK_TIMING */
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* LATIME_H */
@@ -0,0 +1,76 @@
+/* lawsp.h -- reusable workspace pools for the LAPACK drivers.
+
+   A pool is created once and handed to the lawsp_ driver entry points,
+   which take the arguments of the corresponding LAPACK driver minus
+   WORK, LWORK, IWORK and LIWORK.  The optimal LWORK (and LIWORK) of a
+   driver is computed by a workspace query the first time a given
+   (routine, job, m, n, k) shape is seen and cached in the pool, so
+   repeated calls with the same shape make no query and no allocation.
+
+   A pool either wraps caller-provided arrays (it never allocates and a
+   call that needs more workspace fails with the LWORK/LIWORK error of
+   the driver), or, for an array passed as NULL, owns an arena that
+   grows on demand and is released by lawsp_destroy.  A pool is not
+   locked: use one pool per thread.
+
+   Include after f2c.h.
+*/
+
+#ifndef LAWSP_H
+#define LAWSP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define LAWSP_NCACHE 16
+
+typedef struct {
+	char name[8];		/* routine name, upper case */
+	char job[4];		/* job/option characters, upper case */
+	integer m, n, k;	/* problem dimensions */
+	integer lwork, liwork;	/* cached optimal workspace sizes */
+} lawsp_entry;
+
+typedef struct {
+	doublereal *work;	/* double precision workspace */
+	integer lwork;
+	integer *iwork;		/* integer workspace */
+	integer liwork;
+	int ownw, owni;		/* WORK/IWORK belong to the pool and may grow */
+	int nent, next;		/* cache fill and replacement position */
+	lawsp_entry ent[LAWSP_NCACHE];
+	integer nquery;		/* number of workspace queries performed */
+} lawsp;
+
+extern lawsp *lawsp_create(doublereal *work, integer lwork, integer *iwork,
+	integer liwork);
+extern void lawsp_destroy(lawsp *ws);
+
+extern integer lawsp_lookup(lawsp *ws, char *name, char *job, integer m,
+	integer n, integer k, integer *liwork);
+extern void lawsp_store(lawsp *ws, char *name, char *job, integer m,
+	integer n, integer k, integer lwork, integer liwork);
+extern doublereal *lawsp_work(lawsp *ws, integer lwork);
+extern integer *lawsp_iwork(lawsp *ws, integer liwork);
+
+extern int lawsp_dgeev(lawsp *ws, char *jobvl, char *jobvr, integer *n,
+	doublereal *a, integer *lda, doublereal *wr, doublereal *wi,
+	doublereal *vl, integer *ldvl, doublereal *vr, integer *ldvr,
+	integer *info);
+extern int lawsp_dgesdd(lawsp *ws, char *jobz, integer *m, integer *n,
+	doublereal *a, integer *lda, doublereal *s, doublereal *u,
+	integer *ldu, doublereal *vt, integer *ldvt, integer *info);
+extern int lawsp_dsyevr(lawsp *ws, char *jobz, char *range, char *uplo,
+	integer *n, doublereal *a, integer *lda, doublereal *vl,
+	doublereal *vu, integer *il, integer *iu, doublereal *abstol,
+	integer *m, doublereal *w, doublereal *z__, integer *ldz,
+	integer *isuppz, integer *info);
+extern int lawsp_dgelsd(lawsp *ws, integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *s, doublereal *rcond, integer *rank, integer *info);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* LAWSP_H */
@@ -7,9 +7,27 @@
 #define CLK_TCK 60
 #endif
 
+/* CPU time of the process, in seconds.  Where clock_gettime has a
+   CPU-time clock it is used (nanosecond resolution, user plus system
+   time); otherwise times() (user time, in clock ticks).  Compile with
+   -DSECOND_CLOCK=CLOCK_THREAD_CPUTIME_ID for the CPU time of the
+   calling thread, or -DSECOND_CLOCK=CLOCK_MONOTONIC for elapsed time. */
+
+#ifndef SECOND_CLOCK
+#ifdef CLOCK_PROCESS_CPUTIME_ID
+#define SECOND_CLOCK CLOCK_PROCESS_CPUTIME_ID
+#endif
+#endif
+
 doublereal second_()
 {
   struct tms rusage;
+#ifdef SECOND_CLOCK
+  struct timespec ts;
+
+  if (clock_gettime(SECOND_CLOCK, &ts) == 0)
+    return (doublereal)ts.tv_sec + 1e-9 * (doublereal)ts.tv_nsec;
+#endif
 
   times(&rusage);
   return (doublereal)(rusage.tms_utime) / CLK_TCK;
@@ -0,0 +1,66 @@
+/* dcombssq.c -- DCOMBSSQ, combine two scaled sums of squares. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dcombssq_(doublereal *v1, doublereal *v2)
+{
+    /* System generated locals */
+    doublereal d__1;
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DCOMBSSQ adds two scaled sum of squares quantities, V1 := V1 + V2. */
+/*  That is, */
+
+/*     V1_scale**2 * V1_sumsq := V1_scale**2 * V1_sumsq */
+/*                             + V2_scale**2 * V2_sumsq */
+
+/*  Arguments */
+/*  ========= */
+
+/*  V1      (input/output) DOUBLE PRECISION array, dimension (2). */
+/*          The first scaled sum. */
+/*          V1(1) = V1_scale, V1(2) = V1_sumsq. */
+
+/*  V2      (input) DOUBLE PRECISION array, dimension (2). */
+/*          The second scaled sum. */
+/*          V2(1) = V2_scale, V2(2) = V2_sumsq. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --v2;
+    --v1;
+
+    /* Function Body */
+    if (v1[1] >= v2[1]) {
+	if (v1[1] != 0.) {
+/* Computing 2nd power */
+	    d__1 = v2[1] / v1[1];
+	    v1[2] += d__1 * d__1 * v2[2];
+	} else {
+	    v1[2] += v2[2];
+	}
+    } else {
+/* Computing 2nd power */
+	d__1 = v1[1] / v2[1];
+	v1[2] = v2[2] + d__1 * d__1 * v1[2];
+	v1[1] = v2[1];
+    }
+    return 0;
+
+/*     End of DCOMBSSQ */
+
+} /* dcombssq_ */
@@ -0,0 +1,227 @@
+/* dgebnd.c -- DGEBND, Level 3 reduction of a general matrix to upper band form. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dgebnd_(integer *m, integer *n, integer *nb,
+	doublereal *a, integer *lda, doublereal *tauq, doublereal *taup,
+	doublereal *work, integer *lwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
+
+    /* Local variables */
+    integer k, kb, nr, iinfo;
+    extern /* Subroutine */ int dgelqf_(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, integer *),
+	    xerbla_(char *, integer *), dgeqrf_(integer *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, integer *,
+	    integer *), dormlq_(char *, char *, integer *, integer *, integer
+	    *, doublereal *, integer *, doublereal *, doublereal *, integer *,
+	     doublereal *, integer *, integer *), dormqr_(char *,
+	    char *, integer *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    integer *);
+    integer lwkopt;
+    logical lquery;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGEBND reduces a general real M-by-N matrix A with M >= N to upper */
+/*  band form B with bandwidth NB by an orthogonal transformation: */
+/*  Q**T * A * P = B.  This is the first stage of a two-stage reduction */
+/*  to bidiagonal form; the second stage is performed by DGBBRD. */
+
+/*  Unlike DGEBRD, every update of the trailing matrix is done by the */
+/*  blocked routines DORMQR and DORMLQ, so the reduction runs at Level 3 */
+/*  BLAS speed. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  M       (input) INTEGER */
+/*          The number of rows in the matrix A.  M >= N. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns in the matrix A.  N >= 0. */
+
+/*  NB      (input) INTEGER */
+/*          The bandwidth of B.  NB >= 1.  If NB = 1, B is bidiagonal. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the M-by-N general matrix to be reduced. */
+/*          On exit, the upper band matrix B is stored in the elements */
+/*          A(i,j) with i <= j <= min(i+NB,N); the elements below the */
+/*          diagonal, with the array TAUQ, represent the orthogonal */
+/*          matrix Q as a product of elementary reflectors, exactly as */
+/*          returned by DGEQRF; the elements A(i,j) with j > i+NB, with */
+/*          the array TAUP, represent the orthogonal matrix P as a */
+/*          product of elementary reflectors.  See Further Details. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  TAUQ    (output) DOUBLE PRECISION array dimension (N) */
+/*          The scalar factors of the elementary reflectors which */
+/*          represent the orthogonal matrix Q. */
+
+/*  TAUP    (output) DOUBLE PRECISION array, dimension (max(1,N-NB)) */
+/*          The scalar factors of the elementary reflectors which */
+/*          represent the orthogonal matrix P. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The length of the array WORK.  LWORK >= max(1,M). */
+/*          For optimum performance LWORK >= M*NB. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The matrix Q is represented as a product of elementary reflectors */
+
+/*     Q = H(1) H(2) . . . H(n) */
+
+/*  stored as by DGEQRF, so that Q may be applied with DORMQR(..., N, A, */
+/*  LDA, TAUQ, ...) or formed with DORGQR. */
+
+/*  The matrix P is represented as P = diag( I, Z**T ), where I is the */
+/*  identity of order NB and Z is the (N-NB)-by-(N-NB) orthogonal matrix */
+
+/*     Z = G(n-nb) . . . G(2) G(1) */
+
+/*  stored as by DGELQF in the submatrix A(1:N-NB,NB+1:N).  Thus P**T */
+/*  may be applied to the last N-NB columns of a matrix C from the right */
+/*  with DORMLQ('R', 'N', ..., N-NB, A(1,NB+1), LDA, TAUP, ...), and */
+/*  A = Q * B * P**T. */
+
+/*  The reduction alternates a QR factorization of a block of NB */
+/*  columns with an LQ factorization of the NB rows to the right of it, */
+/*  e.g. with m = 7, n = 6 and nb = 2 the first step gives */
+
+/*    (  r   r   l   0   0   0  ) */
+/*    (  v1  r   l   l   0   0  ) */
+/*    (  v1  v2  a   a   a   a  ) */
+/*    (  v1  v2  a   a   a   a  ) */
+/*    (  v1  v2  a   a   a   a  ) */
+/*    (  v1  v2  a   a   a   a  ) */
+/*    (  v1  v2  a   a   a   a  ) */
+
+/*  where r and l denote elements of B, vi the vectors defining H(i) and */
+/*  the vectors of G(1), G(2) (not shown) overwrite the zeros. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --tauq;
+    --taup;
+    --work;
+
+    /* Function Body */
+    *info = 0;
+    lwkopt = max(1,*m) * max(1,*nb);
+    work[1] = (doublereal) lwkopt;
+    lquery = *lwork == -1;
+    if (*n < 0) {
+	*info = -2;
+    } else if (*m < *n) {
+	*info = -1;
+    } else if (*nb < 1) {
+	*info = -3;
+    } else if (*lda < max(1,*m)) {
+	*info = -5;
+    } else if (*lwork < max(1,*m) && ! lquery) {
+	*info = -9;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGEBND", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n == 0) {
+	work[1] = 1.;
+	return 0;
+    }
+
+    i__1 = *n;
+    i__2 = *nb;
+    for (k = 1; i__2 < 0 ? k >= i__1 : k <= i__1; k += i__2) {
+/* Computing MIN */
+	i__3 = *nb, i__4 = *n - k + 1;
+	kb = min(i__3,i__4);
+
+/*        QR factorization of the block column A(k:m,k:k+kb-1) */
+
+	i__3 = *m - k + 1;
+	dgeqrf_(&i__3, &kb, &a[k + k * a_dim1], lda, &tauq[k], &work[1],
+		lwork, &iinfo);
+	if (k + kb <= *n) {
+
+/*           Apply Q(k)**T to A(k:m,k+kb:n) from the left */
+
+	    i__3 = *m - k + 1;
+	    i__4 = *n - k - kb + 1;
+	    dormqr_("Left", "Transpose", &i__3, &i__4, &kb, &a[k + k * 
+		    a_dim1], lda, &tauq[k], &a[k + (k + kb) * a_dim1], lda, &
+		    work[1], lwork, &iinfo);
+
+/*           LQ factorization of the block row A(k:k+kb-1,k+kb:n) */
+
+	    i__3 = *n - k - kb + 1;
+	    dgelqf_(&kb, &i__3, &a[k + (k + kb) * a_dim1], lda, &taup[k], &
+		    work[1], lwork, &iinfo);
+
+/*           Apply P(k) to A(k+kb:m,k+kb:n) from the right */
+
+	    nr = min(kb,i__3);
+	    i__4 = *m - k - kb + 1;
+	    dormlq_("Right", "Transpose", &i__4, &i__3, &nr, &a[k + (k + kb) 
+		    * a_dim1], lda, &taup[k], &a[k + kb + (k + kb) * a_dim1], 
+		    lda, &work[1], lwork, &iinfo);
+	}
+/* L10: */
+    }
+
+    work[1] = (doublereal) lwkopt;
+    return 0;
+
+/*     End of DGEBND */
+
+} /* dgebnd_ */
@@ -0,0 +1,248 @@
+/* dgeconb.c -- DGECONB, block 1-norm estimate of RCOND from LU factors. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static doublereal c_b13 = 1.;
+
+/* Subroutine */ int dgeconb_(char *norm, integer *n, doublereal *a, integer
+	*lda, doublereal *anorm, doublereal *rcond, doublereal *work, integer
+	*iwork, integer *info)
+{
+    /* Initialized data */
+
+    static integer iseed[4] = { 1,3,5,7 };
+
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1;
+    doublereal d__1;
+
+    /* Local variables */
+    integer i__, t, ix, nt, ih, iv, kase, kase1;
+    extern logical lsame_(char *, char *);
+    integer isave[3], iseedl[4];
+    extern /* Subroutine */ int dtrsm_(char *, char *, char *, char *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *), dgecon_(char *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
+	    integer *, integer *), dlacn1_(integer *, integer *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, integer *, doublereal *, integer *,
+	    integer *, integer *);
+    extern doublereal dlamch_(char *);
+    extern /* Subroutine */ int xerbla_(char *, integer *);
+    doublereal ainvnm, bignum;
+    logical onenrm;
+    integer ixold;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGECONB estimates the reciprocal of the condition number of a general */
+/*  real matrix A, in either the 1-norm or the infinity-norm, using */
+/*  the LU factorization computed by DGETRF. */
+
+/*  It computes the same quantity as DGECON, but estimates norm(inv(A)) */
+/*  with the block estimator DLACN1, which works on two vectors at a */
+/*  time.  Each step is then a pair of triangular solves with an N-by-2 */
+/*  right hand side (Level 3 BLAS DTRSM) instead of two DLATRS calls with */
+/*  a single vector, and the estimate is usually obtained in fewer steps */
+/*  and is more often exact. */
+
+/*  An estimate is obtained for norm(inv(A)), and the reciprocal of the */
+/*  condition number is computed as */
+/*     RCOND = 1 / ( norm(A) * norm(inv(A)) ). */
+
+/*  Arguments */
+/*  ========= */
+
+/*  NORM    (input) CHARACTER*1 */
+/*          Specifies whether the 1-norm condition number or the */
+/*          infinity-norm condition number is required: */
+/*          = '1' or 'O':  1-norm; */
+/*          = 'I':         Infinity-norm. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  A       (input) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          The factors L and U from the factorization A = P*L*U */
+/*          as computed by DGETRF. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  ANORM   (input) DOUBLE PRECISION */
+/*          If NORM = '1' or 'O', the 1-norm of the original matrix A. */
+/*          If NORM = 'I', the infinity-norm of the original matrix A. */
+
+/*  RCOND   (output) DOUBLE PRECISION */
+/*          The reciprocal of the condition number of the matrix A, */
+/*          computed as RCOND = 1/(norm(A) * norm(inv(A))). */
+
+/*  WORK    (workspace) DOUBLE PRECISION array, dimension (6*N) */
+
+/*  IWORK   (workspace) INTEGER array, dimension (2*N) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+
+/*  Further Details */
+/*  =============== */
+
+/*  Unlike DLATRS, DTRSM does not guard against overflow.  If a solve */
+/*  produces an entry larger than 1/SAFMIN (or a NaN), the estimate is */
+/*  recomputed by DGECON, which scales the solutions as it goes, so */
+/*  that RCOND is as reliable as that of DGECON for every matrix. */
+
+/*  The starting vectors are generated from a fixed seed, so RCOND is a */
+/*  deterministic function of the factors. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Data statements .. */
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --work;
+    --iwork;
+
+    /* Function Body */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    *info = 0;
+    onenrm = *(unsigned char *)norm == '1' || lsame_(norm, "O");
+    if (! onenrm && ! lsame_(norm, "I")) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*lda < max(1,*n)) {
+	*info = -4;
+    } else if (*anorm < 0.) {
+	*info = -5;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGECONB", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    *rcond = 0.;
+    if (*n == 0) {
+	*rcond = 1.;
+	return 0;
+    } else if (*anorm == 0.) {
+	return 0;
+    }
+
+/*     An exactly singular U gives RCOND = 0, as in DGECON. */
+
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	if (a[i__ + i__ * a_dim1] == 0.) {
+	    return 0;
+	}
+/* L10: */
+    }
+
+    bignum = 1. / dlamch_("Safe minimum");
+
+/*     Partition WORK as X (N-by-T), XOLD (N-by-T), H (N) and V (N). */
+
+    t = min(2,*n);
+    nt = *n * t;
+    ix = 1;
+    ixold = ix + nt;
+    ih = ixold + nt;
+    iv = ih + *n;
+    for (i__ = 1; i__ <= 4; ++i__) {
+	iseedl[i__ - 1] = iseed[i__ - 1];
+/* L20: */
+    }
+
+/*     Estimate the norm of inv(A). */
+
+    ainvnm = 0.;
+    if (onenrm) {
+	kase1 = 1;
+    } else {
+	kase1 = 2;
+    }
+    kase = 0;
+L30:
+    dlacn1_(n, &t, &work[iv], &work[ix], n, &work[ixold], n, &work[ih], &
+	    iwork[1], &iwork[*n + 1], &ainvnm, &kase, iseedl, isave);
+    if (kase != 0) {
+	if (kase == kase1) {
+
+/*           Multiply by inv(L), then by inv(U). */
+
+	    dtrsm_("Left", "Lower", "No transpose", "Unit", n, &t, &c_b13, &a[
+		    a_offset], lda, &work[ix], n);
+	    dtrsm_("Left", "Upper", "No transpose", "Non-unit", n, &t, &c_b13,
+		     &a[a_offset], lda, &work[ix], n);
+	} else {
+
+/*           Multiply by inv(U'), then by inv(L'). */
+
+	    dtrsm_("Left", "Upper", "Transpose", "Non-unit", n, &t, &c_b13, &
+		    a[a_offset], lda, &work[ix], n);
+	    dtrsm_("Left", "Lower", "Transpose", "Unit", n, &t, &c_b13, &a[
+		    a_offset], lda, &work[ix], n);
+	}
+
+/*        Fall back on DGECON if the solves overflowed.  The test is */
+/*        written so that it also catches NaNs. */
+
+	i__1 = nt;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    if (! ((d__1 = work[ix + i__ - 1], abs(d__1)) <= bignum)) {
+		dgecon_(norm, n, &a[a_offset], lda, anorm, rcond, &work[1], &
+			iwork[1], info);
+		return 0;
+	    }
+/* L40: */
+	}
+	goto L30;
+    }
+
+/*     Compute the estimate of the reciprocal condition number. */
+
+    if (ainvnm != 0.) {
+	*rcond = 1. / ainvnm / *anorm;
+    }
+
+    return 0;
+
+/*     End of DGECONB */
+
+} /* dgeconb_ */
@@ -0,0 +1,171 @@
+/* dgeldet.c -- DGELDET, sign and log-determinant of a general matrix. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dgeldet_(char *fact, integer *n, doublereal *a, integer *
+	lda, integer *ipiv, doublereal *sgn, doublereal *logdet, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1;
+
+    /* Builtin functions */
+    double log(doublereal);
+
+    /* Local variables */
+    integer i__;
+    doublereal d__;
+    logical nofact;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int xerbla_(char *, integer *), dgetrf_(
+	    integer *, integer *, doublereal *, integer *, integer *, integer
+	    *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGELDET computes the sign and the logarithm of the absolute value */
+/*  of the determinant of a real N-by-N matrix A, */
+
+/*     det( A ) = SGN * exp( LOGDET ), */
+
+/*  from its LU factorization A = P * L * U.  The logarithm is */
+/*  accumulated from the diagonal of U, so the result neither overflows */
+/*  nor underflows even when det( A ) is not representable. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  FACT    (input) CHARACTER*1 */
+/*          Specifies whether or not the factored form of A is supplied: */
+/*          = 'F':  On entry, A and IPIV contain the factors L and U and */
+/*                  the pivot indices from DGETRF. */
+/*          = 'N':  A is factored by DGETRF. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the matrix A if FACT = 'N', or its factors L and U */
+/*          if FACT = 'F'. */
+/*          On exit, the factors L and U from the factorization */
+/*          A = P*L*U; the unit diagonal elements of L are not stored. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  IPIV    (input or output) INTEGER array, dimension (N) */
+/*          The pivot indices; for 1 <= i <= N, row i of the matrix was */
+/*          interchanged with row IPIV(i).  IPIV is an input argument if */
+/*          FACT = 'F' and an output argument if FACT = 'N'. */
+
+/*  SGN     (output) DOUBLE PRECISION */
+/*          The sign of det( A ): 1, -1, or 0 if A is exactly singular. */
+
+/*  LOGDET  (output) DOUBLE PRECISION */
+/*          The natural logarithm of |det( A )|.  Set to zero if A is */
+/*          exactly singular. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+/*          > 0:  if INFO = i, U(i,i) is exactly zero, so A is singular; */
+/*                SGN = 0 and LOGDET = 0. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --ipiv;
+
+    /* Function Body */
+    *info = 0;
+    nofact = lsame_(fact, "N");
+    if (! nofact && ! lsame_(fact, "F")) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*lda < max(1,*n)) {
+	*info = -4;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGELDET", &i__1);
+	return 0;
+    }
+
+    *sgn = 1.;
+    *logdet = 0.;
+
+/*     Quick return if possible */
+
+    if (*n == 0) {
+	return 0;
+    }
+
+    if (nofact) {
+
+/*        Compute the LU factorization of A. */
+
+	dgetrf_(n, n, &a[a_offset], lda, &ipiv[1], info);
+    } else {
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    if (a[i__ + i__ * a_dim1] == 0.) {
+		*info = i__;
+		goto L20;
+	    }
+/* L10: */
+	}
+    }
+L20:
+    if (*info > 0) {
+	*sgn = 0.;
+	return 0;
+    }
+
+/*     det( A ) = det( P ) * prod U(i,i). */
+
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	d__ = a[i__ + i__ * a_dim1];
+	if (d__ < 0.) {
+	    *sgn = -(*sgn);
+	    d__ = -d__;
+	}
+	if (ipiv[i__] != i__) {
+	    *sgn = -(*sgn);
+	}
+	*logdet += log(d__);
+/* L30: */
+    }
+
+    return 0;
+
+/*     End of DGELDET */
+
+} /* dgeldet_ */
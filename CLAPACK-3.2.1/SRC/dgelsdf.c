@@ -0,0 +1,372 @@
+/* dgelsdf.c -- DGELSDF, SVD factorization for repeated LS solves. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__0 = 0;
+static doublereal c_b18 = 0.;
+
+/* Subroutine */ int dgelsdf_(integer *m, integer *n, doublereal *a, integer
+	*lda, doublereal *rcond, integer *rank, doublereal *tau, doublereal *
+	s, doublereal *u, integer *ldu, doublereal *vt, integer *ldvt,
+	doublereal *work, integer *lwork, integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, u_dim1, u_offset, vt_dim1, vt_offset, i__1,
+	    i__2, i__3;
+
+    /* Local variables */
+    integer i__, ie, ir, nb, mm, nwork;
+    doublereal eps, thr, anrm, dum[1];
+    integer idum[1], iascl, itaup, itauq;
+    extern /* Subroutine */ int dgebrd_(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
+	     doublereal *, integer *, integer *), dbdsdc_(char *, char *,
+	    integer *, doublereal *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, integer *), dlabad_(doublereal *, doublereal *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *,
+	    integer *, doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dgelqf_(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, integer *),
+	    dlacpy_(char *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, integer *), dlascl_(char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, integer *, doublereal *,
+	    integer *, integer *), dgeqrf_(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, integer *),
+	    dlaset_(char *, integer *, integer *, doublereal *, doublereal *,
+	    doublereal *, integer *), xerbla_(char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    doublereal bignum;
+    extern /* Subroutine */ int dormbr_(char *, char *, char *, integer *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, integer *, doublereal *, integer *, integer *);
+    integer minwrk, maxwrk;
+    doublereal smlnum;
+    logical lquery;
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGELSDF computes a factorization of a real M-by-N matrix A from */
+/*  which DGELSDS obtains the minimum norm solution of the least squares */
+/*  problem */
+/*      minimize 2-norm(| b - A*x |) */
+/*  for any number of right hand side batches, using the singular value */
+/*  decomposition (SVD) of A.  A may be rank-deficient.  The pair */
+/*  computes the same solution as DGELSD, but A is factored only once. */
+
+/*  The factorization is */
+
+/*     A = Q * [ U * diag(S) * VT ]   if M >= N, and */
+/*             [         0        ] */
+
+/*     A = [ U * diag(S) * VT  0 ] * Q   if M < N, */
+
+/*  where Q is the orthogonal factor of the QR (or LQ) factorization of */
+/*  A, kept as elementary reflectors in A and TAU, and U * diag(S) * VT */
+/*  is the SVD of the K-by-K triangular factor, K = min(M,N).  The SVD */
+/*  is computed by the divide and conquer method (DBDSDC), whose */
+/*  independent subproblems are solved concurrently when the library */
+/*  is built with OpenMP.  Storing U and VT explicitly lets DGELSDS */
+/*  apply the pseudo-inverse with Level 3 BLAS. */
+
+/*  The effective rank of A is the number of singular values which are */
+/*  greater than RCOND*S(1). */
+
+/*  Arguments */
+/*  ========= */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of A. M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of A. N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the M-by-N matrix A. */
+/*          On exit, the elementary reflectors defining Q, as returned */
+/*          by DGEQRF (if M >= N) or DGELQF (if M < N). */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  RCOND   (input) DOUBLE PRECISION */
+/*          RCOND is used to determine the effective rank of A. */
+/*          Singular values S(i) <= RCOND*S(1) are treated as zero. */
+/*          If RCOND < 0, machine precision is used instead. */
+
+/*  RANK    (output) INTEGER */
+/*          The effective rank of A, i.e., the number of singular values */
+/*          which are greater than RCOND*S(1). */
+
+/*  TAU     (output) DOUBLE PRECISION array, dimension (min(M,N)) */
+/*          The scalar factors of the elementary reflectors defining Q. */
+
+/*  S       (output) DOUBLE PRECISION array, dimension (min(M,N)) */
+/*          The singular values of A in decreasing order. */
+/*          The condition number of A in the 2-norm = S(1)/S(min(m,n)). */
+
+/*  U       (output) DOUBLE PRECISION array, dimension (LDU,min(M,N)) */
+/*          The left singular vectors of the triangular factor of A. */
+
+/*  LDU     (input) INTEGER */
+/*          The leading dimension of the array U. */
+/*          LDU >= max(1,min(M,N)). */
+
+/*  VT      (output) DOUBLE PRECISION array, dimension (LDVT,min(M,N)) */
+/*          The right singular vectors (stored rowwise) of the */
+/*          triangular factor of A. */
+
+/*  LDVT    (input) INTEGER */
+/*          The leading dimension of the array VT. */
+/*          LDVT >= max(1,min(M,N)). */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK. */
+/*          LWORK >= MAX( 1, 4*K*K + 7*K ), where K = min(M,N). */
+/*          For good performance, LWORK should generally be larger. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  IWORK   (workspace) INTEGER array, dimension (MAX(1,8*min(M,N))) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
+/*          > 0:  the algorithm for computing the SVD failed to converge; */
+/*                if INFO = i, i off-diagonal elements of an intermediate */
+/*                bidiagonal form did not converge to zero. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input arguments. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --tau;
+    --s;
+    u_dim1 = *ldu;
+    u_offset = 1 + u_dim1;
+    u -= u_offset;
+    vt_dim1 = *ldvt;
+    vt_offset = 1 + vt_dim1;
+    vt -= vt_offset;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    mm = min(*m,*n);
+    lquery = *lwork == -1;
+    if (*m < 0) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*lda < max(1,*m)) {
+	*info = -4;
+    } else if (*ldu < max(1,mm)) {
+	*info = -10;
+    } else if (*ldvt < max(1,mm)) {
+	*info = -12;
+    }
+
+    ir = 1;
+    ie = ir + mm * mm;
+    itauq = ie + mm;
+    itaup = itauq + mm;
+    nwork = itaup + mm;
+
+/*     Compute workspace. */
+/*     (Note: Comments in the code beginning "Workspace:" describe the */
+/*     minimal amount of workspace needed at that point in the code, */
+/*     as well as the preferred amount for good performance. */
+/*     NB refers to the optimal block size for the immediately */
+/*     following subroutine, as returned by ILAENV.) */
+
+    if (*info == 0) {
+	minwrk = 1;
+	maxwrk = 1;
+	if (mm > 0) {
+	    if (*m >= *n) {
+		nb = ilaenv_(&c__1, "DGEQRF", " ", m, n, &c_n1, &c_n1);
+	    } else {
+		nb = ilaenv_(&c__1, "DGELQF", " ", m, n, &c_n1, &c_n1);
+	    }
+	    minwrk = (mm << 2) * mm + mm * 7;
+/* Computing MAX */
+	    i__1 = minwrk, i__2 = mm * nb;
+	    maxwrk = max(i__1,i__2);
+/* Computing MAX */
+	    i__1 = ilaenv_(&c__1, "DGEBRD", " ", &mm, &mm, &c_n1, &c_n1),
+		    i__2 = ilaenv_(&c__1, "DORMBR", "QLN", &mm, &mm, &mm, &
+		    c_n1);
+	    nb = max(i__1,i__2);
+/* Computing MAX */
+	    i__1 = maxwrk, i__2 = mm * mm + mm * 3 + (mm << 1) * nb;
+	    maxwrk = max(i__1,i__2);
+	}
+	work[1] = (doublereal) maxwrk;
+	if (*lwork < minwrk && ! lquery) {
+	    *info = -14;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGELSDF", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible. */
+
+    *rank = 0;
+    if (mm == 0) {
+	return 0;
+    }
+
+/*     Get machine parameters. */
+
+    eps = dlamch_("P");
+    smlnum = dlamch_("S") / eps;
+    bignum = 1. / smlnum;
+    dlabad_(&smlnum, &bignum);
+
+/*     Scale A if max entry outside range [SMLNUM,BIGNUM]. */
+
+    anrm = dlange_("M", m, n, &a[a_offset], lda, &work[1]);
+    iascl = 0;
+    if (anrm > 0. && anrm < smlnum) {
+
+/*        Scale matrix norm up to SMLNUM. */
+
+	dlascl_("G", &c__0, &c__0, &anrm, &smlnum, m, n, &a[a_offset], lda,
+		info);
+	iascl = 1;
+    } else if (anrm > bignum) {
+
+/*        Scale matrix norm down to BIGNUM. */
+
+	dlascl_("G", &c__0, &c__0, &anrm, &bignum, m, n, &a[a_offset], lda,
+		info);
+	iascl = 2;
+    }
+
+    if (*m >= *n) {
+
+/*        A = Q * R.  Copy R to WORK(IR), zeroing out below it. */
+/*        (Workspace: need N, prefer N*NB) */
+
+	dgeqrf_(m, n, &a[a_offset], lda, &tau[1], &work[1], lwork, info);
+	dlacpy_("U", &mm, &mm, &a[a_offset], lda, &work[ir], &mm);
+	i__1 = mm - 1;
+	i__2 = mm - 1;
+	dlaset_("L", &i__1, &i__2, &c_b18, &c_b18, &work[ir + 1], &mm);
+    } else {
+
+/*        A = L * Q.  Copy L to WORK(IR), zeroing out above it. */
+/*        (Workspace: need M, prefer M*NB) */
+
+	dgelqf_(m, n, &a[a_offset], lda, &tau[1], &work[1], lwork, info);
+	dlacpy_("L", &mm, &mm, &a[a_offset], lda, &work[ir], &mm);
+	i__1 = mm - 1;
+	i__2 = mm - 1;
+	dlaset_("U", &i__1, &i__2, &c_b18, &c_b18, &work[ir + mm], &mm);
+    }
+
+/*     Bidiagonalize the triangular factor in WORK(IR). */
+/*     (Workspace: need K*K+4*K, prefer K*K+3*K+2*K*NB) */
+
+    i__1 = *lwork - nwork + 1;
+    dgebrd_(&mm, &mm, &work[ir], &mm, &s[1], &work[ie], &work[itauq], &work[
+	    itaup], &work[nwork], &i__1, info);
+
+/*     Compute the SVD of the upper bidiagonal matrix by divide and */
+/*     conquer, with singular vectors in U and VT. */
+/*     (Workspace: need K*K+3*K+3*K*K+4*K) */
+
+    dbdsdc_("U", "I", &mm, &s[1], &work[ie], &u[u_offset], ldu, &vt[
+	    vt_offset], ldvt, dum, idum, &work[nwork], &iwork[1], info);
+    if (*info != 0) {
+	return 0;
+    }
+
+/*     U := QB * U and VT := VT * PB', so that U * diag(S) * VT is the */
+/*     SVD of the triangular factor. */
+/*     (Workspace: need K*K+4*K, prefer K*K+3*K+K*NB) */
+
+    i__1 = *lwork - nwork + 1;
+    dormbr_("Q", "L", "N", &mm, &mm, &mm, &work[ir], &mm, &work[itauq], &u[
+	    u_offset], ldu, &work[nwork], &i__1, info);
+    i__1 = *lwork - nwork + 1;
+    dormbr_("P", "R", "T", &mm, &mm, &mm, &work[ir], &mm, &work[itaup], &vt[
+	    vt_offset], ldvt, &work[nwork], &i__1, info);
+
+/*     Undo scaling; the reflectors and singular vectors are invariant. */
+
+    if (iascl == 1) {
+	dlascl_("G", &c__0, &c__0, &smlnum, &anrm, &mm, &c__1, &s[1], &mm,
+		info);
+    } else if (iascl == 2) {
+	dlascl_("G", &c__0, &c__0, &bignum, &anrm, &mm, &c__1, &s[1], &mm,
+		info);
+    }
+
+/*     Determine the effective rank as in DLALSD. */
+
+    if (*rcond <= 0. || *rcond >= 1.) {
+	thr = eps * s[1];
+    } else {
+	thr = *rcond * s[1];
+    }
+    i__3 = mm;
+    for (i__ = 1; i__ <= i__3; ++i__) {
+	if (s[i__] > thr) {
+	    ++(*rank);
+	}
+/* L10: */
+    }
+
+    work[1] = (doublereal) maxwrk;
+    return 0;
+
+/*     End of DGELSDF */
+
+} /* dgelsdf_ */
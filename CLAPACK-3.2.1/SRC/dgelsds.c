@@ -0,0 +1,329 @@
+/* dgelsds.c -- DGELSDS, LS solve using the DGELSDF factorization. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__0 = 0;
+static doublereal c_b12 = 0.;
+static doublereal c_b13 = 1.;
+
+/* Subroutine */ int dgelsds_(integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, integer *rank, doublereal *tau,
+	doublereal *s, doublereal *u, integer *ldu, doublereal *vt, integer *
+	ldvt, doublereal *b, integer *ldb, doublereal *work, integer *lwork,
+	integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, u_dim1, u_offset, vt_dim1, vt_offset, b_dim1,
+	    b_offset, i__1, i__2;
+
+    /* Local variables */
+    integer i__, j, nb, mm, iw, nwork;
+    doublereal r__, bnrm;
+    integer ibscl;
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dlabad_(
+	    doublereal *, doublereal *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *,
+	    integer *, doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, integer *, doublereal *,
+	    integer *, integer *), dlaset_(char *, integer *, integer
+	    *, doublereal *, doublereal *, doublereal *, integer *),
+	    xerbla_(char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    doublereal bignum;
+    extern /* Subroutine */ int dormlq_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, doublereal *,
+	    integer *, doublereal *, integer *, integer *),
+	    dormqr_(char *, char *, integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *, integer *);
+    integer minwrk, maxwrk;
+    doublereal smlnum;
+    logical lquery;
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGELSDS computes the minimum-norm solution to a real linear least */
+/*  squares problem */
+/*      minimize 2-norm(| b - A*x |) */
+/*  using the factorization of A computed by DGELSDF.  The factorization */
+/*  is not modified, so DGELSDS may be called any number of times with */
+/*  new right hand sides. */
+
+/*  With K = min(M,N) and U1, VT1 the first RANK columns of U and rows */
+/*  of VT, the solution is */
+
+/*     X = VT1' * inv(diag(S(1:RANK))) * U1' * ( Q' * B )(1:K,:) */
+
+/*  if M >= N, and */
+
+/*     X = Q' * [ VT1' * inv(diag(S(1:RANK))) * U1' * B ] */
+/*              [                 0                    ] */
+
+/*  if M < N.  The cost per batch is O((M*N + K*RANK)*NRHS), compared */
+/*  to the O(M*N*K) of refactoring A with DGELSD. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of A. M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of A. N >= 0. */
+
+/*  NRHS    (input) INTEGER */
+/*          The number of right hand sides, i.e., the number of columns */
+/*          of the matrices B and X. NRHS >= 0. */
+
+/*  A       (input) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          The elementary reflectors defining Q, as returned by DGELSDF. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  RANK    (input) INTEGER */
+/*          The effective rank of A, as returned by DGELSDF. */
+/*          0 <= RANK <= min(M,N). */
+
+/*  TAU     (input) DOUBLE PRECISION array, dimension (min(M,N)) */
+/*  S       (input) DOUBLE PRECISION array, dimension (min(M,N)) */
+/*  U       (input) DOUBLE PRECISION array, dimension (LDU,min(M,N)) */
+/*  VT      (input) DOUBLE PRECISION array, dimension (LDVT,min(M,N)) */
+/*          The factorization of A, as returned by DGELSDF. */
+
+/*  LDU     (input) INTEGER */
+/*          The leading dimension of the array U. */
+/*          LDU >= max(1,min(M,N)). */
+
+/*  LDVT    (input) INTEGER */
+/*          The leading dimension of the array VT. */
+/*          LDVT >= max(1,min(M,N)). */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,NRHS) */
+/*          On entry the M by NRHS right hand side matrix B. */
+/*          On exit, B is overwritten by the N by NRHS solution matrix X. */
+/*          If M >= N, rows N+1 to M of B hold the last M-N components */
+/*          of Q'*B. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of the array B. LDB >= max(1,max(M,N)). */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK. */
+/*          LWORK >= MAX( 1, (min(M,N)+1)*NRHS ). */
+/*          For optimal performance LWORK >= (min(M,N)+NB)*NRHS, where */
+/*          NB is the optimal block size for DORMQR or DORMLQ. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input arguments. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --tau;
+    --s;
+    u_dim1 = *ldu;
+    u_offset = 1 + u_dim1;
+    u -= u_offset;
+    vt_dim1 = *ldvt;
+    vt_offset = 1 + vt_dim1;
+    vt -= vt_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    --work;
+
+    /* Function Body */
+    *info = 0;
+    mm = min(*m,*n);
+    lquery = *lwork == -1;
+    if (*m < 0) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*nrhs < 0) {
+	*info = -3;
+    } else if (*lda < max(1,*m)) {
+	*info = -5;
+    } else if (*rank < 0 || *rank > mm) {
+	*info = -6;
+    } else if (*ldu < max(1,mm)) {
+	*info = -10;
+    } else if (*ldvt < max(1,mm)) {
+	*info = -12;
+    } else /* if(complicated condition) */ {
+/* Computing MAX */
+	i__1 = max(1,*m);
+	if (*ldb < max(i__1,*n)) {
+	    *info = -14;
+	}
+    }
+
+    iw = 1;
+    nwork = iw + mm * *nrhs;
+
+    if (*info == 0) {
+	minwrk = 1;
+	maxwrk = 1;
+	if (mm > 0 && *nrhs > 0) {
+	    if (*m >= *n) {
+		nb = ilaenv_(&c__1, "DORMQR", "LT", m, nrhs, n, &c_n1);
+	    } else {
+		nb = ilaenv_(&c__1, "DORMLQ", "LT", n, nrhs, m, &c_n1);
+	    }
+	    minwrk = (mm + 1) * *nrhs;
+/* Computing MAX */
+	    i__1 = minwrk, i__2 = (mm + nb) * *nrhs;
+	    maxwrk = max(i__1,i__2);
+	}
+	work[1] = (doublereal) maxwrk;
+	if (*lwork < minwrk && ! lquery) {
+	    *info = -16;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGELSDS", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible. */
+
+    if (mm == 0 || *nrhs == 0) {
+	return 0;
+    }
+    if (*rank == 0) {
+	i__1 = max(*m,*n);
+	dlaset_("F", &i__1, nrhs, &c_b12, &c_b12, &b[b_offset], ldb);
+	goto L40;
+    }
+
+/*     Get machine parameters. */
+
+    smlnum = dlamch_("S") / dlamch_("P");
+    bignum = 1. / smlnum;
+    dlabad_(&smlnum, &bignum);
+
+/*     Scale B if max entry outside range [SMLNUM,BIGNUM]. */
+
+    bnrm = dlange_("M", m, nrhs, &b[b_offset], ldb, &work[1]);
+    ibscl = 0;
+    if (bnrm > 0. && bnrm < smlnum) {
+
+/*        Scale matrix norm up to SMLNUM. */
+
+	dlascl_("G", &c__0, &c__0, &bnrm, &smlnum, m, nrhs, &b[b_offset], ldb,
+		 info);
+	ibscl = 1;
+    } else if (bnrm > bignum) {
+
+/*        Scale matrix norm down to BIGNUM. */
+
+	dlascl_("G", &c__0, &c__0, &bnrm, &bignum, m, nrhs, &b[b_offset], ldb,
+		 info);
+	ibscl = 2;
+    }
+
+/*     B(1:M,1:NRHS) := Q' * B(1:M,1:NRHS) */
+/*     (Workspace: need K*NRHS+NRHS, prefer K*NRHS+NRHS*NB) */
+
+    if (*m >= *n) {
+	i__1 = *lwork - nwork + 1;
+	dormqr_("L", "T", m, nrhs, n, &a[a_offset], lda, &tau[1], &b[b_offset]
+, ldb, &work[nwork], &i__1, info);
+    }
+
+/*     W := inv(diag(S1)) * U1' * B(1:K,1:NRHS) */
+
+    dgemm_("T", "N", rank, nrhs, &mm, &c_b13, &u[u_offset], ldu, &b[
+	    b_offset], ldb, &c_b12, &work[iw], rank);
+    i__1 = *rank;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	r__ = 1. / s[i__];
+	i__2 = *nrhs;
+	for (j = 1; j <= i__2; ++j) {
+	    work[iw + i__ - 1 + (j - 1) * *rank] *= r__;
+/* L10: */
+	}
+/* L20: */
+    }
+
+/*     B(1:K,1:NRHS) := VT1' * W */
+
+    dgemm_("T", "N", &mm, nrhs, rank, &c_b13, &vt[vt_offset], ldvt, &work[iw]
+	    , rank, &c_b12, &b[b_offset], ldb);
+
+/*     B(1:N,1:NRHS) := Q' * [ B(1:M,1:NRHS) ; 0 ] */
+
+    if (*m < *n) {
+	i__1 = *n - *m;
+	dlaset_("F", &i__1, nrhs, &c_b12, &c_b12, &b[*m + 1 + b_dim1], ldb);
+	i__1 = *lwork - nwork + 1;
+	dormlq_("L", "T", n, nrhs, m, &a[a_offset], lda, &tau[1], &b[b_offset]
+, ldb, &work[nwork], &i__1, info);
+    }
+
+/*     Undo scaling. */
+
+    if (ibscl == 1) {
+	dlascl_("G", &c__0, &c__0, &smlnum, &bnrm, n, nrhs, &b[b_offset], ldb,
+		 info);
+    } else if (ibscl == 2) {
+	dlascl_("G", &c__0, &c__0, &bignum, &bnrm, n, nrhs, &b[b_offset], ldb,
+		 info);
+    }
+
+L40:
+    work[1] = (doublereal) maxwrk;
+    return 0;
+
+/*     End of DGELSDS */
+
+} /* dgelsds_ */
@@ -0,0 +1,314 @@
+/* dgelsyf.c -- DGELSYF, complete orthogonal factorization for LS. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__0 = 0;
+static integer c__2 = 2;
+
+/* Subroutine */ int dgelsyf_(integer *m, integer *n, doublereal *a, integer
+	*lda, integer *jpvt, doublereal *rcond, integer *rank, doublereal *
+	tau, doublereal *work, integer *lwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1, i__2;
+    doublereal d__1;
+
+    /* Local variables */
+    integer i__, nb, mn, nb1, nb2;
+    doublereal c1, c2, s1, s2, anrm, smin, smax;
+    integer iascl, ismin, ismax;
+    extern /* Subroutine */ int dlaic1_(integer *, integer *, doublereal *,
+	    doublereal *, doublereal *, doublereal *, doublereal *,
+	    doublereal *, doublereal *);
+    extern /* Subroutine */ int dgeqp3_(integer *, integer *, doublereal *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    integer *), dlabad_(doublereal *, doublereal *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *,
+	    integer *, doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, integer *, doublereal *,
+	    integer *, integer *), xerbla_(char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    doublereal bignum;
+    integer lwkmin;
+    doublereal sminpr, smaxpr, smlnum;
+    integer lwkopt;
+    logical lquery;
+    extern /* Subroutine */ int dtzrzf_(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, integer *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGELSYF computes the complete orthogonal factorization used by */
+/*  DGELSY, */
+/*     A * P = Q * [ T11 0 ] * Z */
+/*                 [  0  0 ] */
+/*  of an M-by-N matrix A which may be rank-deficient, and returns it */
+/*  in a form that DGELSYS can apply to any number of right hand side */
+/*  batches.  Together the two routines compute exactly the solution */
+/*  of DGELSY; the factorization, which costs O(M*N*min(M,N)) */
+/*  operations, is done only once. */
+
+/*  As in DGELSY, A is first factored by DGEQP3, */
+/*      A * P = Q * [ R11 R12 ] */
+/*                  [  0  R22 ] */
+/*  with R11 defined as the largest leading submatrix whose estimated */
+/*  condition number is less than 1/RCOND, and R12 is then annihilated */
+/*  by DTZRZF. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of the matrix A.  M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the M-by-N matrix A. */
+/*          On exit, A has been overwritten by details of its */
+/*          complete orthogonal factorization. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  JPVT    (input/output) INTEGER array, dimension (N) */
+/*          On entry, if JPVT(i) .ne. 0, the i-th column of A is permuted */
+/*          to the front of AP, otherwise column i is a free column. */
+/*          On exit, if JPVT(i) = k, then the i-th column of AP */
+/*          was the k-th column of A. */
+
+/*  RCOND   (input) DOUBLE PRECISION */
+/*          RCOND is used to determine the effective rank of A, as in */
+/*          DGELSY. */
+
+/*  RANK    (output) INTEGER */
+/*          The effective rank of A, i.e., the order of the submatrix */
+/*          T11 in the complete orthogonal factorization of A. */
+
+/*  TAU     (output) DOUBLE PRECISION array, dimension (2*min(M,N)) */
+/*          TAU(1:min(M,N)) holds the scalar factors of the reflectors */
+/*          defining Q and TAU(min(M,N)+1:min(M,N)+RANK) those of the */
+/*          reflectors defining Z. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK. */
+/*          LWORK >= MAX( 1, 3*N+1, 2*min(M,N) ). */
+/*          For optimal performance LWORK >= 2*N+NB*(N+1), where NB is */
+/*          the optimal block size for DGEQP3 and DTZRZF. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: If INFO = -i, the i-th argument had an illegal value. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  If the entries of A are outside the range [SMLNUM,BIGNUM] the */
+/*  factorization is computed for a scaled copy of A and T11 is scaled */
+/*  back on exit, so that DGELSYS need not know about the scaling. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --jpvt;
+    --tau;
+    --work;
+
+    /* Function Body */
+    mn = min(*m,*n);
+    ismin = 1;
+    ismax = mn + 1;
+
+/*     Test the input arguments. */
+
+    *info = 0;
+    lquery = *lwork == -1;
+    if (*m < 0) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*lda < max(1,*m)) {
+	*info = -4;
+    }
+
+/*     Figure out optimal block size */
+
+    if (*info == 0) {
+	if (mn == 0) {
+	    lwkmin = 1;
+	    lwkopt = 1;
+	} else {
+	    nb1 = ilaenv_(&c__1, "DGEQRF", " ", m, n, &c_n1, &c_n1);
+	    nb2 = ilaenv_(&c__1, "DGERQF", " ", m, n, &c_n1, &c_n1);
+	    nb = max(nb1,nb2);
+/* Computing MAX */
+	    i__1 = *n * 3 + 1, i__2 = mn << 1;
+	    lwkmin = max(i__1,i__2);
+/* Computing MAX */
+	    i__1 = lwkmin, i__2 = (*n << 1) + nb * (*n + 1);
+	    lwkopt = max(i__1,i__2);
+	}
+	work[1] = (doublereal) lwkopt;
+
+	if (*lwork < lwkmin && ! lquery) {
+	    *info = -10;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGELSYF", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    *rank = 0;
+    if (mn == 0) {
+	return 0;
+    }
+
+/*     Get machine parameters */
+
+    smlnum = dlamch_("S") / dlamch_("P");
+    bignum = 1. / smlnum;
+    dlabad_(&smlnum, &bignum);
+
+/*     Scale A if max entries outside range [SMLNUM,BIGNUM] */
+
+    anrm = dlange_("M", m, n, &a[a_offset], lda, &work[1]);
+    iascl = 0;
+    if (anrm > 0. && anrm < smlnum) {
+
+/*        Scale matrix norm up to SMLNUM */
+
+	dlascl_("G", &c__0, &c__0, &anrm, &smlnum, m, n, &a[a_offset], lda,
+		info);
+	iascl = 1;
+    } else if (anrm > bignum) {
+
+/*        Scale matrix norm down to BIGNUM */
+
+	dlascl_("G", &c__0, &c__0, &anrm, &bignum, m, n, &a[a_offset], lda,
+		info);
+	iascl = 2;
+    } else if (anrm == 0.) {
+
+/*        Matrix all zero.  RANK = 0 makes DGELSYS return X = 0. */
+
+	goto L70;
+    }
+
+/*     Compute QR factorization with column pivoting of A: */
+/*        A * P = Q * R */
+
+    dgeqp3_(m, n, &a[a_offset], lda, &jpvt[1], &tau[1], &work[1], lwork,
+	    info);
+
+/*     Determine RANK using incremental condition estimation */
+
+    work[ismin] = 1.;
+    work[ismax] = 1.;
+    smax = (d__1 = a[a_dim1 + 1], abs(d__1));
+    smin = smax;
+    if ((d__1 = a[a_dim1 + 1], abs(d__1)) == 0.) {
+	goto L70;
+    } else {
+	*rank = 1;
+    }
+
+L10:
+    if (*rank < mn) {
+	i__ = *rank + 1;
+	dlaic1_(&c__2, rank, &work[ismin], &smin, &a[i__ * a_dim1 + 1], &a[
+		i__ + i__ * a_dim1], &sminpr, &s1, &c1);
+	dlaic1_(&c__1, rank, &work[ismax], &smax, &a[i__ * a_dim1 + 1], &a[
+		i__ + i__ * a_dim1], &smaxpr, &s2, &c2);
+
+	if (smaxpr * *rcond <= sminpr) {
+	    i__1 = *rank;
+	    for (i__ = 1; i__ <= i__1; ++i__) {
+		work[ismin + i__ - 1] = s1 * work[ismin + i__ - 1];
+		work[ismax + i__ - 1] = s2 * work[ismax + i__ - 1];
+/* L20: */
+	    }
+	    work[ismin + *rank] = c1;
+	    work[ismax + *rank] = c2;
+	    smin = sminpr;
+	    smax = smaxpr;
+	    ++(*rank);
+	    goto L10;
+	}
+    }
+
+/*     Logically partition R = [ R11 R12 ] */
+/*                             [  0  R22 ] */
+/*     where R11 = R(1:RANK,1:RANK) */
+
+/*     [R11,R12] = [ T11, 0 ] * Y */
+
+    if (*rank < *n) {
+	dtzrzf_(rank, n, &a[a_offset], lda, &tau[mn + 1], &work[1], lwork,
+		info);
+    }
+
+/*     Undo scaling of T11; the reflectors are invariant under scaling */
+
+    if (iascl == 1) {
+	dlascl_("U", &c__0, &c__0, &smlnum, &anrm, rank, rank, &a[a_offset],
+		lda, info);
+    } else if (iascl == 2) {
+	dlascl_("U", &c__0, &c__0, &bignum, &anrm, rank, rank, &a[a_offset],
+		lda, info);
+    }
+
+L70:
+    work[1] = (doublereal) lwkopt;
+
+    return 0;
+
+/*     End of DGELSYF */
+
+} /* dgelsyf_ */
@@ -0,0 +1,431 @@
+/* dgephi.c -- DGEPHI, matrix phi functions for exponential integrators. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__0 = 0;
+static integer c__1 = 1;
+static doublereal c_b8 = 0.;
+static doublereal c_b9 = 1.;
+static doublereal c_b10 = 2.;
+
+/* Subroutine */ int dgephi_(char *fact, char *balanc, integer *n, integer *
+	p, doublereal *t, doublereal *a, integer *lda, doublereal *phi,
+	integer *ldphi, doublereal *work, integer *lwork, integer *iwork,
+	integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, phi_dim1, phi_dim2, phi_offset, i__1, i__2,
+	    i__3;
+    doublereal d__1, d__2;
+
+    /* Builtin functions */
+    double log(doublereal), d_int(doublereal *), pow_di(doublereal *,
+	    integer *);
+
+    /* Local variables */
+    integer i__, j, k, m, s, ii, nb, nn, ib2, ib3, ib4, ip, iq, ilo, ihi,
+	    ierr, iscl;
+    doublereal c__[25], r1, r2, r3, r4, tr, fac;
+    logical nofact, lquery;
+    extern logical lsame_(char *, char *);
+    extern doublereal dlange_(char *, integer *, integer *, doublereal *,
+	    integer *, doublereal *);
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dscal_(
+	    integer *, doublereal *, doublereal *, integer *), daxpy_(integer
+	    *, doublereal *, doublereal *, integer *, doublereal *, integer *)
+	    , dswap_(integer *, doublereal *, integer *, doublereal *,
+	    integer *), dgebal_(char *, integer *, doublereal *, integer *,
+	    integer *, integer *, doublereal *, integer *), dlacpy_(char *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *), dlascl_(char *, integer *, integer *, doublereal *,
+	    doublereal *, integer *, integer *, doublereal *, integer *,
+	    integer *), dlaset_(char *, integer *, integer *, doublereal *,
+	    doublereal *, doublereal *, integer *), xerbla_(char *, integer *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGEPHI computes the matrix functions phi_k( T*A ), k = 0, ..., P, of */
+/*  a real N-by-N matrix A scaled by a real scalar T, where */
+
+/*     phi_0( Z ) = exp( Z ),   phi_k( Z ) = sum_{i>=0} Z**i / (i+k)!, */
+
+/*  so that phi_k( Z ) = Z*phi_(k+1)( Z ) + I/k!.  These are the */
+/*  functions needed by exponential integrators such as exponential */
+/*  Rosenbrock and exponential time differencing methods. */
+
+/*  As in DGEXPM, A is balanced first, and the balancing and the powers */
+/*  of A are kept in WORK and IWORK so that a further call with */
+/*  FACT = 'F' computes the functions for a new value of T only. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  FACT    (input) CHARACTER*1 */
+/*          Specifies whether the matrix A has already been processed: */
+/*          = 'N':  A is balanced and its powers are formed. */
+/*          = 'F':  A, WORK and IWORK contain the output of a previous */
+/*                  call to DGEPHI for the same N; only T and P may */
+/*                  differ. */
+
+/*  BALANC  (input) CHARACTER*1 */
+/*          Specifies the balancing of A, as in DGEBAL: */
+/*          = 'N':  do not permute or scale; */
+/*          = 'P':  permute only; */
+/*          = 'S':  scale only; */
+/*          = 'B':  both permute and scale. */
+/*          Not referenced if FACT = 'F'. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  P       (input) INTEGER */
+/*          The index of the last function computed.  P >= 0. */
+
+/*  T       (input) DOUBLE PRECISION */
+/*          The scalar T. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry with FACT = 'N', the matrix A.  On exit, A is */
+/*          overwritten by the balanced matrix, as returned by DGEBAL. */
+/*          With FACT = 'F', A is an input argument and must be as */
+/*          returned by the previous call. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  PHI     (output) DOUBLE PRECISION array, dimension (LDPHI,N,0:P) */
+/*          PHI(:,:,k) holds phi_k( T*A ) of the original A. */
+
+/*  LDPHI   (input) INTEGER */
+/*          The leading dimension of the array PHI.  LDPHI >= max(1,N). */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (LWORK) */
+/*          On exit, WORK(1:3*N*N+N+1) holds the balancing and the */
+/*          powers of A for a later call with FACT = 'F'. */
+/*          If LWORK = -1, WORK(1) returns the required LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  LWORK >= 5*N*N+N+1. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the required size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  IWORK   (workspace/output) INTEGER array, dimension (2) */
+/*          On exit, ILO and IHI from DGEBAL. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The method is the modified scaling and squaring method of */
+/*  B. Skaflestad and W.M. Wright, 'The scaling and modified squaring */
+/*  method for matrix functions related to the exponential', Appl. */
+/*  Numer. Math. 59 (2009), with Taylor instead of Pade approximants. */
+/*  s is the smallest integer such that X = T*A/2**s has ||X||_1 <= 1. */
+/*  phi_P( X ) is evaluated from its Taylor polynomial of degree */
+/*  m <= 20, a multiple of 4 large enough that the truncation error is */
+/*  below the unit roundoff, by the Paterson-Stockmeyer scheme in */
+/*  powers of X**4, and phi_k( X ), k = P-1, ..., 0, by the recurrence */
+/*  above.  Each of the s squarings applies */
+
+/*     phi_k( 2*X ) = ( phi_0( X )*phi_k( X ) */
+/*                      + sum_{j=1}^k phi_j( X )/(k-j)! ) / 2**k. */
+
+/*  The powers B**2, B**3 and B**4 of B = A/||A||_1 do not depend on T */
+/*  and are the part kept for FACT = 'F'. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    phi_dim1 = *ldphi;
+    phi_dim2 = *n;
+    phi_offset = 1 + phi_dim1;
+    phi -= phi_offset;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    nofact = lsame_(fact, "N");
+    lquery = *lwork == -1;
+    nn = *n * *n;
+    if (! nofact && ! lsame_(fact, "F")) {
+	*info = -1;
+    } else if (nofact && ! lsame_(balanc, "N") && ! lsame_(balanc, "P") &&
+	     ! lsame_(balanc, "S") && ! lsame_(balanc, "B")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*p < 0) {
+	*info = -4;
+    } else if (*lda < max(1,*n)) {
+	*info = -7;
+    } else if (*ldphi < max(1,*n)) {
+	*info = -9;
+    } else if (*lwork < nn * 5 + *n + 1 && ! lquery) {
+	*info = -11;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGEPHI", &i__1);
+	return 0;
+    } else if (lquery) {
+	work[1] = (doublereal) (nn * 5 + *n + 1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n == 0) {
+	return 0;
+    }
+
+/*     WORK(1) holds ||A||_1, WORK(ISCL) the balancing factors and */
+/*     WORK(IB2), WORK(IB3), WORK(IB4) the powers of B.  WORK(IP) and */
+/*     WORK(IQ) are workspace. */
+
+    iscl = 2;
+    ib2 = iscl + *n;
+    ib3 = ib2 + nn;
+    ib4 = ib3 + nn;
+    ip = ib4 + nn;
+    iq = ip + nn;
+
+    if (nofact) {
+	dgebal_(balanc, n, &a[a_offset], lda, &iwork[1], &iwork[2], &work[
+		iscl], &ierr);
+	work[1] = dlange_("1", n, n, &a[a_offset], lda, &work[ip]);
+	if (work[1] > 0.) {
+	    dlacpy_("Full", n, n, &a[a_offset], lda, &work[ip], n);
+	    dlascl_("G", &c__0, &c__0, &work[1], &c_b9, n, n, &work[ip], n,
+		    &ierr);
+	    dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[ip],
+		    n, &work[ip], n, &c_b8, &work[ib2], n);
+	    dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[ib2],
+		     n, &work[ip], n, &c_b8, &work[ib3], n);
+	    dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[ib2],
+		     n, &work[ib2], n, &c_b8, &work[ib4], n);
+	} else {
+	    i__1 = nn * 3;
+	    dlaset_("Full", &i__1, &c__1, &c_b8, &c_b8, &work[ib2], &i__1);
+	}
+    }
+    ilo = iwork[1];
+    ihi = iwork[2];
+
+/*     Choose s and the degree m, and set the Taylor coefficients */
+/*     C(i) = 1/(i+P)! of phi_P */
+
+    r1 = abs(*t) * work[1];
+    s = 0;
+    if (r1 > 1.) {
+	d__1 = log(r1) / log(2.);
+	d__1 = min(d__1,1100.);
+	s = (integer) d_int(&d__1);
+	if ((doublereal) s < d__1) {
+	    ++s;
+	}
+    }
+    i__1 = -s;
+    tr = *t * pow_di(&c_b10, &i__1);
+    r1 *= pow_di(&c_b10, &i__1);
+    r2 = r1 * r1;
+    r3 = r2 * r1;
+    r4 = r2 * r2;
+
+    fac = 1.;
+    i__1 = *p;
+    for (i__ = 2; i__ <= i__1; ++i__) {
+	fac *= (doublereal) i__;
+/* L10: */
+    }
+    d__1 = r1;
+    for (m = 1; m <= 20; ++m) {
+	c__[m - 1] = 1. / fac;
+	fac *= (doublereal) (m + *p);
+	d__1 *= r1 / (doublereal) (m + 1);
+	if (m % 4 == 0 && d__1 <= 5.55e-17) {
+	    goto L20;
+	}
+/* L15: */
+    }
+    m = 20;
+L20:
+    c__[m] = 1. / fac;
+
+/*     phi_P( X ) = sum_{k=0}^{m/4} C_k( X )*( X**4 )**k, where */
+/*     C_k( X ) = sum_{i=0}^{3} C(4k+i)*X**i, by Horner's rule in X**4 */
+
+    nb = m / 4;
+    dlaset_("Full", n, n, &c_b8, &c__[m], &work[ip], n);
+    for (k = nb - 1; k >= 0; --k) {
+	dgemm_("No transpose", "No transpose", n, n, n, &r4, &work[ip], n, &
+		work[ib4], n, &c_b8, &work[iq], n);
+	i__1 = *n;
+	for (i__ = 0; i__ < i__1; ++i__) {
+	    work[iq + i__ * (*n + 1)] += c__[k * 4];
+/* L30: */
+	}
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    d__1 = c__[(k << 2) + 1] * tr;
+	    daxpy_(n, &d__1, &a[j * a_dim1 + 1], &c__1, &work[iq + (j - 1) *
+		    *n], &c__1);
+/* L40: */
+	}
+	d__1 = c__[(k << 2) + 2] * r2;
+	daxpy_(&nn, &d__1, &work[ib2], &c__1, &work[iq], &c__1);
+	d__1 = c__[(k << 2) + 3] * r3;
+	if (*t < 0.) {
+	    d__1 = -d__1;
+	}
+	daxpy_(&nn, &d__1, &work[ib3], &c__1, &work[iq], &c__1);
+	i__ = ip;
+	ip = iq;
+	iq = i__;
+/* L50: */
+    }
+    dlacpy_("Full", n, n, &work[ip], n, &phi[(*p * phi_dim2 + 1) *
+	    phi_dim1 + 1], ldphi);
+
+/*     phi_k( X ) = X*phi_(k+1)( X ) + I/k! */
+
+    fac = 1.;
+    i__1 = *p;
+    for (i__ = 2; i__ <= i__1; ++i__) {
+	fac *= (doublereal) i__;
+/* L60: */
+    }
+    for (k = *p - 1; k >= 0; --k) {
+	if (k > 0) {
+	    fac /= (doublereal) (k + 1);
+	} else {
+	    fac = 1.;
+	}
+	dgemm_("No transpose", "No transpose", n, n, n, &tr, &a[a_offset],
+		lda, &phi[((k + 1) * phi_dim2 + 1) * phi_dim1 + 1], ldphi, &
+		c_b8, &phi[(k * phi_dim2 + 1) * phi_dim1 + 1], ldphi);
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    phi[i__ + (i__ + k * phi_dim2) * phi_dim1] += 1. / fac;
+/* L70: */
+	}
+/* L80: */
+    }
+
+/*     Undo the scaling: s times, for k = P, ..., 1, */
+/*     phi_k := ( phi_0*phi_k + sum_{j=1}^k phi_j/(k-j)! ) / 2**k, */
+/*     and then phi_0 := phi_0**2 */
+
+    i__1 = s;
+    for (ii = 1; ii <= i__1; ++ii) {
+	for (k = *p; k >= 1; --k) {
+	    dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &phi[
+		    phi_offset], ldphi, &phi[(k * phi_dim2 + 1) * phi_dim1 +
+		    1], ldphi, &c_b8, &work[ip], n);
+	    fac = 1.;
+	    for (j = k; j >= 1; --j) {
+		i__2 = *n;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    d__1 = 1. / fac;
+		    daxpy_(n, &d__1, &phi[(i__ + j * phi_dim2) * phi_dim1 + 1],
+			     &c__1, &work[ip + (i__ - 1) * *n], &c__1);
+/* L90: */
+		}
+		fac *= (doublereal) (k - j + 1);
+/* L100: */
+	    }
+	    i__2 = -k;
+	    d__2 = pow_di(&c_b10, &i__2);
+	    dscal_(&nn, &d__2, &work[ip], &c__1);
+	    dlacpy_("Full", n, n, &work[ip], n, &phi[(k * phi_dim2 + 1) *
+		    phi_dim1 + 1], ldphi);
+/* L110: */
+	}
+	dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &phi[
+		phi_offset], ldphi, &phi[phi_offset], ldphi, &c_b8, &work[ip],
+		 n);
+	dlacpy_("Full", n, n, &work[ip], n, &phi[phi_offset], ldphi);
+/* L120: */
+    }
+
+/*     Undo the balancing, phi_k := P*D*phi_k*inv(D)*P' */
+
+    i__1 = *p;
+    for (k = 0; k <= i__1; ++k) {
+	i__2 = ihi;
+	for (i__ = ilo; i__ <= i__2; ++i__) {
+	    if (work[iscl + i__ - 1] != 1.) {
+		dscal_(n, &work[iscl + i__ - 1], &phi[i__ + (k * phi_dim2 + 1)
+			 * phi_dim1], ldphi);
+		d__1 = 1. / work[iscl + i__ - 1];
+		dscal_(n, &d__1, &phi[(i__ + k * phi_dim2) * phi_dim1 + 1], &
+			c__1);
+	    }
+/* L130: */
+	}
+	i__2 = *n;
+	for (ii = 1; ii <= i__2; ++ii) {
+	    i__ = ii;
+	    if (i__ >= ilo && i__ <= ihi) {
+		goto L140;
+	    }
+	    if (i__ < ilo) {
+		i__ = ilo - ii;
+	    }
+	    i__3 = (integer) work[iscl + i__ - 1];
+	    if (i__3 == i__) {
+		goto L140;
+	    }
+	    dswap_(n, &phi[i__ + (k * phi_dim2 + 1) * phi_dim1], ldphi, &phi[
+		    i__3 + (k * phi_dim2 + 1) * phi_dim1], ldphi);
+	    dswap_(n, &phi[(i__ + k * phi_dim2) * phi_dim1 + 1], &c__1, &phi[
+		    (i__3 + k * phi_dim2) * phi_dim1 + 1], &c__1);
+L140:
+	    ;
+	}
+/* L150: */
+    }
+    return 0;
+
+/*     End of DGEPHI */
+
+} /* dgephi_ */
@@ -0,0 +1,437 @@
+/* dgeqpr.c -- DGEQPR, QR with randomized column pivoting. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__3 = 3;
+static doublereal c_b10 = 1.;
+static doublereal c_b11 = 0.;
+
+/* Subroutine */ int dgeqpr_(integer *m, integer *n, doublereal *a, integer *
+	lda, integer *jpvt, doublereal *tau, doublereal *tol, integer *rank,
+	integer *iseed, doublereal *work, integer *lwork, integer *iwork,
+	integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1, i__2, i__3;
+    doublereal d__1, d__2;
+
+    /* Local variables */
+    integer i__, j, l, r__, s, c__, jn, kb, nb, nr, itb, iwb, ierr, iwrk,
+	    lwrk, minmn, minwrk, lwkopt;
+    doublereal ulp, anrm, dmin__, tnrm, ssq, rnrm, thresh;
+    extern doublereal dnrm2_(integer *, doublereal *, integer *);
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dswap_(integer
+	    *, doublereal *, integer *, doublereal *, integer *), dtrmm_(char
+	    *, char *, char *, char *, integer *, integer *, doublereal *,
+	    doublereal *, integer *, doublereal *, integer *), dtrsm_(char *,
+	     char *, char *, char *, integer *, integer *, doublereal *,
+	    doublereal *, integer *, doublereal *, integer *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dgeqp3_(integer *, integer *, doublereal *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    integer *), dgeqrf_(integer *, integer *, doublereal *, integer *,
+	     doublereal *, doublereal *, integer *, integer *), dlacpy_(char *
+, integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *), dlarnv_(integer *, integer *, integer *, doublereal *)
+	    , dlaset_(char *, integer *, integer *, doublereal *, doublereal *
+, doublereal *, integer *), xerbla_(char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    extern /* Subroutine */ int dormqr_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, doublereal *,
+	    integer *, doublereal *, integer *, integer *);
+    logical lquery;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGEQPR computes a QR factorization with column pivoting of a */
+/*  real M-by-N matrix A: */
+
+/*     A*P = Q*R, */
+
+/*  choosing the pivot columns by randomized sampling, and optionally */
+/*  stops as soon as the numerical rank of A has been revealed. */
+
+/*  A Gaussian L-by-M test matrix OMEGA, L = MIN(NB+8,M), compresses A */
+/*  to the sample B = OMEGA*A.  Each step of NB columns selects the */
+/*  pivots by DGEQP3 applied to the small matrix B, factors the chosen */
+/*  panel with DGEQRF and updates the trailing matrix with DORMQR, and */
+/*  downdates B to a sample of the trailing matrix without touching A */
+/*  again.  All the work on A is done with Level-3 BLAS; the pivoting */
+/*  on B costs O(L*L*N) per step. */
+
+/*  If TOL > 0, the factorization is stopped after the first step whose */
+/*  trailing matrix has Frobenius norm at most TOL*||A||_F, and RANK is */
+/*  the smallest K such that the part of R below its K-th row, together */
+/*  with the unfactored trailing matrix, has norm at most TOL*||A||_F. */
+/*  For matrices of low numerical rank only O(RANK) columns are */
+/*  factored. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of the matrix A. M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the M-by-N matrix A. */
+/*          On exit, the upper triangle of A(1:RANK,1:N) contains the */
+/*          RANK-by-N upper trapezoidal matrix R1 of the factorization */
+/*          A*P ~ Q1*R1, where Q1 holds the first RANK columns of Q; */
+/*          the elements below the diagonal of the first RANK columns, */
+/*          with the array TAU, represent Q1 as a product of RANK */
+/*          elementary reflectors, as returned by DGEQP3.  If TOL <= 0, */
+/*          RANK = min(M,N) and the factorization is complete. */
+/*          If RANK < min(M,N), rows RANK+1:M of A(:,RANK+1:N) hold the */
+/*          remaining rows of R computed in the last step, with their */
+/*          reflectors, and the unreduced trailing matrix; the Frobenius */
+/*          norm of these rows of R and of the trailing matrix is at */
+/*          most TOL*||A||_F. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A. LDA >= max(1,M). */
+
+/*  JPVT    (output) INTEGER array, dimension (N) */
+/*          If JPVT(J)=K, then the J-th column of A*P was the */
+/*          the K-th column of A. */
+
+/*  TAU     (output) DOUBLE PRECISION array, dimension (min(M,N)) */
+/*          The scalar factors of the elementary reflectors.  Entries */
+/*          of reflectors that were not computed are set to zero. */
+
+/*  TOL     (input) DOUBLE PRECISION */
+/*          If TOL > 0, the relative tolerance of the truncated mode */
+/*          described above.  If TOL <= 0, A is factored completely. */
+
+/*  RANK    (output) INTEGER */
+/*          The numerical rank of A with respect to TOL if TOL > 0; */
+/*          min(M,N) otherwise. */
+
+/*  ISEED   (input/output) INTEGER array, dimension (4) */
+/*          On entry, the seed of the random number generator used for */
+/*          the test matrix; the array elements must be between 0 and */
+/*          4095, and ISEED(4) must be odd. */
+/*          On exit, the seed is updated. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO=0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  With L = MIN(NB+8,M), */
+/*          LWORK >= L*N + L + MAX( L*M, NB*N, 3*N+1 ) if min(M,N) > 0, */
+/*          where NB is the optimal block size of DGEQRF; LWORK >= 1 */
+/*          otherwise.  For optimal performance LWORK should be at least */
+/*          L*N + L + MAX( L*M, 2*N+( N+1 )*NB ). */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  IWORK   (workspace) INTEGER array, dimension (3*N) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit. */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The matrix Q is represented as a product of elementary reflectors */
+
+/*     Q = H(1) H(2) . . . H(k), where k = min(m,n). */
+
+/*  Each H(i) has the form */
+
+/*     H(i) = I - tau * v * v' */
+
+/*  where tau is a real scalar, and v is a real vector with */
+/*  v(1:i-1) = 0 and v(i) = 1; v(i+1:m) is stored on exit in */
+/*  A(i+1:m,i), and tau in TAU(i). */
+
+/*  The sample is downdated as in J. A. Duersch and M. Gu, Randomized */
+/*  QR with column pivoting, SIAM J. Sci. Comput. 39 (2017): if DGEQP3 */
+/*  gives B*P = U*[ S11 S12; 0 S22 ] and the panel is factored as */
+/*  A(:,J) = Q1*R11 with trailing block R12, the sample of the trailing */
+/*  matrix is [ S12 - S11*inv(R11)*R12; S22 ].  When R11 is numerically */
+/*  singular, a fresh sample of the trailing matrix is drawn instead. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test input arguments */
+/*     ==================== */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --jpvt;
+    --tau;
+    --iseed;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    lquery = *lwork == -1;
+    if (*m < 0) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*lda < max(1,*m)) {
+	*info = -4;
+    }
+
+    minmn = min(*m,*n);
+    nb = ilaenv_(&c__1, "DGEQRF", " ", m, n, &c_n1, &c_n1);
+    nb = max(nb,1);
+    l = min(nb + 8,*m);
+    if (*info == 0) {
+	if (minmn == 0) {
+	    minwrk = 1;
+	    lwkopt = 1;
+	} else {
+/* Computing MAX */
+	    i__1 = l * *m, i__2 = nb * *n, i__1 = max(i__1,i__2), i__2 = *n *
+		    3 + 1;
+	    minwrk = l * *n + l + max(i__1,i__2);
+/* Computing MAX */
+	    i__1 = l * *m, i__2 = (*n << 1) + (*n + 1) * nb;
+	    lwkopt = l * *n + l + max(i__1,i__2);
+	    lwkopt = max(lwkopt,minwrk);
+	}
+	work[1] = (doublereal) lwkopt;
+	if (*lwork < minwrk && ! lquery) {
+	    *info = -11;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGEQPR", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible. */
+
+    i__1 = *n;
+    for (j = 1; j <= i__1; ++j) {
+	jpvt[j] = j;
+/* L10: */
+    }
+    *rank = 0;
+    if (minmn == 0) {
+	return 0;
+    }
+
+    anrm = dlange_("F", m, n, &a[a_offset], lda, &work[1]);
+    thresh = *tol * anrm;
+    if (*tol > 0. && anrm == 0.) {
+	i__1 = minmn;
+	for (j = 1; j <= i__1; ++j) {
+	    tau[j] = 0.;
+/* L20: */
+	}
+	return 0;
+    }
+    ulp = dlamch_("Precision");
+
+/*     Workspace: B in WORK(IWB), L-by-N; the scalar factors of its */
+/*     QR factorization in WORK(ITB); the rest in WORK(IWRK). */
+
+    iwb = 1;
+    itb = iwb + l * *n;
+    iwrk = itb + l;
+    lwrk = *lwork - iwrk + 1;
+
+/*     Sample B = OMEGA*A */
+
+    i__1 = l * *m;
+    dlarnv_(&c__3, &iseed[1], &i__1, &work[iwrk]);
+    dgemm_("No transpose", "No transpose", &l, n, m, &c_b10, &work[iwrk], &
+	    l, &a[a_offset], lda, &c_b11, &work[iwb], &l);
+
+    j = 1;
+L30:
+    kb = min(nb,minmn - j + 1);
+    nr = *n - j + 1;
+    jn = j + kb;
+
+/*     Select the pivots by QR with column pivoting of the sample */
+/*     B(:,J:N), which also reduces it to [ S11 S12; 0 S22 ] */
+
+    i__1 = nr;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	iwork[i__] = 0;
+/* L40: */
+    }
+    dgeqp3_(&l, &nr, &work[iwb + (j - 1) * l], &l, &iwork[1], &work[itb], &
+	    work[iwrk], &lwrk, &ierr);
+
+/*     Apply the same permutation to A(:,J:N) and JPVT(J:N). */
+/*     IWORK(N+I) is the column now at local position I and */
+/*     IWORK(2*N+C) the current position of local column C. */
+
+    i__1 = nr;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	iwork[*n + i__] = i__;
+	iwork[(*n << 1) + i__] = i__;
+/* L50: */
+    }
+    i__1 = nr;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	s = iwork[(*n << 1) + iwork[i__]];
+	if (s != i__) {
+	    dswap_(m, &a[(j + i__ - 1) * a_dim1 + 1], &c__1, &a[(j + s - 1) *
+		    a_dim1 + 1], &c__1);
+	    c__ = jpvt[j + i__ - 1];
+	    jpvt[j + i__ - 1] = jpvt[j + s - 1];
+	    jpvt[j + s - 1] = c__;
+	    c__ = iwork[*n + i__];
+	    iwork[*n + i__] = iwork[*n + s];
+	    iwork[*n + s] = c__;
+	    iwork[(*n << 1) + iwork[*n + i__]] = i__;
+	    iwork[(*n << 1) + iwork[*n + s]] = s;
+	}
+/* L60: */
+    }
+
+/*     Factor the panel A(J:M,J:J+KB-1) and update the trailing matrix */
+
+    i__1 = *m - j + 1;
+    dgeqrf_(&i__1, &kb, &a[j + j * a_dim1], lda, &tau[j], &work[iwrk], &
+	    lwrk, &ierr);
+    if (jn <= *n) {
+	i__1 = *m - j + 1;
+	i__2 = *n - jn + 1;
+	dormqr_("Left", "Transpose", &i__1, &i__2, &kb, &a[j + j * a_dim1],
+		lda, &tau[j], &a[j + jn * a_dim1], lda, &work[iwrk], &lwrk, &
+		ierr);
+    }
+
+    if (*tol > 0.) {
+
+/*        Truncated mode: stop if the trailing matrix is negligible, and */
+/*        find the numerical rank among the rows of the last panel */
+
+	tnrm = 0.;
+	if (jn <= *m && jn <= *n) {
+	    i__1 = *m - jn + 1;
+	    i__2 = *n - jn + 1;
+	    tnrm = dlange_("F", &i__1, &i__2, &a[jn + jn * a_dim1], lda, &
+		    work[1]);
+	}
+	if (tnrm <= thresh) {
+	    ssq = tnrm * tnrm;
+	    r__ = jn - 1;
+	    i__1 = j;
+	    for (i__ = jn - 1; i__ >= i__1; --i__) {
+		i__2 = *n - i__ + 1;
+		rnrm = dnrm2_(&i__2, &a[i__ + i__ * a_dim1], lda);
+		if (ssq + rnrm * rnrm > thresh * thresh) {
+		    goto L80;
+		}
+		ssq += rnrm * rnrm;
+		r__ = i__ - 1;
+/* L70: */
+	    }
+L80:
+	    *rank = r__;
+	    i__1 = minmn;
+	    for (i__ = jn; i__ <= i__1; ++i__) {
+		tau[i__] = 0.;
+/* L90: */
+	    }
+	    work[1] = (doublereal) lwkopt;
+	    return 0;
+	}
+    }
+    if (jn > minmn) {
+	goto L120;
+    }
+
+/*     Downdate the sample to B(:,JN:N) = [ S12 - S11*inv(R11)*R12; S22 ] */
+/*     unless R11 is numerically singular */
+
+    dmin__ = (d__1 = a[j + j * a_dim1], abs(d__1));
+    i__1 = jn - 1;
+    for (i__ = j + 1; i__ <= i__1; ++i__) {
+/* Computing MIN */
+	d__2 = (d__1 = a[i__ + i__ * a_dim1], abs(d__1));
+	dmin__ = min(dmin__,d__2);
+/* L100: */
+    }
+    nr = *n - jn + 1;
+    if (dmin__ > ulp * anrm) {
+	dlacpy_("Full", &kb, &nr, &a[j + jn * a_dim1], lda, &work[iwrk], &kb);
+	dtrsm_("Left", "Upper", "No transpose", "Non-unit", &kb, &nr, &c_b10,
+		&a[j + j * a_dim1], lda, &work[iwrk], &kb);
+	dtrmm_("Left", "Upper", "No transpose", "Non-unit", &kb, &nr, &c_b10,
+		&work[iwb + (j - 1) * l], &l, &work[iwrk], &kb);
+	i__1 = nr;
+	for (c__ = 1; c__ <= i__1; ++c__) {
+	    i__2 = kb;
+	    for (i__ = 1; i__ <= i__2; ++i__) {
+		work[iwb + (jn + c__ - 2) * l + i__ - 1] -= work[iwrk + (c__ -
+			1) * kb + i__ - 1];
+/* L110: */
+	    }
+	}
+	if (l - kb > 1) {
+	    i__1 = l - kb - 1;
+	    dlaset_("Lower", &i__1, &nr, &c_b11, &c_b11, &work[iwb + (jn - 1)
+		    * l + kb + 1], &l);
+	}
+    } else {
+	i__3 = *m - jn + 1;
+	i__1 = l * i__3;
+	dlarnv_(&c__3, &iseed[1], &i__1, &work[iwrk]);
+	dgemm_("No transpose", "No transpose", &l, &nr, &i__3, &c_b10, &work[
+		iwrk], &l, &a[jn + jn * a_dim1], lda, &c_b11, &work[iwb + (jn
+		- 1) * l], &l);
+    }
+    j = jn;
+    goto L30;
+
+L120:
+    *rank = minmn;
+    work[1] = (doublereal) lwkopt;
+    return 0;
+
+/*     End of DGEQPR */
+
+} /* dgeqpr_ */
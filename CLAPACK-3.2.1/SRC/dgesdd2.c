@@ -0,0 +1,469 @@
+/* dgesdd2.c -- DGESDD2, SVD through a two-stage bidiagonal reduction. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__0 = 0;
+static doublereal c_b22 = 1.;
+static doublereal c_b23 = 0.;
+
+/* Subroutine */ int dgesdd2_(char *jobz, integer *m, integer *n,
+	doublereal *a, integer *lda, doublereal *s, doublereal *u, integer *
+	ldu, doublereal *vt, integer *ldvt, doublereal *work, integer *lwork,
+	integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, u_dim1, u_offset, vt_dim1, vt_offset, i__1,
+	    i__2, i__3;
+
+    /* Builtin functions */
+    double sqrt(doublereal);
+
+    /* Local variables */
+    integer i__, j, nb, mn, mx, iq, ie, ipt, iub, iab, ldab, ivtb, ipa,
+	    ldpa, ipu, ldpu, ipvt, ldpvt, iscl, itaup, itauq, iwrk, ierr,
+	    lwkmin, lwkopt, lwbnd, nrv;
+    doublereal eps, dum[1], anrm;
+    integer idum[1];
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *);
+    extern logical lsame_(char *, char *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dbdsdc_(char *, char *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, integer *, doublereal *, integer *,
+	    integer *), dgbbrd_(char *, integer *, integer *,
+	    integer *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, integer *, doublereal *, integer *),
+	    dgebnd_(integer *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *, integer *),
+	    dlascl_(char *, integer *, integer *, doublereal *, doublereal *,
+	    integer *, integer *, doublereal *, integer *, integer *),
+	    dlaset_(char *, integer *, integer *, doublereal *, doublereal *,
+	    doublereal *, integer *), xerbla_(char *, integer *), dormlq_(
+	    char *, char *, integer *, integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, integer *), dormqr_(char *, char *, integer *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, integer *, doublereal *, integer *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    doublereal bignum, smlnum;
+    logical wntqn, wntqs, trans, lquery;
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGESDD2 computes the singular value decomposition (SVD) of a real */
+/*  M-by-N matrix A, optionally computing the left and right singular */
+/*  vectors.  It performs the same task as DGESDD with JOBZ = 'N' or 'S', */
+/*  but reduces A to bidiagonal form in two stages: */
+
+/*     1. A is reduced to upper band form with bandwidth NB by DGEBND, */
+/*        using only Level 3 BLAS updates of the trailing matrix; */
+/*     2. the band matrix is reduced to bidiagonal form by DGBBRD. */
+
+/*  The bidiagonal SVD is then computed by DBDSDC (divide and conquer). */
+
+/*  For large matrices the one-stage reduction in DGEBRD is limited by */
+/*  memory bandwidth, since half of its flops are matrix-vector */
+/*  products; the two-stage reduction moves that work into DORMQR and */
+/*  DORMLQ.  When singular vectors are wanted the second stage has to */
+/*  accumulate its plane rotations, so the two-stage path pays off */
+/*  mainly when JOBZ = 'N' or when M is much larger than NB. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  JOBZ    (input) CHARACTER*1 */
+/*          Specifies options for computing the singular vectors: */
+/*          = 'S':  the first min(M,N) columns of U and the first */
+/*                  min(M,N) rows of V**T are returned in the arrays U */
+/*                  and VT; */
+/*          = 'N':  no columns of U or rows of V**T are computed. */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of the input matrix A.  M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of the input matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the M-by-N matrix A. */
+/*          On exit, the contents of A are destroyed. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  S       (output) DOUBLE PRECISION array, dimension (min(M,N)) */
+/*          The singular values of A, sorted so that S(i) >= S(i+1). */
+
+/*  U       (output) DOUBLE PRECISION array, dimension (LDU,min(M,N)) */
+/*          If JOBZ = 'S', U contains the left singular vectors of A. */
+/*          If JOBZ = 'N', U is not referenced. */
+
+/*  LDU     (input) INTEGER */
+/*          The leading dimension of the array U.  LDU >= 1; if */
+/*          JOBZ = 'S', LDU >= M. */
+
+/*  VT      (output) DOUBLE PRECISION array, dimension (LDVT,N) */
+/*          If JOBZ = 'S', VT contains the first min(M,N) rows of V**T. */
+/*          If JOBZ = 'N', VT is not referenced. */
+
+/*  LDVT    (input) INTEGER */
+/*          The leading dimension of the array VT.  LDVT >= 1; if */
+/*          JOBZ = 'S', LDVT >= min(M,N). */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  With MN = min(M,N), */
+/*          MX = max(M,N) and NB the bandwidth returned by ILAENV for */
+/*          DGEBRD, LWORK >= 1 and */
+/*          if JOBZ = 'N', */
+/*             LWORK >= TR + MN*(NB+4) + MAX(MX*NB,4*MN), */
+/*          if JOBZ = 'S', */
+/*             LWORK >= TR + MN*(NB+4) + 4*MN*MN + MAX(MX*NB,3*MN*MN+4*MN), */
+/*          where TR = 0 if M >= N and TR = MX*MN + MN*MN + MX*MN */
+/*          (JOBZ = 'S') or TR = MX*MN (JOBZ = 'N') if M < N. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  IWORK   (workspace) INTEGER array, dimension (8*min(M,N)) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit. */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
+/*          > 0:  DBDSDC did not converge, updating process failed. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  If M < N, the SVD of A**T is computed and transposed back. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input arguments */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --s;
+    u_dim1 = *ldu;
+    u_offset = 1 + u_dim1;
+    u -= u_offset;
+    vt_dim1 = *ldvt;
+    vt_offset = 1 + vt_dim1;
+    vt -= vt_offset;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    mn = min(*m,*n);
+    mx = max(*m,*n);
+    wntqn = lsame_(jobz, "N");
+    wntqs = lsame_(jobz, "S");
+    trans = *m < *n;
+    lquery = *lwork == -1;
+
+    if (! (wntqn || wntqs)) {
+	*info = -1;
+    } else if (*m < 0) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*lda < max(1,*m)) {
+	*info = -5;
+    } else if (*ldu < 1 || wntqs && *ldu < *m) {
+	*info = -8;
+    } else if (*ldvt < 1 || wntqs && *ldvt < mn) {
+	*info = -10;
+    }
+
+/*     Compute workspace */
+
+    nb = 1;
+    if (*info == 0) {
+	if (mn > 1) {
+/* Computing MAX */
+/* Computing MIN */
+	    i__1 = ilaenv_(&c__1, "DGEBRD", " ", m, n, &c_n1, &c_n1), i__2 =
+		    mn - 1;
+	    nb = max(1,min(i__1,i__2));
+	}
+	lwbnd = mx * nb;
+	lwkmin = mn * (nb + 4);
+	if (wntqn) {
+	    lwkmin += max(lwbnd,mn << 2);
+	} else {
+/* Computing MAX */
+	    i__1 = lwbnd, i__2 = mn * 3 * mn + (mn << 2);
+	    lwkmin = lwkmin + (mn << 2) * mn + max(i__1,i__2);
+	}
+	if (trans) {
+	    lwkmin += mx * mn;
+	    if (wntqs) {
+		lwkmin = lwkmin + mx * mn + mn * mn;
+	    }
+	}
+	lwkmin = max(1,lwkmin);
+	lwkopt = lwkmin;
+	work[1] = (doublereal) lwkopt;
+	if (*lwork < lwkmin && ! lquery) {
+	    *info = -12;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGESDD2", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (mn == 0) {
+	return 0;
+    }
+
+/*     Get machine constants */
+
+    eps = dlamch_("P");
+    smlnum = sqrt(dlamch_("S")) / eps;
+    bignum = 1. / smlnum;
+
+/*     Scale A if max element outside range [SMLNUM,BIGNUM] */
+
+    anrm = dlange_("M", m, n, &a[a_offset], lda, dum);
+    iscl = 0;
+    if (anrm > 0. && anrm < smlnum) {
+	iscl = 1;
+	dlascl_("G", &c__0, &c__0, &anrm, &smlnum, m, n, &a[a_offset], lda, &
+		ierr);
+    } else if (anrm > bignum) {
+	iscl = 1;
+	dlascl_("G", &c__0, &c__0, &anrm, &bignum, m, n, &a[a_offset], lda, &
+		ierr);
+    }
+
+/*     The reduction works on the MX-by-MN matrix PA, which is A itself */
+/*     if M >= N and a transposed copy of A otherwise.  PU (MX-by-MN) */
+/*     and PVT (MN-by-MN) receive its singular vectors. */
+
+    iwrk = 1;
+    if (trans) {
+	ipa = iwrk;
+	ldpa = mx;
+	iwrk = ipa + mx * mn;
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    i__2 = *m;
+	    for (i__ = 1; i__ <= i__2; ++i__) {
+		work[ipa + j - 1 + (i__ - 1) * ldpa] = a[i__ + j * a_dim1];
+/* L10: */
+	    }
+/* L20: */
+	}
+	if (wntqs) {
+	    ipu = iwrk;
+	    ldpu = mx;
+	    ipvt = ipu + mx * mn;
+	    ldpvt = mn;
+	    iwrk = ipvt + mn * mn;
+	}
+    }
+
+    itauq = iwrk;
+    itaup = itauq + mn;
+    ie = itaup + mn;
+    iab = ie + mn;
+    ldab = nb + 1;
+    iwrk = iab + ldab * mn;
+    if (wntqs) {
+	iq = iwrk;
+	ipt = iq + mn * mn;
+	iub = ipt + mn * mn;
+	ivtb = iub + mn * mn;
+	iwrk = ivtb + mn * mn;
+    }
+
+/*     Stage 1: reduce PA to upper band form */
+
+    i__1 = *lwork - iwrk + 1;
+    if (trans) {
+	dgebnd_(&mx, &mn, &nb, &work[ipa], &ldpa, &work[itauq], &work[itaup],
+		&work[iwrk], &i__1, &ierr);
+    } else {
+	dgebnd_(&mx, &mn, &nb, &a[a_offset], lda, &work[itauq], &work[itaup],
+		&work[iwrk], &i__1, &ierr);
+	ipa = 0;
+	ldpa = *lda;
+	ipu = 0;
+	ldpu = *ldu;
+	ipvt = 0;
+	ldpvt = *ldvt;
+    }
+
+/*     Copy the band into AB, in the storage expected by DGBBRD with */
+/*     KL = 0 and KU = NB */
+
+    i__1 = mn;
+    for (j = 1; j <= i__1; ++j) {
+	i__2 = ldab;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    work[iab + i__ - 1 + (j - 1) * ldab] = 0.;
+/* L30: */
+	}
+/* Computing MAX */
+	i__3 = 1, i__2 = j - nb;
+	i__2 = max(i__3,i__2);
+	for (i__ = i__2; i__ <= j; ++i__) {
+	    if (trans) {
+		work[iab + nb + i__ - j + (j - 1) * ldab] = work[ipa + i__ - 1
+			+ (j - 1) * ldpa];
+	    } else {
+		work[iab + nb + i__ - j + (j - 1) * ldab] = a[i__ + j *
+			a_dim1];
+	    }
+/* L40: */
+	}
+/* L50: */
+    }
+
+/*     Stage 2: reduce the band matrix to bidiagonal form, then compute */
+/*     its SVD */
+
+    if (wntqn) {
+	dgbbrd_("N", &mn, &mn, &c__0, &c__0, &nb, &work[iab], &ldab, &s[1], &
+		work[ie], dum, &c__1, dum, &c__1, dum, &c__1, &work[iwrk], &
+		ierr);
+	dbdsdc_("U", "N", &mn, &s[1], &work[ie], dum, &c__1, dum, &c__1, dum,
+		idum, &work[iwrk], &iwork[1], info);
+    } else {
+	dgbbrd_("B", &mn, &mn, &c__0, &c__0, &nb, &work[iab], &ldab, &s[1], &
+		work[ie], &work[iq], &mn, &work[ipt], &mn, dum, &c__1, &work[
+		iwrk], &ierr);
+	dbdsdc_("U", "I", &mn, &s[1], &work[ie], &work[iub], &mn, &work[ivtb],
+		 &mn, dum, idum, &work[iwrk], &iwork[1], info);
+	if (*info != 0) {
+	    goto L60;
+	}
+
+/*        PU = Q1 * ( Q2*UB ), PVT = ( VTB*PT2 ) * P1**T */
+
+	nrv = mx - mn;
+	if (trans) {
+	    dgemm_("N", "N", &mn, &mn, &mn, &c_b22, &work[iq], &mn, &work[iub]
+		    , &mn, &c_b23, &work[ipu], &ldpu);
+	    dlaset_("F", &nrv, &mn, &c_b23, &c_b23, &work[ipu + mn], &ldpu);
+	    i__1 = *lwork - iwrk + 1;
+	    dormqr_("L", "N", &mx, &mn, &mn, &work[ipa], &ldpa, &work[itauq],
+		    &work[ipu], &ldpu, &work[iwrk], &i__1, &ierr);
+	    dgemm_("N", "N", &mn, &mn, &mn, &c_b22, &work[ivtb], &mn, &work[
+		    ipt], &mn, &c_b23, &work[ipvt], &ldpvt);
+	    if (mn > nb) {
+		i__1 = mn - nb;
+		i__2 = *lwork - iwrk + 1;
+		dormlq_("R", "N", &mn, &i__1, &i__1, &work[ipa + nb * ldpa], &
+			ldpa, &work[itaup], &work[ipvt + nb * ldpvt], &ldpvt, &
+			work[iwrk], &i__2, &ierr);
+	    }
+
+/*           A = PVT**T * S * PU**T */
+
+	    i__1 = mn;
+	    for (j = 1; j <= i__1; ++j) {
+		i__2 = mn;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    u[i__ + j * u_dim1] = work[ipvt + j - 1 + (i__ - 1) *
+			    ldpvt];
+/* L70: */
+		}
+		i__2 = mx;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    vt[j + i__ * vt_dim1] = work[ipu + i__ - 1 + (j - 1) *
+			    ldpu];
+/* L80: */
+		}
+/* L90: */
+	    }
+	} else {
+	    dgemm_("N", "N", &mn, &mn, &mn, &c_b22, &work[iq], &mn, &work[iub]
+		    , &mn, &c_b23, &u[u_offset], ldu);
+	    dlaset_("F", &nrv, &mn, &c_b23, &c_b23, &u[mn + 1 + u_dim1], ldu);
+	    i__1 = *lwork - iwrk + 1;
+	    dormqr_("L", "N", &mx, &mn, &mn, &a[a_offset], lda, &work[itauq],
+		    &u[u_offset], ldu, &work[iwrk], &i__1, &ierr);
+	    dgemm_("N", "N", &mn, &mn, &mn, &c_b22, &work[ivtb], &mn, &work[
+		    ipt], &mn, &c_b23, &vt[vt_offset], ldvt);
+	    if (mn > nb) {
+		i__1 = mn - nb;
+		i__2 = *lwork - iwrk + 1;
+		dormlq_("R", "N", &mn, &i__1, &i__1, &a[(nb + 1) * a_dim1 + 1]
+			, lda, &work[itaup], &vt[(nb + 1) * vt_dim1 + 1], ldvt,
+			 &work[iwrk], &i__2, &ierr);
+	    }
+	}
+    }
+
+L60:
+
+/*     Undo scaling if necessary */
+
+    if (iscl == 1) {
+	if (anrm > bignum) {
+	    dlascl_("G", &c__0, &c__0, &bignum, &anrm, &mn, &c__1, &s[1], &mn,
+		     &ierr);
+	}
+	if (anrm < smlnum) {
+	    dlascl_("G", &c__0, &c__0, &smlnum, &anrm, &mn, &c__1, &s[1], &mn,
+		     &ierr);
+	}
+    }
+
+/*     Return optimal workspace in WORK(1) */
+
+    work[1] = (doublereal) lwkopt;
+
+    return 0;
+
+/*     End of DGESDD2 */
+
+} /* dgesdd2_ */
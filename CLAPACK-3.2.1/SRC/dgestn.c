@@ -0,0 +1,263 @@
+/* dgestn.c -- DGESTN, discrete-time Lyapunov (Stein) equation. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c_n1 = -1;
+static doublereal c_b14 = 0.;
+static doublereal c_b15 = 1.;
+
+/* Subroutine */ int dgestn_(char *fact, char *trana, integer *n, doublereal
+	*a, integer *lda, doublereal *u, integer *ldu, doublereal *c__,
+	integer *ldc, doublereal *scale, doublereal *wr, doublereal *wi,
+	doublereal *work, integer *lwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, u_dim1, u_offset, c_dim1, c_offset, i__1;
+
+    /* Local variables */
+    integer sdim, ierr;
+    logical nofact, notrna, bwork[1], lquery;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dgees_(char *, char *, L_fp, integer *,
+	    doublereal *, integer *, integer *, doublereal *, doublereal *,
+	    doublereal *, integer *, doublereal *, integer *, logical *,
+	    integer *), dgemm_(char *, char *, integer *, integer *, integer *
+, doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, integer *), xerbla_(char *, integer *),
+	     dtrstn_(char *, char *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, integer *);
+    integer minwrk, maxwrk;
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGESTN solves the real discrete-time Lyapunov (Stein) matrix */
+/*  equation */
+
+/*     op(A)*X*op(A)**T - X = scale*C, */
+
+/*  where op(A) = A or A**T, A and C are N-by-N, and scale is an output */
+/*  scale factor, set <= 1 to avoid overflow in X.  If C is symmetric, */
+/*  so is X. */
+
+/*  A is reduced to real Schur form A = U*T*U**T by DGEES (unless the */
+/*  factorization is supplied), the right hand side is transformed to */
+/*  U**T*C*U, the triangular equation is solved by the recursive blocked */
+/*  solver DTRSTN, and the solution is transformed back.  The equation */
+/*  has a unique solution if and only if lambda*mu != 1 for all */
+/*  eigenvalues lambda, mu of A. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  FACT    (input) CHARACTER*1 */
+/*          = 'N': A is reduced to real Schur form by DGEES; */
+/*          = 'F': on entry A contains the real Schur form T of the */
+/*                 matrix and U the orthogonal Schur vectors, e.g. from */
+/*                 a previous call with FACT = 'N'. */
+
+/*  TRANA   (input) CHARACTER*1 */
+/*          Specifies the option op(A): */
+/*          = 'N': solve A*X*A**T - X = scale*C */
+/*          = 'T': solve A**T*X*A - X = scale*C */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrices A, C and X.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, if FACT = 'N', the matrix A; if FACT = 'F', its */
+/*          real Schur form T.  On exit, the real Schur form T. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  U       (input or output) DOUBLE PRECISION array, dimension (LDU,N) */
+/*          If FACT = 'N', U is an output argument and on exit contains */
+/*          the orthogonal matrix of Schur vectors of A. */
+/*          If FACT = 'F', U is an input argument and must contain the */
+/*          Schur vectors. */
+
+/*  LDU     (input) INTEGER */
+/*          The leading dimension of the array U.  LDU >= max(1,N). */
+
+/*  C       (input/output) DOUBLE PRECISION array, dimension (LDC,N) */
+/*          On entry, the right hand side C. */
+/*          On exit, C is overwritten by the solution X. */
+
+/*  LDC     (input) INTEGER */
+/*          The leading dimension of the array C.  LDC >= max(1,N). */
+
+/*  SCALE   (output) DOUBLE PRECISION */
+/*          The scale factor, scale, set <= 1 to avoid overflow in X. */
+
+/*  WR      (output) DOUBLE PRECISION array, dimension (N) */
+/*  WI      (output) DOUBLE PRECISION array, dimension (N) */
+/*          If FACT = 'N', the real and imaginary parts of the */
+/*          eigenvalues of A, as returned by DGEES.  Not referenced if */
+/*          FACT = 'F'. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK. */
+/*          LWORK >= max(1,N*N,3*N) if FACT = 'N', and */
+/*          LWORK >= max(1,N*N) if FACT = 'F'. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value. */
+/*          > 0 and <= N: the QR algorithm failed to compute all the */
+/*                eigenvalues, see DGEES; A, U and C are not referenced */
+/*                any further. */
+/*          = N+1: A has eigenvalues lambda, mu with lambda*mu equal */
+/*                or very close to one; perturbed values were used to */
+/*                solve the equation. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Decode and test the input parameters */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    u_dim1 = *ldu;
+    u_offset = 1 + u_dim1;
+    u -= u_offset;
+    c_dim1 = *ldc;
+    c_offset = 1 + c_dim1;
+    c__ -= c_offset;
+    --wr;
+    --wi;
+    --work;
+
+    /* Function Body */
+    nofact = lsame_(fact, "N");
+    notrna = lsame_(trana, "N");
+    lquery = *lwork == -1;
+
+    *info = 0;
+    if (! nofact && ! lsame_(fact, "F")) {
+	*info = -1;
+    } else if (! notrna && ! lsame_(trana, "T") && ! lsame_(trana, "C")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*lda < max(1,*n)) {
+	*info = -5;
+    } else if (*ldu < max(1,*n)) {
+	*info = -7;
+    } else if (*ldc < max(1,*n)) {
+	*info = -9;
+    }
+
+    if (*info == 0) {
+/* Computing MAX */
+	i__1 = 1, i__1 = max(i__1,*n * *n);
+	minwrk = i__1;
+	maxwrk = minwrk;
+	if (nofact) {
+	    minwrk = max(minwrk,*n * 3);
+	    dgees_("V", "N", (L_fp)0, n, &a[a_offset], lda, &sdim, &wr[1], &
+		    wi[1], &u[u_offset], ldu, &work[1], &c_n1, bwork, &ierr);
+	    maxwrk = max(minwrk,(integer) work[1]);
+	}
+	work[1] = (doublereal) maxwrk;
+	if (*lwork < minwrk && ! lquery) {
+	    *info = -14;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGESTN", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    *scale = 1.;
+    if (*n == 0) {
+	return 0;
+    }
+
+/*     Reduce A to real Schur form A = U*T*U' */
+/*     (Workspace: need 3*N, prefer more) */
+
+    if (nofact) {
+	dgees_("V", "N", (L_fp)0, n, &a[a_offset], lda, &sdim, &wr[1], &wi[1]
+, &u[u_offset], ldu, &work[1], lwork, bwork, info);
+	if (*info > 0) {
+	    return 0;
+	}
+    }
+
+/*     C := U'*C*U */
+/*     (Workspace: need N*N) */
+
+    dgemm_("N", "N", n, n, n, &c_b15, &c__[c_offset], ldc, &u[u_offset],
+	    ldu, &c_b14, &work[1], n);
+    dgemm_("T", "N", n, n, n, &c_b15, &u[u_offset], ldu, &work[1], n, &c_b14,
+	     &c__[c_offset], ldc);
+
+/*     Solve op(T)*Y*op(T)' - Y = scale*C */
+/*     (Workspace: need N*N) */
+
+    if (notrna) {
+	dtrstn_("N", "T", n, n, &a[a_offset], lda, &a[a_offset], lda, &c__[
+		c_offset], ldc, scale, &work[1], &ierr);
+    } else {
+	dtrstn_("T", "N", n, n, &a[a_offset], lda, &a[a_offset], lda, &c__[
+		c_offset], ldc, scale, &work[1], &ierr);
+    }
+    if (ierr > 0) {
+	*info = *n + 1;
+    }
+
+/*     X := U*Y*U' */
+
+    dgemm_("N", "N", n, n, n, &c_b15, &u[u_offset], ldu, &c__[c_offset],
+	    ldc, &c_b14, &work[1], n);
+    dgemm_("N", "T", n, n, n, &c_b15, &work[1], n, &u[u_offset], ldu, &c_b14,
+	     &c__[c_offset], ldc);
+
+    work[1] = (doublereal) maxwrk;
+    return 0;
+
+/*     End of DGESTN */
+
+} /* dgestn_ */
@@ -0,0 +1,406 @@
+/* dgesvdr.c -- DGESVDR, randomized truncated SVD of a general matrix. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__3 = 3;
+static integer c_n1 = -1;
+static integer c__10 = 10;
+static doublereal c_b19 = 1.;
+static doublereal c_b20 = 0.;
+static doublereal c_b45 = -1.;
+
+/* Subroutine */ int dgesvdr_(char *jobz, integer *m, integer *n, integer *k,
+	integer *p, integer *niter, doublereal *a, integer *lda, doublereal *
+	s, doublereal *u, integer *ldu, doublereal *vt, integer *ldvt,
+	integer *iseed, doublereal *errest, doublereal *work, integer *lwork,
+	integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, u_dim1, u_offset, vt_dim1, vt_offset, i__1,
+	    i__2;
+    doublereal d__1, d__2;
+
+    /* Builtin functions */
+    double sqrt(doublereal);
+
+    /* Local variables */
+    integer i__, l, ib, iq, it, mn, np, iub, isb, iwp, iyp, izp;
+    doublereal dum[1];
+    integer itau, ierr, ivtb, iwrk;
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *);
+    extern logical lsame_(char *, char *);
+    extern doublereal dnrm2_(integer *, doublereal *, integer *);
+    logical wntqn, wntqv;
+    extern /* Subroutine */ int dgeqrf_(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, integer *),
+	    dgesdd_(char *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, integer *, integer *), dlacpy_(char *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *), dlarnv_(integer *, integer *, integer *, doublereal *)
+	    , xerbla_(char *, integer *), dorgqr_(integer *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, doublereal *,
+	    integer *, integer *);
+    integer lwkmin, lwkopt, lwqr, lwsvd;
+    logical lquery;
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGESVDR computes the K leading singular values and, optionally, the */
+/*  corresponding left and right singular vectors of a real M-by-N */
+/*  matrix A, using a randomized range finder.  The truncated SVD is */
+/*  written */
+
+/*       A ~ U * SIGMA * VT */
+
+/*  where SIGMA is a K-by-K diagonal matrix, U is an M-by-K matrix with */
+/*  orthonormal columns and VT is a K-by-N matrix with orthonormal rows. */
+
+/*  The method samples the range of A with L = MIN(K+P,M,N) Gaussian */
+/*  test vectors, Y = A * OMEGA, optionally refines the sample with */
+/*  NITER subspace (power) iterations Y = A * ( A' * Q ), and computes */
+/*  an orthonormal basis Q of Y with DGEQRF/DORGQR.  The small L-by-N */
+/*  matrix B = Q' * A is then decomposed with DGESDD, and the leading K */
+/*  singular triplets of B are mapped back to A.  The cost is dominated */
+/*  by 2*(NITER+1) products with A and A', instead of the full */
+/*  bidiagonalization performed by DGESVD and DGESDD. */
+
+/*  A is not modified. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  JOBZ    (input) CHARACTER*1 */
+/*          Specifies options for computing the singular vectors: */
+/*          = 'V':  the first K columns of U and the first K rows of */
+/*                  V**T are computed; */
+/*          = 'N':  only the K leading singular values are computed. */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of the input matrix A.  M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of the input matrix A.  N >= 0. */
+
+/*  K       (input) INTEGER */
+/*          The number of singular triplets wanted. */
+/*          0 <= K <= min(M,N). */
+
+/*  P       (input) INTEGER */
+/*          The oversampling parameter.  The sample size is */
+/*          L = MIN( K+P, M, N ).  P >= 0; P = 5 to 10 is usually */
+/*          sufficient. */
+
+/*  NITER   (input) INTEGER */
+/*          The number of power iterations.  NITER >= 0.  One or two */
+/*          iterations are recommended when the singular values of A */
+/*          decay slowly. */
+
+/*  A       (input) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          The M-by-N matrix A. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  S       (output) DOUBLE PRECISION array, dimension (K) */
+/*          The approximate leading singular values of A, sorted so that */
+/*          S(i) >= S(i+1). */
+
+/*  U       (output) DOUBLE PRECISION array, dimension (LDU,K) */
+/*          If JOBZ = 'V', U contains the approximate left singular */
+/*          vectors of A; if JOBZ = 'N', U is not referenced. */
+
+/*  LDU     (input) INTEGER */
+/*          The leading dimension of the array U.  LDU >= 1; if */
+/*          JOBZ = 'V', LDU >= M. */
+
+/*  VT      (output) DOUBLE PRECISION array, dimension (LDVT,N) */
+/*          If JOBZ = 'V', VT contains the approximate right singular */
+/*          vectors of A, stored rowwise; if JOBZ = 'N', VT is not */
+/*          referenced. */
+
+/*  LDVT    (input) INTEGER */
+/*          The leading dimension of the array VT.  LDVT >= 1; if */
+/*          JOBZ = 'V', LDVT >= K. */
+
+/*  ISEED   (input/output) INTEGER array, dimension (4) */
+/*          On entry, the seed of the random number generator (DLARNV) */
+/*          that draws the Gaussian sketching matrix OMEGA and the */
+/*          probe vectors of ERREST; the array elements must be between */
+/*          0 and 4095, and ISEED(4) must be odd. */
+/*          On exit, the seed is updated. */
+
+/*  ERREST  (output) DOUBLE PRECISION */
+/*          An estimate of the 2-norm error || A - U*SIGMA*VT ||.  It is */
+/*          the sum of the probabilistic bound */
+/*             10*sqrt(2/pi) * max || ( I - Q*Q' ) * A * w_i || */
+/*          over 10 Gaussian probe vectors w_i, which holds with */
+/*          probability at least 1 - 10**(-10), and of the largest */
+/*          discarded singular value of B when L > K. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  With L = MIN(K+P,M,N), */
+/*          LWORK >= M*L + 2*L*N + L*L + 2*L + 10*(M+N+L) + */
+/*                   MAX( M, N, 3*L*L + MAX( N, 4*L*L+4*L ) ). */
+/*          For good performance, LWORK should generally be larger. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  IWORK   (workspace) INTEGER array, dimension (8*MIN(M,N)) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit. */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
+/*          > 0:  DGESDD did not converge on the projected matrix B. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  See N. Halko, P.G. Martinsson and J.A. Tropp, Finding structure */
+/*  with randomness: probabilistic algorithms for constructing */
+/*  approximate matrix decompositions, SIAM Review 53 (2011), 217-288. */
+
+/*  The basis Q is reorthonormalized after every product with A or A', */
+/*  so the power iterations do not lose the information associated */
+/*  with the smaller singular values to rounding errors. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input arguments */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --s;
+    u_dim1 = *ldu;
+    u_offset = 1 + u_dim1;
+    u -= u_offset;
+    vt_dim1 = *ldvt;
+    vt_offset = 1 + vt_dim1;
+    vt -= vt_offset;
+    --iseed;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    mn = min(*m,*n);
+    wntqv = lsame_(jobz, "V");
+    wntqn = lsame_(jobz, "N");
+    lquery = *lwork == -1;
+
+    if (! (wntqv || wntqn)) {
+	*info = -1;
+    } else if (*m < 0) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*k < 0 || *k > mn) {
+	*info = -4;
+    } else if (*p < 0) {
+	*info = -5;
+    } else if (*niter < 0) {
+	*info = -6;
+    } else if (*lda < max(1,*m)) {
+	*info = -8;
+    } else if (*ldu < 1 || wntqv && *ldu < *m) {
+	*info = -11;
+    } else if (*ldvt < 1 || wntqv && *ldvt < *k) {
+	*info = -13;
+    }
+
+/*     Compute workspace */
+
+    if (*info == 0) {
+	lwkmin = 1;
+	lwkopt = 1;
+	if (*k > 0) {
+/* Computing MIN */
+	    i__1 = *k + *p;
+	    l = min(i__1,mn);
+	    np = max(*m,*n);
+	    dgeqrf_(&np, &l, dum, &np, dum, dum, &c_n1, &ierr);
+	    lwqr = (integer) dum[0];
+	    dorgqr_(&np, &l, &l, dum, &np, dum, dum, &c_n1, &ierr);
+/* Computing MAX */
+	    i__1 = lwqr, i__2 = (integer) dum[0];
+	    lwqr = max(i__1,i__2);
+	    dgesdd_("S", &l, n, dum, &l, dum, dum, &l, dum, &l, dum, &c_n1, &
+		    iwork[1], &ierr);
+	    lwsvd = (integer) dum[0];
+	    lwkmin = *m * l + (l << 1) * *n + l * l + (l << 1) + (*m + *n +
+		    l) * 10;
+	    lwkopt = lwkmin + max(lwqr,lwsvd);
+/* Computing MAX */
+	    i__1 = *n, i__2 = (l << 2) * l + (l << 2);
+	    lwsvd = l * 3 * l + max(i__1,i__2);
+	    lwkmin += max(np,lwsvd);
+	    lwkopt = max(lwkopt,lwkmin);
+	}
+	work[1] = (doublereal) lwkopt;
+	if (*lwork < lwkmin && ! lquery) {
+	    *info = -17;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGESVDR", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    *errest = 0.;
+    if (*k == 0) {
+	return 0;
+    }
+
+/*     Partition the workspace: */
+/*        Q (M-by-L), B (L-by-N, also holds OMEGA and Z' products), */
+/*        TAU (L), SB (L), UB (L-by-L), VTB (L-by-N), */
+/*        probes W (N-by-10), Y = A*W (M-by-10), Q'*Y (L-by-10). */
+
+    iq = 1;
+    ib = iq + *m * l;
+    itau = ib + l * *n;
+    isb = itau + l;
+    iub = isb + l;
+    ivtb = iub + l * l;
+    iwp = ivtb + l * *n;
+    iyp = iwp + *n * 10;
+    izp = iyp + *m * 10;
+    iwrk = izp + l * 10;
+    lwqr = *lwork - iwrk + 1;
+
+/*     Draw the N-by-L Gaussian test matrix OMEGA and form Y = A*OMEGA */
+
+    i__1 = *n * l;
+    dlarnv_(&c__3, &iseed[1], &i__1, &work[ib]);
+    dgemm_("N", "N", m, &l, n, &c_b19, &a[a_offset], lda, &work[ib], n, &
+	    c_b20, &work[iq], m);
+
+/*     Power iterations, reorthonormalizing after each product */
+
+    i__1 = *niter;
+    for (it = 1; it <= i__1; ++it) {
+	dgeqrf_(m, &l, &work[iq], m, &work[itau], &work[iwrk], &lwqr, &ierr);
+	dorgqr_(m, &l, &l, &work[iq], m, &work[itau], &work[iwrk], &lwqr, &
+		ierr);
+
+/*        Z = A' * Q, stored N-by-L in the space of B */
+
+	dgemm_("T", "N", n, &l, m, &c_b19, &a[a_offset], lda, &work[iq], m, &
+		c_b20, &work[ib], n);
+	dgeqrf_(n, &l, &work[ib], n, &work[itau], &work[iwrk], &lwqr, &ierr);
+	dorgqr_(n, &l, &l, &work[ib], n, &work[itau], &work[iwrk], &lwqr, &
+		ierr);
+
+/*        Y = A * Z */
+
+	dgemm_("N", "N", m, &l, n, &c_b19, &a[a_offset], lda, &work[ib], n, &
+		c_b20, &work[iq], m);
+/* L10: */
+    }
+
+/*     Orthonormal basis Q of the sample */
+
+    dgeqrf_(m, &l, &work[iq], m, &work[itau], &work[iwrk], &lwqr, &ierr);
+    dorgqr_(m, &l, &l, &work[iq], m, &work[itau], &work[iwrk], &lwqr, &ierr);
+
+/*     Estimate || ( I - Q*Q' ) * A || with 10 Gaussian probes */
+
+    i__1 = *n * 10;
+    dlarnv_(&c__3, &iseed[1], &i__1, &work[iwp]);
+    dgemm_("N", "N", m, &c__10, n, &c_b19, &a[a_offset], lda, &work[iwp], n,
+	    &c_b20, &work[iyp], m);
+    dgemm_("T", "N", &l, &c__10, m, &c_b19, &work[iq], m, &work[iyp], m, &
+	    c_b20, &work[izp], &l);
+    dgemm_("N", "N", m, &c__10, &l, &c_b45, &work[iq], m, &work[izp], &l, &
+	    c_b19, &work[iyp], m);
+    for (i__ = 1; i__ <= 10; ++i__) {
+/* Computing MAX */
+	d__1 = *errest, d__2 = dnrm2_(m, &work[iyp + (i__ - 1) * *m], &c__1);
+	*errest = max(d__1,d__2);
+/* L20: */
+    }
+    *errest = *errest * 10. * sqrt(.63661977236758134307553505349006);
+
+/*     B = Q' * A, and its SVD  B = UB * SB * VTB */
+
+    dgemm_("T", "N", &l, n, m, &c_b19, &work[iq], m, &a[a_offset], lda, &
+	    c_b20, &work[ib], &l);
+    lwsvd = *lwork - iwrk + 1;
+    if (wntqv) {
+	dgesdd_("S", &l, n, &work[ib], &l, &work[isb], &work[iub], &l, &work[
+		ivtb], &l, &work[iwrk], &lwsvd, &iwork[1], info);
+    } else {
+	dgesdd_("N", &l, n, &work[ib], &l, &work[isb], &work[iub], &l, &work[
+		ivtb], &l, &work[iwrk], &lwsvd, &iwork[1], info);
+    }
+    if (*info != 0) {
+	return 0;
+    }
+
+    i__1 = *k;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	s[i__] = work[isb + i__ - 1];
+/* L30: */
+    }
+    if (l > *k) {
+	*errest += work[isb + *k];
+    }
+
+    if (wntqv) {
+
+/*        U = Q * UB(:,1:K),  VT = VTB(1:K,:) */
+
+	dgemm_("N", "N", m, k, &l, &c_b19, &work[iq], m, &work[iub], &l, &
+		c_b20, &u[u_offset], ldu);
+	dlacpy_("F", k, n, &work[ivtb], &l, &vt[vt_offset], ldvt);
+    }
+
+    work[1] = (doublereal) lwkopt;
+    return 0;
+
+/*     End of DGESVDR */
+
+} /* dgesvdr_ */
@@ -0,0 +1,413 @@
+/* dgesvjb.c -- DGESVJB, blocked one-sided Jacobi SVD of a general matrix. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__0 = 0;
+static doublereal c_b17 = 0.;
+static doublereal c_b18 = 1.;
+
+/* Subroutine */ int dgesvjb_(char *jobu, char *jobv, integer *m, integer *n,
+	 integer *nb, doublereal *a, integer *lda, doublereal *sva,
+	doublereal *v, integer *ldv, doublereal *work, integer *lwork,
+	integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, v_dim1, v_offset, i__1, i__2, i__3;
+    doublereal d__1, d__2;
+
+    /* Builtin functions */
+    double sqrt(doublereal);
+
+    /* Local variables */
+    integer g, i__, j, p, q, r__, w, j1, j2, n1, n2, ip, ng, nbb, nbq, nb2,
+	    ioff, iwrk, nblk, nslot, npair, lslot, isweep, ierr, iascl;
+    doublereal anrm, tol, big, sfmin, offmax, scalem, temp1;
+    extern doublereal dnrm2_(integer *, doublereal *, integer *);
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *,
+	    integer *), dswap_(integer *, doublereal *, integer *, doublereal
+	    *, integer *), dgsvjb_(char *, integer *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
+	     integer *, integer *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dlascl_(char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, integer *, doublereal *,
+	    integer *, integer *), dlaset_(char *, integer *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *), xerbla_(
+	    char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    integer lwkmin, lwkopt;
+    logical lsvec, rsvec, uctol, lquery, converged;
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGESVJB computes the singular value decomposition (SVD) of a real */
+/*  M-by-N matrix A, where M >= N, with a blocked one-sided Jacobi */
+/*  method: */
+
+/*       A = U * SIGMA * V', */
+
+/*  where U is M-by-N with orthonormal columns, SIGMA is N-by-N diagonal */
+/*  and V is N-by-N orthogonal. */
+
+/*  The columns of A are split into blocks of width NB.  A sweep visits */
+/*  every pair of blocks once, in the round-robin (tournament) ordering, */
+/*  so that each of the NBLK-1 rounds of a sweep consists of NBLK/2 */
+/*  pairs with disjoint columns.  Each pair is orthogonalized by DGSVJB: */
+/*  a QR factorization of the pair, the point Jacobi method DGESVJ on */
+/*  its small triangular factor, and one DGEMM to apply the accumulated */
+/*  rotation to the columns of A and V.  The pairs of a round are */
+/*  independent; when the routine is compiled with OpenMP they are */
+/*  orthogonalized concurrently, one per workspace slot. */
+
+/*  Like DGESVJ, the method computes the singular values to high relative */
+/*  accuracy for matrices of the form A = B * D with D diagonal and B */
+/*  well conditioned, which makes it the method of choice for badly */
+/*  scaled problems. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  JOBU    (input) CHARACTER*1 */
+/*          = 'U':  the left singular vectors overwrite A; */
+/*          = 'N':  on exit A holds U * SIGMA, i.e. the columns are not */
+/*                  normalized. */
+
+/*  JOBV    (input) CHARACTER*1 */
+/*          = 'V':  the right singular vectors are computed in V; */
+/*          = 'N':  V is not referenced. */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of the input matrix A.  M >= N >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The number of columns of the input matrix A.  N >= 0. */
+
+/*  NB      (input) INTEGER */
+/*          The width of the column blocks.  If NB <= 0, the block size */
+/*          is taken from ILAENV for DGEQRF. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the M-by-N matrix A. */
+/*          On exit, see JOBU. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,M). */
+
+/*  SVA     (output) DOUBLE PRECISION array, dimension (N) */
+/*          The singular values of A, sorted so that */
+/*          SVA(i) >= SVA(i+1). */
+
+/*  V       (output) DOUBLE PRECISION array, dimension (LDV,N) */
+/*          If JOBV = 'V', the N-by-N matrix of right singular vectors. */
+
+/*  LDV     (input) INTEGER */
+/*          The leading dimension of the array V.  LDV >= 1, and */
+/*          LDV >= N if JOBV = 'V'. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK, */
+/*          and WORK(2) the number of sweeps performed. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  Let NB be the block */
+/*          width actually used (see NB, and at most N), W = 2*NB, */
+/*          NPAIR = ceil(N/NB)/2 rounded up, and NBQ the DGEQRF block */
+/*          size ILAENV( 1, 'DGEQRF', ' ', M, N, -1, -1 ), which DGSVJB */
+/*          uses to factor each pair.  One workspace slot holds */
+/*             LSLOT = M*W + 2*W*W + 3*W + MAX(6,2*W) + W*NBQ */
+/*          and LWORK >= NPAIR + LSLOT.  Pairs of a round are processed */
+/*          in groups of MIN(NPAIR,(LWORK-NPAIR)/LSLOT); the optimal */
+/*          LWORK = NPAIR*(1+LSLOT) lets a whole round run at once. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit. */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value. */
+/*          > 0:  the iteration did not converge in 30 sweeps; the */
+/*                computed values may still be useful. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The iteration stops when a full sweep finds every pair numerically */
+/*  orthogonal, i.e. the cosine of the angle between any two columns is */
+/*  below TOL = MAX(sqrt(M),MIN(W,N))*EPS.  DGESVJ uses sqrt(M)*EPS; */
+/*  the columns of a pair are rotated here by one W-by-W orthogonal */
+/*  matrix instead of plane rotations, which leaves them orthogonal */
+/*  only to about W*EPS, so the tolerance cannot be smaller. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input arguments */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --sva;
+    v_dim1 = *ldv;
+    v_offset = 1 + v_dim1;
+    v -= v_offset;
+    --work;
+
+    /* Function Body */
+    lsvec = lsame_(jobu, "U");
+    uctol = lsame_(jobu, "N");
+    rsvec = lsame_(jobv, "V");
+    lquery = *lwork == -1;
+
+    *info = 0;
+    if (! (lsvec || uctol)) {
+	*info = -1;
+    } else if (! (rsvec || lsame_(jobv, "N"))) {
+	*info = -2;
+    } else if (*m < 0) {
+	*info = -3;
+    } else if (*n < 0 || *n > *m) {
+	*info = -4;
+    } else if (*lda < max(1,*m)) {
+	*info = -7;
+    } else if (*ldv < 1 || rsvec && *ldv < *n) {
+	*info = -10;
+    }
+
+/*     Block size, number of blocks and workspace */
+
+    if (*info == 0) {
+	nbq = ilaenv_(&c__1, "DGEQRF", " ", m, n, &c_n1, &c_n1);
+	nbb = *nb;
+	if (nbb <= 0) {
+	    nbb = nbq;
+	}
+	nbb = max(1,min(nbb,*n));
+	nblk = (*n + nbb - 1) / nbb;
+	nb2 = nblk + nblk % 2;
+	npair = max(1,nb2 / 2);
+	w = nbb << 1;
+/* Computing MAX */
+	i__1 = 6, i__2 = w << 1;
+	lslot = *m * w + (w << 1) * w + w * 3 + max(i__1,i__2) + w * nbq;
+	lwkmin = npair + lslot;
+	lwkopt = npair * (lslot + 1);
+	work[1] = (doublereal) lwkopt;
+	if (*lwork < lwkmin && ! lquery) {
+	    *info = -12;
+	}
+    }
+
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGESVJB", &i__1);
+	return 0;
+    } else if (lquery) {
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*m == 0 || *n == 0) {
+	return 0;
+    }
+
+    nslot = min(npair,(*lwork - npair) / lslot);
+    ioff = 1;
+    iwrk = ioff + npair;
+
+/*     Machine constants.  DLAMCH is evaluated here once, before any */
+/*     concurrent calls of DGSVJB. */
+
+/* Computing MAX */
+    d__1 = sqrt((doublereal) (*m)), d__2 = (doublereal) min(w,*n);
+    tol = max(d__1,d__2) * dlamch_("Epsilon");
+    sfmin = dlamch_("SafeMinimum");
+    big = dlamch_("Overflow");
+
+/*     Scale A so that the Gram matrices of the pairs cannot overflow */
+/*     or underflow */
+
+    anrm = dlange_("M", m, n, &a[a_offset], lda, &work[1]);
+
+/*     As in DGESVJ, a zero matrix gets SVA = 0 and U = I (JOBU = 'U') */
+
+    if (anrm == 0.) {
+	dlaset_("G", n, &c__1, &c_b17, &c_b17, &sva[1], n);
+	if (lsvec) {
+	    dlaset_("G", m, n, &c_b17, &c_b18, &a[a_offset], lda);
+	}
+	if (rsvec) {
+	    dlaset_("A", n, n, &c_b17, &c_b18, &v[v_offset], ldv);
+	}
+	work[1] = (doublereal) lwkopt;
+	work[2] = 0.;
+	return 0;
+    }
+    iascl = 0;
+    scalem = 1.;
+    temp1 = sqrt(big / (doublereal) (*m)) / (doublereal) (*n);
+    if (anrm > 0. && anrm < sqrt(sfmin)) {
+	scalem = sqrt(sfmin);
+	iascl = 1;
+    } else if (anrm > temp1) {
+	scalem = temp1;
+	iascl = 1;
+    }
+    if (iascl == 1) {
+	dlascl_("G", &c__0, &c__0, &anrm, &scalem, m, n, &a[a_offset], lda, &
+		ierr);
+    }
+
+    if (rsvec) {
+	dlaset_("A", n, n, &c_b17, &c_b18, &v[v_offset], ldv);
+    }
+
+/*     Jacobi sweeps */
+
+    converged = FALSE_;
+    for (isweep = 1; isweep <= 30; ++isweep) {
+	offmax = 0.;
+
+/*        Round R of the tournament: block NB2-1 meets block R, and */
+/*        blocks (R+I) and (R-I) mod (NB2-1) meet for I = 1..NPAIR-1 */
+
+	i__1 = nb2 - 2;
+	for (r__ = 0; r__ <= i__1; ++r__) {
+	    i__2 = npair - 1;
+	    i__3 = nslot;
+	    for (g = 0; i__3 < 0 ? g >= i__2 : g <= i__2; g += i__3) {
+		ng = min(nslot,npair - g);
+#ifdef _OPENMP
+#pragma omp parallel for private(i__, p, q, j1, j2, n1, n2, ierr)
+#endif
+		for (ip = 0; ip < ng; ++ip) {
+		    i__ = g + ip;
+		    if (i__ == 0) {
+			p = r__;
+			q = nb2 - 1;
+		    } else {
+			p = (r__ + i__) % (nb2 - 1);
+			q = (r__ - i__ + nb2 - 1) % (nb2 - 1);
+		    }
+		    j1 = p * nbb + 1;
+		    j2 = q * nbb + 1;
+/* Computing MAX */
+		    n1 = max(0,min(nbb,*n - j1 + 1));
+		    n2 = max(0,min(nbb,*n - j2 + 1));
+		    j1 = min(j1,*n);
+		    j2 = min(j2,*n);
+		    dgsvjb_(jobv, m, n, &n1, &n2, &a[j1 * a_dim1 + 1], &a[j2 *
+			    a_dim1 + 1], lda, &v[j1 * v_dim1 + 1], &v[j2 *
+			    v_dim1 + 1], ldv, &tol, &work[ioff + i__], &work[
+			    iwrk + ip * lslot], &lslot, &ierr);
+/* L10: */
+		}
+		for (ip = 0; ip < ng; ++ip) {
+/* Computing MAX */
+		    d__1 = work[ioff + g + ip];
+		    offmax = max(offmax,d__1);
+/* L20: */
+		}
+/* L30: */
+	    }
+/* L40: */
+	}
+	if (offmax <= tol) {
+	    converged = TRUE_;
+	    goto L50;
+	}
+/* L45: */
+    }
+L50:
+    if (! converged) {
+	*info = 1;
+	isweep = 30;
+    }
+
+/*     The singular values are the column norms */
+
+    i__1 = *n;
+    for (j = 1; j <= i__1; ++j) {
+	sva[j] = dnrm2_(m, &a[j * a_dim1 + 1], &c__1);
+	if (lsvec && sva[j] > 0.) {
+	    d__1 = 1. / sva[j];
+	    dscal_(m, &d__1, &a[j * a_dim1 + 1], &c__1);
+	}
+/* L60: */
+    }
+
+/*     Sort the singular values into decreasing order */
+
+    i__1 = *n - 1;
+    for (p = 1; p <= i__1; ++p) {
+	q = p;
+	i__2 = *n;
+	for (j = p + 1; j <= i__2; ++j) {
+	    if (sva[j] > sva[q]) {
+		q = j;
+	    }
+/* L70: */
+	}
+	if (q != p) {
+	    temp1 = sva[p];
+	    sva[p] = sva[q];
+	    sva[q] = temp1;
+	    dswap_(m, &a[p * a_dim1 + 1], &c__1, &a[q * a_dim1 + 1], &c__1);
+	    if (rsvec) {
+		dswap_(n, &v[p * v_dim1 + 1], &c__1, &v[q * v_dim1 + 1], &
+			c__1);
+	    }
+	}
+/* L80: */
+    }
+
+/*     Undo the scaling */
+
+    if (iascl == 1) {
+	dlascl_("G", &c__0, &c__0, &scalem, &anrm, n, &c__1, &sva[1], n, &
+		ierr);
+	if (uctol) {
+	    dlascl_("G", &c__0, &c__0, &scalem, &anrm, m, n, &a[a_offset],
+		    lda, &ierr);
+	}
+    }
+
+    work[1] = (doublereal) lwkopt;
+    work[2] = (doublereal) isweep;
+    return 0;
+
+/*     End of DGESVJB */
+
+} /* dgesvjb_ */
@@ -125,6 +125,18 @@ static doublereal c_b10 = -1.;
     bignum = 1. / smlnum;
     dlabad_(&smlnum, &bignum);
 
+/*     Handle the case N=1 by itself (SMIN is not set below) */
+
+    if (*n == 1) {
+	ipiv[1] = 1;
+	jpiv[1] = 1;
+	if (abs(a[a_dim1 + 1]) < smlnum) {
+	    *info = 1;
+	    a[a_dim1 + 1] = smlnum;
+	}
+	return 0;
+    }
+
 /*     Factorize A using complete pivoting. */
 /*     Set pivots less than SMIN to SMIN. */
 
@@ -0,0 +1,148 @@
+/* dgetrfc.c -- DGETRFC, LU factorization with a condition estimate. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dgetrfc_(char *norm, integer *n, doublereal *a, 
+	integer *lda, integer *ipiv, doublereal *rcond, doublereal *work, 
+	integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1;
+
+    /* Local variables */
+    extern logical lsame_(char *, char *);
+    extern doublereal dlange_(char *, integer *, integer *, doublereal *, 
+	    integer *, doublereal *);
+    extern /* Subroutine */ int dgetrf_(integer *, integer *, doublereal *, 
+	    integer *, integer *, integer *), xerbla_(char *, integer *), 
+	    dgeconb_(char *, integer *, doublereal *, integer *, doublereal *, 
+	    doublereal *, doublereal *, integer *, integer *);
+    doublereal anorm;
+    logical onenrm;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGETRFC computes an LU factorization of a general N-by-N matrix A */
+/*  using partial pivoting with row interchanges, as DGETRF does, and */
+/*  returns together with the factors an estimate of the reciprocal of */
+/*  the condition number of A in the 1-norm or the infinity-norm. */
+
+/*  The norm of A is taken before A is overwritten and the estimate is */
+/*  computed by DGECONB while the factors are still in cache, so the */
+/*  caller needs neither a copy of A nor a separate DLANGE/DGECON pass. */
+/*  RCOND may be kept with the factors and tested before each DGETRS. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  NORM    (input) CHARACTER*1 */
+/*          Specifies whether the 1-norm condition number or the */
+/*          infinity-norm condition number is required: */
+/*          = '1' or 'O':  1-norm; */
+/*          = 'I':         Infinity-norm. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the N-by-N matrix to be factored. */
+/*          On exit, the factors L and U from the factorization */
+/*          A = P*L*U; the unit diagonal elements of L are not stored. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  IPIV    (output) INTEGER array, dimension (N) */
+/*          The pivot indices; for 1 <= i <= N, row i of the */
+/*          matrix was interchanged with row IPIV(i). */
+
+/*  RCOND   (output) DOUBLE PRECISION */
+/*          The estimate of the reciprocal of the condition number of */
+/*          the original matrix A, computed as in DGECONB.  RCOND = 0 */
+/*          if A is exactly singular (INFO > 0). */
+
+/*  WORK    (workspace) DOUBLE PRECISION array, dimension (6*N) */
+
+/*  IWORK   (workspace) INTEGER array, dimension (2*N) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+/*          > 0:  if INFO = i, U(i,i) is exactly zero.  The factorization */
+/*                has been completed, but the factor U is exactly */
+/*                singular. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --ipiv;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    onenrm = *(unsigned char *)norm == '1' || lsame_(norm, "O");
+    if (! onenrm && ! lsame_(norm, "I")) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*lda < max(1,*n)) {
+	*info = -4;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGETRFC", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n == 0) {
+	*rcond = 1.;
+	return 0;
+    }
+
+/*     Compute the norm of A, then factor it. */
+
+    anorm = dlange_(norm, n, n, &a[a_offset], lda, &work[1]);
+    dgetrf_(n, n, &a[a_offset], lda, &ipiv[1], info);
+
+/*     Estimate the reciprocal of the condition number. */
+
+    *rcond = 0.;
+    if (*info > 0) {
+	return 0;
+    }
+    dgeconb_(norm, n, &a[a_offset], lda, &anorm, rcond, &work[1], &iwork[1], 
+	    info);
+
+    return 0;
+
+/*     End of DGETRFC */
+
+} /* dgetrfc_ */
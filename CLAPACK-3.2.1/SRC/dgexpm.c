@@ -0,0 +1,597 @@
+/* dgexpm.c -- DGEXPM, matrix exponential by scaling and squaring. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__0 = 0;
+static integer c__1 = 1;
+static integer c__2 = 2;
+static integer c__3 = 3;
+static doublereal c_b8 = 0.;
+static doublereal c_b9 = 1.;
+static doublereal c_b10 = 2.;
+
+/* Coefficients of the numerators of the [m/m] Pade approximants to */
+/* exp, m = 3, 5, 7, 9 and 13, and the bounds THETA(m) on the norm of */
+/* the argument for which their backward error is at most 2**(-53). */
+
+static doublereal b3[4] = { 120.,60.,12.,1. };
+static doublereal b5[6] = { 30240.,15120.,3360.,420.,30.,1. };
+static doublereal b7[8] = { 17297280.,8648640.,1995840.,277200.,25200.,
+	1512.,56.,1. };
+static doublereal b9[10] = { 17643225600.,8821612800.,2075673600.,
+	302702400.,30270240.,2162160.,110880.,3960.,90.,1. };
+static doublereal b13[14] = { 64764752532480000.,32382376266240000.,
+	7771770303897600.,1187353796428800.,129060195264000.,
+	10559470521600.,670442572800.,33522128640.,1323241920.,40840800.,
+	960960.,16380.,182.,1. };
+static doublereal theta[5] = { .01495585217958292,.253939833006323,
+	.9504178996162932,2.097847961257068,5.371920351148152 };
+
+static int dgexpm_nrm(integer *n, integer *k, doublereal *b, integer *l,
+	doublereal *c__, doublereal *work, integer *iwork, doublereal *est);
+
+/* Subroutine */ int dgexpm_(char *fact, char *balanc, integer *n,
+	doublereal *t, doublereal *a, integer *lda, doublereal *e, integer *
+	lde, doublereal *work, integer *lwork, integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, e_dim1, e_offset, i__1, i__2;
+    doublereal d__1, d__2;
+
+    /* Builtin functions */
+    double pow_dd(doublereal *, doublereal *), log(doublereal), d_int(
+	    doublereal *), pow_di(doublereal *, integer *);
+
+    /* Local variables */
+    integer i__, j, k, m, s, ii, nn, ia2, ia4, ia6, iu, iv, ix, ju, ilo,
+	    ihi, ierr, iscl;
+    doublereal d4, d6, d8, d10, r0, r2, r4, r6, r8, tr, eta;
+    doublereal *b;
+    logical big, nofact, lquery;
+    extern logical lsame_(char *, char *);
+    extern doublereal dlange_(char *, integer *, integer *, doublereal *,
+	    integer *, doublereal *);
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dscal_(
+	    integer *, doublereal *, doublereal *, integer *), daxpy_(integer
+	    *, doublereal *, doublereal *, integer *, doublereal *, integer *)
+	    , dswap_(integer *, doublereal *, integer *, doublereal *,
+	    integer *), dgebal_(char *, integer *, doublereal *, integer *,
+	    integer *, integer *, doublereal *, integer *), dgesv_(integer *,
+	    integer *, doublereal *, integer *, integer *, doublereal *,
+	    integer *, integer *), dlacpy_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *), dlascl_(char *,
+	     integer *, integer *, doublereal *, doublereal *, integer *,
+	    integer *, doublereal *, integer *, integer *), dlaset_(char *,
+	    integer *, integer *, doublereal *, doublereal *, doublereal *,
+	    integer *), xerbla_(char *, integer *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGEXPM computes the exponential exp( T*A ) of a real N-by-N matrix */
+/*  A scaled by a real scalar T, using the scaling and squaring method */
+/*  with Pade approximation. */
+
+/*  A is first balanced by DGEBAL.  The degree m of the Pade approximant */
+/*  and the number s of squarings are chosen from estimates of */
+/*  || A**k ||**(1/k), which are cheap to obtain from the powers of A */
+/*  needed anyway, so that nonnormal matrices are not overscaled. */
+/*  The powers of A, their norms and the balancing are kept in WORK and */
+/*  IWORK, and a further call with FACT = 'F' reuses them to compute */
+/*  exp( T*A ) for a new value of T at the cost of about three matrix */
+/*  multiplications fewer. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  FACT    (input) CHARACTER*1 */
+/*          Specifies whether the matrix A has already been processed: */
+/*          = 'N':  A is balanced and its powers are formed as needed. */
+/*          = 'F':  A, WORK and IWORK contain the output of a previous */
+/*                  call to DGEXPM for the same N; only T may differ. */
+
+/*  BALANC  (input) CHARACTER*1 */
+/*          Specifies the balancing of A, as in DGEBAL: */
+/*          = 'N':  do not permute or scale; */
+/*          = 'P':  permute only; */
+/*          = 'S':  scale only; */
+/*          = 'B':  both permute and scale. */
+/*          Not referenced if FACT = 'F'. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  T       (input) DOUBLE PRECISION */
+/*          The scalar T. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry with FACT = 'N', the matrix A.  On exit, A is */
+/*          overwritten by the balanced matrix, as returned by DGEBAL. */
+/*          With FACT = 'F', A is an input argument and must be as */
+/*          returned by the previous call. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  E       (output) DOUBLE PRECISION array, dimension (LDE,N) */
+/*          If INFO = 0, the matrix exp( T*A ) of the original A. */
+
+/*  LDE     (input) INTEGER */
+/*          The leading dimension of the array E.  LDE >= max(1,N). */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (LWORK) */
+/*          On exit, if INFO = 0, WORK(1:3*N*N+N+5) holds the balancing */
+/*          and the powers of A for a later call with FACT = 'F'. */
+/*          If LWORK = -1, WORK(1) returns the required LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  LWORK >= 6*N*N+N+5. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the required size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  IWORK   (workspace/output) INTEGER array, dimension (N+3) */
+/*          On exit, IWORK(1:3) holds ILO and IHI from DGEBAL and the */
+/*          number of powers of A kept in WORK. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+/*          > 0:  if INFO = i, U(i,i) of the LU factorization of the */
+/*                denominator of the Pade approximant is exactly zero, */
+/*                and exp( T*A ) could not be computed.  This can only */
+/*                happen if elements of T*A are Inf or NaN. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The method is Algorithm 3.1 of A.H. Al-Mohy and N.J. Higham, 'A new */
+/*  scaling and squaring algorithm for the matrix exponential', SIAM J. */
+/*  Matrix Anal. Appl. 31 (2009), without the correction of s for */
+/*  rounding errors in the Pade approximant.  With B = A/||A||_1 the */
+/*  powers B**2, B**4 and B**6 are formed only as far as the degree m */
+/*  requires and kept in WORK; the norms of B**4 and B**6 are exact once */
+/*  those powers exist and are estimated with DLACN2 before, and the */
+/*  norms of B**8 and B**10 are always estimated.  If ||T*A||_1 exceeds */
+/*  2**50, m = 13 is used and s is large enough that no power of the */
+/*  scaled argument overflows. */
+
+/*  For the new T, X = T*A/2**s and the Pade approximant is */
+/*  r(X) = (V-U)**(-1)*(V+U), with V and U the even and odd parts of */
+/*  its numerator; r(X) is squared s times and the balancing undone. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    e_dim1 = *lde;
+    e_offset = 1 + e_dim1;
+    e -= e_offset;
+    --work;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    nofact = lsame_(fact, "N");
+    lquery = *lwork == -1;
+    nn = *n * *n;
+    if (! nofact && ! lsame_(fact, "F")) {
+	*info = -1;
+    } else if (nofact && ! lsame_(balanc, "N") && ! lsame_(balanc, "P") &&
+	     ! lsame_(balanc, "S") && ! lsame_(balanc, "B")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*lda < max(1,*n)) {
+	*info = -6;
+    } else if (*lde < max(1,*n)) {
+	*info = -8;
+    } else if (*lwork < nn * 6 + *n + 5 && ! lquery) {
+	*info = -10;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DGEXPM", &i__1);
+	return 0;
+    } else if (lquery) {
+	work[1] = (doublereal) (nn * 6 + *n + 5);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n == 0) {
+	return 0;
+    }
+
+/*     WORK(1:5) holds ||A||_1 and the norms of B**4, B**6, B**8 and */
+/*     B**10 (negative while unknown), WORK(ISCL) the balancing factors */
+/*     and WORK(IA2), WORK(IA4), WORK(IA6) the powers of B.  The rest */
+/*     is workspace. */
+
+    iscl = 6;
+    ia2 = iscl + *n;
+    ia4 = ia2 + nn;
+    ia6 = ia4 + nn;
+    iu = ia6 + nn;
+    iv = iu + nn;
+    ix = iv + nn;
+
+    if (nofact) {
+	dgebal_(balanc, n, &a[a_offset], lda, &iwork[1], &iwork[2], &work[
+		iscl], &ierr);
+	work[1] = dlange_("1", n, n, &a[a_offset], lda, &work[iu]);
+	for (k = 2; k <= 5; ++k) {
+	    work[k] = -1.;
+/* L10: */
+	}
+	iwork[3] = 0;
+    }
+    ilo = iwork[1];
+    ihi = iwork[2];
+
+    r0 = abs(*t) * work[1];
+    if (r0 == 0.) {
+	dlaset_("Full", n, n, &c_b8, &c_b9, &e[e_offset], lde);
+	return 0;
+    }
+    big = r0 > 1125899906842624.;
+
+/*     Form B**2 and estimate the norms of B**4 and B**6 */
+
+    if (iwork[3] < 1) {
+	dlacpy_("Full", n, n, &a[a_offset], lda, &work[iu], n);
+	dlascl_("G", &c__0, &c__0, &work[1], &c_b9, n, n, &work[iu], n, &
+		ierr);
+	dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[iu], n,
+		&work[iu], n, &c_b8, &work[ia2], n);
+	iwork[3] = 1;
+    }
+    if (work[2] < 0.) {
+	dgexpm_nrm(n, &c__2, &work[ia2], &c__0, &work[ia2], &work[iu], &
+		iwork[4], &work[2]);
+    }
+    if (work[3] < 0.) {
+	dgexpm_nrm(n, &c__3, &work[ia2], &c__0, &work[ia2], &work[iu], &
+		iwork[4], &work[3]);
+    }
+    d__1 = .25;
+    d4 = pow_dd(&work[2], &d__1);
+    d__1 = 1. / 6.;
+    d6 = pow_dd(&work[3], &d__1);
+    s = 0;
+    if (! big && r0 * max(d4,d6) <= theta[0]) {
+	m = 3;
+	goto L30;
+    }
+
+/*     Form B**4 */
+
+    if (iwork[3] < 2) {
+	dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[ia2], n,
+		 &work[ia2], n, &c_b8, &work[ia4], n);
+	work[2] = dlange_("1", n, n, &work[ia4], n, &work[iu]);
+	iwork[3] = 2;
+    }
+    d__1 = .25;
+    d4 = pow_dd(&work[2], &d__1);
+    if (! big && r0 * max(d4,d6) <= theta[1]) {
+	m = 5;
+	goto L30;
+    }
+
+/*     Form B**6 and estimate the norm of B**8 */
+
+    if (iwork[3] < 3) {
+	dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[ia4], n,
+		 &work[ia2], n, &c_b8, &work[ia6], n);
+	work[3] = dlange_("1", n, n, &work[ia6], n, &work[iu]);
+	iwork[3] = 3;
+    }
+    if (work[4] < 0.) {
+	dgexpm_nrm(n, &c__2, &work[ia4], &c__0, &work[ia4], &work[iu], &
+		iwork[4], &work[4]);
+    }
+    d__1 = 1. / 6.;
+    d6 = pow_dd(&work[3], &d__1);
+    d__1 = .125;
+    d8 = pow_dd(&work[4], &d__1);
+    eta = max(d6,d8);
+    if (! big && r0 * eta <= theta[2]) {
+	m = 7;
+	goto L30;
+    }
+    if (! big && r0 * eta <= theta[3]) {
+	m = 9;
+	goto L30;
+    }
+
+/*     Estimate the norm of B**10 = B**4*B**6 and choose s for m = 13 */
+
+    if (work[5] < 0.) {
+	dgexpm_nrm(n, &c__1, &work[ia4], &c__1, &work[ia6], &work[iu], &
+		iwork[4], &work[5]);
+    }
+    d__1 = .1;
+    d10 = pow_dd(&work[5], &d__1);
+/* Computing MIN */
+    d__1 = eta, d__2 = max(d8,d10);
+    eta = min(d__1,d__2);
+    m = 13;
+    d__1 = log(r0) / log(2.);
+    d__1 = min(d__1,1024.);
+    if (eta > 0.) {
+	d__2 = d__1 + log(eta / theta[4]) / log(2.);
+	if (d__2 > 0.) {
+	    s = (integer) d_int(&d__2);
+	    if ((doublereal) s < d__2) {
+		++s;
+	    }
+	}
+    }
+    d__1 += -50.;
+    if (d__1 > (doublereal) s) {
+	s = (integer) d_int(&d__1) + 1;
+    }
+
+L30:
+
+/*     X = T*A/2**s = TR*A, and X**k = (R0/2**s)**k * B**k */
+
+    i__1 = -s;
+    tr = *t * pow_di(&c_b10, &i__1);
+    r2 = r0 * pow_di(&c_b10, &i__1);
+    r2 *= r2;
+    r4 = r2 * r2;
+    r6 = r4 * r2;
+    r8 = r4 * r4;
+
+    if (m <= 9) {
+
+/*        V = sum b(2k) X**(2k) and W = sum b(2k+1) X**(2k) in WORK(IV) */
+/*        and WORK(IX); B**8 is formed in WORK(IU) when m = 9 */
+
+	if (m == 3) {
+	    b = b3;
+	} else if (m == 5) {
+	    b = b5;
+	} else if (m == 7) {
+	    b = b7;
+	} else {
+	    b = b9;
+	    dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &work[ia4],
+		    n, &work[ia4], n, &c_b8, &work[iu], n);
+	}
+	dlaset_("Full", n, n, &c_b8, b, &work[iv], n);
+	dlaset_("Full", n, n, &c_b8, &b[1], &work[ix], n);
+	d__1 = b[2] * r2;
+	daxpy_(&nn, &d__1, &work[ia2], &c__1, &work[iv], &c__1);
+	d__1 = b[3] * r2;
+	daxpy_(&nn, &d__1, &work[ia2], &c__1, &work[ix], &c__1);
+	if (m >= 5) {
+	    d__1 = b[4] * r4;
+	    daxpy_(&nn, &d__1, &work[ia4], &c__1, &work[iv], &c__1);
+	    d__1 = b[5] * r4;
+	    daxpy_(&nn, &d__1, &work[ia4], &c__1, &work[ix], &c__1);
+	}
+	if (m >= 7) {
+	    d__1 = b[6] * r6;
+	    daxpy_(&nn, &d__1, &work[ia6], &c__1, &work[iv], &c__1);
+	    d__1 = b[7] * r6;
+	    daxpy_(&nn, &d__1, &work[ia6], &c__1, &work[ix], &c__1);
+	}
+	if (m == 9) {
+	    d__1 = b[8] * r8;
+	    daxpy_(&nn, &d__1, &work[iu], &c__1, &work[iv], &c__1);
+	    d__1 = b[9] * r8;
+	    daxpy_(&nn, &d__1, &work[iu], &c__1, &work[ix], &c__1);
+	}
+
+/*        U = X*W */
+
+	dgemm_("No transpose", "No transpose", n, n, n, &tr, &a[a_offset],
+		lda, &work[ix], n, &c_b8, &work[iu], n);
+	ju = iu;
+    } else {
+
+/*        U = X*( X**6*( b13*X**6 + b11*X**4 + b9*X**2 ) */
+/*                + b7*X**6 + b5*X**4 + b3*X**2 + b1*I ) */
+
+	i__1 = nn;
+	for (i__ = 0; i__ < i__1; ++i__) {
+	    work[ix + i__] = b13[13] * r6 * work[ia6 + i__] + b13[11] * r4 *
+		    work[ia4 + i__] + b13[9] * r2 * work[ia2 + i__];
+/* L40: */
+	}
+	dlaset_("Full", n, n, &c_b8, &b13[1], &work[iu], n);
+	i__1 = nn;
+	for (i__ = 0; i__ < i__1; ++i__) {
+	    work[iu + i__] = work[iu + i__] + b13[7] * r6 * work[ia6 + i__] +
+		    b13[5] * r4 * work[ia4 + i__] + b13[3] * r2 * work[ia2 +
+		    i__];
+/* L50: */
+	}
+	dgemm_("No transpose", "No transpose", n, n, n, &r6, &work[ia6], n, &
+		work[ix], n, &c_b9, &work[iu], n);
+	dgemm_("No transpose", "No transpose", n, n, n, &tr, &a[a_offset],
+		lda, &work[iu], n, &c_b8, &work[ix], n);
+	ju = ix;
+
+/*        V = X**6*( b12*X**6 + b10*X**4 + b8*X**2 ) */
+/*            + b6*X**6 + b4*X**4 + b2*X**2 + b0*I */
+
+	i__1 = nn;
+	for (i__ = 0; i__ < i__1; ++i__) {
+	    work[iu + i__] = b13[12] * r6 * work[ia6 + i__] + b13[10] * r4 *
+		    work[ia4 + i__] + b13[8] * r2 * work[ia2 + i__];
+/* L60: */
+	}
+	dlaset_("Full", n, n, &c_b8, b13, &work[iv], n);
+	i__1 = nn;
+	for (i__ = 0; i__ < i__1; ++i__) {
+	    work[iv + i__] = work[iv + i__] + b13[6] * r6 * work[ia6 + i__] +
+		    b13[4] * r4 * work[ia4 + i__] + b13[2] * r2 * work[ia2 +
+		    i__];
+/* L70: */
+	}
+	dgemm_("No transpose", "No transpose", n, n, n, &r6, &work[ia6], n, &
+		work[iu], n, &c_b9, &work[iv], n);
+    }
+
+/*     Solve ( V - U )*R = V + U, with R overwriting E */
+
+    i__1 = *n;
+    for (j = 1; j <= i__1; ++j) {
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    k = iv + i__ - 1 + (j - 1) * *n;
+	    ii = ju + i__ - 1 + (j - 1) * *n;
+	    e[i__ + j * e_dim1] = work[k] + work[ii];
+	    work[k] -= work[ii];
+/* L80: */
+	}
+/* L90: */
+    }
+    dgesv_(n, n, &work[iv], n, &iwork[4], &e[e_offset], lde, info);
+    if (*info > 0) {
+	return 0;
+    }
+
+/*     Square s times */
+
+    i__1 = s;
+    for (k = 1; k <= i__1; ++k) {
+	dgemm_("No transpose", "No transpose", n, n, n, &c_b9, &e[e_offset],
+		lde, &e[e_offset], lde, &c_b8, &work[iu], n);
+	dlacpy_("Full", n, n, &work[iu], n, &e[e_offset], lde);
+/* L100: */
+    }
+
+/*     Undo the balancing, E := P*D*E*inv(D)*P' */
+
+    i__1 = ihi;
+    for (i__ = ilo; i__ <= i__1; ++i__) {
+	if (work[iscl + i__ - 1] != 1.) {
+	    dscal_(n, &work[iscl + i__ - 1], &e[i__ + e_dim1], lde);
+	    d__1 = 1. / work[iscl + i__ - 1];
+	    dscal_(n, &d__1, &e[i__ * e_dim1 + 1], &c__1);
+	}
+/* L110: */
+    }
+    i__1 = *n;
+    for (ii = 1; ii <= i__1; ++ii) {
+	i__ = ii;
+	if (i__ >= ilo && i__ <= ihi) {
+	    goto L120;
+	}
+	if (i__ < ilo) {
+	    i__ = ilo - ii;
+	}
+	k = (integer) work[iscl + i__ - 1];
+	if (k == i__) {
+	    goto L120;
+	}
+	dswap_(n, &e[i__ + e_dim1], lde, &e[k + e_dim1], lde);
+	dswap_(n, &e[i__ * e_dim1 + 1], &c__1, &e[k * e_dim1 + 1], &c__1);
+L120:
+	;
+    }
+    return 0;
+
+/*     End of DGEXPM */
+
+} /* dgexpm_ */
+
+/* Estimates the 1-norm of B**K * C**L, where B and C are N-by-N with */
+/* leading dimension N, using DLACN2.  WORK has length 3*N and IWORK */
+/* length N. */
+
+static int dgexpm_nrm(integer *n, integer *k, doublereal *b, integer *l,
+	doublereal *c__, doublereal *work, integer *iwork, doublereal *est)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    integer j, kase, isave[3];
+    extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, integer *), dcopy_(integer *,
+	    doublereal *, integer *, doublereal *, integer *), dlacn2_(
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, integer *);
+
+    /* Parameter adjustments */
+    --work;
+
+    /* Function Body */
+    kase = 0;
+L10:
+    dlacn2_(n, &work[1], &work[*n + 1], iwork, est, &kase, isave);
+    if (kase != 0) {
+	if (kase == 1) {
+	    i__1 = *l;
+	    for (j = 1; j <= i__1; ++j) {
+		dgemv_("No transpose", n, n, &c_b9, c__, n, &work[*n + 1], &
+			c__1, &c_b8, &work[(*n << 1) + 1], &c__1);
+		dcopy_(n, &work[(*n << 1) + 1], &c__1, &work[*n + 1], &c__1);
+/* L20: */
+	    }
+	    i__1 = *k;
+	    for (j = 1; j <= i__1; ++j) {
+		dgemv_("No transpose", n, n, &c_b9, b, n, &work[*n + 1], &
+			c__1, &c_b8, &work[(*n << 1) + 1], &c__1);
+		dcopy_(n, &work[(*n << 1) + 1], &c__1, &work[*n + 1], &c__1);
+/* L30: */
+	    }
+	} else {
+	    i__1 = *k;
+	    for (j = 1; j <= i__1; ++j) {
+		dgemv_("Transpose", n, n, &c_b9, b, n, &work[*n + 1], &c__1,
+			&c_b8, &work[(*n << 1) + 1], &c__1);
+		dcopy_(n, &work[(*n << 1) + 1], &c__1, &work[*n + 1], &c__1);
+/* L40: */
+	    }
+	    i__1 = *l;
+	    for (j = 1; j <= i__1; ++j) {
+		dgemv_("Transpose", n, n, &c_b9, c__, n, &work[*n + 1], &
+			c__1, &c_b8, &work[(*n << 1) + 1], &c__1);
+		dcopy_(n, &work[(*n << 1) + 1], &c__1, &work[*n + 1], &c__1);
+/* L50: */
+	    }
+	}
+	goto L10;
+    }
+    return 0;
+} /* dgexpm_nrm */
@@ -93,6 +93,11 @@ static doublereal c_b39 = 1.;
     extern /* Subroutine */ int dormqr_(char *, char *, integer *, integer *, 
 	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
 	    integer *, doublereal *, integer *, integer *);
+    extern /* Subroutine */ int dlaqz0_(char *, char *, char *, integer *, 
+	    integer *, integer *, doublereal *, integer *, doublereal *, 
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *, 
+	     integer *, doublereal *, integer *, doublereal *, integer *, 
+	    integer *, integer *);
     integer minwrk, maxwrk;
     doublereal smlnum;
     logical wantst, lquery;
@@ -245,7 +250,9 @@ static doublereal c_b39 = 1.;
 /*  LWORK   (input) INTEGER */
 /*          The dimension of the array WORK. */
 /*          If N = 0, LWORK >= 1, else LWORK >= 8*N+16. */
-/*          For good performance , LWORK must generally be larger. */
+/*          For good performance , LWORK must generally be larger; with */
+/*          the optimal LWORK the multishift QZ algorithm (DLAQZ0) is */
+/*          used instead of DHGEQZ. */
 
 /*          If LWORK = -1, then a workspace query is assumed; the routine */
 /*          only calculates the optimal size of the WORK array, returns */
@@ -378,6 +385,13 @@ static doublereal c_b39 = 1.;
 			"GQR", " ", n, &c__1, n, &c_n1);
 		maxwrk = max(i__1,i__2);
 	    }
+	    dlaqz0_("S", jobvsl, jobvsr, n, &c__1, n, &a[a_offset], lda, &b[
+		    b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vsl[
+		    vsl_offset], ldvsl, &vsr[vsr_offset], ldvsr, &work[1], &
+		    c_n1, &c__0, &ierr);
+/* Computing MAX */
+	    i__1 = maxwrk, i__2 = (*n << 1) + (integer) work[1];
+	    maxwrk = max(i__1,i__2);
 	} else {
 	    minwrk = 1;
 	    maxwrk = 1;
@@ -502,13 +516,24 @@ static doublereal c_b39 = 1.;
 	    ldb, &vsl[vsl_offset], ldvsl, &vsr[vsr_offset], ldvsr, &ierr);
 
 /*     Perform QZ algorithm, computing Schur vectors if desired */
-/*     (Workspace: need N) */
+/*     (Workspace: need N, prefer the size returned by DLAQZ0) */
 
     iwrk = itau;
-    i__1 = *lwork + 1 - iwrk;
-    dhgeqz_("S", jobvsl, jobvsr, n, &ilo, &ihi, &a[a_offset], lda, &b[
+    dlaqz0_("S", jobvsl, jobvsr, n, &ilo, &ihi, &a[a_offset], lda, &b[
 	    b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vsl[vsl_offset]
-, ldvsl, &vsr[vsr_offset], ldvsr, &work[iwrk], &i__1, &ierr);
+, ldvsl, &vsr[vsr_offset], ldvsr, &work[iwrk], &c_n1, &c__0, &ierr);
+    i__1 = *lwork + 1 - iwrk;
+    if (i__1 >= (integer) work[iwrk]) {
+	dlaqz0_("S", jobvsl, jobvsr, n, &ilo, &ihi, &a[a_offset], lda, &b[
+		b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vsl[
+		vsl_offset], ldvsl, &vsr[vsr_offset], ldvsr, &work[iwrk], &
+		i__1, &c__0, &ierr);
+    } else {
+	dhgeqz_("S", jobvsl, jobvsr, n, &ilo, &ihi, &a[a_offset], lda, &b[
+		b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vsl[
+		vsl_offset], ldvsl, &vsr[vsr_offset], ldvsr, &work[iwrk], &
+		i__1, &ierr);
+    }
     if (ierr != 0) {
 	if (ierr > 0 && ierr <= *n) {
 	    *info = ierr;
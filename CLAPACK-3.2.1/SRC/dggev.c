@@ -85,6 +85,11 @@ static doublereal c_b37 = 1.;
     extern /* Subroutine */ int dormqr_(char *, char *, integer *, integer *, 
 	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
 	    integer *, doublereal *, integer *, integer *);
+    extern /* Subroutine */ int dlaqz0_(char *, char *, char *, integer *, 
+	    integer *, integer *, doublereal *, integer *, doublereal *, 
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *, 
+	     integer *, doublereal *, integer *, doublereal *, integer *, 
+	    integer *, integer *);
     integer minwrk, maxwrk;
     doublereal smlnum;
     logical lquery;
@@ -204,7 +209,9 @@ static doublereal c_b37 = 1.;
 
 /*  LWORK   (input) INTEGER */
 /*          The dimension of the array WORK.  LWORK >= max(1,8*N). */
-/*          For good performance, LWORK must generally be larger. */
+/*          For good performance, LWORK must generally be larger; with */
+/*          the optimal LWORK the multishift QZ algorithm (DLAQZ0) is */
+/*          used instead of DHGEQZ. */
 
 /*          If LWORK = -1, then a workspace query is assumed; the routine */
 /*          only calculates the optimal size of the WORK array, returns */
@@ -327,6 +334,18 @@ static doublereal c_b37 = 1.;
 		    c__1, n, &c_n1) + 7);
 	    maxwrk = max(i__1,i__2);
 	}
+	if (ilv) {
+	    *(unsigned char *)chtemp = 'S';
+	} else {
+	    *(unsigned char *)chtemp = 'E';
+	}
+	dlaqz0_(chtemp, jobvl, jobvr, n, &c__1, n, &a[a_offset], lda, &b[
+		b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vl[
+		vl_offset], ldvl, &vr[vr_offset], ldvr, &work[1], &c_n1, &
+		c__0, &ierr);
+/* Computing MAX */
+	i__1 = maxwrk, i__2 = (*n << 1) + (integer) work[1];
+	maxwrk = max(i__1,i__2);
 	work[1] = (doublereal) maxwrk;
 
 	if (*lwork < minwrk && ! lquery) {
@@ -462,7 +481,7 @@ static doublereal c_b37 = 1.;
 
 /*     Perform QZ algorithm (Compute eigenvalues, and optionally, the */
 /*     Schur forms and Schur vectors) */
-/*     (Workspace: need N) */
+/*     (Workspace: need N, prefer the size returned by DLAQZ0) */
 
     iwrk = itau;
     if (ilv) {
@@ -470,10 +489,21 @@ static doublereal c_b37 = 1.;
     } else {
 	*(unsigned char *)chtemp = 'E';
     }
-    i__1 = *lwork + 1 - iwrk;
-    dhgeqz_(chtemp, jobvl, jobvr, n, &ilo, &ihi, &a[a_offset], lda, &b[
+    dlaqz0_(chtemp, jobvl, jobvr, n, &ilo, &ihi, &a[a_offset], lda, &b[
 	    b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vl[vl_offset], 
-	    ldvl, &vr[vr_offset], ldvr, &work[iwrk], &i__1, &ierr);
+	    ldvl, &vr[vr_offset], ldvr, &work[iwrk], &c_n1, &c__0, &ierr);
+    i__1 = *lwork + 1 - iwrk;
+    if (i__1 >= (integer) work[iwrk]) {
+	dlaqz0_(chtemp, jobvl, jobvr, n, &ilo, &ihi, &a[a_offset], lda, &b[
+		b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vl[
+		vl_offset], ldvl, &vr[vr_offset], ldvr, &work[iwrk], &i__1, &
+		c__0, &ierr);
+    } else {
+	dhgeqz_(chtemp, jobvl, jobvr, n, &ilo, &ihi, &a[a_offset], lda, &b[
+		b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &vl[
+		vl_offset], ldvl, &vr[vr_offset], ldvr, &work[iwrk], &i__1, &
+		ierr);
+    }
     if (ierr != 0) {
 	if (ierr > 0 && ierr <= *n) {
 	    *info = ierr;
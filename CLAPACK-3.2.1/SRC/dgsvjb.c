@@ -0,0 +1,327 @@
+/* dgsvjb.c -- DGSVJB, orthogonalizes one pair of column blocks for DGESVJB. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__0 = 0;
+static doublereal c_b10 = 0.;
+static doublereal c_b11 = 1.;
+
+/* Subroutine */ int dgsvjb_(char *jobv, integer *m, integer *mv, integer *
+	n1, integer *n2, doublereal *a1, doublereal *a2, integer *lda,
+	doublereal *v1, doublereal *v2, integer *ldv, doublereal *tol,
+	doublereal *off, doublereal *work, integer *lwork, integer *info)
+{
+    /* System generated locals */
+    integer i__1, i__2;
+    doublereal d__1, d__2;
+
+    /* Local variables */
+    integer i__, j, k, w, ig, ir, iwk, ivp, ipos, isva, itau, iwrk, ierr,
+	    lrem;
+    doublereal beta, cnrm, vmax, scale;
+    extern doublereal dnrm2_(integer *, doublereal *, integer *);
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dsyrk_(char *,
+	    char *, integer *, integer *, doublereal *, doublereal *, integer
+	    *, doublereal *, doublereal *, integer *), dgeqrf_(integer *,
+	    integer *, doublereal *, integer *, doublereal *, doublereal *,
+	    integer *, integer *), dorgqr_(integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, integer *,
+	    integer *), dscal_(integer *, doublereal *, doublereal *, integer
+	    *), dswap_(integer *, doublereal *, integer *, doublereal *,
+	    integer *), dgesvj_(char *, char *, char *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, integer *),
+	    dlacpy_(char *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, integer *), dlaset_(char *, integer *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *), dlascl_(
+	    char *, integer *, integer *, doublereal *, doublereal *, integer
+	    *, integer *, doublereal *, integer *, integer *);
+    logical rsvec;
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DGSVJB is called from DGESVJB to orthogonalize one pair of column */
+/*  blocks [ A1 A2 ] of an M-by-N matrix (M >= N1+N2) against each */
+/*  other, as one step of a blocked one-sided Jacobi sweep. */
+
+/*  If the columns of the pair are not already numerically orthogonal, */
+/*  the pair is reduced to the (N1+N2)-by-(N1+N2) triangular factor R */
+/*  of its QR factorization [ A1 A2 ] = Q * R, DGESVJ computes the SVD */
+/*  R = UR * SIGMA * VP', and the block rotation is applied with DGEMM: */
+
+/*       [ A1 A2 ] := Q * ( UR * SIGMA ) = [ A1 A2 ] * VP, */
+/*       [ V1 V2 ] := [ V1 V2 ] * VP. */
+
+/*  Forming the rotated pair from Q and the columns of UR * SIGMA, */
+/*  rather than multiplying the old columns by VP, preserves the high */
+/*  relative accuracy of small columns. */
+
+/*  The routine touches only the columns of the pair and its own WORK, */
+/*  so calls for disjoint pairs may execute concurrently. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  JOBV    (input) CHARACTER*1 */
+/*          = 'V':  the block rotation is also applied to [ V1 V2 ]; */
+/*          = 'N':  V1 and V2 are not referenced. */
+
+/*  M       (input) INTEGER */
+/*          The number of rows of A1 and A2.  M >= N1+N2. */
+
+/*  MV      (input) INTEGER */
+/*          If JOBV = 'V', the number of rows of V1 and V2.  MV >= 0. */
+
+/*  N1      (input) INTEGER */
+/*          The number of columns of A1.  N1 >= 0. */
+
+/*  N2      (input) INTEGER */
+/*          The number of columns of A2.  N2 >= 0. */
+
+/*  A1      (input/output) DOUBLE PRECISION array, dimension (LDA,N1) */
+/*  A2      (input/output) DOUBLE PRECISION array, dimension (LDA,N2) */
+/*          On entry, the two column blocks of the pair. */
+/*          On exit, the rotated blocks [ A1 A2 ] * VP. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of A1 and A2.  LDA >= max(1,M). */
+
+/*  V1      (input/output) DOUBLE PRECISION array, dimension (LDV,N1) */
+/*  V2      (input/output) DOUBLE PRECISION array, dimension (LDV,N2) */
+/*          If JOBV = 'V', the corresponding column blocks of the */
+/*          accumulated right singular vectors, postmultiplied by VP */
+/*          on exit. */
+
+/*  LDV     (input) INTEGER */
+/*          The leading dimension of V1 and V2.  LDV >= 1, and */
+/*          LDV >= MV if JOBV = 'V'. */
+
+/*  TOL     (input) DOUBLE PRECISION */
+/*          The pair is left untouched if the largest cosine of the */
+/*          angle between two of its columns does not exceed TOL. */
+
+/*  OFF     (output) DOUBLE PRECISION */
+/*          The largest cosine of the angle between two columns of the */
+/*          pair, measured before the rotation. */
+
+/*  WORK    (workspace) DOUBLE PRECISION array, dimension (LWORK) */
+
+/*  LWORK   (input) INTEGER */
+/*          The length of WORK.  With W = N1+N2, */
+/*          LWORK >= MAX(M,MV)*W + 2*W*W + 3*W + MAX(6,2*W). */
+/*          DGEQRF runs blocked if LWORK exceeds this by W*NB. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0 : successful exit. */
+/*          > 0 : DGESVJ did not converge on R; the rotation is still */
+/*                applied and the next sweep continues the iteration. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --work;
+
+    /* Function Body */
+    *info = 0;
+    *off = 0.;
+    rsvec = lsame_(jobv, "V");
+    w = *n1 + *n2;
+    if (w == 0 || *m == 0) {
+	return 0;
+    }
+
+/*     Partition the workspace: WK (MAX(M,MV)-by-W), TAU (W), */
+/*     R (W-by-W), G and VP (W-by-W), SVA (W), POS (W). */
+
+    iwk = 1;
+    itau = iwk + max(*m,*mv) * w;
+    ir = itau + w;
+    ivp = ir + w * w;
+    ig = ivp;
+    isva = ivp + w * w;
+    ipos = isva + w;
+    iwrk = ipos + w;
+    lrem = *lwork - iwrk + 1;
+
+/*     Measure the departure from orthogonality as DGESVJ does, on the */
+/*     columns themselves: G = WK' * WK, with WK the columns of the */
+/*     pair scaled to unit norm, holds their cosines.  (The cosines of */
+/*     R'*R carry a rounding error of order W*EPS, which would keep */
+/*     OFF above TOL = sqrt(M)*EPS when W is comparable to M.) */
+
+    if (*n1 > 0) {
+	dlacpy_("F", m, n1, a1, lda, &work[iwk], m);
+    }
+    if (*n2 > 0) {
+	dlacpy_("F", m, n2, a2, lda, &work[iwk + *m * *n1], m);
+    }
+    i__1 = w;
+    for (j = 1; j <= i__1; ++j) {
+	cnrm = dnrm2_(m, &work[iwk + (j - 1) * *m], &c__1);
+	work[isva + j - 1] = cnrm;
+	if (cnrm > 0.) {
+	    dlascl_("G", &c__0, &c__0, &cnrm, &c_b11, m, &c__1, &work[iwk + (
+		    j - 1) * *m], m, &ierr);
+	}
+/* L5: */
+    }
+    dsyrk_("U", "T", &w, m, &c_b11, &work[iwk], m, &c_b10, &work[ig], &w);
+    i__1 = w;
+    for (j = 2; j <= i__1; ++j) {
+	i__2 = j - 1;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    if (work[isva + i__ - 1] > 0. && work[isva + j - 1] > 0.) {
+		d__1 = (d__2 = work[ig + i__ - 1 + (j - 1) * w], abs(d__2));
+		*off = max(*off,d__1);
+	    }
+/* L10: */
+	}
+/* L20: */
+    }
+    if (*off <= *tol) {
+	return 0;
+    }
+
+/*     R = triangular factor of [ A1 A2 ] */
+
+    if (*n1 > 0) {
+	dlacpy_("F", m, n1, a1, lda, &work[iwk], m);
+    }
+    if (*n2 > 0) {
+	dlacpy_("F", m, n2, a2, lda, &work[iwk + *m * *n1], m);
+    }
+    dgeqrf_(m, &w, &work[iwk], m, &work[itau], &work[iwrk], &lrem, &ierr);
+    dlaset_("F", &w, &w, &c_b10, &c_b10, &work[ir], &w);
+    dlacpy_("U", &w, &w, &work[iwk], m, &work[ir], &w);
+
+/*     R * VP = UR * SIGMA by the point Jacobi method; C = UR * SIGMA */
+/*     is formed column by column, so that every column keeps its */
+/*     relative accuracy */
+
+    dgesvj_("U", "U", "V", &w, &w, &work[ir], &w, &work[isva], &w, &work[ivp]
+	    , &w, &work[iwrk], &lrem, info);
+    scale = work[iwrk];
+    i__1 = w;
+    for (j = 1; j <= i__1; ++j) {
+	d__1 = scale * work[isva + j - 1];
+	if (d__1 > 0.) {
+	    dscal_(&w, &d__1, &work[ir + (j - 1) * w], &c__1);
+	} else {
+	    dlaset_("F", &w, &c__1, &c_b10, &c_b10, &work[ir + (j - 1) * w], &
+		    w);
+	}
+/* L30: */
+    }
+
+/*     DGESVJ returns the columns sorted by decreasing singular values. */
+/*     Put every column back at the position of the input column it is */
+/*     closest to (largest entry of its column of VP), so that VP tends */
+/*     to the identity as the sweeps converge and the columns do not */
+/*     migrate between the blocks of the tournament. */
+
+    i__1 = w;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	work[isva + i__ - 1] = 0.;
+/* L40: */
+    }
+    i__1 = w;
+    for (j = 1; j <= i__1; ++j) {
+	k = 0;
+	vmax = -1.;
+	i__2 = w;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    d__1 = (d__2 = work[ivp + i__ - 1 + (j - 1) * w], abs(d__2));
+	    if (work[isva + i__ - 1] == 0. && d__1 > vmax) {
+		k = i__;
+		vmax = d__1;
+	    }
+/* L50: */
+	}
+	work[isva + k - 1] = 1.;
+	work[ipos + j - 1] = (doublereal) k;
+/* L60: */
+    }
+    i__1 = w;
+    for (j = 1; j <= i__1; ++j) {
+L70:
+	k = (integer) work[ipos + j - 1];
+	if (k != j) {
+	    dswap_(&w, &work[ir + (j - 1) * w], &c__1, &work[ir + (k - 1) * w]
+		    , &c__1);
+	    dswap_(&w, &work[ivp + (j - 1) * w], &c__1, &work[ivp + (k - 1) *
+		    w], &c__1);
+	    work[ipos + j - 1] = work[ipos + k - 1];
+	    work[ipos + k - 1] = (doublereal) k;
+	    goto L70;
+	}
+/* L80: */
+    }
+
+/*     [ A1 A2 ] := Q * C, with Q the first W columns of the orthogonal */
+/*     factor of the pair */
+
+    dorgqr_(m, &w, &w, &work[iwk], m, &work[itau], &work[iwrk], &lrem, &ierr);
+    if (*n1 > 0) {
+	dgemm_("N", "N", m, n1, &w, &c_b11, &work[iwk], m, &work[ir], &w, &
+		c_b10, a1, lda);
+    }
+    if (*n2 > 0) {
+	dgemm_("N", "N", m, n2, &w, &c_b11, &work[iwk], m, &work[ir + *n1 * w]
+		, &w, &c_b10, a2, lda);
+    }
+
+/*     [ V1 V2 ] := [ V1 V2 ] * VP */
+
+    if (rsvec && *mv > 0) {
+	beta = 0.;
+	if (*n1 > 0) {
+	    beta = 1.;
+	}
+	if (*n1 > 0) {
+	    dgemm_("N", "N", mv, &w, n1, &c_b11, v1, ldv, &work[ivp], &w, &
+		    c_b10, &work[iwk], mv);
+	}
+	if (*n2 > 0) {
+	    dgemm_("N", "N", mv, &w, n2, &c_b11, v2, ldv, &work[ivp + *n1], &
+		    w, &beta, &work[iwk], mv);
+	}
+	if (*n1 > 0) {
+	    dlacpy_("F", mv, n1, &work[iwk], mv, v1, ldv);
+	}
+	if (*n2 > 0) {
+	    dlacpy_("F", mv, n2, &work[iwk + *mv * *n1], mv, v2, ldv);
+	}
+    }
+    return 0;
+
+/*     End of DGSVJB */
+
+} /* dgsvjb_ */
@@ -0,0 +1,111 @@
+/* dla_ddaxpy.c -- DLA_DDAXPY, double-double AXPY update. */
+
+#include <math.h>
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dla_ddaxpy__(integer *n, doublereal *sh, doublereal *
+	sl, doublereal *x, doublereal *yh, doublereal *yl)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    integer i__;
+    doublereal e, p, s, t;
+#ifndef FP_FAST_FMA
+    doublereal ah, al, xh, xl;
+#endif
+
+
+/*     -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*     Purpose */
+/*     ======= */
+
+/*     DLA_DDAXPY adds a multiple of a vector X to a double-double */
+/*     vector (YH, YL), */
+
+/*        (YH, YL) := (YH, YL) + (SH + SL) * X, */
+
+/*     with the products SH*X(i) and the sums formed by error-free */
+/*     transformations (TwoProd and TwoSum).  The rounding errors are */
+/*     accumulated in YL, so after any number of calls YH(i) + YL(i) is */
+/*     as accurate as if the sum had been computed in twice the working */
+/*     precision. */
+
+/*     The loop has no dependences between iterations and vectorizes. */
+/*     TwoProd uses a fused multiply-add when the C library reports a */
+/*     fast one (FP_FAST_FMA) and Dekker's splitting otherwise.  This */
+/*     file must be compiled without contraction of a*b+c into an FMA */
+/*     (e.g. -ffp-contract=off) and without value-unsafe optimizations. */
+
+/*     Arguments */
+/*     ========= */
+
+/*     N      (input) INTEGER */
+/*            The length of vectors X, YH and YL. */
+
+/*     SH, SL (input) DOUBLE PRECISION */
+/*            The multiplier, as a double-double SH + SL. */
+
+/*     X      (input) DOUBLE PRECISION array, length N */
+/*            The vector to be added. */
+
+/*     YH, YL (input/output) DOUBLE PRECISION array, length N */
+/*            The double-double accumulation vector. */
+/*     .. */
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --yl;
+    --yh;
+    --x;
+
+    /* Function Body */
+#ifndef FP_FAST_FMA
+    t = *sh * 134217729.;
+    ah = t - (t - *sh);
+    al = *sh - ah;
+#endif
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+
+/*        (P, E) := SH * X(i) exactly. */
+
+	p = *sh * x[i__];
+#ifdef FP_FAST_FMA
+	e = fma(*sh, x[i__], -p);
+#else
+	t = x[i__] * 134217729.;
+	xh = t - (t - x[i__]);
+	xl = x[i__] - xh;
+	e = ah * xh - p + ah * xl + al * xh + al * xl;
+#endif
+	e += *sl * x[i__];
+
+/*        (S, T) := YH(i) + P exactly. */
+
+	s = yh[i__] + p;
+	t = s - yh[i__];
+	t = yh[i__] - (s - t) + (p - t);
+
+	yl[i__] = yl[i__] + (t + e);
+	yh[i__] = s;
+/* L10: */
+    }
+    return 0;
+
+/*     End of DLA_DDAXPY */
+
+} /* dla_ddaxpy__ */
@@ -0,0 +1,141 @@
+/* dla_dddot.c -- DLA_DDDOT, double-double dot product (Dot2). */
+
+#include <math.h>
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* TWOPROD(A, B, P, E) sets P + E = A * B exactly, P = fl(A * B). */
+
+#ifdef FP_FAST_FMA
+#define TWOPROD(a, b, p, e) \
+	(p = (a) * (b), e = fma((a), (b), -(p)))
+#else
+#define TWOPROD(a, b, p, e) \
+	(p = (a) * (b), t = (a) * 134217729., xh = t - (t - (a)), \
+	xl = (a) - xh, t = (b) * 134217729., zh = t - (t - (b)), \
+	zl = (b) - zh, e = xh * zh - (p) + xh * zl + xl * zh + xl * zl)
+#endif
+
+/* DDSTEP(I, K) adds X(I) * (YH(I) + YL(I)) into partial sum K. */
+
+#define DDSTEP(i, k) \
+	TWOPROD(x[i], yh[i], p, e); \
+	e += x[i] * yl[i]; \
+	s = ch[k] + p; \
+	t = s - ch[k]; \
+	t = ch[k] - (s - t) + (p - t); \
+	cl[k] = cl[k] + (t + e); \
+	ch[k] = s
+
+/* Subroutine */ int dla_dddot__(integer *n, doublereal *x, doublereal *yh,
+	 doublereal *yl, doublereal *sh, doublereal *sl)
+{
+    /* System generated locals */
+    integer i__1, i__2, i__3;
+
+    /* Local variables */
+    integer i__, k, m;
+    doublereal e, p, s, t, ch[4], cl[4];
+#ifndef FP_FAST_FMA
+    doublereal xh, xl, zh, zl;
+#endif
+
+
+/*     -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*     Purpose */
+/*     ======= */
+
+/*     DLA_DDDOT adds the dot product of a vector X with a double-double */
+/*     vector (YH, YL) to the double-double scalar (SH, SL), */
+
+/*        (SH, SL) := (SH, SL) + sum( X(i) * (YH(i) + YL(i)) ), */
+
+/*     with the products X(i)*YH(i) and the sums formed by error-free */
+/*     transformations (TwoProd and TwoSum), so that the result is as */
+/*     accurate as if it had been computed in twice the working */
+/*     precision (algorithm Dot2 of Ogita, Rump and Oishi). */
+
+/*     Four partial sums are carried so that groups of four consecutive */
+/*     iterations are independent and can be vectorized.  TwoProd uses */
+/*     a fused multiply-add when the C library reports a fast one */
+/*     (FP_FAST_FMA) and Dekker's splitting otherwise.  This file must */
+/*     be compiled without contraction of a*b+c into an FMA (e.g. */
+/*     -ffp-contract=off) and without value-unsafe optimizations. */
+
+/*     Arguments */
+/*     ========= */
+
+/*     N      (input) INTEGER */
+/*            The length of vectors X, YH and YL. */
+
+/*     X      (input) DOUBLE PRECISION array, length N */
+
+/*     YH, YL (input) DOUBLE PRECISION array, length N */
+/*            The double-double vector. */
+
+/*     SH, SL (input/output) DOUBLE PRECISION */
+/*            The double-double accumulator. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --yl;
+    --yh;
+    --x;
+
+    /* Function Body */
+    ch[0] = *sh;
+    cl[0] = *sl;
+    for (k = 1; k <= 3; ++k) {
+	ch[k] = 0.;
+	cl[k] = 0.;
+/* L10: */
+    }
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; i__ += 4) {
+/* Computing MIN */
+	i__2 = 4, i__3 = *n - i__ + 1;
+	m = min(i__2,i__3);
+	if (m == 4) {
+	    for (k = 0; k <= 3; ++k) {
+		DDSTEP(i__ + k, k);
+/* L20: */
+	    }
+	} else {
+	    i__2 = m - 1;
+	    for (k = 0; k <= i__2; ++k) {
+		DDSTEP(i__ + k, k);
+/* L30: */
+	    }
+	}
+/* L40: */
+    }
+
+/*     Combine the partial sums. */
+
+    for (k = 1; k <= 3; ++k) {
+	s = ch[0] + ch[k];
+	t = s - ch[0];
+	t = ch[0] - (s - t) + (ch[k] - t);
+	cl[0] = cl[0] + (t + cl[k]);
+	ch[0] = s;
+/* L50: */
+    }
+    *sh = ch[0];
+    *sl = cl[0];
+    return 0;
+
+/*     End of DLA_DDDOT */
+
+} /* dla_dddot__ */
@@ -0,0 +1,166 @@
+/* dla_gbresdd.c -- DLA_GBRESDD, double-double residual, band A. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dla_gbresdd__(integer *trans, integer *n, integer *kl, 
+	integer *ku, doublereal *ab, integer *ldab, doublereal *y, doublereal 
+	*y_tail__, doublereal *r__, doublereal *w)
+{
+    /* System generated locals */
+    integer ab_dim1, ab_offset, i__1, i__2, i__3;
+    doublereal d__1, d__2;
+
+    /* Local variables */
+    integer i__, j, k, i1, i2, len;
+    doublereal s, t, sh, sl;
+    extern integer ilatrans_(char *);
+    extern /* Subroutine */ int dla_ddaxpy__(integer *, doublereal *, 
+	    doublereal *, doublereal *, doublereal *, doublereal *), 
+	    dla_dddot__(integer *, doublereal *, doublereal *, doublereal *, 
+	    doublereal *, doublereal *);
+
+
+/*     -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*     Purpose */
+/*     ======= */
+
+/*     DLA_GBRESDD computes the residual */
+
+/*        R := R - op(A) * (Y + Y_TAIL),   op(A) = A or A', */
+
+/*     of an N-by-N band matrix A with KL subdiagonals and KU */
+/*     superdiagonals in double-double arithmetic, and rounds the result */
+/*     to working precision.  It is used by DLA_GBRFSX_EXTENDED in place */
+/*     of the XBLAS routines BLAS_DGBMV_X and BLAS_DGBMV2_X; see */
+/*     DLA_GERESDD. */
+
+/*     Arguments */
+/*     ========= */
+
+/*     TRANS  (input) INTEGER */
+/*            Specifies op(A), as returned by ILATRANS: */
+/*            = BLAS_NO_TRANS:   op(A) = A; */
+/*            = BLAS_TRANS or BLAS_CONJ_TRANS:  op(A) = A'. */
+
+/*     N      (input) INTEGER */
+/*            The order of the matrix A.  N >= 0. */
+
+/*     KL     (input) INTEGER */
+/*            The number of subdiagonals within the band of A.  KL >= 0. */
+
+/*     KU     (input) INTEGER */
+/*            The number of superdiagonals within the band of A.  KU >= 0. */
+
+/*     AB     (input) DOUBLE PRECISION array, dimension (LDAB,N) */
+/*            The matrix A in band storage, in rows 1 to KL+KU+1: */
+/*            AB(KU+1+i-j,j) = A(i,j) for max(1,j-KU)<=i<=min(N,j+KL). */
+
+/*     LDAB   (input) INTEGER */
+/*            The leading dimension of the array AB.  LDAB >= KL+KU+1. */
+
+/*     Y      (input) DOUBLE PRECISION array, dimension (N) */
+/*     Y_TAIL (input) DOUBLE PRECISION array, dimension (N) */
+/*            The solution vector in doubled precision, Y + Y_TAIL. */
+/*            Y_TAIL may be zero. */
+
+/*     R      (input/output) DOUBLE PRECISION array, dimension (N) */
+/*            On entry, the right hand side B. */
+/*            On exit, the residual B - op(A) * (Y + Y_TAIL). */
+
+/*     W      (workspace) DOUBLE PRECISION array, dimension (N) */
+
+/*     ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    ab_dim1 = *ldab;
+    ab_offset = 1 + ab_dim1;
+    ab -= ab_offset;
+    --y;
+    --y_tail__;
+    --r__;
+    --w;
+
+    /* Function Body */
+    if (*n <= 0) {
+	return 0;
+    }
+    if (*trans == ilatrans_("N")) {
+
+/*        Form  (R, W) := (R, 0) - A*(Y + Y_TAIL)  a column at a time. */
+
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    w[i__] = 0.;
+/* L10: */
+	}
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    if (y[j] != 0. || y_tail__[j] != 0.) {
+		k = *ku + 1 - j;
+/* Computing MAX */
+		i__2 = 1, i__3 = j - *ku;
+		i1 = max(i__2,i__3);
+/* Computing MIN */
+		i__2 = *n, i__3 = j + *kl;
+		i2 = min(i__2,i__3);
+		len = i2 - i1 + 1;
+		d__1 = -y[j];
+		d__2 = -y_tail__[j];
+		dla_ddaxpy__(&len, &d__1, &d__2, &ab[k + i1 + j * ab_dim1], &
+			r__[i1], &w[i1]);
+	    }
+/* L20: */
+	}
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    r__[i__] += w[i__];
+/* L30: */
+	}
+    } else {
+
+/*        Form  R(j) := R(j) - A(:,j)'*(Y + Y_TAIL). */
+
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    k = *ku + 1 - j;
+/* Computing MAX */
+	    i__2 = 1, i__3 = j - *ku;
+	    i1 = max(i__2,i__3);
+/* Computing MIN */
+	    i__2 = *n, i__3 = j + *kl;
+	    i2 = min(i__2,i__3);
+	    len = i2 - i1 + 1;
+	    sh = 0.;
+	    sl = 0.;
+	    dla_dddot__(&len, &ab[k + i1 + j * ab_dim1], &y[i1], &y_tail__[i1]
+		    , &sh, &sl);
+	    s = r__[j] - sh;
+	    t = s - r__[j];
+	    t = r__[j] - (s - t) - (sh + t);
+	    r__[j] = s + (t - sl);
+/* L40: */
+	}
+    }
+    return 0;
+
+/*     End of DLA_GBRESDD */
+
+} /* dla_gbresdd__ */
@@ -52,15 +52,11 @@ static doublereal c_b8 = 1.;
     extern /* Subroutine */ int dla_lin_berr__(integer *, integer *, integer *
 	    , doublereal *, doublereal *, doublereal *);
     doublereal ymin;
-    extern /* Subroutine */ int blas_dgbmv_x__(integer *, integer *, integer *
-	    , integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
-	    integer *);
+    extern /* Subroutine */ int dla_gbresdd__(integer *, integer *, integer *, 
+	    integer *, doublereal *, integer *, doublereal *, doublereal *, 
+	    doublereal *, doublereal *);
     integer y_prec_state__;
-    extern /* Subroutine */ int blas_dgbmv2_x__(integer *, integer *, integer 
-	    *, integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, doublereal *,
-	     integer *, integer *), dgbmv_(char *, integer *, integer *, 
+    extern /* Subroutine */ int dgbmv_(char *, integer *, integer *, 
 	    integer *, integer *, doublereal *, doublereal *, integer *, 
 	    doublereal *, integer *, doublereal *, doublereal *, integer *), dcopy_(integer *, doublereal *, integer *, doublereal *, 
 	    integer *);
@@ -116,6 +112,8 @@ static doublereal c_b8 = 1.;
 /*          = 'D':  Double */
 /*          = 'I':  Indigenous */
 /*          = 'X', 'E':  Extra */
+/*     PREC_TYPE is not referenced.  Extra precise residuals are */
+/*     computed in double-double arithmetic by DLA_GBRESDD. */
 
 /*     TRANS_TYPE     (input) INTEGER */
 /*     Specifies the transposition operation on A. */
@@ -402,11 +400,9 @@ static doublereal c_b8 = 1.;
     i__1 = *nrhs;
     for (j = 1; j <= i__1; ++j) {
 	y_prec_state__ = 1;
-	if (y_prec_state__ == 2) {
-	    i__2 = *n;
-	    for (i__ = 1; i__ <= i__2; ++i__) {
-		y_tail__[i__] = 0.;
-	    }
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    y_tail__[i__] = 0.;
 	}
 	dxrat = 0.;
 	dxratmax = 0.;
@@ -431,14 +427,9 @@ static doublereal c_b8 = 1.;
 	    if (y_prec_state__ == 0) {
 		dgbmv_(trans, &m, n, kl, ku, &c_b6, &ab[ab_offset], ldab, &y[
 			j * y_dim1 + 1], &c__1, &c_b8, &res[1], &c__1);
-	    } else if (y_prec_state__ == 1) {
-		blas_dgbmv_x__(trans_type__, n, n, kl, ku, &c_b6, &ab[
-			ab_offset], ldab, &y[j * y_dim1 + 1], &c__1, &c_b8, &
-			res[1], &c__1, prec_type__);
 	    } else {
-		blas_dgbmv2_x__(trans_type__, n, n, kl, ku, &c_b6, &ab[
-			ab_offset], ldab, &y[j * y_dim1 + 1], &y_tail__[1], &
-			c__1, &c_b8, &res[1], &c__1, prec_type__);
+		dla_gbresdd__(trans_type__, n, kl, ku, &ab[ab_offset], ldab, &
+			y[j * y_dim1 + 1], &y_tail__[1], &res[1], &dy[1]);
 	    }
 /*        XXX: RES is no longer needed. */
 	    dcopy_(n, &res[1], &c__1, &dy[1], &c__1);
@@ -0,0 +1,143 @@
+/* dla_geresdd.c -- DLA_GERESDD, double-double residual, general A. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dla_geresdd__(integer *trans, integer *n, doublereal *
+	a, integer *lda, doublereal *y, doublereal *y_tail__, doublereal *
+	r__, doublereal *w)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1;
+    doublereal d__1, d__2;
+
+    /* Local variables */
+    integer i__, j;
+    doublereal s, t, sh, sl;
+    extern integer ilatrans_(char *);
+    extern /* Subroutine */ int dla_ddaxpy__(integer *, doublereal *, 
+	    doublereal *, doublereal *, doublereal *, doublereal *), 
+	    dla_dddot__(integer *, doublereal *, doublereal *, doublereal *, 
+	    doublereal *, doublereal *);
+
+
+/*     -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*     Purpose */
+/*     ======= */
+
+/*     DLA_GERESDD computes the residual */
+
+/*        R := R - op(A) * (Y + Y_TAIL),   op(A) = A or A', */
+
+/*     of a general N-by-N matrix A in double-double arithmetic, and */
+/*     rounds the result to working precision.  It is used by */
+/*     DLA_GERFSX_EXTENDED in place of the XBLAS routines BLAS_DGEMV_X */
+/*     and BLAS_DGEMV2_X, so that extra-precise iterative refinement is */
+/*     available without XBLAS.  The products and sums are formed by */
+/*     error-free transformations (see DLA_DDAXPY and DLA_DDDOT), at a */
+/*     cost of a few times that of DGEMV. */
+
+/*     Arguments */
+/*     ========= */
+
+/*     TRANS  (input) INTEGER */
+/*            Specifies op(A), as returned by ILATRANS: */
+/*            = BLAS_NO_TRANS:   op(A) = A; */
+/*            = BLAS_TRANS or BLAS_CONJ_TRANS:  op(A) = A'. */
+
+/*     N      (input) INTEGER */
+/*            The order of the matrix A.  N >= 0. */
+
+/*     A      (input) DOUBLE PRECISION array, dimension (LDA,N) */
+/*            The N-by-N matrix A. */
+
+/*     LDA    (input) INTEGER */
+/*            The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*     Y      (input) DOUBLE PRECISION array, dimension (N) */
+/*     Y_TAIL (input) DOUBLE PRECISION array, dimension (N) */
+/*            The solution vector in doubled precision, Y + Y_TAIL. */
+/*            Y_TAIL may be zero. */
+
+/*     R      (input/output) DOUBLE PRECISION array, dimension (N) */
+/*            On entry, the right hand side B. */
+/*            On exit, the residual B - op(A) * (Y + Y_TAIL). */
+
+/*     W      (workspace) DOUBLE PRECISION array, dimension (N) */
+/*            Holds the low order part of R during the computation. */
+
+/*     ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --y;
+    --y_tail__;
+    --r__;
+    --w;
+
+    /* Function Body */
+    if (*n <= 0) {
+	return 0;
+    }
+    if (*trans == ilatrans_("N")) {
+
+/*        Form  (R, W) := (R, 0) - A*(Y + Y_TAIL)  a column at a time. */
+
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    w[i__] = 0.;
+/* L10: */
+	}
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    if (y[j] != 0. || y_tail__[j] != 0.) {
+		d__1 = -y[j];
+		d__2 = -y_tail__[j];
+		dla_ddaxpy__(n, &d__1, &d__2, &a[j * a_dim1 + 1], &r__[1], &w[
+			1]);
+	    }
+/* L20: */
+	}
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    r__[i__] += w[i__];
+/* L30: */
+	}
+    } else {
+
+/*        Form  R(j) := R(j) - A(:,j)'*(Y + Y_TAIL). */
+
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    sh = 0.;
+	    sl = 0.;
+	    dla_dddot__(n, &a[j * a_dim1 + 1], &y[1], &y_tail__[1], &sh, &sl);
+	    s = r__[j] - sh;
+	    t = s - r__[j];
+	    t = r__[j] - (s - t) - (sh + t);
+	    r__[j] = s + (t - sl);
+/* L40: */
+	}
+    }
+    return 0;
+
+/*     End of DLA_GERESDD */
+
+} /* dla_geresdd__ */
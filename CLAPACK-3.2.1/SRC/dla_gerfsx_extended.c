@@ -52,17 +52,14 @@ static doublereal c_b8 = 1.;
     extern /* Subroutine */ int dla_lin_berr__(integer *, integer *, integer *
 	    , doublereal *, doublereal *, doublereal *);
     doublereal ymin;
-    extern /* Subroutine */ int blas_dgemv_x__(integer *, integer *, integer *
-	    , doublereal *, doublereal *, integer *, doublereal *, integer *, 
-	    doublereal *, doublereal *, integer *, integer *);
+    extern /* Subroutine */ int dla_geresdd__(integer *, integer *, 
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *, 
+	    doublereal *);
     integer y_prec_state__;
-    extern /* Subroutine */ int blas_dgemv2_x__(integer *, integer *, integer 
-	    *, doublereal *, doublereal *, integer *, doublereal *, 
-	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
-	    integer *), dgemv_(char *, integer *, integer *, doublereal *, 
-	    doublereal *, integer *, doublereal *, integer *, doublereal *, 
-	    doublereal *, integer *), dcopy_(integer *, doublereal *, 
-	    integer *, doublereal *, integer *);
+    extern /* Subroutine */ int dgemv_(char *, integer *, integer *, 
+	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
+	    doublereal *, doublereal *, integer *), dcopy_(integer *, 
+	    doublereal *, integer *, doublereal *, integer *);
     doublereal dxrat, dzrat;
     extern /* Subroutine */ int daxpy_(integer *, doublereal *, doublereal *, 
 	    integer *, doublereal *, integer *);
@@ -115,6 +112,8 @@ static doublereal c_b8 = 1.;
 /*          = 'D':  Double */
 /*          = 'I':  Indigenous */
 /*          = 'X', 'E':  Extra */
+/*     PREC_TYPE is not referenced.  Extra precise residuals are */
+/*     computed in double-double arithmetic by DLA_GERESDD. */
 
 /*     TRANS_TYPE     (input) INTEGER */
 /*     Specifies the transposition operation on A. */
@@ -395,11 +394,9 @@ static doublereal c_b8 = 1.;
     i__1 = *nrhs;
     for (j = 1; j <= i__1; ++j) {
 	y_prec_state__ = 1;
-	if (y_prec_state__ == 2) {
-	    i__2 = *n;
-	    for (i__ = 1; i__ <= i__2; ++i__) {
-		y_tail__[i__] = 0.;
-	    }
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    y_tail__[i__] = 0.;
 	}
 	dxrat = 0.;
 	dxratmax = 0.;
@@ -424,14 +421,9 @@ static doublereal c_b8 = 1.;
 	    if (y_prec_state__ == 0) {
 		dgemv_(trans, n, n, &c_b6, &a[a_offset], lda, &y[j * y_dim1 + 
 			1], &c__1, &c_b8, &res[1], &c__1);
-	    } else if (y_prec_state__ == 1) {
-		blas_dgemv_x__(trans_type__, n, n, &c_b6, &a[a_offset], lda, &
-			y[j * y_dim1 + 1], &c__1, &c_b8, &res[1], &c__1, 
-			prec_type__);
 	    } else {
-		blas_dgemv2_x__(trans_type__, n, n, &c_b6, &a[a_offset], lda, 
-			&y[j * y_dim1 + 1], &y_tail__[1], &c__1, &c_b8, &res[
-			1], &c__1, prec_type__);
+		dla_geresdd__(trans_type__, n, &a[a_offset], lda, &y[j * 
+			y_dim1 + 1], &y_tail__[1], &res[1], &dy[1]);
 	    }
 /*        XXX: RES is no longer needed. */
 	    dcopy_(n, &res[1], &c__1, &dy[1], &c__1);
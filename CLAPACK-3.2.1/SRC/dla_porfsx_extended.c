@@ -52,16 +52,13 @@ static doublereal c_b11 = 1.;
 	    , doublereal *, doublereal *, doublereal *);
     doublereal ymin;
     integer y_prec_state__;
-    extern /* Subroutine */ int blas_dsymv_x__(integer *, integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
-	    doublereal *, doublereal *, integer *, integer *);
+    extern /* Subroutine */ int dla_syresdd__(integer *, integer *, 
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *, 
+	    doublereal *);
     integer uplo2;
     extern logical lsame_(char *, char *);
-    extern /* Subroutine */ int blas_dsymv2_x__(integer *, integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, doublereal *,
-	     integer *, doublereal *, doublereal *, integer *, integer *), 
-	    dcopy_(integer *, doublereal *, integer *, doublereal *, integer *
-);
+    extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *, 
+	    doublereal *, integer *);
     doublereal dxrat, dzrat;
     extern /* Subroutine */ int daxpy_(integer *, doublereal *, doublereal *, 
 	    integer *, doublereal *, integer *), dsymv_(char *, integer *, 
@@ -114,6 +111,8 @@ static doublereal c_b11 = 1.;
 /*          = 'D':  Double */
 /*          = 'I':  Indigenous */
 /*          = 'X', 'E':  Extra */
+/*     PREC_TYPE is not referenced.  Extra precise residuals are */
+/*     computed in double-double arithmetic by DLA_SYRESDD. */
 
 /*     UPLO    (input) CHARACTER*1 */
 /*       = 'U':  Upper triangle of A is stored; */
@@ -389,11 +388,9 @@ static doublereal c_b11 = 1.;
     i__1 = *nrhs;
     for (j = 1; j <= i__1; ++j) {
 	y_prec_state__ = 1;
-	if (y_prec_state__ == 2) {
-	    i__2 = *n;
-	    for (i__ = 1; i__ <= i__2; ++i__) {
-		y_tail__[i__] = 0.;
-	    }
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    y_tail__[i__] = 0.;
 	}
 	dxrat = 0.;
 	dxratmax = 0.;
@@ -418,18 +415,13 @@ static doublereal c_b11 = 1.;
 	    if (y_prec_state__ == 0) {
 		dsymv_(uplo, n, &c_b9, &a[a_offset], lda, &y[j * y_dim1 + 1], 
 			&c__1, &c_b11, &res[1], &c__1);
-	    } else if (y_prec_state__ == 1) {
-		blas_dsymv_x__(&uplo2, n, &c_b9, &a[a_offset], lda, &y[j * 
-			y_dim1 + 1], &c__1, &c_b11, &res[1], &c__1, 
-			prec_type__);
 	    } else {
-		blas_dsymv2_x__(&uplo2, n, &c_b9, &a[a_offset], lda, &y[j * 
-			y_dim1 + 1], &y_tail__[1], &c__1, &c_b11, &res[1], &
-			c__1, prec_type__);
+		dla_syresdd__(&uplo2, n, &a[a_offset], lda, &y[j * y_dim1 + 
+			1], &y_tail__[1], &res[1], &dy[1]);
 	    }
 /*         XXX: RES is no longer needed. */
 	    dcopy_(n, &res[1], &c__1, &dy[1], &c__1);
-	    dpotrs_(uplo, n, nrhs, &af[af_offset], ldaf, &dy[1], n, info);
+	    dpotrs_(uplo, n, &c__1, &af[af_offset], ldaf, &dy[1], n, info);
 
 /*         Calculate relative changes DX_X, DZ_Z and ratios DXRAT, DZRAT. */
 
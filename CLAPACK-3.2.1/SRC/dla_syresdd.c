@@ -0,0 +1,151 @@
+/* dla_syresdd.c -- DLA_SYRESDD, double-double residual, symmetric A. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dla_syresdd__(integer *uplo, integer *n, doublereal *a,
+	 integer *lda, doublereal *y, doublereal *y_tail__, doublereal *r__, 
+	doublereal *w)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1, i__2;
+    doublereal d__1, d__2;
+
+    /* Local variables */
+    integer i__, j;
+    doublereal s, t, sh, sl;
+    extern integer ilauplo_(char *);
+    extern /* Subroutine */ int dla_ddaxpy__(integer *, doublereal *, 
+	    doublereal *, doublereal *, doublereal *, doublereal *), 
+	    dla_dddot__(integer *, doublereal *, doublereal *, doublereal *, 
+	    doublereal *, doublereal *);
+
+
+/*     -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*     Purpose */
+/*     ======= */
+
+/*     DLA_SYRESDD computes the residual */
+
+/*        R := R - A * (Y + Y_TAIL) */
+
+/*     of an N-by-N symmetric matrix A in double-double arithmetic, and */
+/*     rounds the result to working precision.  It is used by */
+/*     DLA_SYRFSX_EXTENDED and DLA_PORFSX_EXTENDED in place of the XBLAS */
+/*     routines BLAS_DSYMV_X and BLAS_DSYMV2_X; see DLA_GERESDD. */
+
+/*     Arguments */
+/*     ========= */
+
+/*     UPLO   (input) INTEGER */
+/*            Specifies which triangle of A is stored, as returned by */
+/*            ILAUPLO: */
+/*            = BLAS_UPPER:  Upper triangle; */
+/*            = BLAS_LOWER:  Lower triangle. */
+
+/*     N      (input) INTEGER */
+/*            The order of the matrix A.  N >= 0. */
+
+/*     A      (input) DOUBLE PRECISION array, dimension (LDA,N) */
+/*            The symmetric matrix A.  Only the triangle specified by */
+/*            UPLO is referenced. */
+
+/*     LDA    (input) INTEGER */
+/*            The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*     Y      (input) DOUBLE PRECISION array, dimension (N) */
+/*     Y_TAIL (input) DOUBLE PRECISION array, dimension (N) */
+/*            The solution vector in doubled precision, Y + Y_TAIL. */
+/*            Y_TAIL may be zero. */
+
+/*     R      (input/output) DOUBLE PRECISION array, dimension (N) */
+/*            On entry, the right hand side B. */
+/*            On exit, the residual B - A * (Y + Y_TAIL). */
+
+/*     W      (workspace) DOUBLE PRECISION array, dimension (N) */
+
+/*     ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    --y;
+    --y_tail__;
+    --r__;
+    --w;
+
+    /* Function Body */
+    if (*n <= 0) {
+	return 0;
+    }
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	w[i__] = 0.;
+/* L10: */
+    }
+
+/*     Each column j of the stored triangle contributes to R twice: */
+/*     through A(:,j)*Y(j) and, as a row of A, through A(:,j)'*Y. */
+
+    i__1 = *n;
+    for (j = 1; j <= i__1; ++j) {
+	sh = 0.;
+	sl = 0.;
+	if (*uplo == ilauplo_("U")) {
+	    i__2 = j - 1;
+	    if (i__2 > 0 && (y[j] != 0. || y_tail__[j] != 0.)) {
+		d__1 = -y[j];
+		d__2 = -y_tail__[j];
+		dla_ddaxpy__(&i__2, &d__1, &d__2, &a[j * a_dim1 + 1], &r__[1],
+			 &w[1]);
+	    }
+	    dla_dddot__(&j, &a[j * a_dim1 + 1], &y[1], &y_tail__[1], &sh, &
+		    sl);
+	} else {
+	    i__2 = *n - j;
+	    if (i__2 > 0 && (y[j] != 0. || y_tail__[j] != 0.)) {
+		d__1 = -y[j];
+		d__2 = -y_tail__[j];
+		dla_ddaxpy__(&i__2, &d__1, &d__2, &a[j + 1 + j * a_dim1], &
+			r__[j + 1], &w[j + 1]);
+	    }
+	    i__2 = *n - j + 1;
+	    dla_dddot__(&i__2, &a[j + j * a_dim1], &y[j], &y_tail__[j], &sh, &
+		    sl);
+	}
+
+/*        (R(j), W(j)) := (R(j), W(j)) - (SH, SL). */
+
+	s = r__[j] - sh;
+	t = s - r__[j];
+	t = r__[j] - (s - t) - (sh + t);
+	w[j] += t - sl;
+	r__[j] = s;
+/* L20: */
+    }
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	r__[i__] += w[i__];
+/* L30: */
+    }
+    return 0;
+
+/*     End of DLA_SYRESDD */
+
+} /* dla_syresdd__ */
@@ -28,11 +28,16 @@ static doublereal c_b16 = 0.;
     /* System generated locals */
     integer a_dim1, a_offset, x_dim1, x_offset, y_dim1, y_offset, i__1, i__2, 
 	    i__3;
+    doublereal d__1, d__2, d__3, d__4;
 
     /* Local variables */
-    integer i__;
-    extern /* Subroutine */ int dscal_(integer *, doublereal *, doublereal *, 
-	    integer *), dgemv_(char *, integer *, integer *, doublereal *, 
+    integer i__, j;
+    doublereal zmax, alpha;
+    extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *, 
+	    integer *);
+    extern /* Subroutine */ int daxpy_(integer *, doublereal *, doublereal *, 
+	    integer *, doublereal *, integer *), dscal_(integer *, doublereal *,
+	     doublereal *, integer *), dgemv_(char *, integer *, integer *, doublereal *, 
 	    doublereal *, integer *, doublereal *, integer *, doublereal *, 
 	    doublereal *, integer *), dlarfg_(integer *, doublereal *, 
 	     doublereal *, integer *, doublereal *);
@@ -150,6 +155,15 @@ static doublereal c_b16 = 0.;
 /*  the transformation to the unreduced part of the matrix, using a block */
 /*  update of the form:  A := A - V*Y' - X*U'. */
 
+/*  If m >= n, the products A(i:m,i+1:n)'*v and A(i+1:m,i+1:n)*u of */
+/*  step i are formed in a single sweep over the trailing matrix: the */
+/*  product with the updated row z = A(i,i+1:n) is accumulated while */
+/*  the columns of Y are computed, and A*u is recovered from it through */
+/*  u = ( z - e(i)*e_1 ) / ( z(1) - e(i) ).  The product is accumulated */
+/*  with z divided by a running bound on its largest entry, so that it */
+/*  cannot overflow or underflow where A*u would not.  This halves the */
+/*  memory traffic of the panel, which dominates the cost of DGEBRD. */
+
 /*  The contents of A on exit are illustrated by the following examples */
 /*  with nb = 2: */
 
@@ -231,13 +245,14 @@ static doublereal c_b16 = 0.;
 	    if (i__ < *n) {
 		a[i__ + i__ * a_dim1] = 1.;
 
-/*              Compute Y(i+1:n,i) */
+/*              Corrections to Y(i+1:n,i) that involve only the */
+/*              panel, using Y(1:i-1,i) as workspace */
 
-		i__2 = *m - i__ + 1;
-		i__3 = *n - i__;
-		dgemv_("Transpose", &i__2, &i__3, &c_b5, &a[i__ + (i__ + 1) * 
-			a_dim1], lda, &a[i__ + i__ * a_dim1], &c__1, &c_b16, &
-			y[i__ + 1 + i__ * y_dim1], &c__1);
+		i__2 = *n;
+		for (j = i__ + 1; j <= i__2; ++j) {
+		    y[j + i__ * y_dim1] = 0.;
+/* L5: */
+		}
 		i__2 = *m - i__ + 1;
 		i__3 = i__ - 1;
 		dgemv_("Transpose", &i__2, &i__3, &c_b5, &a[i__ + a_dim1], 
@@ -258,23 +273,58 @@ static doublereal c_b16 = 0.;
 		dgemv_("Transpose", &i__2, &i__3, &c_b4, &a[(i__ + 1) * 
 			a_dim1 + 1], lda, &y[i__ * y_dim1 + 1], &c__1, &c_b5, 
 			&y[i__ + 1 + i__ * y_dim1], &c__1);
-		i__2 = *n - i__;
-		dscal_(&i__2, &tauq[i__], &y[i__ + 1 + i__ * y_dim1], &c__1);
 
-/*              Update A(i,i+1:n) */
-
-		i__2 = *n - i__;
-		dgemv_("No transpose", &i__2, &i__, &c_b4, &y[i__ + 1 + 
-			y_dim1], ldy, &a[i__ + a_dim1], lda, &c_b5, &a[i__ + (
-			i__ + 1) * a_dim1], lda);
-		i__2 = i__ - 1;
-		i__3 = *n - i__;
-		dgemv_("Transpose", &i__2, &i__3, &c_b4, &a[(i__ + 1) * 
-			a_dim1 + 1], lda, &x[i__ + x_dim1], ldx, &c_b5, &a[
-			i__ + (i__ + 1) * a_dim1], lda);
+/*              One pass over the trailing matrix computes */
+/*              Y(i+1:n,i), finishes the update of A(i,i+1:n) and */
+/*              accumulates W = A(i+1:m,i+1:n)*A(i,i+1:n)'/ZMAX in */
+/*              X(i+1:m,i), so that the two matrix-vector products with */
+/*              A(i:m,i+1:n) share one sweep through memory.  ZMAX */
+/*              bounds the entries of the row seen so far, and W is */
+/*              rescaled whenever it grows, so that W cannot overflow */
+/*              or underflow where A*u would not */
+
+		i__2 = *m;
+		for (j = i__ + 1; j <= i__2; ++j) {
+		    x[j + i__ * x_dim1] = 0.;
+/* L6: */
+		}
+		zmax = 0.;
+		i__2 = *n;
+		for (j = i__ + 1; j <= i__2; ++j) {
+		    i__3 = *m - i__ + 1;
+		    y[j + i__ * y_dim1] = tauq[i__] * (ddot_(&i__3, &a[i__ + j 
+			    * a_dim1], &c__1, &a[i__ + i__ * a_dim1], &c__1) 
+			    + y[j + i__ * y_dim1]);
+		    i__3 = i__ - 1;
+		    a[i__ + j * a_dim1] = a[i__ + j * a_dim1] - ddot_(&i__3, &
+			    y[j + y_dim1], ldy, &a[i__ + a_dim1], lda) - ddot_(&
+			    i__3, &a[j * a_dim1 + 1], &c__1, &x[i__ + x_dim1], 
+			    ldx) - y[j + i__ * y_dim1];
+		    i__3 = *m - i__;
+		    if ((d__1 = a[i__ + j * a_dim1], abs(d__1)) > zmax) {
+			if (zmax > 0.) {
+/* Computing MAX */
+			    d__1 = (d__2 = a[i__ + j * a_dim1], abs(d__2)), 
+				    d__3 = zmax * 256.;
+			    d__4 = zmax / max(d__1,d__3);
+			    dscal_(&i__3, &d__4, &x[i__ + 1 + i__ * x_dim1], &
+				    c__1);
+			    zmax = max(d__1,d__3);
+			} else {
+			    zmax = (d__1 = a[i__ + j * a_dim1], abs(d__1));
+			}
+		    }
+		    if (zmax > 0.) {
+			d__1 = a[i__ + j * a_dim1] / zmax;
+			daxpy_(&i__3, &d__1, &a[i__ + 1 + j * a_dim1], &c__1, 
+				&x[i__ + 1 + i__ * x_dim1], &c__1);
+		    }
+/* L7: */
+		}
 
 /*              Generate reflection P(i) to annihilate A(i,i+2:n) */
 
+		alpha = a[i__ + (i__ + 1) * a_dim1];
 		i__2 = *n - i__;
 /* Computing MIN */
 		i__3 = i__ + 2;
@@ -283,13 +333,18 @@ static doublereal c_b16 = 0.;
 		e[i__] = a[i__ + (i__ + 1) * a_dim1];
 		a[i__ + (i__ + 1) * a_dim1] = 1.;
 
-/*              Compute X(i+1:m,i) */
-
-		i__2 = *m - i__;
-		i__3 = *n - i__;
-		dgemv_("No transpose", &i__2, &i__3, &c_b5, &a[i__ + 1 + (i__ 
-			+ 1) * a_dim1], lda, &a[i__ + (i__ + 1) * a_dim1], 
-			lda, &c_b16, &x[i__ + 1 + i__ * x_dim1], &c__1);
+/*              Compute X(i+1:m,i).  The reflector vector is */
+/*              u = ( z - E(i)*e_1 ) / ( alpha - E(i) ), where z is the */
+/*              updated row, hence A(i+1:m,i+1:n)*u follows from W */
+
+		if (taup[i__] != 0.) {
+		    i__2 = *m - i__;
+		    d__1 = -e[i__] / zmax;
+		    daxpy_(&i__2, &d__1, &a[i__ + 1 + (i__ + 1) * a_dim1], &
+			    c__1, &x[i__ + 1 + i__ * x_dim1], &c__1);
+		    d__1 = zmax / (alpha - e[i__]);
+		    dscal_(&i__2, &d__1, &x[i__ + 1 + i__ * x_dim1], &c__1);
+		}
 		i__2 = *n - i__;
 		dgemv_("Transpose", &i__2, &i__, &c_b5, &y[i__ + 1 + y_dim1], 
 			ldy, &a[i__ + (i__ + 1) * a_dim1], lda, &c_b16, &x[
@@ -0,0 +1,458 @@
+/* dlacn1.c -- DLACN1, block (Higham-Tisseur) 1-norm estimator. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__2 = 2;
+
+/* Subroutine */ int dlacn1_(integer *n, integer *t, doublereal *v,
+	doublereal *x, integer *ldx, doublereal *xold, integer *ldxold,
+	doublereal *h__, integer *ind, integer *indh, doublereal *est,
+	integer *kase, integer *iseed, integer *isave)
+{
+    /* System generated locals */
+    integer x_dim1, x_offset, xold_dim1, xold_offset, i__1, i__2;
+    doublereal d__1;
+
+    /* Local variables */
+    integer i__, j, k, it, jb, nsel, iter;
+    doublereal temp, hmax;
+    extern doublereal ddot_(integer *, doublereal *, integer *, doublereal *,
+	    integer *);
+    logical allhst, paral;
+    extern doublereal dasum_(integer *, doublereal *, integer *);
+    extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
+	    doublereal *, integer *), dlacpy_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *), dlarnv_(
+	    integer *, integer *, integer *, doublereal *);
+    doublereal estnew;
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DLACN1 estimates the 1-norm of a square, real matrix A using the */
+/*  block algorithm of Higham and Tisseur, which iterates with T vectors */
+/*  at a time.  Reverse communication is used for evaluating the */
+/*  products of A or A' with N-by-T matrices, so the caller can use */
+/*  Level 3 BLAS (e.g. DTRSM when A is the inverse of a triangular */
+/*  factor). */
+
+/*  With T = 1 the algorithm is that of DLACN2 without its alternative */
+/*  estimate; larger T gives a more reliable estimate in fewer */
+/*  iterations.  T = 2 is usually sufficient. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  N      (input) INTEGER */
+/*         The order of the matrix.  N >= 1. */
+
+/*  T      (input) INTEGER */
+/*         The number of vectors used per iteration.  1 <= T <= N. */
+
+/*  V      (output) DOUBLE PRECISION array, dimension (N) */
+/*         On the final return, V = A*W,  where  EST = norm(V)/norm(W) */
+/*         (W is not returned). */
+
+/*  X      (input/output) DOUBLE PRECISION array, dimension (LDX,T) */
+/*         On an intermediate return, X should be overwritten by */
+/*               A * X,   if KASE=1, */
+/*               A' * X,  if KASE=2, */
+/*         and DLACN1 must be re-called with all the other parameters */
+/*         unchanged. */
+
+/*  LDX    (input) INTEGER */
+/*         The leading dimension of the array X.  LDX >= max(1,N). */
+
+/*  XOLD   (workspace) DOUBLE PRECISION array, dimension (LDXOLD,T) */
+
+/*  LDXOLD (input) INTEGER */
+/*         The leading dimension of the array XOLD.  LDXOLD >= max(1,N). */
+
+/*  H      (workspace) DOUBLE PRECISION array, dimension (N) */
+
+/*  IND    (workspace) INTEGER array, dimension (N) */
+
+/*  INDH   (workspace) INTEGER array, dimension (N) */
+
+/*  EST    (input/output) DOUBLE PRECISION */
+/*         On entry with KASE = 1 or 2, EST should be unchanged from the */
+/*         previous call to DLACN1. */
+/*         On exit, EST is an estimate (a lower bound) for norm(A). */
+
+/*  KASE   (input/output) INTEGER */
+/*         On the initial call to DLACN1, KASE should be 0. */
+/*         On an intermediate return, KASE will be 1 or 2, indicating */
+/*         whether X should be overwritten by A * X  or A' * X. */
+/*         On the final return from DLACN1, KASE will again be 0. */
+
+/*  ISEED  (input/output) INTEGER array, dimension (4) */
+/*         The seed of the random number generator used to choose the */
+/*         starting vectors 2 to T, as in DLARNV; the array elements */
+/*         must be between 0 and 4095, and ISEED(4) must be odd. */
+/*         The estimate is a deterministic function of A and ISEED. */
+
+/*  ISAVE  (input/output) INTEGER array, dimension (3) */
+/*         ISAVE is used to save variables between calls to DLACN1. */
+
+/*  Further Details */
+/*  ======= ======= */
+
+/*  Reference: N.J. Higham and F. Tisseur, "A block algorithm for */
+/*  matrix 1-norm estimation, with an application to 1-norm */
+/*  pseudospectra", SIAM J. Matrix Anal. Appl., vol. 21, no. 4, */
+/*  pp. 1185-1201, 2000 (Algorithm 2.4). */
+
+/*  The variables of the algorithm are saved as follows: */
+
+/*      JUMP      ISAVE(1) */
+/*      ITER      ISAVE(2) */
+/*      IND_BEST  ISAVE(3) */
+
+/*  At most ITMAX = 5 iterations are performed.  Columns of the sign */
+/*  matrix that are parallel to another column or to a column of the */
+/*  previous sign matrix are resampled at most ITMAX times each. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --v;
+    x_dim1 = *ldx;
+    x_offset = 1 + x_dim1;
+    x -= x_offset;
+    xold_dim1 = *ldxold;
+    xold_offset = 1 + xold_dim1;
+    xold -= xold_offset;
+    --h__;
+    --ind;
+    --indh;
+    --iseed;
+    --isave;
+
+    /* Function Body */
+    if (*kase == 0) {
+
+/*        X(:,1) = ones, X(:,2:T) random +-1 with no two columns */
+/*        parallel, all scaled to unit 1-norm */
+
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    x[i__ + x_dim1] = 1.;
+	    indh[i__] = 0;
+/* L10: */
+	}
+	i__1 = *t;
+	for (j = 2; j <= i__1; ++j) {
+	    for (it = 1; it <= 5; ++it) {
+		dlarnv_(&c__2, &iseed[1], n, &x[j * x_dim1 + 1]);
+		i__2 = *n;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (x[i__ + j * x_dim1] >= 0.) {
+			x[i__ + j * x_dim1] = 1.;
+		    } else {
+			x[i__ + j * x_dim1] = -1.;
+		    }
+/* L20: */
+		}
+		paral = FALSE_;
+		i__2 = j - 1;
+		for (k = 1; k <= i__2; ++k) {
+		    if ((d__1 = ddot_(n, &x[j * x_dim1 + 1], &c__1, &x[k *
+			    x_dim1 + 1], &c__1), abs(d__1)) == (doublereal) (*
+			    n)) {
+			paral = TRUE_;
+		    }
+/* L30: */
+		}
+		if (! paral) {
+		    goto L50;
+		}
+/* L40: */
+	    }
+L50:
+	    ;
+	}
+	i__1 = *t;
+	for (j = 1; j <= i__1; ++j) {
+	    i__2 = *n;
+	    for (i__ = 1; i__ <= i__2; ++i__) {
+		x[i__ + j * x_dim1] /= (doublereal) (*n);
+/* L60: */
+	    }
+/* L70: */
+	}
+	*est = 0.;
+	isave[1] = 1;
+	isave[2] = 1;
+	isave[3] = 0;
+	*kase = 1;
+	return 0;
+    }
+
+    iter = isave[2];
+    switch (isave[1]) {
+	case 1:  goto L100;
+	case 2:  goto L210;
+    }
+
+/*     ................ ENTRY   (ISAVE( 1 ) = 1) */
+/*     X HAS BEEN OVERWRITTEN BY A*X. */
+
+L100:
+    estnew = 0.;
+    jb = 1;
+    i__1 = *t;
+    for (j = 1; j <= i__1; ++j) {
+	temp = dasum_(n, &x[j * x_dim1 + 1], &c__1);
+	if (temp > estnew) {
+	    estnew = temp;
+	    jb = j;
+	}
+/* L110: */
+    }
+    if (iter >= 2 && estnew <= *est) {
+	goto L900;
+    }
+    dcopy_(n, &x[jb * x_dim1 + 1], &c__1, &v[1], &c__1);
+    if (iter >= 2) {
+	isave[3] = ind[jb];
+    }
+    *est = estnew;
+    if (*n == 1 || iter > 5) {
+	goto L900;
+    }
+
+/*     S = SIGN(Y) */
+
+    i__1 = *t;
+    for (j = 1; j <= i__1; ++j) {
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    if (x[i__ + j * x_dim1] >= 0.) {
+		x[i__ + j * x_dim1] = 1.;
+	    } else {
+		x[i__ + j * x_dim1] = -1.;
+	    }
+/* L120: */
+	}
+/* L130: */
+    }
+
+/*     Converged if every column of S is parallel to a column of SOLD. */
+
+    if (iter >= 2) {
+	i__1 = *t;
+	for (j = 1; j <= i__1; ++j) {
+	    paral = FALSE_;
+	    i__2 = *t;
+	    for (k = 1; k <= i__2; ++k) {
+		if ((d__1 = ddot_(n, &x[j * x_dim1 + 1], &c__1, &xold[k *
+			xold_dim1 + 1], &c__1), abs(d__1)) == (doublereal) (*
+			n)) {
+		    paral = TRUE_;
+		}
+/* L140: */
+	    }
+	    if (! paral) {
+		goto L160;
+	    }
+/* L150: */
+	}
+	goto L900;
+    }
+L160:
+
+/*     Resample columns of S parallel to an earlier column of S or to a */
+/*     column of SOLD. */
+
+    if (*t > 1) {
+	i__1 = *t;
+	for (j = 1; j <= i__1; ++j) {
+	    for (it = 1; it <= 5; ++it) {
+		paral = FALSE_;
+		i__2 = j - 1;
+		for (k = 1; k <= i__2; ++k) {
+		    if ((d__1 = ddot_(n, &x[j * x_dim1 + 1], &c__1, &x[k *
+			    x_dim1 + 1], &c__1), abs(d__1)) == (doublereal) (*
+			    n)) {
+			paral = TRUE_;
+		    }
+/* L170: */
+		}
+		if (iter >= 2) {
+		    i__2 = *t;
+		    for (k = 1; k <= i__2; ++k) {
+			if ((d__1 = ddot_(n, &x[j * x_dim1 + 1], &c__1, &xold[
+				k * xold_dim1 + 1], &c__1), abs(d__1)) == (
+				doublereal) (*n)) {
+			    paral = TRUE_;
+			}
+/* L180: */
+		    }
+		}
+		if (! paral) {
+		    goto L200;
+		}
+		dlarnv_(&c__2, &iseed[1], n, &x[j * x_dim1 + 1]);
+		i__2 = *n;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (x[i__ + j * x_dim1] >= 0.) {
+			x[i__ + j * x_dim1] = 1.;
+		    } else {
+			x[i__ + j * x_dim1] = -1.;
+		    }
+/* L190: */
+		}
+	    }
+L200:
+	    ;
+	}
+    }
+    dlacpy_("F", n, t, &x[x_offset], ldx, &xold[xold_offset], ldxold);
+    isave[1] = 2;
+    *kase = 2;
+    return 0;
+
+/*     ................ ENTRY   (ISAVE( 1 ) = 2) */
+/*     X HAS BEEN OVERWRITTEN BY TRANSPOSE(A)*S. */
+
+L210:
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	h__[i__] = 0.;
+	i__2 = *t;
+	for (j = 1; j <= i__2; ++j) {
+	    temp = (d__1 = x[i__ + j * x_dim1], abs(d__1));
+	    h__[i__] = max(h__[i__],temp);
+/* L220: */
+	}
+/* L230: */
+    }
+
+/*     Converged if the largest entry of H is at the best index. */
+
+    if (iter >= 2) {
+	hmax = 0.;
+	i__1 = *n;
+	for (i__ = 1; i__ <= i__1; ++i__) {
+	    hmax = max(hmax,h__[i__]);
+/* L240: */
+	}
+	if (hmax == h__[isave[3]]) {
+	    goto L900;
+	}
+    }
+
+/*     IND(1:T) = indices of the T largest entries of H.  Entries */
+/*     already chosen are marked by storing -1-H(I) in H. */
+
+    allhst = TRUE_;
+    i__1 = *t;
+    for (j = 1; j <= i__1; ++j) {
+	k = 1;
+	i__2 = *n;
+	for (i__ = 2; i__ <= i__2; ++i__) {
+	    if (h__[i__] > h__[k]) {
+		k = i__;
+	    }
+/* L250: */
+	}
+	ind[j] = k;
+	if (indh[k] == 0) {
+	    allhst = FALSE_;
+	}
+	h__[k] = -1. - h__[k];
+/* L260: */
+    }
+    i__1 = *t;
+    for (j = 1; j <= i__1; ++j) {
+	h__[ind[j]] = -1. - h__[ind[j]];
+/* L270: */
+    }
+    if (allhst) {
+	goto L900;
+    }
+
+/*     Replace IND(1:T) by the T largest entries of H whose unit vectors */
+/*     have not been used yet. */
+
+    nsel = 0;
+    i__1 = *t;
+    for (j = 1; j <= i__1; ++j) {
+	k = 0;
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    if (indh[i__] == 0 && h__[i__] >= 0.) {
+		if (k == 0) {
+		    k = i__;
+		} else if (h__[i__] > h__[k]) {
+		    k = i__;
+		}
+	    }
+/* L280: */
+	}
+	if (k == 0) {
+	    goto L300;
+	}
+	++nsel;
+	ind[j] = k;
+	h__[k] = -1. - h__[k];
+/* L290: */
+    }
+L300:
+    i__1 = nsel;
+    for (j = 1; j <= i__1; ++j) {
+	h__[ind[j]] = -1. - h__[ind[j]];
+/* L310: */
+    }
+
+/*     X(:,J) = E(IND(J)); unused columns are set to zero. */
+
+    i__1 = *t;
+    for (j = 1; j <= i__1; ++j) {
+	i__2 = *n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    x[i__ + j * x_dim1] = 0.;
+/* L320: */
+	}
+	if (j <= nsel) {
+	    x[ind[j] + j * x_dim1] = 1.;
+	    indh[ind[j]] = 1;
+	}
+/* L330: */
+    }
+    isave[1] = 1;
+    isave[2] = iter + 1;
+    *kase = 1;
+    return 0;
+
+L900:
+    *kase = 0;
+    return 0;
+
+/*     End of DLACN1 */
+
+} /* dlacn1_ */
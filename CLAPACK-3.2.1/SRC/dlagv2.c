@@ -191,6 +191,7 @@ static integer c__1 = 1;
 	*snr = 0.;
 	a[a_dim1 + 2] = 0.;
 	b[b_dim1 + 2] = 0.;
+	wi = 0.;
 
 /*     Check if B is singular */
 
@@ -203,6 +204,7 @@ static integer c__1 = 1;
 	a[a_dim1 + 2] = 0.;
 	b[b_dim1 + 1] = 0.;
 	b[b_dim1 + 2] = 0.;
+	wi = 0.;
 
     } else if ((d__1 = b[(b_dim1 << 1) + 2], abs(d__1)) <= ulp) {
 	dlartg_(&a[(a_dim1 << 1) + 2], &a[a_dim1 + 2], csr, snr, &t);
@@ -216,6 +218,7 @@ static integer c__1 = 1;
 	a[a_dim1 + 2] = 0.;
 	b[b_dim1 + 2] = 0.;
 	b[(b_dim1 << 1) + 2] = 0.;
+	wi = 0.;
 
     } else {
 
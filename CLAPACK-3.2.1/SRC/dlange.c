@@ -22,18 +22,18 @@ doublereal dlange_(char *norm, integer *m, integer *n, doublereal *a, integer
 {
     /* System generated locals */
     integer a_dim1, a_offset, i__1, i__2;
-    doublereal ret_val, d__1, d__2, d__3;
+    doublereal ret_val, d__1;
 
     /* Builtin functions */
     double sqrt(doublereal);
 
     /* Local variables */
-    integer i__, j;
-    doublereal sum, scale;
+    integer i__, j, k, jlo, jhi, nchk;
+    doublereal sum, ssq[128], cval[64], temp;
     extern logical lsame_(char *, char *);
-    doublereal value;
+    doublereal value, colssq[2];
     extern /* Subroutine */ int dlassq_(integer *, doublereal *, integer *, 
-	    doublereal *, doublereal *);
+	    doublereal *, doublereal *), dcombssq_(doublereal *, doublereal *);
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -70,6 +70,12 @@ doublereal dlange_(char *norm, integer *m, integer *n, doublereal *a, integer
 /*  normF  denotes the  Frobenius norm of a matrix (square root of sum of */
 /*  squares).  Note that  max(abs(A(i,j)))  is not a consistent matrix norm. */
 
+/*  The matrix is reduced in at most 64 blocks of columns (of rows for */
+/*  normI), which may be processed in parallel.  The block boundaries */
+/*  depend only on M and N and the partial results are combined in */
+/*  block order, so the value returned does not depend on the number */
+/*  of threads.  A NaN in A is propagated to the result. */
+
 /*  Arguments */
 /*  ========= */
 
@@ -122,73 +128,129 @@ doublereal dlange_(char *norm, integer *m, integer *n, doublereal *a, integer
 
 /*        Find max(abs(A(i,j))). */
 
-	value = 0.;
-	i__1 = *n;
-	for (j = 1; j <= i__1; ++j) {
-	    i__2 = *m;
-	    for (i__ = 1; i__ <= i__2; ++i__) {
-/* Computing MAX */
-		d__2 = value, d__3 = (d__1 = a[i__ + j * a_dim1], abs(d__1));
-		value = max(d__2,d__3);
+	nchk = min(*n,64);
+#ifdef _OPENMP
+#pragma omp parallel for private(i__, i__2, j, jlo, jhi, temp, sum) \
+	if ((doublereal)*m * *n > 65536)
+#endif
+	for (k = 0; k < nchk; ++k) {
+	    jlo = k * *n / nchk + 1;
+	    jhi = (k + 1) * *n / nchk;
+	    sum = 0.;
+	    for (j = jlo; j <= jhi; ++j) {
+		i__2 = *m;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    temp = (d__1 = a[i__ + j * a_dim1], abs(d__1));
+		    if (sum < temp || temp != temp) {
+			sum = temp;
+		    }
 /* L10: */
-	    }
+		}
 /* L20: */
+	    }
+	    cval[k] = sum;
+	}
+	value = 0.;
+	i__1 = nchk;
+	for (k = 0; k < i__1; ++k) {
+	    if (value < cval[k] || cval[k] != cval[k]) {
+		value = cval[k];
+	    }
 	}
     } else if (lsame_(norm, "O") || *(unsigned char *)
 	    norm == '1') {
 
 /*        Find norm1(A). */
 
-	value = 0.;
-	i__1 = *n;
-	for (j = 1; j <= i__1; ++j) {
-	    sum = 0.;
-	    i__2 = *m;
-	    for (i__ = 1; i__ <= i__2; ++i__) {
-		sum += (d__1 = a[i__ + j * a_dim1], abs(d__1));
+	nchk = min(*n,64);
+#ifdef _OPENMP
+#pragma omp parallel for private(i__, i__2, j, jlo, jhi, temp, sum) \
+	if ((doublereal)*m * *n > 65536)
+#endif
+	for (k = 0; k < nchk; ++k) {
+	    jlo = k * *n / nchk + 1;
+	    jhi = (k + 1) * *n / nchk;
+	    cval[k] = 0.;
+	    for (j = jlo; j <= jhi; ++j) {
+		sum = 0.;
+		i__2 = *m;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    sum += (d__1 = a[i__ + j * a_dim1], abs(d__1));
 /* L30: */
-	    }
-	    value = max(value,sum);
+		}
+		if (cval[k] < sum || sum != sum) {
+		    cval[k] = sum;
+		}
 /* L40: */
+	    }
+	}
+	value = 0.;
+	i__1 = nchk;
+	for (k = 0; k < i__1; ++k) {
+	    if (value < cval[k] || cval[k] != cval[k]) {
+		value = cval[k];
+	    }
 	}
     } else if (lsame_(norm, "I")) {
 
-/*        Find normI(A). */
-
-	i__1 = *m;
-	for (i__ = 1; i__ <= i__1; ++i__) {
-	    work[i__] = 0.;
+/*        Find normI(A).  Each row sum is accumulated in column order */
+/*        whatever the number of threads. */
+
+	nchk = min(*m,64);
+#ifdef _OPENMP
+#pragma omp parallel for private(i__, j, jlo, jhi) \
+	if ((doublereal)*m * *n > 65536)
+#endif
+	for (k = 0; k < nchk; ++k) {
+	    jlo = k * *m / nchk + 1;
+	    jhi = (k + 1) * *m / nchk;
+	    for (i__ = jlo; i__ <= jhi; ++i__) {
+		work[i__] = 0.;
 /* L50: */
-	}
-	i__1 = *n;
-	for (j = 1; j <= i__1; ++j) {
-	    i__2 = *m;
-	    for (i__ = 1; i__ <= i__2; ++i__) {
-		work[i__] += (d__1 = a[i__ + j * a_dim1], abs(d__1));
-/* L60: */
 	    }
+	    for (j = 1; j <= *n; ++j) {
+		for (i__ = jlo; i__ <= jhi; ++i__) {
+		    work[i__] += (d__1 = a[i__ + j * a_dim1], abs(d__1));
+/* L60: */
+		}
 /* L70: */
+	    }
 	}
 	value = 0.;
 	i__1 = *m;
 	for (i__ = 1; i__ <= i__1; ++i__) {
-/* Computing MAX */
-	    d__1 = value, d__2 = work[i__];
-	    value = max(d__1,d__2);
+	    if (value < work[i__] || work[i__] != work[i__]) {
+		value = work[i__];
+	    }
 /* L80: */
 	}
     } else if (lsame_(norm, "F") || lsame_(norm, "E")) {
 
 /*        Find normF(A). */
 
-	scale = 0.;
-	sum = 1.;
-	i__1 = *n;
-	for (j = 1; j <= i__1; ++j) {
-	    dlassq_(m, &a[j * a_dim1 + 1], &c__1, &scale, &sum);
+	nchk = min(*n,64);
+#ifdef _OPENMP
+#pragma omp parallel for private(j, jlo, jhi) \
+	if ((doublereal)*m * *n > 65536)
+#endif
+	for (k = 0; k < nchk; ++k) {
+	    jlo = k * *n / nchk + 1;
+	    jhi = (k + 1) * *n / nchk;
+	    ssq[(k << 1)] = 0.;
+	    ssq[(k << 1) + 1] = 1.;
+	    for (j = jlo; j <= jhi; ++j) {
+		dlassq_(m, &a[j * a_dim1 + 1], &c__1, &ssq[(k << 1)], &ssq[(k 
+			<< 1) + 1]);
 /* L90: */
+	    }
+	}
+	colssq[0] = 0.;
+	colssq[1] = 1.;
+	i__1 = nchk;
+	for (k = 0; k < i__1; ++k) {
+	    dcombssq_(colssq, &ssq[k << 1]);
 	}
-	value = scale * sqrt(sum);
+	value = colssq[0] * sqrt(colssq[1]);
     }
 
     ret_val = value;
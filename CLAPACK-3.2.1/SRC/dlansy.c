@@ -28,12 +28,13 @@ doublereal dlansy_(char *norm, char *uplo, integer *n, doublereal *a, integer
     double sqrt(doublereal);
 
     /* Local variables */
-    integer i__, j;
-    doublereal sum, absa, scale;
+    integer i__, j, k, jlo, jhi, nchk;
+    doublereal sum, ssq[128], absa;
     extern logical lsame_(char *, char *);
-    doublereal value;
+    logical upper;
+    doublereal value, colssq[2];
     extern /* Subroutine */ int dlassq_(integer *, doublereal *, integer *, 
-	    doublereal *, doublereal *);
+	    doublereal *, doublereal *), dcombssq_(doublereal *, doublereal *);
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -70,6 +71,10 @@ doublereal dlansy_(char *norm, char *uplo, integer *n, doublereal *a, integer
 /*  normF  denotes the  Frobenius norm of a matrix (square root of sum of */
 /*  squares).  Note that  max(abs(A(i,j)))  is not a consistent matrix norm. */
 
+/*  For normF the off-diagonal part is reduced in at most 64 blocks of */
+/*  columns that depend only on N, so the value returned does not */
+/*  depend on the number of threads. */
+
 /*  Arguments */
 /*  ========= */
 
@@ -208,27 +213,41 @@ doublereal dlansy_(char *norm, char *uplo, integer *n, doublereal *a, integer
 
 /*        Find normF(A). */
 
-	scale = 0.;
-	sum = 1.;
-	if (lsame_(uplo, "U")) {
-	    i__1 = *n;
-	    for (j = 2; j <= i__1; ++j) {
-		i__2 = j - 1;
-		dlassq_(&i__2, &a[j * a_dim1 + 1], &c__1, &scale, &sum);
+	upper = lsame_(uplo, "U");
+	nchk = min(*n,64);
+#ifdef _OPENMP
+#pragma omp parallel for private(j, jlo, jhi, i__2) \
+	if ((doublereal)*n * *n > 131072)
+#endif
+	for (k = 0; k < nchk; ++k) {
+	    jlo = k * *n / nchk + 1;
+	    jhi = (k + 1) * *n / nchk;
+	    ssq[(k << 1)] = 0.;
+	    ssq[(k << 1) + 1] = 1.;
+	    for (j = jlo; j <= jhi; ++j) {
+		if (upper) {
+		    i__2 = j - 1;
+		    dlassq_(&i__2, &a[j * a_dim1 + 1], &c__1, &ssq[(k << 1)], 
+			    &ssq[(k << 1) + 1]);
+		} else {
+		    i__2 = *n - j;
+		    dlassq_(&i__2, &a[j + 1 + j * a_dim1], &c__1, &ssq[(k << 
+			    1)], &ssq[(k << 1) + 1]);
+		}
 /* L110: */
 	    }
-	} else {
-	    i__1 = *n - 1;
-	    for (j = 1; j <= i__1; ++j) {
-		i__2 = *n - j;
-		dlassq_(&i__2, &a[j + 1 + j * a_dim1], &c__1, &scale, &sum);
+	}
+	colssq[0] = 0.;
+	colssq[1] = 1.;
+	i__1 = nchk;
+	for (k = 0; k < i__1; ++k) {
+	    dcombssq_(colssq, &ssq[k << 1]);
 /* L120: */
-	    }
 	}
-	sum *= 2;
+	colssq[1] *= 2;
 	i__1 = *lda + 1;
-	dlassq_(n, &a[a_offset], &i__1, &scale, &sum);
-	value = scale * sqrt(sum);
+	dlassq_(n, &a[a_offset], &i__1, colssq, &colssq[1]);
+	value = colssq[0] * sqrt(colssq[1]);
     }
 
     ret_val = value;
@@ -0,0 +1,767 @@
+/* dlaqz0.c -- DLAQZ0, multishift QZ with aggressive early deflation. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static integer c__12 = 12;
+static integer c__13 = 13;
+static integer c__14 = 14;
+static integer c__15 = 15;
+static doublereal c_b16 = 0.;
+static doublereal c_b17 = 1.;
+
+/* Subroutine */ int dlaqz0_(char *wants, char *wantq, char *wantz, integer *
+	n, integer *ilo, integer *ihi, doublereal *a, integer *lda,
+	doublereal *b, integer *ldb, doublereal *alphar, doublereal *alphai,
+	doublereal *beta, doublereal *q, integer *ldq, doublereal *z__,
+	integer *ldz, doublereal *work, integer *lwork, integer *rec,
+	integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset, q_dim1, q_offset, z_dim1,
+	    z_offset, i__1, i__2, i__3;
+    doublereal d__1, d__2, d__3, d__4;
+
+    /* Local variables */
+    integer i__, j, k, k2, ld, ns, nd, nw, jhi, nsr, nwr, ierr, iter,
+	    nmin, nmax, iqc, izc, isr, isi, iss, iwrk, maxit, nblock, nibble,
+	    npairs, ireal, istart, istop, istart2, istartm, istopm, lworkreq,
+	    iwantq, iwantz, iwants, lwork_qz3__, lwork_qz4__;
+    doublereal c1, s1, ulp, temp, btol, eshift, safmin, smlnum;
+    logical ilq, ilz, ilschur;
+    doublereal csl, snl, csr, snr;
+    char compq[1], compz[1];
+    extern /* Subroutine */ int drot_(integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *);
+    extern logical lsame_(char *, char *);
+    extern doublereal dlamch_(char *), dlanhs_(char *, integer *,
+	    doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dhgeqz_(char *, char *, char *, integer *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
+	     integer *, doublereal *, integer *, doublereal *, integer *,
+	    integer *), dlagv2_(doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
+	     doublereal *, doublereal *, doublereal *), dlaqz3_(logical *,
+	    logical *, logical *, integer *, integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, integer *, integer *, integer *,
+	    doublereal *, doublereal *, doublereal *, doublereal *, integer *,
+	     doublereal *, integer *, doublereal *, integer *, integer *,
+	    integer *), dlaqz4_(logical *, logical *, logical *, integer *,
+	    integer *, integer *, integer *, integer *, doublereal *,
+	    doublereal *, doublereal *, doublereal *, integer *, doublereal *,
+	     integer *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, integer *), dlartg_(doublereal *, doublereal *,
+	    doublereal *, doublereal *, doublereal *), dlaset_(char *,
+	    integer *, integer *, doublereal *, doublereal *, doublereal *,
+	    integer *), xerbla_(char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DLAQZ0 computes the eigenvalues of a real matrix pair (H,T), */
+/*  where H is an upper Hessenberg matrix and T is upper triangular, */
+/*  using the multishift QZ method with aggressive early deflation. */
+/*  It is a drop-in replacement for DHGEQZ, which it calls for small */
+/*  pencils: the arguments, the Schur form computed and the meaning */
+/*  of INFO are exactly those of DHGEQZ. */
+
+/*  Matrix pairs of this type are produced by the reduction to */
+/*  generalized upper Hessenberg form of a real matrix pair (A,B): */
+
+/*     A = Q1*H*Z1**T,  B = Q1*T*Z1**T, */
+
+/*  as computed by DGGHRD. */
+
+/*  If WANTS='S', then the Hessenberg-triangular pair (H,T) is */
+/*  also reduced to generalized Schur form, */
+
+/*     H = Q*S*Z**T,  T = Q*P*Z**T, */
+
+/*  where Q and Z are orthogonal matrices, P is an upper triangular */
+/*  matrix, and S is a quasi-triangular matrix with 1-by-1 and 2-by-2 */
+/*  diagonal blocks, standardized as in DHGEQZ. */
+
+/*  Optionally, the orthogonal matrix Q from the generalized Schur */
+/*  factorization may be postmultiplied into an input matrix Q1, and */
+/*  the orthogonal matrix Z may be postmultiplied into an input matrix */
+/*  Z1, exactly as in DHGEQZ. */
+
+/*  Each iteration first performs aggressive early deflation (DLAQZ3) */
+/*  on a trailing window of the active block; the unconverged */
+/*  eigenvalues of the window then serve as shifts for a multishift */
+/*  sweep (DLAQZ4) that chases a chain of small bulges down the block. */
+/*  Both steps accumulate their transformations and apply them to the */
+/*  rest of the pencil with DGEMM. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  WANTS   (input) CHARACTER*1 */
+/*          = 'E': Compute eigenvalues only; */
+/*          = 'S': Compute eigenvalues and the Schur form. */
+
+/*  WANTQ   (input) CHARACTER*1 */
+/*          = 'N': Left Schur vectors (Q) are not computed; */
+/*          = 'I': Q is initialized to the unit matrix and the matrix Q */
+/*                 of left Schur vectors of (H,T) is returned; */
+/*          = 'V': Q must contain an orthogonal matrix Q1 on entry and */
+/*                 the product Q1*Q is returned. */
+
+/*  WANTZ   (input) CHARACTER*1 */
+/*          = 'N': Right Schur vectors (Z) are not computed; */
+/*          = 'I': Z is initialized to the unit matrix and the matrix Z */
+/*                 of right Schur vectors of (H,T) is returned; */
+/*          = 'V': Z must contain an orthogonal matrix Z1 on entry and */
+/*                 the product Z1*Z is returned. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrices H, T, Q, and Z.  N >= 0. */
+
+/*  ILO     (input) INTEGER */
+/*  IHI     (input) INTEGER */
+/*          ILO and IHI mark the rows and columns of H which are in */
+/*          Hessenberg form.  It is assumed that A is already upper */
+/*          triangular in rows and columns 1:ILO-1 and IHI+1:N. */
+/*          If N > 0, 1 <= ILO <= IHI <= N; if N = 0, ILO=1 and IHI=0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA, N) */
+/*          On entry, the N-by-N upper Hessenberg matrix H. */
+/*          On exit, if WANTS = 'S', H contains the upper */
+/*          quasi-triangular matrix S from the generalized Schur */
+/*          factorization; if WANTS = 'E', the contents of H on exit */
+/*          are unspecified. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max( 1, N ). */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB, N) */
+/*          On entry, the N-by-N upper triangular matrix T. */
+/*          On exit, if WANTS = 'S', T contains the upper triangular */
+/*          matrix P from the generalized Schur factorization; */
+/*          if WANTS = 'E', the contents of T on exit are unspecified. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of the array B.  LDB >= max( 1, N ). */
+
+/*  ALPHAR  (output) DOUBLE PRECISION array, dimension (N) */
+/*  ALPHAI  (output) DOUBLE PRECISION array, dimension (N) */
+/*  BETA    (output) DOUBLE PRECISION array, dimension (N) */
+/*          The generalized eigenvalues, as returned by DHGEQZ. */
+
+/*  Q       (input/output) DOUBLE PRECISION array, dimension (LDQ, N) */
+/*          See WANTQ. */
+
+/*  LDQ     (input) INTEGER */
+/*          The leading dimension of the array Q.  LDQ >= 1. */
+/*          If WANTQ='V' or 'I', then LDQ >= N. */
+
+/*  Z       (input/output) DOUBLE PRECISION array, dimension (LDZ, N) */
+/*          See WANTZ. */
+
+/*  LDZ     (input) INTEGER */
+/*          The leading dimension of the array Z.  LDZ >= 1. */
+/*          If WANTZ='V' or 'I', then LDZ >= N. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO >= 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  LWORK >= max(1,N), and */
+/*          at least the value returned by a workspace query when N is */
+/*          large enough for the multishift iteration to be used. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  REC     (input) INTEGER */
+/*          The current recursion level; external callers pass 0. */
+/*          AED windows are reduced with DLAQZ0 at level REC+1, and */
+/*          DHGEQZ is used from level 2 on. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value */
+/*          = 1,...,N: the QZ iteration did not converge.  (H,T) is not */
+/*                     in Schur form, but ALPHAR(i), ALPHAI(i), and */
+/*                     BETA(i), i=INFO+1,...,N should be correct. */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The window size, the number of shifts and the crossover point to */
+/*  DHGEQZ are taken from ILAENV (ISPEC = 13, 15 and 12, as for */
+/*  DLAQR0).  The QZ sweep itself chases 2-by-2 shift bulges with */
+/*  Householder reflections of order 3, see DLAQZ2.  The 2-by-2 */
+/*  blocks of the deflated pencil with real eigenvalues are split by */
+/*  DLAGV2, and the pencil is then passed to DHGEQZ, which standardizes */
+/*  the remaining 2-by-2 blocks and sets ALPHAR, ALPHAI and BETA. */
+
+/*  Reference: */
+
+/*    B. Kagstrom and D. Kressner, Multishift variants of the QZ */
+/*    algorithm with aggressive early deflation, SIAM J. Matrix Anal. */
+/*    Appl. 29(1):199-227, 2006. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Decode WANTS,WANTQ,WANTZ */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    --alphar;
+    --alphai;
+    --beta;
+    q_dim1 = *ldq;
+    q_offset = 1 + q_dim1;
+    q -= q_offset;
+    z_dim1 = *ldz;
+    z_offset = 1 + z_dim1;
+    z__ -= z_offset;
+    --work;
+
+    /* Function Body */
+    if (lsame_(wants, "E")) {
+	ilschur = FALSE_;
+	iwants = 1;
+    } else if (lsame_(wants, "S")) {
+	ilschur = TRUE_;
+	iwants = 2;
+    } else {
+	iwants = 0;
+    }
+
+    if (lsame_(wantq, "N")) {
+	ilq = FALSE_;
+	iwantq = 1;
+    } else if (lsame_(wantq, "V")) {
+	ilq = TRUE_;
+	iwantq = 2;
+    } else if (lsame_(wantq, "I")) {
+	ilq = TRUE_;
+	iwantq = 3;
+    } else {
+	iwantq = 0;
+    }
+
+    if (lsame_(wantz, "N")) {
+	ilz = FALSE_;
+	iwantz = 1;
+    } else if (lsame_(wantz, "V")) {
+	ilz = TRUE_;
+	iwantz = 2;
+    } else if (lsame_(wantz, "I")) {
+	ilz = TRUE_;
+	iwantz = 3;
+    } else {
+	iwantz = 0;
+    }
+
+/*     Check Argument Values */
+
+    *info = 0;
+    if (iwants == 0) {
+	*info = -1;
+    } else if (iwantq == 0) {
+	*info = -2;
+    } else if (iwantz == 0) {
+	*info = -3;
+    } else if (*n < 0) {
+	*info = -4;
+    } else if (*ilo < 1) {
+	*info = -5;
+    } else if (*ihi > *n || *ihi < *ilo - 1) {
+	*info = -6;
+    } else if (*lda < *n) {
+	*info = -8;
+    } else if (*ldb < *n) {
+	*info = -10;
+    } else if (*ldq < 1 || ilq && *ldq < *n) {
+	*info = -15;
+    } else if (*ldz < 1 || ilz && *ldz < *n) {
+	*info = -17;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DLAQZ0", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n <= 0) {
+	work[1] = 1.;
+	return 0;
+    }
+
+/*     Get the parameters */
+
+    nmin = ilaenv_(&c__12, "DLAQZ0", " ", n, ilo, ihi, lwork);
+    nmin = max(nmin,11);
+
+/*     Use the unblocked algorithm for small pencils and deep recursion */
+
+    if (*n < nmin || *rec >= 2) {
+	dhgeqz_(wants, wantq, wantz, n, ilo, ihi, &a[a_offset], lda, &b[
+		b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &q[q_offset]
+		, ldq, &z__[z_offset], ldz, &work[1], lwork, info);
+	return 0;
+    }
+
+/*     Deflation window size: at least 2, at most the active block and */
+/*     at most (N-1)/3 so that the sweeps have something to work on */
+
+    nwr = ilaenv_(&c__13, "DLAQZ0", " ", n, ilo, ihi, lwork);
+    nwr = max(2,nwr);
+/* Computing MIN */
+    i__1 = *ihi - *ilo + 1, i__2 = (*n - 1) / 3, i__1 = min(i__1,i__2);
+    nwr = min(i__1,nwr);
+
+/*     Number of shifts: even, at least 2 */
+
+    nsr = ilaenv_(&c__15, "DLAQZ0", " ", n, ilo, ihi, lwork);
+/* Computing MIN */
+    i__1 = nsr, i__2 = (*n + 6) / 9, i__1 = min(i__1,i__2), i__2 = *ihi - *
+	    ilo;
+    nsr = min(i__1,i__2);
+/* Computing MAX */
+    i__1 = 2, i__2 = nsr - nsr % 2;
+    nsr = max(i__1,i__2);
+
+    nibble = ilaenv_(&c__14, "DLAQZ0", " ", n, ilo, ihi, lwork);
+    nblock = nsr * 3;
+
+/*     Workspace: the accumulated transformations QC and ZC, the shifts, */
+/*     and the workspace of DLAQZ3 and DLAQZ4.  Blocks smaller than NMIN */
+/*     are handed to DLAQZ3 as a whole. */
+
+/* Computing MIN */
+/* Computing MAX */
+    i__2 = max(nwr,nblock);
+    i__1 = max(i__2,nmin), i__3 = *ihi - *ilo + 1;
+    nmax = min(i__1,i__3);
+    nmax = max(nmax,nblock);
+    dlaqz3_(&ilschur, &ilq, &ilz, n, ilo, ihi, &nmax, &a[a_offset], lda, &b[
+	    b_offset], ldb, &q[q_offset], ldq, &z__[z_offset], ldz, &ns, &nd,
+	    &alphar[1], &alphai[1], &beta[1], &work[1], &nmax, &work[1], &
+	    nmax, &work[1], &c_n1, rec, &ierr);
+    lwork_qz3__ = (integer) work[1];
+    dlaqz4_(&ilschur, &ilq, &ilz, n, ilo, ihi, &nsr, &nblock, &alphar[1], &
+	    alphai[1], &beta[1], &a[a_offset], lda, &b[b_offset], ldb, &q[
+	    q_offset], ldq, &z__[z_offset], ldz, &work[1], &nblock, &work[1],
+	     &nblock, &work[1], &c_n1, &ierr);
+    lwork_qz4__ = (integer) work[1];
+    lworkreq = (nmax << 1) * nmax + nsr * 3 + max(lwork_qz3__,lwork_qz4__);
+    lworkreq = max(lworkreq,*n);
+    if (*lwork == -1) {
+	work[1] = (doublereal) lworkreq;
+	return 0;
+    } else if (*lwork < lworkreq) {
+	*info = -19;
+	i__1 = -(*info);
+	xerbla_("DLAQZ0", &i__1);
+	return 0;
+    }
+    iqc = 1;
+    izc = iqc + nmax * nmax;
+    isr = izc + nmax * nmax;
+    isi = isr + nsr;
+    iss = isi + nsr;
+    iwrk = iss + nsr;
+
+/*     Initialize Q and Z */
+
+    if (iwantq == 3) {
+	dlaset_("Full", n, n, &c_b16, &c_b17, &q[q_offset], ldq);
+    }
+    if (iwantz == 3) {
+	dlaset_("Full", n, n, &c_b16, &c_b17, &z__[z_offset], ldz);
+    }
+
+/*     Get machine constants */
+
+    safmin = dlamch_("SAFE MINIMUM");
+    ulp = dlamch_("PRECISION");
+    smlnum = safmin * ((doublereal) (*n) / ulp);
+
+    i__1 = *ihi - *ilo + 1;
+/* Computing MAX */
+    d__1 = safmin, d__2 = ulp * dlanhs_("F", &i__1, &b[*ilo + *ilo * b_dim1]
+	    , ldb, &work[1]);
+    btol = max(d__1,d__2);
+
+    istart = *ilo;
+    istop = *ihi;
+    maxit = (*ihi - *ilo + 1) * 30;
+    ld = 0;
+    eshift = 0.;
+
+    i__1 = maxit;
+    for (iter = 1; iter <= i__1; ++iter) {
+	if (istart + 1 >= istop) {
+	    istop = istart;
+	    goto L80;
+	}
+
+/*        Check deflations at the end */
+
+/* Computing MAX */
+	d__2 = smlnum, d__3 = ulp * ((d__1 = a[istop + istop * a_dim1], abs(
+		d__1)) + (d__4 = a[istop - 1 + (istop - 1) * a_dim1], abs(
+		d__4)));
+	if ((d__1 = a[istop + (istop - 1) * a_dim1], abs(d__1)) <= max(d__2,
+		d__3)) {
+	    a[istop + (istop - 1) * a_dim1] = 0.;
+	    --istop;
+	    ld = 0;
+	    eshift = 0.;
+	} else /* if(complicated condition) */ {
+/* Computing MAX */
+	    d__2 = smlnum, d__3 = ulp * ((d__1 = a[istop - 1 + (istop - 1) *
+		    a_dim1], abs(d__1)) + (d__4 = a[istop - 2 + (istop - 2) *
+		    a_dim1], abs(d__4)));
+	    if ((d__1 = a[istop - 1 + (istop - 2) * a_dim1], abs(d__1)) <=
+		    max(d__2,d__3)) {
+		a[istop - 1 + (istop - 2) * a_dim1] = 0.;
+		istop += -2;
+		ld = 0;
+		eshift = 0.;
+	    }
+	}
+
+/*        Check deflations at the start */
+
+/* Computing MAX */
+	d__2 = smlnum, d__3 = ulp * ((d__1 = a[istart + istart * a_dim1], abs(
+		d__1)) + (d__4 = a[istart + 1 + (istart + 1) * a_dim1], abs(
+		d__4)));
+	if ((d__1 = a[istart + 1 + istart * a_dim1], abs(d__1)) <= max(d__2,
+		d__3)) {
+	    a[istart + 1 + istart * a_dim1] = 0.;
+	    ++istart;
+	    ld = 0;
+	    eshift = 0.;
+	}
+
+	if (istart + 1 >= istop) {
+	    goto L70;
+	}
+
+/*        Check interior deflations */
+
+	istart2 = istart;
+	i__2 = istart + 1;
+	for (k = istop; k >= i__2; --k) {
+/* Computing MAX */
+	    d__2 = smlnum, d__3 = ulp * ((d__1 = a[k + k * a_dim1], abs(d__1))
+		     + (d__4 = a[k - 1 + (k - 1) * a_dim1], abs(d__4)));
+	    if ((d__1 = a[k + (k - 1) * a_dim1], abs(d__1)) <= max(d__2,d__3))
+		     {
+		a[k + (k - 1) * a_dim1] = 0.;
+		istart2 = k;
+		goto L20;
+	    }
+/* L10: */
+	}
+L20:
+
+/*        Get range to apply rotations to */
+
+	if (ilschur) {
+	    istartm = 1;
+	    istopm = *n;
+	} else {
+	    istartm = istart2;
+	    istopm = istop;
+	}
+
+/*        Check for infinite eigenvalues: a negligible diagonal element */
+/*        of B is chased to the top of the block and deflated there */
+
+	k = istop;
+	while(k >= istart2) {
+	    if ((d__1 = b[k + k * b_dim1], abs(d__1)) < btol) {
+		b[k + k * b_dim1] = 0.;
+		i__2 = istart2 + 1;
+		for (k2 = k; k2 >= i__2; --k2) {
+		    dlartg_(&b[k2 - 1 + k2 * b_dim1], &b[k2 - 1 + (k2 - 1) *
+			    b_dim1], &c1, &s1, &temp);
+		    b[k2 - 1 + k2 * b_dim1] = temp;
+		    b[k2 - 1 + (k2 - 1) * b_dim1] = 0.;
+		    i__3 = k2 - 2 - istartm + 1;
+		    drot_(&i__3, &b[istartm + k2 * b_dim1], &c__1, &b[istartm
+			    + (k2 - 1) * b_dim1], &c__1, &c1, &s1);
+/* Computing MIN */
+		    i__3 = min(k2 + 1,istop) - istartm + 1;
+		    drot_(&i__3, &a[istartm + k2 * a_dim1], &c__1, &a[istartm
+			    + (k2 - 1) * a_dim1], &c__1, &c1, &s1);
+		    if (ilz) {
+			drot_(n, &z__[k2 * z_dim1 + 1], &c__1, &z__[(k2 - 1) *
+				 z_dim1 + 1], &c__1, &c1, &s1);
+		    }
+		    if (k2 < istop) {
+			dlartg_(&a[k2 + (k2 - 1) * a_dim1], &a[k2 + 1 + (k2 -
+				1) * a_dim1], &c1, &s1, &temp);
+			a[k2 + (k2 - 1) * a_dim1] = temp;
+			a[k2 + 1 + (k2 - 1) * a_dim1] = 0.;
+			i__3 = istopm - k2 + 1;
+			drot_(&i__3, &a[k2 + k2 * a_dim1], lda, &a[k2 + 1 +
+				k2 * a_dim1], lda, &c1, &s1);
+			drot_(&i__3, &b[k2 + k2 * b_dim1], ldb, &b[k2 + 1 +
+				k2 * b_dim1], ldb, &c1, &s1);
+			if (ilq) {
+			    drot_(n, &q[k2 * q_dim1 + 1], &c__1, &q[(k2 + 1) *
+				     q_dim1 + 1], &c__1, &c1, &s1);
+			}
+		    }
+/* L30: */
+		}
+		if (istart2 < istop) {
+		    dlartg_(&a[istart2 + istart2 * a_dim1], &a[istart2 + 1 +
+			    istart2 * a_dim1], &c1, &s1, &temp);
+		    a[istart2 + istart2 * a_dim1] = temp;
+		    a[istart2 + 1 + istart2 * a_dim1] = 0.;
+		    i__2 = istopm - istart2;
+		    drot_(&i__2, &a[istart2 + (istart2 + 1) * a_dim1], lda, &
+			    a[istart2 + 1 + (istart2 + 1) * a_dim1], lda, &c1,
+			     &s1);
+		    drot_(&i__2, &b[istart2 + (istart2 + 1) * b_dim1], ldb, &
+			    b[istart2 + 1 + (istart2 + 1) * b_dim1], ldb, &c1,
+			     &s1);
+		    if (ilq) {
+			drot_(n, &q[istart2 * q_dim1 + 1], &c__1, &q[(istart2
+				+ 1) * q_dim1 + 1], &c__1, &c1, &s1);
+		    }
+		}
+		++istart2;
+	    }
+	    --k;
+	}
+
+/*        ISTART2 now points to the top of the bottom right unreduced */
+/*        Hessenberg block */
+
+	if (istart2 >= istop) {
+	    istop = istart2 - 1;
+	    ld = 0;
+	    eshift = 0.;
+	    goto L70;
+	}
+
+/*        Aggressive early deflation.  A block that is too small for */
+/*        a sweep is reduced completely as a single window.  The window */
+/*        stays below ISTART2: without the Schur form the rows above it */
+/*        are not updated, and a window reaching into them would make */
+/*        the eigenvalues depend on WANTS. */
+
+	nw = nwr;
+	if (istop - istart2 + 1 < nmin) {
+	    nw = istop - istart2 + 1;
+	}
+	i__2 = *lwork - iwrk + 1;
+	dlaqz3_(&ilschur, &ilq, &ilz, n, &istart2, &istop, &nw, &a[a_offset],
+		 lda, &b[b_offset], ldb, &q[q_offset], ldq, &z__[z_offset],
+		ldz, &ns, &nd, &alphar[1], &alphai[1], &beta[1], &work[iqc], &
+		nmax, &work[izc], &nmax, &work[iwrk], &i__2, rec, &ierr);
+	if (nd > 0) {
+	    ld = 0;
+	    eshift = 0.;
+	}
+	istop -= nd;
+
+/*        Skip the sweep if AED deflated enough eigenvalues, or some of */
+/*        a small block.  If it made no progress on a small block (the */
+/*        window of a singular pencil can defeat DHGEQZ), sweep anyway, */
+/*        or the next AED would see the same window again. */
+
+	if (nd * 100 > nibble * (nd + ns) || (istop - istart2 + 1 < nmin && 
+		nd > 0)) {
+	    goto L70;
+	}
+	++ld;
+
+/*        Select the shifts from the bottom of the undeflated */
+/*        eigenvalues of the window; complex pairs are kept together */
+
+/* Computing MIN */
+	i__2 = nsr, i__3 = istop - istart2;
+	jhi = min(i__2,i__3) / 2;
+	npairs = 0;
+	ireal = 0;
+	i__ = istop;
+	while(i__ > istop - ns && npairs < jhi) {
+	    if (alphai[i__] != 0. && i__ - 1 > istop - ns && alphai[i__ - 1]
+		    != 0.) {
+		j = isr + (npairs << 1);
+		work[j] = alphar[i__ - 1];
+		work[j + 1] = alphar[i__ - 1];
+		work[j + nsr] = alphai[i__ - 1];
+		work[j + 1 + nsr] = -alphai[i__ - 1];
+		work[j + (nsr << 1)] = beta[i__ - 1];
+		work[j + 1 + (nsr << 1)] = beta[i__ - 1];
+		++npairs;
+		i__ += -2;
+	    } else if (alphai[i__] != 0.) {
+		--i__;
+	    } else if (ireal == 0) {
+		ireal = i__;
+		--i__;
+	    } else {
+		j = isr + (npairs << 1);
+		work[j] = alphar[ireal];
+		work[j + 1] = alphar[i__];
+		work[j + nsr] = 0.;
+		work[j + 1 + nsr] = 0.;
+		work[j + (nsr << 1)] = beta[ireal];
+		work[j + 1 + (nsr << 1)] = beta[i__];
+		++npairs;
+		ireal = 0;
+		--i__;
+	    }
+	}
+
+	if (ld % 6 == 0 || npairs == 0) {
+
+/*           Exceptional shift.  Chosen for no particularly good reason. */
+
+	    if ((doublereal) maxit * safmin * (d__1 = a[istop + (istop - 1) *
+		    a_dim1], abs(d__1)) < (d__2 = b[istop - 1 + (istop - 1) *
+		    b_dim1], abs(d__2))) {
+		eshift = a[istop + (istop - 1) * a_dim1] / b[istop - 1 + (
+			istop - 1) * b_dim1];
+	    } else {
+		eshift += 1. / (safmin * (doublereal) maxit);
+	    }
+	    work[isr] = eshift;
+	    work[isr + 1] = eshift;
+	    work[isi] = 0.;
+	    work[isi + 1] = 0.;
+	    work[iss] = 1.;
+	    work[iss + 1] = 1.;
+	    npairs = 1;
+	}
+
+/*        Time for a QZ sweep */
+
+	ns = npairs << 1;
+	i__2 = *lwork - iwrk + 1;
+	dlaqz4_(&ilschur, &ilq, &ilz, n, &istart2, &istop, &ns, &nblock, &
+		work[isr], &work[isi], &work[iss], &a[a_offset], lda, &b[
+		b_offset], ldb, &q[q_offset], ldq, &z__[z_offset], ldz, &work[
+		iqc], &nblock, &work[izc], &nblock, &work[iwrk], &i__2, &ierr)
+		;
+L70:
+	;
+    }
+
+/*     Drop-through = non-convergence; DHGEQZ takes over below */
+
+    goto L100;
+L80:
+
+/*     Split the 2-by-2 blocks with real eigenvalues.  DHGEQZ would */
+/*     iterate on them with a tolerance taken from the norm of the whole */
+/*     pencil, which without the Schur form includes stale entries above */
+/*     the blocks, so the eigenvalues would depend on WANTS. */
+
+    j = *ilo;
+    while(j < *ihi) {
+	if (a[j + 1 + j * a_dim1] != 0.) {
+	    dlagv2_(&a[j + j * a_dim1], lda, &b[j + j * b_dim1], ldb, &alphar[
+		    j], &alphai[j], &beta[j], &csl, &snl, &csr, &snr);
+	    if (ilschur) {
+		if (j + 2 <= *n) {
+		    i__1 = *n - j - 1;
+		    drot_(&i__1, &a[j + (j + 2) * a_dim1], lda, &a[j + 1 + (j
+			    + 2) * a_dim1], lda, &csl, &snl);
+		    drot_(&i__1, &b[j + (j + 2) * b_dim1], ldb, &b[j + 1 + (j
+			    + 2) * b_dim1], ldb, &csl, &snl);
+		}
+		i__1 = j - 1;
+		drot_(&i__1, &a[j * a_dim1 + 1], &c__1, &a[(j + 1) * a_dim1 +
+			1], &c__1, &csr, &snr);
+		drot_(&i__1, &b[j * b_dim1 + 1], &c__1, &b[(j + 1) * b_dim1 +
+			1], &c__1, &csr, &snr);
+	    }
+	    if (ilq) {
+		drot_(n, &q[j * q_dim1 + 1], &c__1, &q[(j + 1) * q_dim1 + 1],
+			&c__1, &csl, &snl);
+	    }
+	    if (ilz) {
+		drot_(n, &z__[j * z_dim1 + 1], &c__1, &z__[(j + 1) * z_dim1 +
+			1], &c__1, &csr, &snr);
+	    }
+	    if (alphai[j] == 0.) {
+		a[j + 1 + j * a_dim1] = 0.;
+	    }
+	    j += 2;
+	} else {
+	    ++j;
+	}
+    }
+
+L100:
+
+/*     Let DHGEQZ standardize the 2-by-2 blocks, make the diagonal of */
+/*     B nonnegative and store the eigenvalues; on converged blocks it */
+/*     does nothing more than that.  It computes the eigenvalues of a */
+/*     complex pair from the block after standardization, so for an */
+/*     ill-conditioned pair (e.g. a perturbed double eigenvalue) they */
+/*     agree with the eigenvectors DTGEVC computes from that block. */
+/*     If the sweeps did not converge, its single shifts continue. */
+
+    if (iwantq == 1) {
+	*(unsigned char *)compq = 'N';
+    } else {
+	*(unsigned char *)compq = 'V';
+    }
+    if (iwantz == 1) {
+	*(unsigned char *)compz = 'N';
+    } else {
+	*(unsigned char *)compz = 'V';
+    }
+    dhgeqz_(wants, compq, compz, n, ilo, ihi, &a[a_offset], lda, &b[
+	    b_offset], ldb, &alphar[1], &alphai[1], &beta[1], &q[q_offset],
+	    ldq, &z__[z_offset], ldz, &work[1], lwork, info);
+
+    work[1] = (doublereal) lworkreq;
+    return 0;
+
+/*     End of DLAQZ0 */
+
+} /* dlaqz0_ */
@@ -0,0 +1,154 @@
+/* dlaqz1.c -- DLAQZ1, first column of the double-shift polynomial for DLAQZ0. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dlaqz1_(doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *sr1, doublereal *sr2, doublereal *si,
+	doublereal *beta1, doublereal *beta2, doublereal *v)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset;
+    doublereal d__1, d__2, d__3;
+
+    /* Builtin functions */
+    double sqrt(doublereal);
+
+    /* Local variables */
+    doublereal w1, w2, scale1, scale2, safmin, safmax;
+    extern doublereal dlamch_(char *);
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  Given a 3-by-3 matrix pencil (A,B), DLAQZ1 sets v to a scalar */
+/*  multiple of the first column of the product */
+
+/*     (*)  K = (beta2*A - (sr2-i*si)*B)*B^(-1)*(beta1*A - (sr1+i*si)*B)*B^(-1). */
+
+/*  It is assumed that either */
+
+/*          1) sr1 = sr2 and beta1 = beta2 */
+/*     or */
+/*          2) si = 0. */
+
+/*  This is useful for starting double implicit shift bulges */
+/*  in the QZ algorithm, see DLAQZ4. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  A       (input) DOUBLE PRECISION array, dimension (LDA,3) */
+/*          The 3-by-3 upper Hessenberg matrix A in (*). */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of A as declared in */
+/*          the calling procedure. */
+
+/*  B       (input) DOUBLE PRECISION array, dimension (LDB,3) */
+/*          The 3-by-3 upper triangular matrix B in (*).  Only the */
+/*          leading 2-by-2 block is referenced; its diagonal must be */
+/*          nonzero. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of B as declared in */
+/*          the calling procedure. */
+
+/*  SR1     (input) DOUBLE PRECISION */
+/*  SR2     (input) DOUBLE PRECISION */
+/*  SI      (input) DOUBLE PRECISION */
+/*  BETA1   (input) DOUBLE PRECISION */
+/*  BETA2   (input) DOUBLE PRECISION */
+/*          The shifts in (*) are (SR1 + i*SI)/BETA1 and */
+/*          (SR2 - i*SI)/BETA2.  A zero BETA gives an infinite shift. */
+
+/*  V       (output) DOUBLE PRECISION array, dimension (3) */
+/*          A scalar multiple of the first column of the matrix K in */
+/*          (*).  If the computation produced a non-finite result, V is */
+/*          set to zero. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    --v;
+
+    /* Function Body */
+    safmin = dlamch_("SAFE MINIMUM");
+    safmax = 1. / safmin;
+
+/*     Calculate first shifted vector */
+
+    w1 = *beta1 * a[a_dim1 + 1] - *sr1 * b[b_dim1 + 1];
+    w2 = *beta1 * a[a_dim1 + 2] - *sr1 * b[b_dim1 + 2];
+    scale1 = sqrt((abs(w1))) * sqrt((abs(w2)));
+    if (scale1 >= safmin && scale1 <= safmax) {
+	w1 /= scale1;
+	w2 /= scale1;
+    } else {
+	scale1 = 1.;
+    }
+
+/*     Solve linear system */
+
+    w2 /= b[(b_dim1 << 1) + 2];
+    w1 = (w1 - b[(b_dim1 << 1) + 1] * w2) / b[b_dim1 + 1];
+    scale2 = sqrt((abs(w1))) * sqrt((abs(w2)));
+    if (scale2 >= safmin && scale2 <= safmax) {
+	w1 /= scale2;
+	w2 /= scale2;
+    } else {
+	scale2 = 1.;
+    }
+
+/*     Apply second shift */
+
+    v[1] = *beta2 * (a[a_dim1 + 1] * w1 + a[(a_dim1 << 1) + 1] * w2) - *sr2 *
+	     (b[b_dim1 + 1] * w1 + b[(b_dim1 << 1) + 1] * w2);
+    v[2] = *beta2 * (a[a_dim1 + 2] * w1 + a[(a_dim1 << 1) + 2] * w2) - *sr2 *
+	     (b[b_dim1 + 2] * w1 + b[(b_dim1 << 1) + 2] * w2);
+    v[3] = *beta2 * a[(a_dim1 << 1) + 3] * w2;
+
+/*     Account for imaginary part */
+
+    v[1] += *si * *si * b[b_dim1 + 1] / scale1 / scale2;
+
+/*     Check for overflow */
+
+    d__1 = abs(v[1]), d__2 = abs(v[2]), d__1 = max(d__1,d__2), d__3 = abs(v[
+	    3]);
+    if (max(d__1,d__3) > safmax || v[1] != v[1] || v[2] != v[2] || v[3] !=
+	    v[3]) {
+	v[1] = 0.;
+	v[2] = 0.;
+	v[3] = 0.;
+    }
+
+    return 0;
+
+/*     End of DLAQZ1 */
+
+} /* dlaqz1_ */
@@ -0,0 +1,241 @@
+/* dlaqz2.c -- DLAQZ2, moves one 2x2 shift bulge one position down. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__2 = 2;
+static integer c__3 = 3;
+
+/* Subroutine */ int dlaqz2_(logical *ilq, logical *ilz, integer *k,
+	integer *istartm, integer *istopm, integer *ihi, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, integer *nq, integer *
+	qstart, doublereal *q, integer *ldq, integer *nz, integer *zstart,
+	doublereal *z__, integer *ldz)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset, q_dim1, q_offset, z_dim1,
+	    z_offset, i__1;
+
+    /* Local variables */
+    doublereal v[3], tau, dum[1];
+    extern /* Subroutine */ int dlarfg_(integer *, doublereal *, doublereal *,
+	     integer *, doublereal *), dlarfx_(char *, integer *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *, doublereal *);
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DLAQZ2 chases a 2x2 shift bulge in a matrix pencil (A,B) down a */
+/*  single position.  On entry the bulge is at position K: A is upper */
+/*  Hessenberg except for the element A(K+2,K), and B is upper */
+/*  triangular except for the elements B(K+1,K), B(K+2,K) and */
+/*  B(K+2,K+1).  On exit the bulge is at position K+1, or, if */
+/*  K+2 = IHI, it has been removed from the pencil. */
+
+/*  Each step applies two Householder reflections from the right, */
+/*  determined by the last two rows of the bulge in B (an RQ */
+/*  factorization, which is well defined even if B is singular), */
+/*  followed by one Householder reflection from the left that */
+/*  annihilates A(K+2:K+3,K). */
+
+/*  Arguments */
+/*  ========= */
+
+/*  ILQ     (input) LOGICAL */
+/*          Determines whether or not to update the matrix Q */
+
+/*  ILZ     (input) LOGICAL */
+/*          Determines whether or not to update the matrix Z */
+
+/*  K       (input) INTEGER */
+/*          The position of the bulge, see Purpose. */
+
+/*  ISTARTM (input) INTEGER */
+/*  ISTOPM  (input) INTEGER */
+/*          Updates to (A,B) are restricted to rows ISTARTM:K+3 and */
+/*          columns K:ISTOPM.  It is assumed without checking that */
+/*          ISTARTM <= K and min(K+3,IHI) <= ISTOPM. */
+
+/*  IHI     (input) INTEGER */
+/*          The last row of the active block of the pencil. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of A as declared in */
+/*          the calling procedure. */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,N) */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of B as declared in */
+/*          the calling procedure. */
+
+/*  NQ      (input) INTEGER */
+/*          The order of the matrix Q */
+
+/*  QSTART  (input) INTEGER */
+/*          Start index of the matrix Q. Rotations are applied */
+/*          to columns k+2-qStart:k+4-qStart of Q. */
+
+/*  Q       (input/output) DOUBLE PRECISION array, dimension (LDQ,NQ) */
+
+/*  LDQ     (input) INTEGER */
+/*          The leading dimension of Q as declared in */
+/*          the calling procedure. */
+
+/*  NZ      (input) INTEGER */
+/*          The order of the matrix Z */
+
+/*  ZSTART  (input) INTEGER */
+/*          Start index of the matrix Z. Rotations are applied */
+/*          to columns k+1-zStart:k+3-zStart of Z. */
+
+/*  Z       (input/output) DOUBLE PRECISION array, dimension (LDZ,NZ) */
+
+/*  LDZ     (input) INTEGER */
+/*          The leading dimension of Z as declared in */
+/*          the calling procedure. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    q_dim1 = *ldq;
+    q_offset = 1 + q_dim1;
+    q -= q_offset;
+    z_dim1 = *ldz;
+    z_offset = 1 + z_dim1;
+    z__ -= z_offset;
+
+    /* Function Body */
+
+/*     Annihilate B(k+2,k:k+1) */
+
+    dlarfg_(&c__3, &b[*k + 2 + (*k + 2) * b_dim1], &b[*k + 2 + *k * b_dim1]
+	    , ldb, &tau);
+    v[0] = b[*k + 2 + *k * b_dim1];
+    v[1] = b[*k + 2 + (*k + 1) * b_dim1];
+    v[2] = 1.;
+    b[*k + 2 + *k * b_dim1] = 0.;
+    b[*k + 2 + (*k + 1) * b_dim1] = 0.;
+    i__1 = *k + 2 - *istartm;
+    dlarfx_("Right", &i__1, &c__3, v, &tau, &b[*istartm + *k * b_dim1], ldb,
+	    dum);
+/* Computing MIN */
+    i__1 = min(*ihi,*k + 3) - *istartm + 1;
+    dlarfx_("Right", &i__1, &c__3, v, &tau, &a[*istartm + *k * a_dim1], lda,
+	    dum);
+    if (*ilz) {
+	dlarfx_("Right", nz, &c__3, v, &tau, &z__[(*k - *zstart + 1) * z_dim1
+		+ 1], ldz, dum);
+    }
+
+/*     Annihilate B(k+1,k) */
+
+    dlarfg_(&c__2, &b[*k + 1 + (*k + 1) * b_dim1], &b[*k + 1 + *k * b_dim1]
+	    , ldb, &tau);
+    v[0] = b[*k + 1 + *k * b_dim1];
+    v[1] = 1.;
+    b[*k + 1 + *k * b_dim1] = 0.;
+    i__1 = *k + 1 - *istartm;
+    dlarfx_("Right", &i__1, &c__2, v, &tau, &b[*istartm + *k * b_dim1], ldb,
+	    dum);
+/* Computing MIN */
+    i__1 = min(*ihi,*k + 3) - *istartm + 1;
+    dlarfx_("Right", &i__1, &c__2, v, &tau, &a[*istartm + *k * a_dim1], lda,
+	    dum);
+    if (*ilz) {
+	dlarfx_("Right", nz, &c__2, v, &tau, &z__[(*k - *zstart + 1) * z_dim1
+		+ 1], ldz, dum);
+    }
+
+    if (*k + 2 == *ihi) {
+
+/*        Shift is located on the edge of the matrix, remove it */
+
+	dlarfg_(&c__2, &a[*k + 1 + *k * a_dim1], &a[*k + 2 + *k * a_dim1], &
+		c__1, &tau);
+	v[0] = 1.;
+	v[1] = a[*k + 2 + *k * a_dim1];
+	a[*k + 2 + *k * a_dim1] = 0.;
+	i__1 = *istopm - *k;
+	dlarfx_("Left", &c__2, &i__1, v, &tau, &a[*k + 1 + (*k + 1) * a_dim1],
+		 lda, dum);
+	dlarfx_("Left", &c__2, &i__1, v, &tau, &b[*k + 1 + (*k + 1) * b_dim1],
+		 ldb, dum);
+	if (*ilq) {
+	    dlarfx_("Right", nq, &c__2, v, &tau, &q[(*k + 2 - *qstart) *
+		    q_dim1 + 1], ldq, dum);
+	}
+
+/*        Annihilate B(k+2,k+1) */
+
+	dlarfg_(&c__2, &b[*k + 2 + (*k + 2) * b_dim1], &b[*k + 2 + (*k + 1) *
+		 b_dim1], ldb, &tau);
+	v[0] = b[*k + 2 + (*k + 1) * b_dim1];
+	v[1] = 1.;
+	b[*k + 2 + (*k + 1) * b_dim1] = 0.;
+	i__1 = *k + 2 - *istartm;
+	dlarfx_("Right", &i__1, &c__2, v, &tau, &b[*istartm + (*k + 1) *
+		b_dim1], ldb, dum);
+	i__1 = *ihi - *istartm + 1;
+	dlarfx_("Right", &i__1, &c__2, v, &tau, &a[*istartm + (*k + 1) *
+		a_dim1], lda, dum);
+	if (*ilz) {
+	    dlarfx_("Right", nz, &c__2, v, &tau, &z__[(*k - *zstart + 2) *
+		    z_dim1 + 1], ldz, dum);
+	}
+    } else {
+
+/*        Normal operation, move bulge down: annihilate A(k+2:k+3,k) */
+
+	dlarfg_(&c__3, &a[*k + 1 + *k * a_dim1], &a[*k + 2 + *k * a_dim1], &
+		c__1, &tau);
+	v[0] = 1.;
+	v[1] = a[*k + 2 + *k * a_dim1];
+	v[2] = a[*k + 3 + *k * a_dim1];
+	a[*k + 2 + *k * a_dim1] = 0.;
+	a[*k + 3 + *k * a_dim1] = 0.;
+	i__1 = *istopm - *k;
+	dlarfx_("Left", &c__3, &i__1, v, &tau, &a[*k + 1 + (*k + 1) * a_dim1],
+		 lda, dum);
+	dlarfx_("Left", &c__3, &i__1, v, &tau, &b[*k + 1 + (*k + 1) * b_dim1],
+		 ldb, dum);
+	if (*ilq) {
+	    dlarfx_("Right", nq, &c__3, v, &tau, &q[(*k + 2 - *qstart) *
+		    q_dim1 + 1], ldq, dum);
+	}
+    }
+
+    return 0;
+
+/*     End of DLAQZ2 */
+
+} /* dlaqz2_ */
@@ -0,0 +1,605 @@
+/* dlaqz3.c -- DLAQZ3, aggressive early deflation for DLAQZ0. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static doublereal c_b14 = 0.;
+static doublereal c_b15 = 1.;
+static logical c_true = TRUE_;
+
+/* Subroutine */ int dlaqz3_(logical *ilschur, logical *ilq, logical *ilz,
+	integer *n, integer *ilo, integer *ihi, integer *nw, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, doublereal *q, integer *
+	ldq, doublereal *z__, integer *ldz, integer *ns, integer *nd,
+	doublereal *alphar, doublereal *alphai, doublereal *beta, doublereal *
+	qc, integer *ldqc, doublereal *zc, integer *ldzc, doublereal *work,
+	integer *lwork, integer *rec, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset, q_dim1, q_offset, z_dim1,
+	    z_offset, qc_dim1, qc_offset, zc_dim1, zc_offset, i__1, i__2,
+	    i__3;
+    doublereal d__1, d__2, d__3, d__4;
+
+    /* Builtin functions */
+    double sqrt(doublereal);
+
+    /* Local variables */
+    integer i__, k, jw, nc, ir, nr, kb, k2, iq2, iz2, ix, itau, iwrk, ifst,
+	    ilst, lwkopt, kwtop, kwbot, rec1, ierr;
+    doublereal s, tau, ulp, temp, safmin, smlnum;
+    logical bulge;
+    doublereal dum[1];
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dlag2_(
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, doublereal *, doublereal *, doublereal *,
+	    doublereal *), dlarf_(char *, integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *);
+    extern doublereal dlamch_(char *);
+    extern /* Subroutine */ int dlaqz0_(char *, char *, char *, integer *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *,
+	     integer *, doublereal *, integer *, doublereal *, integer *,
+	    integer *, integer *), dgerqf_(integer *, integer *, doublereal *,
+	     integer *, doublereal *, doublereal *, integer *, integer *),
+	    dgghrd_(char *, char *, integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, integer *, integer *), dlacpy_(char *,
+	    integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *), dlarfg_(integer *, doublereal *, doublereal *,
+	    integer *, doublereal *), dlaset_(char *, integer *, integer *,
+	    doublereal *, doublereal *, doublereal *, integer *), dtgexc_(
+	    logical *, logical *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, integer *, integer *, doublereal *, integer *, integer
+	    *), dormrq_(char *, char *, integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *, integer *), xerbla_(char *, integer *);
+    integer istartm, istopm;
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DLAQZ3 performs aggressive early deflation (AED) on the trailing */
+/*  window of the active block ILO:IHI of a Hessenberg-triangular */
+/*  pencil (A,B). */
+
+/*  The JW-by-JW window in the bottom right corner of the block is */
+/*  reduced to generalized real Schur form by DLAQZ0 (or DHGEQZ when */
+/*  the window is small).  The eigenvalues of the window whose part of */
+/*  the spike A(KWTOP:IHI,KWTOP-1) is negligible are deflated and */
+/*  moved to the bottom with DTGEXC; the remaining ones are returned as */
+/*  shifts for the next QZ sweep.  Finally the window is returned to */
+/*  Hessenberg-triangular form and the transformations, accumulated in */
+/*  QC and ZC, are applied to the rest of the pencil with DGEMM. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  ILSCHUR (input) LOGICAL */
+/*          Determines whether or not to update the full Schur form */
+
+/*  ILQ     (input) LOGICAL */
+/*          Determines whether or not to update the matrix Q */
+
+/*  ILZ     (input) LOGICAL */
+/*          Determines whether or not to update the matrix Z */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrices A, B, Q, and Z.  N >= 0. */
+
+/*  ILO     (input) INTEGER */
+/*  IHI     (input) INTEGER */
+/*          The active block is A(ILO:IHI,ILO:IHI), B(ILO:IHI,ILO:IHI). */
+/*          It is assumed that either ILO = 1 or A(ILO,ILO-1) = 0, and */
+/*          either IHI = N or A(IHI+1,IHI) = 0. */
+
+/*  NW      (input) INTEGER */
+/*          The desired size of the deflation window. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of A. */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,N) */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of B. */
+
+/*  Q       (input/output) DOUBLE PRECISION array, dimension (LDQ,N) */
+
+/*  LDQ     (input) INTEGER */
+
+/*  Z       (input/output) DOUBLE PRECISION array, dimension (LDZ,N) */
+
+/*  LDZ     (input) INTEGER */
+
+/*  NS      (output) INTEGER */
+/*          The number of unconverged eigenvalues available as shifts. */
+
+/*  ND      (output) INTEGER */
+/*          The number of converged (deflated) eigenvalues. */
+
+/*  ALPHAR  (output) DOUBLE PRECISION array, dimension (N) */
+/*  ALPHAI  (output) DOUBLE PRECISION array, dimension (N) */
+/*  BETA    (output) DOUBLE PRECISION array, dimension (N) */
+/*          On exit, the eigenvalues of the window are stored in */
+/*          entries IHI-ND-NS+1 through IHI; the shifts come first, */
+/*          the converged eigenvalues last.  Complex conjugate pairs */
+/*          are stored consecutively with the positive imaginary part */
+/*          first. */
+
+/*  QC      (workspace) DOUBLE PRECISION array, dimension (LDQC,JW) */
+
+/*  LDQC    (input) INTEGER */
+
+/*  ZC      (workspace) DOUBLE PRECISION array, dimension (LDZC,JW) */
+
+/*  LDZC    (input) INTEGER */
+/*          The leading dimensions of QC and ZC, >= JW = min(NW,IHI-ILO+1). */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  REC     (input) INTEGER */
+/*          The current recursion level of DLAQZ0; the window is */
+/*          reduced with recursion level REC+1. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value */
+
+/*  Further Details */
+/*  =============== */
+
+/*  If the reduction of the window does not converge, the window is */
+/*  restored, ND is set to zero and NS to the number of eigenvalues */
+/*  that did converge, so that the caller can still use them as shifts. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    q_dim1 = *ldq;
+    q_offset = 1 + q_dim1;
+    q -= q_offset;
+    z_dim1 = *ldz;
+    z_offset = 1 + z_dim1;
+    z__ -= z_offset;
+    --alphar;
+    --alphai;
+    --beta;
+    qc_dim1 = *ldqc;
+    qc_offset = 1 + qc_dim1;
+    qc -= qc_offset;
+    zc_dim1 = *ldzc;
+    zc_offset = 1 + zc_dim1;
+    zc -= zc_offset;
+    --work;
+
+    /* Function Body */
+    *info = 0;
+
+/*     Set up deflation window */
+
+/* Computing MIN */
+    i__1 = *nw, i__2 = *ihi - *ilo + 1;
+    jw = min(i__1,i__2);
+    kwtop = *ihi - jw + 1;
+    if (kwtop == *ilo) {
+	s = 0.;
+    } else {
+	s = a[kwtop + (kwtop - 1) * a_dim1];
+    }
+
+/*     Determine required workspace: two copies of the window, then the */
+/*     largest of the needs of the window reduction, DTGEXC, the RQ */
+/*     factorization and the final matrix-matrix products */
+
+    rec1 = *rec + 1;
+    dlaqz0_("S", "V", "V", &jw, &c__1, &jw, &a[kwtop + kwtop * a_dim1], lda,
+	     &b[kwtop + kwtop * b_dim1], ldb, &alphar[1], &alphai[1], &beta[1]
+	    , &qc[qc_offset], ldqc, &zc[zc_offset], ldzc, &work[1], &c_n1, &
+	    rec1, &ierr);
+    lwkopt = (integer) work[1];
+/* Computing MAX */
+    i__1 = lwkopt, i__2 = (jw << 2) + 16;
+    lwkopt = max(i__1,i__2);
+    dgerqf_(&jw, &jw, &b[b_offset], ldb, dum, &work[1], &c_n1, &ierr);
+/* Computing MAX */
+    i__1 = lwkopt, i__2 = (jw << 1) + (integer) work[1];
+    lwkopt = max(i__1,i__2);
+    dormrq_("R", "T", &jw, &jw, &jw, &b[b_offset], ldb, dum, &a[a_offset],
+	    lda, &work[1], &c_n1, &ierr);
+/* Computing MAX */
+    i__1 = lwkopt, i__2 = (jw << 1) + (integer) work[1];
+    lwkopt = max(i__1,i__2);
+/* Computing MAX */
+    i__1 = lwkopt, i__2 = jw * 3 * jw;
+    lwkopt = max(i__1,i__2) + (jw << 1) * jw;
+    if (*lwork == -1) {
+
+/*        workspace query, quick return */
+
+	work[1] = (doublereal) lwkopt;
+	return 0;
+    } else if (*lwork < lwkopt) {
+	*info = -26;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DLAQZ3", &i__1);
+	return 0;
+    }
+
+/*     Get machine constants */
+
+    safmin = dlamch_("SAFE MINIMUM");
+    ulp = dlamch_("PRECISION");
+    smlnum = safmin * ((doublereal) (*n) / ulp);
+
+    if (*ilschur) {
+	istartm = 1;
+	istopm = *n;
+    } else {
+	istartm = *ilo;
+	istopm = *ihi;
+    }
+
+    if (*ihi == kwtop) {
+
+/*        1 by 1 deflation window, just try a regular deflation */
+
+	alphar[kwtop] = a[kwtop + kwtop * a_dim1];
+	alphai[kwtop] = 0.;
+	beta[kwtop] = b[kwtop + kwtop * b_dim1];
+	*ns = 1;
+	*nd = 0;
+/* Computing MAX */
+	d__2 = smlnum, d__3 = ulp * (d__1 = a[kwtop + kwtop * a_dim1], abs(
+		d__1));
+	if (abs(s) <= max(d__2,d__3)) {
+	    *ns = 0;
+	    *nd = 1;
+	    if (kwtop > *ilo) {
+		a[kwtop + (kwtop - 1) * a_dim1] = 0.;
+	    }
+	}
+	return 0;
+    }
+
+/*     Store the window in case of convergence failure */
+
+    dlacpy_("ALL", &jw, &jw, &a[kwtop + kwtop * a_dim1], lda, &work[1], &jw);
+    dlacpy_("ALL", &jw, &jw, &b[kwtop + kwtop * b_dim1], ldb, &work[jw * jw
+	    + 1], &jw);
+    iwrk = (jw << 1) * jw + 1;
+
+/*     Transform the window to real Schur form */
+
+    dlaset_("Full", &jw, &jw, &c_b14, &c_b15, &qc[qc_offset], ldqc);
+    dlaset_("Full", &jw, &jw, &c_b14, &c_b15, &zc[zc_offset], ldzc);
+    i__1 = *lwork - iwrk + 1;
+    dlaqz0_("S", "V", "V", &jw, &c__1, &jw, &a[kwtop + kwtop * a_dim1], lda,
+	     &b[kwtop + kwtop * b_dim1], ldb, &alphar[kwtop], &alphai[kwtop],
+	     &beta[kwtop], &qc[qc_offset], ldqc, &zc[zc_offset], ldzc, &work[
+	    iwrk], &i__1, &rec1, &ierr);
+
+    if (ierr != 0) {
+
+/*        Convergence failure, restore the window and exit */
+
+	*nd = 0;
+	*ns = jw - ierr;
+	dlacpy_("ALL", &jw, &jw, &work[1], &jw, &a[kwtop + kwtop * a_dim1],
+		lda);
+	dlacpy_("ALL", &jw, &jw, &work[jw * jw + 1], &jw, &b[kwtop + kwtop *
+		b_dim1], ldb);
+	return 0;
+    }
+
+/*     Deflation detection loop: the spike of a block of the window is */
+/*     S times the corresponding entries of the first row of QC */
+
+    kwbot = jw;
+    if (s != 0.) {
+	k2 = 1;
+	while(k2 <= kwbot) {
+	    bulge = FALSE_;
+	    if (kwbot >= 2) {
+		bulge = a[kwtop + kwbot - 1 + (kwtop + kwbot - 2) * a_dim1]
+			!= 0.;
+	    }
+	    kb = kwtop + kwbot - 1;
+	    if (bulge) {
+
+/*              Try to deflate complex conjugate eigenvalue pair */
+
+		temp = (d__1 = a[kb + kb * a_dim1], abs(d__1)) + sqrt((d__2 =
+			a[kb + (kb - 1) * a_dim1], abs(d__2))) * sqrt((d__3 =
+			a[kb - 1 + kb * a_dim1], abs(d__3)));
+		if (temp == 0.) {
+		    temp = abs(s);
+		}
+/* Computing MAX */
+		d__3 = (d__1 = s * qc[(kwbot - 1) * qc_dim1 + 1], abs(d__1)),
+			d__4 = (d__2 = s * qc[kwbot * qc_dim1 + 1], abs(d__2))
+			;
+/* Computing MAX */
+		d__1 = smlnum, d__2 = ulp * temp;
+		if (max(d__3,d__4) <= max(d__1,d__2)) {
+
+/*                 Deflatable */
+
+		    kwbot += -2;
+		} else {
+
+/*                 Not deflatable, move out of the way */
+
+		    ifst = kwbot;
+		    ilst = k2;
+		    i__1 = *lwork - iwrk + 1;
+		    dtgexc_(&c_true, &c_true, &jw, &a[kwtop + kwtop * a_dim1],
+			    lda, &b[kwtop + kwtop * b_dim1], ldb, &qc[
+			    qc_offset], ldqc, &zc[zc_offset], ldzc, &ifst, &
+			    ilst, &work[iwrk], &i__1, &ierr);
+		    if (ierr != 0) {
+			goto L20;
+		    }
+		    k2 += 2;
+		}
+	    } else {
+
+/*              Try to deflate real eigenvalue */
+
+		temp = (d__1 = a[kb + kb * a_dim1], abs(d__1));
+		if (temp == 0.) {
+		    temp = abs(s);
+		}
+/* Computing MAX */
+		d__2 = smlnum, d__3 = ulp * temp;
+		if ((d__1 = s * qc[kwbot * qc_dim1 + 1], abs(d__1)) <= max(
+			d__2,d__3)) {
+
+/*                 Deflatable */
+
+		    --kwbot;
+		} else {
+
+/*                 Not deflatable, move out of the way */
+
+		    ifst = kwbot;
+		    ilst = k2;
+		    i__1 = *lwork - iwrk + 1;
+		    dtgexc_(&c_true, &c_true, &jw, &a[kwtop + kwtop * a_dim1],
+			    lda, &b[kwtop + kwtop * b_dim1], ldb, &qc[
+			    qc_offset], ldqc, &zc[zc_offset], ldzc, &ifst, &
+			    ilst, &work[iwrk], &i__1, &ierr);
+		    if (ierr != 0) {
+			goto L20;
+		    }
+		    ++k2;
+		}
+	    }
+	}
+    } else {
+	kwbot = 0;
+    }
+L20:
+
+/*     Store eigenvalues of the window */
+
+    *nd = jw - kwbot;
+    *ns = kwbot;
+    k = kwtop;
+    while(k <= *ihi) {
+	bulge = FALSE_;
+	if (k < *ihi) {
+	    if (a[k + 1 + k * a_dim1] != 0.) {
+		bulge = TRUE_;
+	    }
+	}
+	if (bulge) {
+
+/*           2x2 eigenvalue block */
+
+	    dlag2_(&a[k + k * a_dim1], lda, &b[k + k * b_dim1], ldb, &safmin,
+		     &beta[k], &beta[k + 1], &alphar[k], &alphar[k + 1], &
+		    alphai[k]);
+	    alphai[k + 1] = -alphai[k];
+	    k += 2;
+	} else {
+
+/*           1x1 eigenvalue block */
+
+	    alphar[k] = a[k + k * a_dim1];
+	    alphai[k] = 0.;
+	    beta[k] = b[k + k * b_dim1];
+	    ++k;
+	}
+    }
+
+    if (kwtop != *ilo && s != 0.) {
+	if (kwbot > 0) {
+
+/*           Reflect the spike S*QC(1,1:KWBOT) back to a multiple of */
+/*           e1; this fills in the leading KWBOT rows of the window */
+
+	    ix = iwrk;
+	    itau = ix + jw;
+	    iq2 = itau + jw;
+	    i__1 = kwbot;
+	    for (i__ = 1; i__ <= i__1; ++i__) {
+		work[ix + i__ - 1] = s * qc[i__ * qc_dim1 + 1];
+/* L30: */
+	    }
+	    dlarfg_(&kwbot, &work[ix], &work[ix + 1], &c__1, &tau);
+	    s = work[ix];
+	    work[ix] = 1.;
+	    dlarf_("Left", &kwbot, &jw, &work[ix], &c__1, &tau, &a[kwtop +
+		    kwtop * a_dim1], lda, &work[iq2]);
+	    dlarf_("Left", &kwbot, &jw, &work[ix], &c__1, &tau, &b[kwtop +
+		    kwtop * b_dim1], ldb, &work[iq2]);
+	    dlarf_("Right", &jw, &kwbot, &work[ix], &c__1, &tau, &qc[
+		    qc_offset], ldqc, &work[iq2]);
+
+/*           Restore B(window) to triangular form by an RQ factorization */
+
+	    i__1 = *lwork - iq2 + 1;
+	    dgerqf_(&kwbot, &kwbot, &b[kwtop + kwtop * b_dim1], ldb, &work[
+		    itau], &work[iq2], &i__1, &ierr);
+	    i__1 = *lwork - iq2 + 1;
+	    dormrq_("R", "T", &kwbot, &kwbot, &kwbot, &b[kwtop + kwtop *
+		    b_dim1], ldb, &work[itau], &a[kwtop + kwtop * a_dim1], lda,
+		     &work[iq2], &i__1, &ierr);
+	    i__1 = *lwork - iq2 + 1;
+	    dormrq_("R", "T", &jw, &kwbot, &kwbot, &b[kwtop + kwtop * b_dim1],
+		     ldb, &work[itau], &zc[zc_offset], ldzc, &work[iq2], &i__1,
+		     &ierr);
+	    i__1 = kwbot - 1;
+	    i__2 = kwbot - 1;
+	    dlaset_("Lower", &i__1, &i__2, &c_b14, &c_b14, &b[kwtop + 1 +
+		    kwtop * b_dim1], ldb);
+
+/*           Return the leading KWBOT rows and columns of the window to */
+/*           Hessenberg-triangular form */
+
+	    iq2 = iwrk;
+	    iz2 = iq2 + kwbot * kwbot;
+	    ix = iz2 + kwbot * kwbot;
+	    dgghrd_("I", "I", &kwbot, &c__1, &kwbot, &a[kwtop + kwtop *
+		    a_dim1], lda, &b[kwtop + kwtop * b_dim1], ldb, &work[iq2],
+		     &kwbot, &work[iz2], &kwbot, &ierr);
+	    if (kwbot < jw) {
+		i__1 = jw - kwbot;
+		dgemm_("T", "N", &kwbot, &i__1, &kwbot, &c_b15, &work[iq2], &
+			kwbot, &a[kwtop + (kwtop + kwbot) * a_dim1], lda, &
+			c_b14, &work[ix], &kwbot);
+		dlacpy_("ALL", &kwbot, &i__1, &work[ix], &kwbot, &a[kwtop + (
+			kwtop + kwbot) * a_dim1], lda);
+		dgemm_("T", "N", &kwbot, &i__1, &kwbot, &c_b15, &work[iq2], &
+			kwbot, &b[kwtop + (kwtop + kwbot) * b_dim1], ldb, &
+			c_b14, &work[ix], &kwbot);
+		dlacpy_("ALL", &kwbot, &i__1, &work[ix], &kwbot, &b[kwtop + (
+			kwtop + kwbot) * b_dim1], ldb);
+	    }
+	    dgemm_("N", "N", &jw, &kwbot, &kwbot, &c_b15, &qc[qc_offset],
+		    ldqc, &work[iq2], &kwbot, &c_b14, &work[ix], &jw);
+	    dlacpy_("ALL", &jw, &kwbot, &work[ix], &jw, &qc[qc_offset], ldqc);
+	    dgemm_("N", "N", &jw, &kwbot, &kwbot, &c_b15, &zc[zc_offset],
+		    ldzc, &work[iz2], &kwbot, &c_b14, &work[ix], &jw);
+	    dlacpy_("ALL", &jw, &kwbot, &work[ix], &jw, &zc[zc_offset], ldzc);
+	}
+
+/*        The new spike */
+
+	a[kwtop + (kwtop - 1) * a_dim1] = s;
+	if (kwbot == 0) {
+	    a[kwtop + (kwtop - 1) * a_dim1] = 0.;
+	}
+	i__1 = *ihi;
+	for (i__ = kwtop + 1; i__ <= i__1; ++i__) {
+	    a[i__ + (kwtop - 1) * a_dim1] = 0.;
+/* L40: */
+	}
+    }
+
+/*     Apply the window transformations to the rest of the pencil */
+
+    i__1 = istopm;
+    i__2 = jw;
+    for (k = *ihi + 1; i__2 < 0 ? k >= i__1 : k <= i__1; k += i__2) {
+/* Computing MIN */
+	i__3 = jw, nc = istopm - k + 1;
+	nc = min(i__3,nc);
+	dgemm_("T", "N", &jw, &nc, &jw, &c_b15, &qc[qc_offset], ldqc, &a[
+		kwtop + k * a_dim1], lda, &c_b14, &work[1], &jw);
+	dlacpy_("ALL", &jw, &nc, &work[1], &jw, &a[kwtop + k * a_dim1], lda);
+	dgemm_("T", "N", &jw, &nc, &jw, &c_b15, &qc[qc_offset], ldqc, &b[
+		kwtop + k * b_dim1], ldb, &c_b14, &work[1], &jw);
+	dlacpy_("ALL", &jw, &nc, &work[1], &jw, &b[kwtop + k * b_dim1], ldb);
+/* L50: */
+    }
+    i__2 = kwtop - 1;
+    i__1 = jw;
+    for (ir = istartm; i__1 < 0 ? ir >= i__2 : ir <= i__2; ir += i__1) {
+/* Computing MIN */
+	i__3 = jw, nr = kwtop - ir;
+	nr = min(i__3,nr);
+	dgemm_("N", "N", &nr, &jw, &jw, &c_b15, &a[ir + kwtop * a_dim1], lda,
+		 &zc[zc_offset], ldzc, &c_b14, &work[1], &nr);
+	dlacpy_("ALL", &nr, &jw, &work[1], &nr, &a[ir + kwtop * a_dim1], lda);
+	dgemm_("N", "N", &nr, &jw, &jw, &c_b15, &b[ir + kwtop * b_dim1], ldb,
+		 &zc[zc_offset], ldzc, &c_b14, &work[1], &nr);
+	dlacpy_("ALL", &nr, &jw, &work[1], &nr, &b[ir + kwtop * b_dim1], ldb);
+/* L60: */
+    }
+    i__1 = *n;
+    i__2 = jw;
+    for (ir = 1; i__2 < 0 ? ir >= i__1 : ir <= i__1; ir += i__2) {
+/* Computing MIN */
+	i__3 = jw, nr = *n - ir + 1;
+	nr = min(i__3,nr);
+	if (*ilq) {
+	    dgemm_("N", "N", &nr, &jw, &jw, &c_b15, &q[ir + kwtop * q_dim1],
+		    ldq, &qc[qc_offset], ldqc, &c_b14, &work[1], &nr);
+	    dlacpy_("ALL", &nr, &jw, &work[1], &nr, &q[ir + kwtop * q_dim1],
+		    ldq);
+	}
+	if (*ilz) {
+	    dgemm_("N", "N", &nr, &jw, &jw, &c_b15, &z__[ir + kwtop * z_dim1],
+		     ldz, &zc[zc_offset], ldzc, &c_b14, &work[1], &nr);
+	    dlacpy_("ALL", &nr, &jw, &work[1], &nr, &z__[ir + kwtop * z_dim1],
+		     ldz);
+	}
+/* L70: */
+    }
+
+    work[1] = (doublereal) lwkopt;
+    return 0;
+
+/*     End of DLAQZ3 */
+
+} /* dlaqz3_ */
@@ -0,0 +1,348 @@
+/* dlaqz4.c -- DLAQZ4, one multishift QZ sweep for DLAQZ0. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__3 = 3;
+static logical c_true = TRUE_;
+static doublereal c_b10 = 0.;
+static doublereal c_b11 = 1.;
+
+/* Subroutine */ int dlaqz4_(logical *ilschur, logical *ilq, logical *ilz,
+	integer *n, integer *ilo, integer *ihi, integer *nshifts, integer *
+	nblock_desired__, doublereal *sr, doublereal *si, doublereal *ss,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb, doublereal *
+	q, integer *ldq, doublereal *z__, integer *ldz, doublereal *qc,
+	integer *ldqc, doublereal *zc, integer *ldzc, doublereal *work,
+	integer *lwork, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset, q_dim1, q_offset, z_dim1,
+	    z_offset, qc_dim1, qc_offset, zc_dim1, zc_offset, i__1, i__2,
+	    i__3, i__4, i__5;
+
+    /* Local variables */
+    integer j, k, t, t0, t1, jc, nc, ir, nr, tj, nw, wlo, whi, npos, tlast,
+	    nwmax, npairs, istartm, istopm;
+    doublereal v[3], tau, dum[1];
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dlaqz1_(
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, doublereal *, doublereal *, doublereal *,
+	    doublereal *), dlaqz2_(logical *, logical *, integer *, integer *,
+	     integer *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, integer *, integer *, doublereal *, integer *, integer
+	    *, integer *, doublereal *, integer *), dlacpy_(char *, integer *,
+	     integer *, doublereal *, integer *, doublereal *, integer *),
+	    dlarfg_(integer *, doublereal *, doublereal *, integer *,
+	    doublereal *), dlarfx_(char *, integer *, integer *, doublereal *,
+	     doublereal *, doublereal *, integer *, doublereal *), dlaset_(
+	    char *, integer *, integer *, doublereal *, doublereal *,
+	    doublereal *, integer *), xerbla_(char *, integer *);
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DLAQZ4 executes a single multishift QZ sweep on the active block */
+/*  ILO:IHI of the Hessenberg-triangular pencil (A,B). */
+
+/*  The NSHIFTS/2 double-shift bulges are introduced one after the */
+/*  other at the top of the block and chased down as a chain, three */
+/*  rows apart, by DLAQZ2.  The chase proceeds in windows: within a */
+/*  window the reflections are applied only to the window itself and */
+/*  accumulated in the orthogonal matrices QC and ZC, which are then */
+/*  applied to the rest of (A,B) and to Q and Z with DGEMM.  Thus the */
+/*  bulk of the work of the sweep is done by Level 3 BLAS. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  ILSCHUR (input) LOGICAL */
+/*          Determines whether or not to update the full Schur form */
+
+/*  ILQ     (input) LOGICAL */
+/*          Determines whether or not to update the matrix Q */
+
+/*  ILZ     (input) LOGICAL */
+/*          Determines whether or not to update the matrix Z */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrices A, B, Q, and Z.  N >= 0. */
+
+/*  ILO     (input) INTEGER */
+/*  IHI     (input) INTEGER */
+/*          The active block is A(ILO:IHI,ILO:IHI), B(ILO:IHI,ILO:IHI). */
+/*          A is upper Hessenberg and B upper triangular, with */
+/*          IHI-ILO >= 2. */
+
+/*  NSHIFTS (input) INTEGER */
+/*          The desired number of shifts to use; it must be even. */
+
+/*  NBLOCK_DESIRED (input) INTEGER */
+/*          The desired size of the computational windows. */
+
+/*  SR      (input) DOUBLE PRECISION array, dimension (NSHIFTS) */
+/*  SI      (input) DOUBLE PRECISION array, dimension (NSHIFTS) */
+/*  SS      (input) DOUBLE PRECISION array, dimension (NSHIFTS) */
+/*          The shifts are (SR(i)+i*SI(i))/SS(i).  Shifts 2*j-1 and 2*j */
+/*          form a pair: either a complex conjugate pair, with */
+/*          SR(2*j-1) = SR(2*j), SS(2*j-1) = SS(2*j) and */
+/*          SI(2*j) = -SI(2*j-1), or two real shifts. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of A. */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,N) */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of B. */
+
+/*  Q       (input/output) DOUBLE PRECISION array, dimension (LDQ,N) */
+
+/*  LDQ     (input) INTEGER */
+
+/*  Z       (input/output) DOUBLE PRECISION array, dimension (LDZ,N) */
+
+/*  LDZ     (input) INTEGER */
+
+/*  QC      (workspace) DOUBLE PRECISION array, dimension (LDQC,NWMAX) */
+
+/*  LDQC    (input) INTEGER */
+/*          LDQC >= NWMAX = max(NBLOCK_DESIRED, 3*(NSHIFTS/2)+1). */
+
+/*  ZC      (workspace) DOUBLE PRECISION array, dimension (LDZC,NWMAX) */
+
+/*  LDZC    (input) INTEGER */
+/*          LDZC >= NWMAX. */
+
+/*  WORK    (workspace/output) DOUBLE PRECISION array, dimension (MAX(1,LWORK)) */
+/*          On exit, if INFO = 0, WORK(1) returns the optimal LWORK. */
+
+/*  LWORK   (input) INTEGER */
+/*          The dimension of the array WORK.  LWORK >= NWMAX*NWMAX. */
+
+/*          If LWORK = -1, then a workspace query is assumed; the routine */
+/*          only calculates the optimal size of the WORK array, returns */
+/*          this value as the first entry of the WORK array, and no error */
+/*          message related to LWORK is issued by XERBLA. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value */
+
+/*  Further Details */
+/*  =============== */
+
+/*  Bulge j (j = 1 is the front of the chain) is introduced at time */
+/*  step 3*(j-1) and afterwards moved one position per time step, so */
+/*  at time t it sits at position ILO+t-3*(j-1).  A window covers */
+/*  NPOS consecutive time steps and the rows and columns touched by */
+/*  them. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --sr;
+    --si;
+    --ss;
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    q_dim1 = *ldq;
+    q_offset = 1 + q_dim1;
+    q -= q_offset;
+    z_dim1 = *ldz;
+    z_offset = 1 + z_dim1;
+    z__ -= z_offset;
+    qc_dim1 = *ldqc;
+    qc_offset = 1 + qc_dim1;
+    qc -= qc_offset;
+    zc_dim1 = *ldzc;
+    zc_offset = 1 + zc_dim1;
+    zc -= zc_offset;
+    --work;
+
+    /* Function Body */
+    *info = 0;
+    npairs = *nshifts / 2;
+/* Computing MAX */
+    i__1 = *nblock_desired__ - npairs * 3;
+    npos = max(i__1,1);
+    nwmax = npos + npairs * 3;
+    if (*lwork == -1) {
+
+/*        workspace query, quick return */
+
+	work[1] = (doublereal) (nwmax * nwmax);
+	return 0;
+    } else if (*lwork < nwmax * nwmax) {
+	*info = -25;
+    }
+    if (*nshifts < 2 || *nshifts % 2 != 0) {
+	*info = -7;
+    } else if (*ihi - *ilo < 2) {
+	*info = -6;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DLAQZ4", &i__1);
+	return 0;
+    }
+
+    if (*ilschur) {
+	istartm = 1;
+	istopm = *n;
+    } else {
+	istartm = *ilo;
+	istopm = *ihi;
+    }
+
+/*     The front bulge leaves the pencil at time step IHI-ILO-1 */
+
+    tlast = *ihi - *ilo - 1 + (npairs - 1) * 3;
+
+    i__1 = tlast;
+    for (t0 = 0; t0 <= i__1; t0 += npos) {
+/* Computing MIN */
+	i__3 = t0 + npos - 1;
+	t1 = min(i__3,tlast);
+
+/*        Rows and columns touched by the time steps T0:T1 */
+
+/* Computing MAX */
+	i__3 = *ilo + t0 - (npairs - 1) * 3 - 1;
+	wlo = max(*ilo,i__3);
+/* Computing MIN */
+	i__3 = *ilo + t1 + 2;
+	whi = min(*ihi,i__3);
+	nw = whi - wlo + 1;
+	dlaset_("Full", &nw, &nw, &c_b10, &c_b11, &qc[qc_offset], ldqc);
+	dlaset_("Full", &nw, &nw, &c_b10, &c_b11, &zc[zc_offset], ldzc);
+
+	i__3 = t1;
+	for (t = t0; t <= i__3; ++t) {
+	    for (j = 1; j <= npairs; ++j) {
+		tj = t - (j - 1) * 3;
+		if (tj == 0) {
+
+/*                 Introduce bulge j at the top of the block */
+
+		    dlaqz1_(&a[*ilo + *ilo * a_dim1], lda, &b[*ilo + *ilo *
+			    b_dim1], ldb, &sr[(j << 1) - 1], &sr[j * 2], &si[(
+			    j << 1) - 1], &ss[(j << 1) - 1], &ss[j * 2], v);
+		    dlarfg_(&c__3, v, &v[1], &c__1, &tau);
+		    v[0] = 1.;
+		    i__4 = whi - *ilo + 1;
+		    dlarfx_("Left", &c__3, &i__4, v, &tau, &a[*ilo + *ilo *
+			    a_dim1], lda, dum);
+		    dlarfx_("Left", &c__3, &i__4, v, &tau, &b[*ilo + *ilo *
+			    b_dim1], ldb, dum);
+		    dlarfx_("Right", &nw, &c__3, v, &tau, &qc[(*ilo - wlo + 1)
+			     * qc_dim1 + 1], ldqc, dum);
+		} else if (tj >= 1 && tj <= *ihi - *ilo - 1) {
+
+/*                 Move bulge j from position K to K+1 */
+
+		    k = *ilo + tj - 1;
+		    dlaqz2_(&c_true, &c_true, &k, &wlo, &whi, ihi, &a[
+			    a_offset], lda, &b[b_offset], ldb, &nw, &wlo, &qc[
+			    qc_offset], ldqc, &nw, &wlo, &zc[zc_offset], ldzc);
+		}
+/* L10: */
+	    }
+/* L20: */
+	}
+
+/*        Update the rest of the pencil and Q, Z with the accumulated */
+/*        transformations */
+
+	i__5 = istopm;
+	i__4 = nwmax;
+	for (jc = whi + 1; i__4 < 0 ? jc >= i__5 : jc <= i__5; jc += i__4) {
+/* Computing MIN */
+	    i__2 = nwmax, nc = istopm - jc + 1;
+	    nc = min(i__2,nc);
+	    dgemm_("T", "N", &nw, &nc, &nw, &c_b11, &qc[qc_offset], ldqc, &a[
+		    wlo + jc * a_dim1], lda, &c_b10, &work[1], &nw);
+	    dlacpy_("ALL", &nw, &nc, &work[1], &nw, &a[wlo + jc * a_dim1],
+		    lda);
+	    dgemm_("T", "N", &nw, &nc, &nw, &c_b11, &qc[qc_offset], ldqc, &b[
+		    wlo + jc * b_dim1], ldb, &c_b10, &work[1], &nw);
+	    dlacpy_("ALL", &nw, &nc, &work[1], &nw, &b[wlo + jc * b_dim1],
+		    ldb);
+/* L30: */
+	}
+	i__4 = wlo - 1;
+	i__5 = nwmax;
+	for (ir = istartm; i__5 < 0 ? ir >= i__4 : ir <= i__4; ir += i__5) {
+/* Computing MIN */
+	    i__2 = nwmax, nr = wlo - ir;
+	    nr = min(i__2,nr);
+	    dgemm_("N", "N", &nr, &nw, &nw, &c_b11, &a[ir + wlo * a_dim1],
+		    lda, &zc[zc_offset], ldzc, &c_b10, &work[1], &nr);
+	    dlacpy_("ALL", &nr, &nw, &work[1], &nr, &a[ir + wlo * a_dim1],
+		    lda);
+	    dgemm_("N", "N", &nr, &nw, &nw, &c_b11, &b[ir + wlo * b_dim1],
+		    ldb, &zc[zc_offset], ldzc, &c_b10, &work[1], &nr);
+	    dlacpy_("ALL", &nr, &nw, &work[1], &nr, &b[ir + wlo * b_dim1],
+		    ldb);
+/* L40: */
+	}
+	i__5 = *n;
+	i__4 = nwmax;
+	for (ir = 1; i__4 < 0 ? ir >= i__5 : ir <= i__5; ir += i__4) {
+/* Computing MIN */
+	    i__2 = nwmax, nr = *n - ir + 1;
+	    nr = min(i__2,nr);
+	    if (*ilq) {
+		dgemm_("N", "N", &nr, &nw, &nw, &c_b11, &q[ir + wlo * q_dim1],
+			 ldq, &qc[qc_offset], ldqc, &c_b10, &work[1], &nr);
+		dlacpy_("ALL", &nr, &nw, &work[1], &nr, &q[ir + wlo * q_dim1],
+			 ldq);
+	    }
+	    if (*ilz) {
+		dgemm_("N", "N", &nr, &nw, &nw, &c_b11, &z__[ir + wlo *
+			z_dim1], ldz, &zc[zc_offset], ldzc, &c_b10, &work[1],
+			&nr);
+		dlacpy_("ALL", &nr, &nw, &work[1], &nr, &z__[ir + wlo *
+			z_dim1], ldz);
+	    }
+/* L50: */
+	}
+/* L60: */
+    }
+
+    return 0;
+
+/*     End of DLAQZ4 */
+
+} /* dlaqz4_ */
@@ -17,7 +17,7 @@
 	doublereal *x)
 {
     /* System generated locals */
-    integer i__1, i__2, i__3;
+    integer i__2, i__3;
 
     /* Builtin functions */
     double log(doublereal), sqrt(doublereal), cos(doublereal);
@@ -25,8 +25,9 @@
     /* Local variables */
     integer i__;
     doublereal u[128];
-    integer il, iv, il2;
-    extern /* Subroutine */ int dlaruv_(integer *, integer *, doublereal *);
+    integer ib, il, iv, jv, nb, nu, il2, jseed[4];
+    extern /* Subroutine */ int dlarsk_(integer *, integer *), dlaruv_(
+	    integer *, integer *, doublereal *);
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -73,6 +74,11 @@
 /*  128 using vectorisable code. The Box-Muller method is used to */
 /*  transform numbers from a uniform to a normal distribution. */
 
+/*  The batches are independent: each starts from the seed advanced by */
+/*  DLARSK past the numbers of the batches before it.  With OpenMP, long */
+/*  vectors are generated in parallel, and the result does not depend on */
+/*  the number of threads. */
+
 /*  ===================================================================== */
 
 /*     .. Parameters .. */
@@ -92,21 +98,44 @@
     --iseed;
 
     /* Function Body */
-    i__1 = *n;
-    for (iv = 1; iv <= i__1; iv += 64) {
+    if (*n <= 0) {
+	return 0;
+    }
+    if (*idist == 3) {
+	nu = 2;
+    } else {
+	nu = 1;
+    }
+
+/*     Each batch of 64 numbers starts from its own seed, advanced past */
+/*     the numbers used by the batches before it, so the batches can be */
+/*     generated in any order and give the same vector. */
+
+    nb = (*n + 63) / 64;
+#ifdef _OPENMP
+#pragma omp parallel for private(ib,iv,il,il2,i__,i__2,i__3,jseed,jv,u) \
+	if (*n > 4096)
+#endif
+    for (ib = 0; ib < nb; ++ib) {
+	iv = (ib << 6) + 1;
 /* Computing MIN */
 	i__2 = 64, i__3 = *n - iv + 1;
 	il = min(i__2,i__3);
-	if (*idist == 3) {
-	    il2 = il << 1;
-	} else {
-	    il2 = il;
+	il2 = il * nu;
+	jseed[0] = iseed[1];
+	jseed[1] = iseed[2];
+	jseed[2] = iseed[3];
+	jseed[3] = iseed[4];
+	jv = iv - 1;
+	dlarsk_(jseed, &jv);
+	if (nu == 2) {
+	    dlarsk_(jseed, &jv);
 	}
 
 /*        Call DLARUV to generate IL2 numbers from a uniform (0,1) */
 /*        distribution (IL2 <= LV) */
 
-	dlaruv_(&iseed[1], &il2, u);
+	dlaruv_(jseed, &il2, u);
 
 	if (*idist == 1) {
 
@@ -139,6 +168,14 @@
 	}
 /* L40: */
     }
+
+/*     Advance the seed past all the numbers used, N at a time so that */
+/*     N*NU cannot overflow. */
+
+    dlarsk_(&iseed[1], n);
+    if (nu == 2) {
+	dlarsk_(&iseed[1], n);
+    }
     return 0;
 
 /*     End of DLARNV */
@@ -0,0 +1,75 @@
+/* dlarsk.c -- DLARSK, skip ahead in the DLARUV random number stream. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+#ifndef INTEGER_STAR_8
+typedef unsigned long long ulongint;
+#endif
+
+/* Same constants as in DLARUV. */
+
+static ulongint m47 = 140737488355327ULL;
+static ulongint pscl = 128167451614493ULL;
+static ulongint pinv = 32533708197173ULL;
+
+/* Subroutine */ int dlarsk_(integer *iseed, integer *n)
+{
+    ulongint p, s;
+
+
+/*  -- LAPACK auxiliary routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DLARSK advances the seed ISEED of DLARUV past N random numbers: */
+/*  on exit ISEED is the seed DLARUV would return after generating N */
+/*  numbers, but no numbers are generated. */
+
+/*  DLARNV uses one number from DLARUV per element for IDIST = 1 or 2 */
+/*  and two for IDIST = 3; ZLARNV uses two per element.  DLARSK thus */
+/*  lets several threads fill disjoint parts of one random vector, */
+/*  each starting from its own offset, and obtain the same numbers as */
+/*  a single call. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  ISEED   (input/output) INTEGER array, dimension (4) */
+/*          On entry, the seed of the random number generator; the array */
+/*          elements must be between 0 and 4095, and ISEED(4) must be */
+/*          odd. */
+/*          On exit, the seed is advanced by N numbers. */
+
+/*  N       (input) INTEGER */
+/*          The number of random numbers to skip.  If N < 0, the seed */
+/*          is moved back by -N numbers. */
+
+/*  ===================================================================== */
+
+/*     .. Executable Statements .. */
+
+    /* Parameter adjustments */
+    --iseed;
+
+    /* Function Body */
+    s = (ulongint) (iseed[1] & 4095) << 36 | (ulongint) (iseed[2] & 4095)
+	    << 24 | (ulongint) (iseed[3] & 4095) << 12 | (ulongint) (iseed[4]
+	    & 4095);
+    p = (s >> 1) * pscl + (ulongint) (*n) & m47;
+    s = (p * pinv & m47) << 1 | 1;
+    iseed[1] = (integer) (s >> 36);
+    iseed[2] = (integer) (s >> 24 & 4095);
+    iseed[3] = (integer) (s >> 12 & 4095);
+    iseed[4] = (integer) (s & 4095);
+    return 0;
+
+/*     End of DLARSK */
+
+} /* dlarsk_ */
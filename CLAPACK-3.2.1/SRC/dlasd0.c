@@ -31,7 +31,7 @@ static integer c__2 = 2;
 
     /* Local variables */
     integer i__, j, m, i1, ic, lf, nd, ll, nl, nr, im1, ncc, nlf, nrf, iwk, 
-	    lvl, ndb1, nlp1, nrp1;
+	    lvl, ndb1, nlp1, nrp1, ierr, iinfo, iwrk;
     doublereal beta;
     integer idxq, nlvl;
     doublereal alpha;
@@ -45,6 +45,7 @@ static integer c__2 = 2;
 	    doublereal *, integer *), dlasdt_(integer *, integer *, 
 	    integer *, integer *, integer *, integer *, integer *), xerbla_(
 	    char *, integer *);
+    extern doublereal dlamch_(char *);
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -123,6 +124,12 @@ static integer c__2 = 2;
 /*     Ming Gu and Huan Ren, Computer Science Division, University of */
 /*     California at Berkeley, USA */
 
+/*  The subproblems on each level of the computation tree are */
+/*  independent and are solved concurrently when compiled with OpenMP. */
+/*  The node whose rows start at NLF uses WORK from 3*(NLF-1)**2 + */
+/*  2*(NLF-1) + 1 and IWORK from 4*(NLF-1) + 1 on, so the workspace */
+/*  requirements are the same as for the sequential algorithm. */
+
 /*  ===================================================================== */
 
 /*     .. Local Scalars .. */
@@ -187,12 +194,22 @@ static integer c__2 = 2;
     dlasdt_(n, &nlvl, &nd, &iwork[inode], &iwork[ndiml], &iwork[ndimr], 
 	    smlsiz);
 
+/*     DLAMCH saves its values on the first call; make that call here */
+/*     rather than from concurrent subproblems */
+
+    dlamch_("P");
+
 /*     For the nodes on bottom level of the tree, solve */
 /*     their subproblems by DLASDQ. */
 
     ndb1 = (nd + 1) / 2;
     ncc = 0;
+    ierr = 0;
     i__1 = nd;
+#ifdef _OPENMP
+#pragma omp parallel for private(i1, ic, nl, nlp1, nr, nrp1, nlf, nrf, \
+	sqrei, itemp, j, i__2, iinfo) reduction(max:ierr) if (nd > ndb1)
+#endif
     for (i__ = ndb1; i__ <= i__1; ++i__) {
 
 /*     IC : center row of each node */
@@ -212,9 +229,10 @@ static integer c__2 = 2;
 	sqrei = 1;
 	dlasdq_("U", &sqrei, &nl, &nlp1, &nl, &ncc, &d__[nlf], &e[nlf], &vt[
 		nlf + nlf * vt_dim1], ldvt, &u[nlf + nlf * u_dim1], ldu, &u[
-		nlf + nlf * u_dim1], ldu, &work[1], info);
-	if (*info != 0) {
-	    return 0;
+		nlf + nlf * u_dim1], ldu, &work[(nlf - 1 << 2) + 1], &iinfo);
+	if (iinfo != 0) {
+	    ierr = max(ierr,iinfo);
+	    continue;
 	}
 	itemp = idxq + nlf - 2;
 	i__2 = nl;
@@ -230,9 +248,10 @@ static integer c__2 = 2;
 	nrp1 = nr + sqrei;
 	dlasdq_("U", &sqrei, &nr, &nrp1, &nr, &ncc, &d__[nrf], &e[nrf], &vt[
 		nrf + nrf * vt_dim1], ldvt, &u[nrf + nrf * u_dim1], ldu, &u[
-		nrf + nrf * u_dim1], ldu, &work[1], info);
-	if (*info != 0) {
-	    return 0;
+		nrf + nrf * u_dim1], ldu, &work[(nrf - 1 << 2) + 1], &iinfo);
+	if (iinfo != 0) {
+	    ierr = max(ierr,iinfo);
+	    continue;
 	}
 	itemp = idxq + ic;
 	i__2 = nr;
@@ -242,6 +261,10 @@ static integer c__2 = 2;
 	}
 /* L30: */
     }
+    if (ierr != 0) {
+	*info = ierr;
+	return 0;
+    }
 
 /*     Now conquer each subproblem bottom-up. */
 
@@ -259,6 +282,10 @@ static integer c__2 = 2;
 	    ll = (lf << 1) - 1;
 	}
 	i__1 = ll;
+#ifdef _OPENMP
+#pragma omp parallel for private(im1, ic, nl, nr, nlf, sqrei, idxqc, \
+	alpha, beta, iwrk, iinfo) reduction(max:ierr) if (ll > lf)
+#endif
 	for (i__ = lf; i__ <= i__1; ++i__) {
 	    im1 = i__ - 1;
 	    ic = iwork[inode + im1];
@@ -273,14 +300,19 @@ static integer c__2 = 2;
 	    idxqc = idxq + nlf - 1;
 	    alpha = d__[ic];
 	    beta = e[ic];
+	    iwrk = (nlf - 1) * ((nlf - 1) * 3 + 2) + 1;
 	    dlasd1_(&nl, &nr, &sqrei, &d__[nlf], &alpha, &beta, &u[nlf + nlf *
 		     u_dim1], ldu, &vt[nlf + nlf * vt_dim1], ldvt, &iwork[
-		    idxqc], &iwork[iwk], &work[1], info);
-	    if (*info != 0) {
-		return 0;
+		    idxqc], &iwork[iwk + (nlf - 1 << 2)], &work[iwrk], &iinfo);
+	    if (iinfo != 0) {
+		ierr = max(ierr,iinfo);
 	    }
 /* L40: */
 	}
+	if (ierr != 0) {
+	    *info = ierr;
+	    return 0;
+	}
 /* L50: */
     }
 
@@ -39,7 +39,7 @@ static integer c__2 = 2;
 
     /* Local variables */
     integer i__, j, m, i1, ic, lf, nd, ll, nl, vf, nr, vl, im1, ncc, nlf, nrf,
-	     vfi, iwk, vli, lvl, nru, ndb1, nlp1, lvl2, nrp1;
+	     vfi, iwk, vli, lvl, nru, ndb1, nlp1, lvl2, nrp1, ierr, iinfo;
     doublereal beta;
     integer idxq, nlvl;
     doublereal alpha;
@@ -62,6 +62,7 @@ static integer c__2 = 2;
 	    char *, integer *, integer *, doublereal *, doublereal *, 
 	    doublereal *, integer *), xerbla_(char *, integer *);
     integer smlszp;
+    extern doublereal dlamch_(char *);
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -221,6 +222,12 @@ static integer c__2 = 2;
 /*     Ming Gu and Huan Ren, Computer Science Division, University of */
 /*     California at Berkeley, USA */
 
+/*  If ICOMPQ = 1 the subproblems on each level of the computation tree */
+/*  write disjoint parts of the output arrays and are solved */
+/*  concurrently when compiled with OpenMP.  The node whose rows start */
+/*  at NLF then uses WORK from NWORK1 + 4*(NLF-1) and IWORK from */
+/*  4*N + 3*(NLF-1) + 1 on, within the workspace documented above. */
+
 /*  ===================================================================== */
 
 /*     .. Parameters .. */
@@ -329,11 +336,22 @@ static integer c__2 = 2;
     dlasdt_(n, &nlvl, &nd, &iwork[inode], &iwork[ndiml], &iwork[ndimr], 
 	    smlsiz);
 
+/*     DLAMCH saves its values on the first call; make that call here */
+/*     rather than from concurrent subproblems */
+
+    dlamch_("P");
+
 /*     for the nodes on bottom level of the tree, solve */
 /*     their subproblems by DLASDQ. */
 
     ndb1 = (nd + 1) / 2;
+    ierr = 0;
     i__1 = nd;
+#ifdef _OPENMP
+#pragma omp parallel for private(i1, ic, nl, nlp1, nr, nrp1, nlf, nrf, \
+	idxqi, vfi, vli, sqrei, itemp, j, i__2, iinfo) reduction(max:ierr) \
+	if (*icompq == 1 && nd > ndb1)
+#endif
     for (i__ = ndb1; i__ <= i__1; ++i__) {
 
 /*        IC : center row of each node */
@@ -357,7 +375,7 @@ static integer c__2 = 2;
 	    dlaset_("A", &nlp1, &nlp1, &c_b11, &c_b12, &work[nwork1], &smlszp);
 	    dlasdq_("U", &sqrei, &nl, &nlp1, &nru, &ncc, &d__[nlf], &e[nlf], &
 		    work[nwork1], &smlszp, &work[nwork2], &nl, &work[nwork2], 
-		    &nl, &work[nwork2], info);
+		    &nl, &work[nwork2], &iinfo);
 	    itemp = nwork1 + nl * smlszp;
 	    dcopy_(&nlp1, &work[nwork1], &c__1, &work[vfi], &c__1);
 	    dcopy_(&nlp1, &work[itemp], &c__1, &work[vli], &c__1);
@@ -367,13 +385,14 @@ static integer c__2 = 2;
 		    ldu);
 	    dlasdq_("U", &sqrei, &nl, &nlp1, &nl, &ncc, &d__[nlf], &e[nlf], &
 		    vt[nlf + vt_dim1], ldu, &u[nlf + u_dim1], ldu, &u[nlf + 
-		    u_dim1], ldu, &work[nwork1], info);
+		    u_dim1], ldu, &work[nwork1 + (nlf - 1 << 2)], &iinfo);
 	    dcopy_(&nlp1, &vt[nlf + vt_dim1], &c__1, &work[vfi], &c__1);
 	    dcopy_(&nlp1, &vt[nlf + nlp1 * vt_dim1], &c__1, &work[vli], &c__1)
 		    ;
 	}
-	if (*info != 0) {
-	    return 0;
+	if (iinfo != 0) {
+	    ierr = max(ierr,iinfo);
+	    continue;
 	}
 	i__2 = nl;
 	for (j = 1; j <= i__2; ++j) {
@@ -393,7 +412,7 @@ static integer c__2 = 2;
 	    dlaset_("A", &nrp1, &nrp1, &c_b11, &c_b12, &work[nwork1], &smlszp);
 	    dlasdq_("U", &sqrei, &nr, &nrp1, &nru, &ncc, &d__[nrf], &e[nrf], &
 		    work[nwork1], &smlszp, &work[nwork2], &nr, &work[nwork2], 
-		    &nr, &work[nwork2], info);
+		    &nr, &work[nwork2], &iinfo);
 	    itemp = nwork1 + (nrp1 - 1) * smlszp;
 	    dcopy_(&nrp1, &work[nwork1], &c__1, &work[vfi], &c__1);
 	    dcopy_(&nrp1, &work[itemp], &c__1, &work[vli], &c__1);
@@ -403,13 +422,14 @@ static integer c__2 = 2;
 		    ldu);
 	    dlasdq_("U", &sqrei, &nr, &nrp1, &nr, &ncc, &d__[nrf], &e[nrf], &
 		    vt[nrf + vt_dim1], ldu, &u[nrf + u_dim1], ldu, &u[nrf + 
-		    u_dim1], ldu, &work[nwork1], info);
+		    u_dim1], ldu, &work[nwork1 + (nrf - 1 << 2)], &iinfo);
 	    dcopy_(&nrp1, &vt[nrf + vt_dim1], &c__1, &work[vfi], &c__1);
 	    dcopy_(&nrp1, &vt[nrf + nrp1 * vt_dim1], &c__1, &work[vli], &c__1)
 		    ;
 	}
-	if (*info != 0) {
-	    return 0;
+	if (iinfo != 0) {
+	    ierr = max(ierr,iinfo);
+	    continue;
 	}
 	i__2 = nr;
 	for (j = 1; j <= i__2; ++j) {
@@ -418,10 +438,13 @@ static integer c__2 = 2;
 	}
 /* L30: */
     }
+    if (ierr != 0) {
+	*info = ierr;
+	return 0;
+    }
 
 /*     Now conquer each subproblem bottom-up. */
 
-    j = pow_ii(&c__2, &nlvl);
     for (lvl = nlvl; lvl >= 1; --lvl) {
 	lvl2 = (lvl << 1) - 1;
 
@@ -437,6 +460,11 @@ static integer c__2 = 2;
 	    ll = (lf << 1) - 1;
 	}
 	i__1 = ll;
+#ifdef _OPENMP
+#pragma omp parallel for private(j, im1, ic, nl, nr, nlf, nrf, sqrei, \
+	vfi, vli, idxqi, alpha, beta, iinfo) reduction(max:ierr) \
+	if (*icompq == 1 && ll > lf)
+#endif
 	for (i__ = lf; i__ <= i__1; ++i__) {
 	    im1 = i__ - 1;
 	    ic = iwork[inode + im1];
@@ -461,9 +489,13 @@ static integer c__2 = 2;
 			ldgcol, &givnum[givnum_offset], ldu, &poles[
 			poles_offset], &difl[difl_offset], &difr[difr_offset], 
 			 &z__[z_offset], &k[1], &c__[1], &s[1], &work[nwork1], 
-			 &iwork[iwk], info);
+			 &iwork[iwk], &iinfo);
 	    } else {
-		--j;
+/*              J numbers the nodes in the order of the sequential */
+/*              algorithm: 2**NLVL-1 for the first node on level NLVL */
+/*              down to 1 for the root. */
+
+		j = lf + ll - i__;
 		dlasd6_(icompq, &nl, &nr, &sqrei, &d__[nlf], &work[vfi], &
 			work[vli], &alpha, &beta, &iwork[idxqi], &perm[nlf + 
 			lvl * perm_dim1], &givptr[j], &givcol[nlf + lvl2 * 
@@ -471,13 +503,18 @@ static integer c__2 = 2;
 			givnum_dim1], ldu, &poles[nlf + lvl2 * poles_dim1], &
 			difl[nlf + lvl * difl_dim1], &difr[nlf + lvl2 * 
 			difr_dim1], &z__[nlf + lvl * z_dim1], &k[j], &c__[j], 
-			&s[j], &work[nwork1], &iwork[iwk], info);
+			&s[j], &work[nwork1 + (nlf - 1 << 2)], &iwork[iwk + (
+			nlf - 1) * 3], &iinfo);
 	    }
-	    if (*info != 0) {
-		return 0;
+	    if (iinfo != 0) {
+		ierr = max(ierr,iinfo);
 	    }
 /* L40: */
 	}
+	if (ierr != 0) {
+	    *info = ierr;
+	    return 0;
+	}
 /* L50: */
     }
 
@@ -13,16 +13,28 @@
 #include "f2c.h"
 #include "blaswrap.h"
 
+/* Blue's scaling constants for IEEE double precision: */
+/* TSML = 2**-511, TBIG = 2**486, SSML = 2**537, SBIG = 2**-538. */
+
+static doublereal tsml = 1.4916681462400413e-154;
+static doublereal tbig = 1.997919072202235e+146;
+static doublereal ssml = 4.4989137945431964e+161;
+static doublereal sbig = 1.1113793747425387e-162;
+
 /* Subroutine */ int dlassq_(integer *n, doublereal *x, integer *incx, 
 	doublereal *scale, doublereal *sumsq)
 {
     /* System generated locals */
-    integer i__1, i__2;
+    integer i__1;
     doublereal d__1;
 
+    /* Builtin functions */
+    double sqrt(doublereal);
+
     /* Local variables */
-    integer ix;
-    doublereal absxi;
+    integer i__, k, ix, nb;
+    doublereal ax, ymin, ymax, asml[4], amed[4], abig[4], xk[4], sml, med, 
+	    big;
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -42,14 +54,17 @@
 /*     ( scl**2 )*smsq = x( 1 )**2 +...+ x( n )**2 + ( scale**2 )*sumsq, */
 
 /*  where  x( i ) = X( 1 + ( i - 1 )*INCX ). The value of  sumsq  is */
-/*  assumed to be non-negative and  scl  returns the value */
-
-/*     scl = max( scale, abs( x( i ) ) ). */
+/*  assumed to be non-negative. */
 
 /*  scale and sumsq must be supplied in SCALE and SUMSQ and */
 /*  scl and smsq are overwritten on SCALE and SUMSQ respectively. */
 
-/*  The routine makes only one pass through the vector x. */
+/*  The routine makes only one pass through the vector x, using Blue's */
+/*  algorithm: the squares are accumulated in three ranges (small, */
+/*  medium, big) with power-of-two scaling, so no divisions are needed */
+/*  inside the loop.  The elements are dealt cyclically to four */
+/*  accumulators that are combined in a fixed order, so the result is */
+/*  the same whether or not the loop is vectorized. */
 
 /*  Arguments */
 /*  ========= */
@@ -63,7 +78,7 @@
 
 /*  INCX    (input) INTEGER */
 /*          The increment between successive values of the vector X. */
-/*          INCX > 0. */
+/*          If INCX < 0, x( i ) = X( 1 - ( n - i )*INCX ). */
 
 /*  SCALE   (input/output) DOUBLE PRECISION */
 /*          On entry, the value  scale  in the equation above. */
@@ -89,25 +104,135 @@
     --x;
 
     /* Function Body */
-    if (*n > 0) {
-	i__1 = (*n - 1) * *incx + 1;
-	i__2 = *incx;
-	for (ix = 1; i__2 < 0 ? ix >= i__1 : ix <= i__1; ix += i__2) {
-	    if (x[ix] != 0.) {
-		absxi = (d__1 = x[ix], abs(d__1));
-		if (*scale < absxi) {
+    if (*scale != *scale || *sumsq != *sumsq) {
+	return 0;
+    }
+    if (*sumsq == 0.) {
+	*scale = 1.;
+    }
+    if (*scale == 0.) {
+	*scale = 1.;
+	*sumsq = 0.;
+    }
+    if (*n <= 0) {
+	return 0;
+    }
+
+    for (k = 0; k < 4; ++k) {
+	asml[k] = 0.;
+	amed[k] = 0.;
+	abig[k] = 0.;
+/* L10: */
+    }
+    ix = 1;
+    if (*incx < 0) {
+	ix = 1 - (*n - 1) * *incx;
+    }
+
+/*     Main loop, four elements at a time. */
+
+    nb = *n - *n % 4;
+    i__1 = nb;
+    for (i__ = 1; i__ <= i__1; i__ += 4) {
+	for (k = 0; k < 4; ++k) {
+	    xk[k] = x[ix + k * *incx];
+/* L20: */
+	}
+	for (k = 0; k < 4; ++k) {
+	    ax = abs(xk[k]);
+	    big = ax > tbig ? ax * sbig : 0.;
+	    sml = ax < tsml ? ax * ssml : 0.;
+	    med = ax > tbig || ax < tsml ? 0. : ax;
+	    abig[k] += big * big;
+	    asml[k] += sml * sml;
+	    amed[k] += med * med;
+/* L30: */
+	}
+	ix += *incx << 2;
+/* L40: */
+    }
+
+/*     Remaining elements. */
+
+    i__1 = *n;
+    for (i__ = nb + 1; i__ <= i__1; ++i__) {
+	k = i__ - nb - 1;
+	ax = (d__1 = x[ix], abs(d__1));
+	if (ax > tbig) {
 /* Computing 2nd power */
-		    d__1 = *scale / absxi;
-		    *sumsq = *sumsq * (d__1 * d__1) + 1;
-		    *scale = absxi;
-		} else {
+	    d__1 = ax * sbig;
+	    abig[k] += d__1 * d__1;
+	} else if (ax < tsml) {
 /* Computing 2nd power */
-		    d__1 = absxi / *scale;
-		    *sumsq += d__1 * d__1;
-		}
+	    d__1 = ax * ssml;
+	    asml[k] += d__1 * d__1;
+	} else {
+	    amed[k] += ax * ax;
+	}
+	ix += *incx;
+/* L50: */
+    }
+
+/*     Combine the lanes. */
+
+    abig[0] = abig[0] + abig[1] + (abig[2] + abig[3]);
+    asml[0] = asml[0] + asml[1] + (asml[2] + asml[3]);
+    amed[0] = amed[0] + amed[1] + (amed[2] + amed[3]);
+
+/*     Put the existing sum of squares into one of the accumulators. */
+
+    if (*sumsq > 0.) {
+	ax = *scale * sqrt(*sumsq);
+	if (ax > tbig) {
+	    if (*scale > 1.) {
+		*scale *= sbig;
+		abig[0] += *scale * (*scale * *sumsq);
+	    } else {
+		abig[0] += *scale * (*scale * (sbig * (sbig * *sumsq)));
 	    }
-/* L10: */
+	} else if (ax < tsml) {
+	    if (*scale < 1.) {
+		*scale *= ssml;
+		asml[0] += *scale * (*scale * *sumsq);
+	    } else {
+		asml[0] += *scale * (*scale * (ssml * (ssml * *sumsq)));
+	    }
+	} else {
+	    amed[0] += *scale * (*scale * *sumsq);
+	}
+    }
+
+/*     Combine abig and amed or amed and asml if more than one */
+/*     accumulator was used. */
+
+    if (abig[0] > 0.) {
+	if (amed[0] > 0. || amed[0] != amed[0]) {
+	    abig[0] += amed[0] * sbig * sbig;
+	}
+	*scale = 1. / sbig;
+	*sumsq = abig[0];
+    } else if (asml[0] > 0.) {
+	if (amed[0] > 0. || amed[0] != amed[0]) {
+	    amed[0] = sqrt(amed[0]);
+	    asml[0] = sqrt(asml[0]) / ssml;
+	    if (asml[0] > amed[0]) {
+		ymin = amed[0];
+		ymax = asml[0];
+	    } else {
+		ymin = asml[0];
+		ymax = amed[0];
+	    }
+	    *scale = 1.;
+/* Computing 2nd power */
+	    d__1 = ymin / ymax;
+	    *sumsq = ymax * ymax * (d__1 * d__1 + 1.);
+	} else {
+	    *scale = 1. / ssml;
+	    *sumsq = asml[0];
 	}
+    } else {
+	*scale = 1.;
+	*sumsq = amed[0];
     }
     return 0;
 
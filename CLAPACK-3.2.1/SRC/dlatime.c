@@ -0,0 +1,670 @@
+/* dlatime.c -- timed wrappers of double precision LAPACK and BLAS routines.
+
+   See INCLUDE/latime.h.  Each latime_ routine calls the routine of the
+   same name and charges its elapsed time and operation count to the
+   routine's entry.
+*/
+
+#include "f2c.h"
+#include "blaswrap.h"
+#undef LAPACK_TIMING
+#include "latime.h"
+
+extern logical lsame_(char *, char *);
+extern /* Subroutine */ int dgemm_(char *transa, char *transb, integer *m,
+	integer *n, integer *k, doublereal *alpha, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, doublereal *beta,
+	doublereal *c__, integer *ldc);
+extern /* Subroutine */ int dsymm_(char *side, char *uplo, integer *m,
+	integer *n, doublereal *alpha, doublereal *a, integer *lda,
+	doublereal *b, integer *ldb, doublereal *beta, doublereal *c__,
+	integer *ldc);
+extern /* Subroutine */ int dsyrk_(char *uplo, char *trans, integer *n,
+	integer *k, doublereal *alpha, doublereal *a, integer *lda,
+	doublereal *beta, doublereal *c__, integer *ldc);
+extern /* Subroutine */ int dsyr2k_(char *uplo, char *trans, integer *n,
+	integer *k, doublereal *alpha, doublereal *a, integer *lda,
+	doublereal *b, integer *ldb, doublereal *beta, doublereal *c__,
+	integer *ldc);
+extern /* Subroutine */ int dtrmm_(char *side, char *uplo, char *transa,
+	char *diag, integer *m, integer *n, doublereal *alpha,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb);
+extern /* Subroutine */ int dtrsm_(char *side, char *uplo, char *transa,
+	char *diag, integer *m, integer *n, doublereal *alpha,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb);
+extern /* Subroutine */ int dgemv_(char *trans, integer *m, integer *n,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *x,
+	integer *incx, doublereal *beta, doublereal *y, integer *incy);
+extern /* Subroutine */ int dger_(integer *m, integer *n, doublereal *alpha,
+	doublereal *x, integer *incx, doublereal *y, integer *incy,
+	doublereal *a, integer *lda);
+extern /* Subroutine */ int dtrsv_(char *uplo, char *trans, char *diag,
+	integer *n, doublereal *a, integer *lda, doublereal *x,
+	integer *incx);
+extern /* Subroutine */ int dsymv_(char *uplo, integer *n,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *x,
+	integer *incx, doublereal *beta, doublereal *y, integer *incy);
+extern /* Subroutine */ int dgesv_(integer *n, integer *nrhs, doublereal *a,
+	integer *lda, integer *ipiv, doublereal *b, integer *ldb,
+	integer *info);
+extern /* Subroutine */ int dgetrf_(integer *m, integer *n, doublereal *a,
+	integer *lda, integer *ipiv, integer *info);
+extern /* Subroutine */ int dgetrs_(char *trans, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, integer *ipiv, doublereal *b,
+	integer *ldb, integer *info);
+extern /* Subroutine */ int dgetri_(integer *n, doublereal *a, integer *lda,
+	integer *ipiv, doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dposv_(char *uplo, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	integer *info);
+extern /* Subroutine */ int dpotrf_(char *uplo, integer *n, doublereal *a,
+	integer *lda, integer *info);
+extern /* Subroutine */ int dpotrs_(char *uplo, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	integer *info);
+extern /* Subroutine */ int dpotri_(char *uplo, integer *n, doublereal *a,
+	integer *lda, integer *info);
+extern /* Subroutine */ int dtrtri_(char *uplo, char *diag, integer *n,
+	doublereal *a, integer *lda, integer *info);
+extern /* Subroutine */ int dsysv_(char *uplo, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, integer *ipiv, doublereal *b,
+	integer *ldb, doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dsytrf_(char *uplo, integer *n, doublereal *a,
+	integer *lda, integer *ipiv, doublereal *work, integer *lwork,
+	integer *info);
+extern /* Subroutine */ int dgeqrf_(integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info);
+extern /* Subroutine */ int dgelqf_(integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info);
+extern /* Subroutine */ int dorgqr_(integer *m, integer *n, integer *k,
+	doublereal *a, integer *lda, doublereal *tau, doublereal *work,
+	integer *lwork, integer *info);
+extern /* Subroutine */ int dormqr_(char *side, char *trans, integer *m,
+	integer *n, integer *k, doublereal *a, integer *lda,
+	doublereal *tau, doublereal *c__, integer *ldc, doublereal *work,
+	integer *lwork, integer *info);
+extern /* Subroutine */ int dgels_(char *trans, integer *m, integer *n,
+	integer *nrhs, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dgelsd_(integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *s, doublereal *rcond, integer *rank, doublereal *work,
+	integer *lwork, integer *iwork, integer *info);
+extern /* Subroutine */ int dsytrd_(char *uplo, integer *n, doublereal *a,
+	integer *lda, doublereal *d__, doublereal *e, doublereal *tau,
+	doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dgehrd_(integer *n, integer *ilo, integer *ihi,
+	doublereal *a, integer *lda, doublereal *tau, doublereal *work,
+	integer *lwork, integer *info);
+extern /* Subroutine */ int dgebrd_(integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *d__, doublereal *e, doublereal *tauq,
+	doublereal *taup, doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dsyev_(char *jobz, char *uplo, integer *n,
+	doublereal *a, integer *lda, doublereal *w, doublereal *work,
+	integer *lwork, integer *info);
+extern /* Subroutine */ int dsyevd_(char *jobz, char *uplo, integer *n,
+	doublereal *a, integer *lda, doublereal *w, doublereal *work,
+	integer *lwork, integer *iwork, integer *liwork, integer *info);
+extern /* Subroutine */ int dsyevr_(char *jobz, char *range, char *uplo,
+	integer *n, doublereal *a, integer *lda, doublereal *vl,
+	doublereal *vu, integer *il, integer *iu, doublereal *abstol,
+	integer *m, doublereal *w, doublereal *z__, integer *ldz,
+	integer *isuppz, doublereal *work, integer *lwork, integer *iwork,
+	integer *liwork, integer *info);
+extern /* Subroutine */ int dgesvd_(char *jobu, char *jobvt, integer *m,
+	integer *n, doublereal *a, integer *lda, doublereal *s,
+	doublereal *u, integer *ldu, doublereal *vt, integer *ldvt,
+	doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dgesdd_(char *jobz, integer *m, integer *n,
+	doublereal *a, integer *lda, doublereal *s, doublereal *u,
+	integer *ldu, doublereal *vt, integer *ldvt, doublereal *work,
+	integer *lwork, integer *iwork, integer *info);
+extern /* Subroutine */ int dgeev_(char *jobvl, char *jobvr, integer *n,
+	doublereal *a, integer *lda, doublereal *wr, doublereal *wi,
+	doublereal *vl, integer *ldvl, doublereal *vr, integer *ldvr,
+	doublereal *work, integer *lwork, integer *info);
+extern /* Subroutine */ int dggev_(char *jobvl, char *jobvr, integer *n,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *alphar, doublereal *alphai, doublereal *beta,
+	doublereal *vl, integer *ldvl, doublereal *vr, integer *ldvr,
+	doublereal *work, integer *lwork, integer *info);
+
+/* Operation counts of DORGQR, DORMQR, DGELS and DGEHRD */
+
+static doublereal
+orgqr_flops(integer m, integer n, integer k)
+{
+	return 4. * m * n * k - 2. * (m + n) * k * k + 4. * k * k * k / 3;
+}
+
+static doublereal
+ormqr_flops(char *side, integer m, integer n, integer k)
+{
+	return lsame_(side, "L") ? 4. * m * n * k - 2. * n * k * k
+		: 4. * m * n * k - 2. * m * k * k;
+}
+
+static doublereal
+gels_flops(integer m, integer n, integer nrhs)
+{
+	doublereal p = (doublereal)min(m,n);
+
+	return 2. * latime_lu(m, n) + 4. * max(m,n) * p * nrhs - p * p * nrhs;
+}
+
+static doublereal
+hrd_flops(integer ilo, integer ihi)
+{
+	doublereal h = (doublereal)(ihi - ilo + 1);
+
+	return 10. * h * h * h / 3;
+}
+
+int
+latime_dgemm(char *transa, char *transb, integer *m, integer *n, integer *k,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *beta, doublereal *c__, integer *ldc)
+{
+	static latime_ent ent = LATIME_ENT("DGEMM");
+	doublereal t = latime_now();
+
+	dgemm_(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c__,
+		ldc);
+	latime_end(&ent, t, 2. * *m * *n * *k);
+	return 0;
+}
+
+int
+latime_dsymm(char *side, char *uplo, integer *m, integer *n,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *beta, doublereal *c__, integer *ldc)
+{
+	static latime_ent ent = LATIME_ENT("DSYMM");
+	doublereal t = latime_now();
+
+	dsymm_(side, uplo, m, n, alpha, a, lda, b, ldb, beta, c__, ldc);
+	latime_end(&ent, t, 2. * latime_tr(side, *m, *n));
+	return 0;
+}
+
+int
+latime_dsyrk(char *uplo, char *trans, integer *n, integer *k,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *beta,
+	doublereal *c__, integer *ldc)
+{
+	static latime_ent ent = LATIME_ENT("DSYRK");
+	doublereal t = latime_now();
+
+	dsyrk_(uplo, trans, n, k, alpha, a, lda, beta, c__, ldc);
+	latime_end(&ent, t, (doublereal)*k * *n * (*n + 1));
+	return 0;
+}
+
+int
+latime_dsyr2k(char *uplo, char *trans, integer *n, integer *k,
+	doublereal *alpha, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *beta, doublereal *c__, integer *ldc)
+{
+	static latime_ent ent = LATIME_ENT("DSYR2K");
+	doublereal t = latime_now();
+
+	dsyr2k_(uplo, trans, n, k, alpha, a, lda, b, ldb, beta, c__, ldc);
+	latime_end(&ent, t, 2. * *k * *n * *n + *n);
+	return 0;
+}
+
+int
+latime_dtrmm(char *side, char *uplo, char *transa, char *diag, integer *m,
+	integer *n, doublereal *alpha, doublereal *a, integer *lda,
+	doublereal *b, integer *ldb)
+{
+	static latime_ent ent = LATIME_ENT("DTRMM");
+	doublereal t = latime_now();
+
+	dtrmm_(side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb);
+	latime_end(&ent, t, latime_tr(side, *m, *n));
+	return 0;
+}
+
+int
+latime_dtrsm(char *side, char *uplo, char *transa, char *diag, integer *m,
+	integer *n, doublereal *alpha, doublereal *a, integer *lda,
+	doublereal *b, integer *ldb)
+{
+	static latime_ent ent = LATIME_ENT("DTRSM");
+	doublereal t = latime_now();
+
+	dtrsm_(side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb);
+	latime_end(&ent, t, latime_tr(side, *m, *n));
+	return 0;
+}
+
+int
+latime_dgemv(char *trans, integer *m, integer *n, doublereal *alpha,
+	doublereal *a, integer *lda, doublereal *x, integer *incx,
+	doublereal *beta, doublereal *y, integer *incy)
+{
+	static latime_ent ent = LATIME_ENT("DGEMV");
+	doublereal t = latime_now();
+
+	dgemv_(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+	latime_end(&ent, t, 2. * *m * *n);
+	return 0;
+}
+
+int
+latime_dger(integer *m, integer *n, doublereal *alpha, doublereal *x,
+	integer *incx, doublereal *y, integer *incy, doublereal *a,
+	integer *lda)
+{
+	static latime_ent ent = LATIME_ENT("DGER");
+	doublereal t = latime_now();
+
+	dger_(m, n, alpha, x, incx, y, incy, a, lda);
+	latime_end(&ent, t, 2. * *m * *n);
+	return 0;
+}
+
+int
+latime_dtrsv(char *uplo, char *trans, char *diag, integer *n, doublereal *a,
+	integer *lda, doublereal *x, integer *incx)
+{
+	static latime_ent ent = LATIME_ENT("DTRSV");
+	doublereal t = latime_now();
+
+	dtrsv_(uplo, trans, diag, n, a, lda, x, incx);
+	latime_end(&ent, t, (doublereal)*n * *n);
+	return 0;
+}
+
+int
+latime_dsymv(char *uplo, integer *n, doublereal *alpha, doublereal *a,
+	integer *lda, doublereal *x, integer *incx, doublereal *beta,
+	doublereal *y, integer *incy)
+{
+	static latime_ent ent = LATIME_ENT("DSYMV");
+	doublereal t = latime_now();
+
+	dsymv_(uplo, n, alpha, a, lda, x, incx, beta, y, incy);
+	latime_end(&ent, t, 2. * *n * *n);
+	return 0;
+}
+
+int
+latime_dgesv(integer *n, integer *nrhs, doublereal *a, integer *lda,
+	integer *ipiv, doublereal *b, integer *ldb, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGESV");
+	doublereal t = latime_now();
+
+	dgesv_(n, nrhs, a, lda, ipiv, b, ldb, info);
+	latime_end(&ent, t, latime_lu(*n, *n) + 2. * *n * *n * *nrhs);
+	return 0;
+}
+
+int
+latime_dgetrf(integer *m, integer *n, doublereal *a, integer *lda,
+	integer *ipiv, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGETRF");
+	doublereal t = latime_now();
+
+	dgetrf_(m, n, a, lda, ipiv, info);
+	latime_end(&ent, t, latime_lu(*m, *n));
+	return 0;
+}
+
+int
+latime_dgetrs(char *trans, integer *n, integer *nrhs, doublereal *a,
+	integer *lda, integer *ipiv, doublereal *b, integer *ldb,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGETRS");
+	doublereal t = latime_now();
+
+	dgetrs_(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+	latime_end(&ent, t, 2. * *n * *n * *nrhs);
+	return 0;
+}
+
+int
+latime_dgetri(integer *n, doublereal *a, integer *lda, integer *ipiv,
+	doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGETRI");
+	doublereal t = latime_now();
+
+	dgetri_(n, a, lda, ipiv, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 4. * *n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_dposv(char *uplo, integer *n, integer *nrhs, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DPOSV");
+	doublereal t = latime_now();
+
+	dposv_(uplo, n, nrhs, a, lda, b, ldb, info);
+	latime_end(&ent, t, (doublereal)*n * *n * *n / 3
+		+ 2. * *n * *n * *nrhs);
+	return 0;
+}
+
+int
+latime_dpotrf(char *uplo, integer *n, doublereal *a, integer *lda,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DPOTRF");
+	doublereal t = latime_now();
+
+	dpotrf_(uplo, n, a, lda, info);
+	latime_end(&ent, t, (doublereal)*n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_dpotrs(char *uplo, integer *n, integer *nrhs, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DPOTRS");
+	doublereal t = latime_now();
+
+	dpotrs_(uplo, n, nrhs, a, lda, b, ldb, info);
+	latime_end(&ent, t, 2. * *n * *n * *nrhs);
+	return 0;
+}
+
+int
+latime_dpotri(char *uplo, integer *n, doublereal *a, integer *lda,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DPOTRI");
+	doublereal t = latime_now();
+
+	dpotri_(uplo, n, a, lda, info);
+	latime_end(&ent, t, 2. * *n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_dtrtri(char *uplo, char *diag, integer *n, doublereal *a,
+	integer *lda, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DTRTRI");
+	doublereal t = latime_now();
+
+	dtrtri_(uplo, diag, n, a, lda, info);
+	latime_end(&ent, t, (doublereal)*n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_dsysv(char *uplo, integer *n, integer *nrhs, doublereal *a,
+	integer *lda, integer *ipiv, doublereal *b, integer *ldb,
+	doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DSYSV");
+	doublereal t = latime_now();
+
+	dsysv_(uplo, n, nrhs, a, lda, ipiv, b, ldb, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, (doublereal)*n * *n * *n / 3
+			+ 2. * *n * *n * *nrhs);
+	return 0;
+}
+
+int
+latime_dsytrf(char *uplo, integer *n, doublereal *a, integer *lda,
+	integer *ipiv, doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DSYTRF");
+	doublereal t = latime_now();
+
+	dsytrf_(uplo, n, a, lda, ipiv, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, (doublereal)*n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_dgeqrf(integer *m, integer *n, doublereal *a, integer *lda,
+	doublereal *tau, doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGEQRF");
+	doublereal t = latime_now();
+
+	dgeqrf_(m, n, a, lda, tau, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 2. * latime_lu(*m, *n));
+	return 0;
+}
+
+int
+latime_dgelqf(integer *m, integer *n, doublereal *a, integer *lda,
+	doublereal *tau, doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGELQF");
+	doublereal t = latime_now();
+
+	dgelqf_(m, n, a, lda, tau, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 2. * latime_lu(*m, *n));
+	return 0;
+}
+
+int
+latime_dorgqr(integer *m, integer *n, integer *k, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DORGQR");
+	doublereal t = latime_now();
+
+	dorgqr_(m, n, k, a, lda, tau, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, orgqr_flops(*m, *n, *k));
+	return 0;
+}
+
+int
+latime_dormqr(char *side, char *trans, integer *m, integer *n, integer *k,
+	doublereal *a, integer *lda, doublereal *tau, doublereal *c__,
+	integer *ldc, doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DORMQR");
+	doublereal t = latime_now();
+
+	dormqr_(side, trans, m, n, k, a, lda, tau, c__, ldc, work, lwork,
+		info);
+	if (*lwork != -1)
+		latime_end(&ent, t, ormqr_flops(side, *m, *n, *k));
+	return 0;
+}
+
+int
+latime_dgels(char *trans, integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGELS");
+	doublereal t = latime_now();
+
+	dgels_(trans, m, n, nrhs, a, lda, b, ldb, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, gels_flops(*m, *n, *nrhs));
+	return 0;
+}
+
+int
+latime_dgelsd(integer *m, integer *n, integer *nrhs, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, doublereal *s,
+	doublereal *rcond, integer *rank, doublereal *work, integer *lwork,
+	integer *iwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGELSD");
+	doublereal t = latime_now();
+
+	dgelsd_(m, n, nrhs, a, lda, b, ldb, s, rcond, rank, work, lwork,
+		iwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dsytrd(char *uplo, integer *n, doublereal *a, integer *lda,
+	doublereal *d__, doublereal *e, doublereal *tau, doublereal *work,
+	integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DSYTRD");
+	doublereal t = latime_now();
+
+	dsytrd_(uplo, n, a, lda, d__, e, tau, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 4. * *n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_dgehrd(integer *n, integer *ilo, integer *ihi, doublereal *a,
+	integer *lda, doublereal *tau, doublereal *work, integer *lwork,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGEHRD");
+	doublereal t = latime_now();
+
+	dgehrd_(n, ilo, ihi, a, lda, tau, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, hrd_flops(*ilo, *ihi));
+	return 0;
+}
+
+int
+latime_dgebrd(integer *m, integer *n, doublereal *a, integer *lda,
+	doublereal *d__, doublereal *e, doublereal *tauq, doublereal *taup,
+	doublereal *work, integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGEBRD");
+	doublereal t = latime_now();
+
+	dgebrd_(m, n, a, lda, d__, e, tauq, taup, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 4. * latime_lu(*m, *n));
+	return 0;
+}
+
+int
+latime_dsyev(char *jobz, char *uplo, integer *n, doublereal *a,
+	integer *lda, doublereal *w, doublereal *work, integer *lwork,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DSYEV");
+	doublereal t = latime_now();
+
+	dsyev_(jobz, uplo, n, a, lda, w, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dsyevd(char *jobz, char *uplo, integer *n, doublereal *a,
+	integer *lda, doublereal *w, doublereal *work, integer *lwork,
+	integer *iwork, integer *liwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DSYEVD");
+	doublereal t = latime_now();
+
+	dsyevd_(jobz, uplo, n, a, lda, w, work, lwork, iwork, liwork, info);
+	if (*lwork != -1 && *liwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dsyevr(char *jobz, char *range, char *uplo, integer *n,
+	doublereal *a, integer *lda, doublereal *vl, doublereal *vu,
+	integer *il, integer *iu, doublereal *abstol, integer *m,
+	doublereal *w, doublereal *z__, integer *ldz, integer *isuppz,
+	doublereal *work, integer *lwork, integer *iwork, integer *liwork,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DSYEVR");
+	doublereal t = latime_now();
+
+	dsyevr_(jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w,
+		z__, ldz, isuppz, work, lwork, iwork, liwork, info);
+	if (*lwork != -1 && *liwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dgesvd(char *jobu, char *jobvt, integer *m, integer *n,
+	doublereal *a, integer *lda, doublereal *s, doublereal *u,
+	integer *ldu, doublereal *vt, integer *ldvt, doublereal *work,
+	integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGESVD");
+	doublereal t = latime_now();
+
+	dgesvd_(jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, work, lwork,
+		info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dgesdd(char *jobz, integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *s, doublereal *u, integer *ldu,
+	doublereal *vt, integer *ldvt, doublereal *work, integer *lwork,
+	integer *iwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGESDD");
+	doublereal t = latime_now();
+
+	dgesdd_(jobz, m, n, a, lda, s, u, ldu, vt, ldvt, work, lwork, iwork,
+		info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dgeev(char *jobvl, char *jobvr, integer *n, doublereal *a,
+	integer *lda, doublereal *wr, doublereal *wi, doublereal *vl,
+	integer *ldvl, doublereal *vr, integer *ldvr, doublereal *work,
+	integer *lwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGEEV");
+	doublereal t = latime_now();
+
+	dgeev_(jobvl, jobvr, n, a, lda, wr, wi, vl, ldvl, vr, ldvr, work,
+		lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_dggev(char *jobvl, char *jobvr, integer *n, doublereal *a,
+	integer *lda, doublereal *b, integer *ldb, doublereal *alphar,
+	doublereal *alphai, doublereal *beta, doublereal *vl, integer *ldvl,
+	doublereal *vr, integer *ldvr, doublereal *work, integer *lwork,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("DGGEV");
+	doublereal t = latime_now();
+
+	dggev_(jobvl, jobvr, n, a, lda, b, ldb, alphar, alphai, beta, vl,
+		ldvl, vr, ldvr, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
@@ -19,27 +19,20 @@ static integer c__1 = 1;
 static integer c_n1 = -1;
 static doublereal c_b15 = 1.;
 
+static int dlauum_rec(char *, integer *, doublereal *, integer *, integer *);
+
 /* Subroutine */ int dlauum_(char *uplo, integer *n, doublereal *a, integer *
 	lda, integer *info)
 {
     /* System generated locals */
-    integer a_dim1, a_offset, i__1, i__2, i__3, i__4;
+    integer a_dim1, a_offset, i__1;
 
     /* Local variables */
-    integer i__, ib, nb;
-    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *, 
-	    integer *, doublereal *, doublereal *, integer *, doublereal *, 
-	    integer *, doublereal *, doublereal *, integer *);
+    integer nb;
     extern logical lsame_(char *, char *);
-    extern /* Subroutine */ int dtrmm_(char *, char *, char *, char *, 
-	    integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *);
     logical upper;
-    extern /* Subroutine */ int dsyrk_(char *, char *, integer *, integer *, 
-	    doublereal *, doublereal *, integer *, doublereal *, doublereal *, 
-	     integer *), dlauu2_(char *, integer *, 
-	    doublereal *, integer *, integer *), xerbla_(char *, 
-	    integer *);
+    extern /* Subroutine */ int dlauu2_(char *, integer *, doublereal *, 
+	    integer *, integer *), xerbla_(char *, integer *);
     extern integer ilaenv_(integer *, char *, char *, integer *, integer *, 
 	    integer *, integer *);
 
@@ -65,7 +58,10 @@ static doublereal c_b15 = 1.;
 /*  If UPLO = 'L' or 'l' then the lower triangle of the result is stored, */
 /*  overwriting the factor L in A. */
 
-/*  This is the blocked form of the algorithm, calling Level 3 BLAS. */
+/*  This is the recursive form of the algorithm, calling Level 3 BLAS. */
+/*  The factor is split in halves until the blocks have order at most */
+/*  NB, which are handled by DLAUU2; the off-diagonal blocks are */
+/*  updated with DSYRK and DTRMM. */
 
 /*  Arguments */
 /*  ========= */
@@ -147,67 +143,9 @@ static doublereal c_b15 = 1.;
 	dlauu2_(uplo, n, &a[a_offset], lda, info);
     } else {
 
-/*        Use blocked code */
-
-	if (upper) {
-
-/*           Compute the product U * U'. */
-
-	    i__1 = *n;
-	    i__2 = nb;
-	    for (i__ = 1; i__2 < 0 ? i__ >= i__1 : i__ <= i__1; i__ += i__2) {
-/* Computing MIN */
-		i__3 = nb, i__4 = *n - i__ + 1;
-		ib = min(i__3,i__4);
-		i__3 = i__ - 1;
-		dtrmm_("Right", "Upper", "Transpose", "Non-unit", &i__3, &ib, 
-			&c_b15, &a[i__ + i__ * a_dim1], lda, &a[i__ * a_dim1 
-			+ 1], lda)
-			;
-		dlauu2_("Upper", &ib, &a[i__ + i__ * a_dim1], lda, info);
-		if (i__ + ib <= *n) {
-		    i__3 = i__ - 1;
-		    i__4 = *n - i__ - ib + 1;
-		    dgemm_("No transpose", "Transpose", &i__3, &ib, &i__4, &
-			    c_b15, &a[(i__ + ib) * a_dim1 + 1], lda, &a[i__ + 
-			    (i__ + ib) * a_dim1], lda, &c_b15, &a[i__ * 
-			    a_dim1 + 1], lda);
-		    i__3 = *n - i__ - ib + 1;
-		    dsyrk_("Upper", "No transpose", &ib, &i__3, &c_b15, &a[
-			    i__ + (i__ + ib) * a_dim1], lda, &c_b15, &a[i__ + 
-			    i__ * a_dim1], lda);
-		}
-/* L10: */
-	    }
-	} else {
-
-/*           Compute the product L' * L. */
-
-	    i__2 = *n;
-	    i__1 = nb;
-	    for (i__ = 1; i__1 < 0 ? i__ >= i__2 : i__ <= i__2; i__ += i__1) {
-/* Computing MIN */
-		i__3 = nb, i__4 = *n - i__ + 1;
-		ib = min(i__3,i__4);
-		i__3 = i__ - 1;
-		dtrmm_("Left", "Lower", "Transpose", "Non-unit", &ib, &i__3, &
-			c_b15, &a[i__ + i__ * a_dim1], lda, &a[i__ + a_dim1], 
-			lda);
-		dlauu2_("Lower", &ib, &a[i__ + i__ * a_dim1], lda, info);
-		if (i__ + ib <= *n) {
-		    i__3 = i__ - 1;
-		    i__4 = *n - i__ - ib + 1;
-		    dgemm_("Transpose", "No transpose", &ib, &i__3, &i__4, &
-			    c_b15, &a[i__ + ib + i__ * a_dim1], lda, &a[i__ + 
-			    ib + a_dim1], lda, &c_b15, &a[i__ + a_dim1], lda);
-		    i__3 = *n - i__ - ib + 1;
-		    dsyrk_("Lower", "Transpose", &ib, &i__3, &c_b15, &a[i__ + 
-			    ib + i__ * a_dim1], lda, &c_b15, &a[i__ + i__ * 
-			    a_dim1], lda);
-		}
-/* L20: */
-	    }
-	}
+/*        Use recursive code */
+
+	dlauum_rec(uplo, n, &a[a_offset], lda, &nb);
     }
 
     return 0;
@@ -215,3 +153,60 @@ static doublereal c_b15 = 1.;
 /*     End of DLAUUM */
 
 } /* dlauum_ */
+
+static int dlauum_rec(char *uplo, integer *n, doublereal *a, integer *lda,
+	integer *nb)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset;
+
+    /* Local variables */
+    integer n1, n2, info;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dtrmm_(char *, char *, char *, char *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *), dsyrk_(char *, char *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    doublereal *, integer *), dlauu2_(char *, integer *, doublereal *,
+	    integer *, integer *);
+
+
+/*     Recursive part of DLAUUM. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+
+    /* Function Body */
+    if (*n <= *nb) {
+	dlauu2_(uplo, n, &a[a_offset], lda, &info);
+	return 0;
+    }
+    n1 = *n / 2;
+    n2 = *n - n1;
+
+    if (lsame_(uplo, "U")) {
+
+/*        A11 := U11*U11' + U12*U12',  A12 := U12*U22',  A22 := U22*U22' */
+
+	dlauum_rec(uplo, &n1, &a[a_offset], lda, nb);
+	dsyrk_("Upper", "No transpose", &n1, &n2, &c_b15, &a[(n1 + 1) * 
+		a_dim1 + 1], lda, &c_b15, &a[a_offset], lda);
+	dtrmm_("Right", "Upper", "Transpose", "Non-unit", &n1, &n2, &c_b15, &
+		a[n1 + 1 + (n1 + 1) * a_dim1], lda, &a[(n1 + 1) * a_dim1 + 1],
+		lda);
+	dlauum_rec(uplo, &n2, &a[n1 + 1 + (n1 + 1) * a_dim1], lda, nb);
+    } else {
+
+/*        A11 := L11'*L11 + L21'*L21,  A21 := L22'*L21,  A22 := L22'*L22 */
+
+	dlauum_rec(uplo, &n1, &a[a_offset], lda, nb);
+	dsyrk_("Lower", "Transpose", &n1, &n2, &c_b15, &a[n1 + 1 + a_dim1], 
+		lda, &c_b15, &a[a_offset], lda);
+	dtrmm_("Left", "Lower", "Transpose", "Non-unit", &n2, &n1, &c_b15, &
+		a[n1 + 1 + (n1 + 1) * a_dim1], lda, &a[n1 + 1 + a_dim1], lda);
+	dlauum_rec(uplo, &n2, &a[n1 + 1 + (n1 + 1) * a_dim1], lda, nb);
+    }
+    return 0;
+} /* dlauum_rec */
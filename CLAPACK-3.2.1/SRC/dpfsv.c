@@ -0,0 +1,144 @@
+/* dpfsv.c -- DPFSV, SPD solve with the matrix in RFP format. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dpfsv_(char *transr, char *uplo, integer *n, integer *
+	nrhs, doublereal *a, doublereal *b, integer *ldb, integer *info)
+{
+    /* System generated locals */
+    integer b_dim1, b_offset, i__1;
+
+    /* Local variables */
+    logical normaltransr;
+    extern logical lsame_(char *, char *);
+    logical lower;
+    extern /* Subroutine */ int xerbla_(char *, integer *), dpftrf_(
+	    char *, char *, integer *, doublereal *, integer *), dpftrs_(
+	    char *, char *, integer *, integer *, doublereal *, doublereal *, 
+	    integer *, integer *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DPFSV computes the solution to a real system of linear equations */
+/*     A * X = B, */
+/*  where A is an N-by-N symmetric positive definite matrix stored in */
+/*  Rectangular Full Packed (RFP) format and X and B are N-by-NRHS */
+/*  matrices. */
+
+/*  The Cholesky decomposition is used to factor A as */
+/*     A = U**T* U,  if UPLO = 'U', or */
+/*     A = L * L**T,  if UPLO = 'L', */
+/*  where U is an upper triangular matrix and L is a lower triangular */
+/*  matrix.  The factored form of A is then used to solve the system of */
+/*  equations A * X = B. */
+
+/*  RFP format needs the same N*(N+1)/2 words as packed format, but is */
+/*  factored by DPFTRF with Level 3 BLAS, as fast as DPOSV on a full */
+/*  N-by-N array.  A matrix held in packed format can be put in RFP */
+/*  format in place by DTPTTFI; see also DPPSVF. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  TRANSR  (input) CHARACTER*1 */
+/*          = 'N':  The Normal TRANSR of RFP A is stored; */
+/*          = 'T':  The Transpose TRANSR of RFP A is stored. */
+
+/*  UPLO    (input) CHARACTER*1 */
+/*          = 'U':  Upper triangle of RFP A is stored; */
+/*          = 'L':  Lower triangle of RFP A is stored. */
+
+/*  N       (input) INTEGER */
+/*          The number of linear equations, i.e., the order of the */
+/*          matrix A.  N >= 0. */
+
+/*  NRHS    (input) INTEGER */
+/*          The number of right hand sides, i.e., the number of columns */
+/*          of the matrix B.  NRHS >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
+/*          On entry, the symmetric matrix A in RFP format, as described */
+/*          in DPFTRF. */
+/*          On exit, if INFO = 0, the factor U or L from the Cholesky */
+/*          factorization A = U**T*U or A = L*L**T, in the same storage */
+/*          format as A. */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,NRHS) */
+/*          On entry, the N-by-NRHS right hand side matrix B. */
+/*          On exit, if INFO = 0, the N-by-NRHS solution matrix X. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of the array B.  LDB >= max(1,N). */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+/*          > 0:  if INFO = i, the leading minor of order i of A is not */
+/*                positive definite, so the factorization could not be */
+/*                completed, and the solution has not been computed. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+
+    /* Function Body */
+    *info = 0;
+    normaltransr = lsame_(transr, "N");
+    lower = lsame_(uplo, "L");
+    if (! normaltransr && ! lsame_(transr, "T")) {
+	*info = -1;
+    } else if (! lower && ! lsame_(uplo, "U")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*nrhs < 0) {
+	*info = -4;
+    } else if (*ldb < max(1,*n)) {
+	*info = -7;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DPFSV ", &i__1);
+	return 0;
+    }
+
+/*     Compute the Cholesky factorization A = U'*U or A = L*L'. */
+
+    dpftrf_(transr, uplo, n, a, info);
+    if (*info == 0) {
+
+/*        Solve the system A*X = B, overwriting B with X. */
+
+	dpftrs_(transr, uplo, n, nrhs, a, &b[b_offset], ldb, info);
+
+    }
+    return 0;
+
+/*     End of DPFSV */
+
+} /* dpfsv_ */
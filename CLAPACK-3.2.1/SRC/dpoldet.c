@@ -0,0 +1,149 @@
+/* dpoldet.c -- DPOLDET, log-determinant of an SPD matrix. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Subroutine */ int dpoldet_(char *fact, char *uplo, integer *n, doublereal *
+	a, integer *lda, doublereal *logdet, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, i__1;
+
+    /* Builtin functions */
+    double log(doublereal);
+
+    /* Local variables */
+    integer i__;
+    logical nofact;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int xerbla_(char *, integer *), dpotrf_(
+	    char *, integer *, doublereal *, integer *, integer *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DPOLDET computes the logarithm of the determinant of a real */
+/*  symmetric positive definite matrix A from its Cholesky */
+/*  factorization A = U**T*U or A = L*L**T, */
+
+/*     log( det( A ) ) = 2 * sum log( U(i,i) ). */
+
+/*  The result neither overflows nor underflows even when det( A ) is */
+/*  not representable. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  FACT    (input) CHARACTER*1 */
+/*          Specifies whether or not the factored form of A is supplied: */
+/*          = 'F':  On entry, A contains the Cholesky factor from DPOTRF. */
+/*          = 'N':  A is factored by DPOTRF. */
+
+/*  UPLO    (input) CHARACTER*1 */
+/*          = 'U':  Upper triangle of A is stored; */
+/*          = 'L':  Lower triangle of A is stored. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension (LDA,N) */
+/*          On entry, the symmetric matrix A if FACT = 'N', or its */
+/*          Cholesky factor U or L if FACT = 'F'. */
+/*          On exit, the factor U or L from the Cholesky factorization. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A.  LDA >= max(1,N). */
+
+/*  LOGDET  (output) DOUBLE PRECISION */
+/*          The natural logarithm of det( A ). */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+/*          > 0:  if INFO = i, the leading minor of order i is not */
+/*                positive definite (FACT = 'N'), or the i-th diagonal */
+/*                element of the factor is not positive (FACT = 'F'); */
+/*                LOGDET is not computed. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+
+    /* Function Body */
+    *info = 0;
+    nofact = lsame_(fact, "N");
+    if (! nofact && ! lsame_(fact, "F")) {
+	*info = -1;
+    } else if (! lsame_(uplo, "U") && ! lsame_(uplo, "L")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    } else if (*lda < max(1,*n)) {
+	*info = -5;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DPOLDET", &i__1);
+	return 0;
+    }
+
+    *logdet = 0.;
+
+/*     Quick return if possible */
+
+    if (*n == 0) {
+	return 0;
+    }
+
+    if (nofact) {
+
+/*        Compute the Cholesky factorization of A. */
+
+	dpotrf_(uplo, n, &a[a_offset], lda, info);
+	if (*info > 0) {
+	    return 0;
+	}
+    }
+
+    i__1 = *n;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	if (a[i__ + i__ * a_dim1] <= 0.) {
+	    *info = i__;
+	    *logdet = 0.;
+	    return 0;
+	}
+	*logdet += log(a[i__ + i__ * a_dim1]);
+/* L10: */
+    }
+    *logdet *= 2.;
+
+    return 0;
+
+/*     End of DPOLDET */
+
+} /* dpoldet_ */
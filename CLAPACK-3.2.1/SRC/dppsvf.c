@@ -0,0 +1,150 @@
+/* dppsvf.c -- DPPSVF, packed SPD solve through in-place RFP conversion. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c_n1 = -1;
+
+/* Subroutine */ int dppsvf_(char *uplo, integer *n, integer *nrhs, 
+	doublereal *ap, doublereal *b, integer *ldb, integer *iwork, integer *
+	info)
+{
+    /* System generated locals */
+    integer b_dim1, b_offset, i__1;
+
+    /* Local variables */
+    integer nb, iinfo;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dpfsv_(char *, char *, integer *, integer *, 
+	    doublereal *, doublereal *, integer *, integer *), xerbla_(char *,
+	     integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *, 
+	    integer *, integer *);
+    extern /* Subroutine */ int dppsv_(char *, integer *, integer *, 
+	    doublereal *, doublereal *, integer *, integer *), dtfttpi_(char *
+	    , char *, integer *, doublereal *, integer *, integer *), 
+	    dtpttfi_(char *, char *, integer *, doublereal *, integer *, 
+	    integer *);
+
+
+/*  -- LAPACK driver routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DPPSVF computes the solution to a real system of linear equations */
+/*     A * X = B, */
+/*  where A is an N-by-N symmetric positive definite matrix stored in */
+/*  packed format and X and B are N-by-NRHS matrices. */
+
+/*  DPPSVF has the same results as DPPSV and needs only a bit map of */
+/*  N*(N+1)/2 bits as extra workspace.  For N larger than the block */
+/*  size of DPOTRF, A is converted in place to Rectangular Full Packed */
+/*  format (DTPTTFI), factored and solved there with Level 3 BLAS */
+/*  (DPFSV), and the factor is converted back (DTFTTPI).  With an */
+/*  optimized BLAS this gives the speed of DPOSV at half its storage, */
+/*  for problems where an N-by-N array does not fit in memory. */
+/*  Smaller problems are solved by DPPSV. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  UPLO    (input) CHARACTER*1 */
+/*          = 'U':  Upper triangle of A is stored; */
+/*          = 'L':  Lower triangle of A is stored. */
+
+/*  N       (input) INTEGER */
+/*          The number of linear equations, i.e., the order of the */
+/*          matrix A.  N >= 0. */
+
+/*  NRHS    (input) INTEGER */
+/*          The number of right hand sides, i.e., the number of columns */
+/*          of the matrix B.  NRHS >= 0. */
+
+/*  AP      (input/output) DOUBLE PRECISION array, dimension (N*(N+1)/2) */
+/*          On entry, the upper or lower triangle of the symmetric matrix */
+/*          A, packed columnwise in a linear array, as in DPPSV. */
+/*          On exit, if INFO = 0, the factor U or L from the Cholesky */
+/*          factorization A = U**T*U or A = L*L**T, in the same storage */
+/*          format as A. */
+
+/*  B       (input/output) DOUBLE PRECISION array, dimension (LDB,NRHS) */
+/*          On entry, the N-by-NRHS right hand side matrix B. */
+/*          On exit, if INFO = 0, the N-by-NRHS solution matrix X. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of the array B.  LDB >= max(1,N). */
+
+/*  IWORK   (workspace) INTEGER array, dimension ((N*(N+1)/2+31)/32) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+/*          > 0:  if INFO = i, the leading minor of order i of A is not */
+/*                positive definite, so the factorization could not be */
+/*                completed, and the solution has not been computed. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    /* Parameter adjustments */
+    --ap;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    --iwork;
+
+    /* Function Body */
+    *info = 0;
+    if (! lsame_(uplo, "U") && ! lsame_(uplo, "L")) {
+	*info = -1;
+    } else if (*n < 0) {
+	*info = -2;
+    } else if (*nrhs < 0) {
+	*info = -3;
+    } else if (*ldb < max(1,*n)) {
+	*info = -6;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DPPSVF", &i__1);
+	return 0;
+    }
+
+/*     Use the packed routines unless DPOTRF would use blocked code. */
+
+    nb = ilaenv_(&c__1, "DPOTRF", uplo, n, &c_n1, &c_n1, &c_n1);
+    if (nb <= 1 || nb >= *n) {
+	dppsv_(uplo, n, nrhs, &ap[1], &b[b_offset], ldb, info);
+	return 0;
+    }
+
+/*     Convert A to RFP format, solve, and convert the factor back. */
+
+    dtpttfi_("N", uplo, n, &ap[1], &iwork[1], &iinfo);
+    dpfsv_("N", uplo, n, nrhs, &ap[1], &b[b_offset], ldb, info);
+    dtfttpi_("N", uplo, n, &ap[1], &iwork[1], &iinfo);
+    return 0;
+
+/*     End of DPPSVF */
+
+} /* dppsvf_ */
@@ -0,0 +1,184 @@
+/* dtfttpi.c -- DTFTTPI, in-place RFP to standard packed conversion. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* TFMAP(P, Q) sets Q to the position in AP of the element that is */
+/* stored at position P of ARF (both counted from zero). */
+
+#define TFMAP(p, q) \
+	if (normaltransr) { \
+	    r__ = (p) % lda; \
+	    c__ = (p) / lda; \
+	} else { \
+	    r__ = (p) / nc; \
+	    c__ = (p) % nc; \
+	} \
+	if (lower) { \
+	    if (! nisodd) { \
+		--r__; \
+	    } \
+	    if (r__ < c__) { \
+		i__ = m + c__; \
+		j = m + 1 + r__; \
+	    } else { \
+		i__ = r__; \
+		j = c__; \
+	    } \
+	    (q) = i__ + j * ((*n << 1) - j - 1) / 2; \
+	} else { \
+	    if (r__ <= m + c__) { \
+		i__ = r__; \
+		j = m + c__; \
+	    } else { \
+		i__ = c__; \
+		j = r__ - m - 1; \
+	    } \
+	    (q) = i__ + j * (j + 1) / 2; \
+	}
+
+/* Subroutine */ int dtfttpi_(char *transr, char *uplo, integer *n, 
+	doublereal *a, integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    integer i__, j, k, m, p, q, s, c__, r__, nc, nt, lda;
+    doublereal temp, work;
+    logical normaltransr;
+    extern logical lsame_(char *, char *);
+    logical lower;
+    extern /* Subroutine */ int xerbla_(char *, integer *);
+    logical nisodd;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DTFTTPI converts a triangular matrix A from rectangular full packed */
+/*  format (TF) to standard packed format (TP) in place.  It is the */
+/*  inverse of DTPTTFI, and the result is the same as that of DTFTTP. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  TRANSR   (input) CHARACTER */
+/*          = 'N':  ARF is in Normal format; */
+/*          = 'T':  ARF is in Conjugate-transpose format. */
+
+/*  UPLO    (input) CHARACTER */
+/*          = 'U':  A is upper triangular; */
+/*          = 'L':  A is lower triangular. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension */
+/*          ( N*(N+1)/2 ) */
+/*          On entry, the upper or lower triangular matrix A stored in */
+/*          RFP format, as in DTPTTF. */
+/*          On exit, the same matrix packed columnwise, as in DTPTTF. */
+
+/*  IWORK   (workspace) INTEGER array, dimension ((N*(N+1)/2+31)/32) */
+/*          Used as a bit map of the positions already moved. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The cycles of the permutation are moved as in DTPTTFI, in the */
+/*  opposite direction. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    *info = 0;
+    normaltransr = lsame_(transr, "N");
+    lower = lsame_(uplo, "L");
+    if (! normaltransr && ! lsame_(transr, "T")) {
+	*info = -1;
+    } else if (! lower && ! lsame_(uplo, "U")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DTFTTPI", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n <= 1) {
+	return 0;
+    }
+
+/*     ARF is LDA-by-NC when TRANSR = 'N' and NC-by-LDA otherwise. */
+
+    nt = *n * (*n + 1) / 2;
+    m = *n / 2;
+    nisodd = *n % 2 == 1;
+    if (nisodd) {
+	lda = *n;
+    } else {
+	lda = *n + 1;
+    }
+    nc = (*n + 1) / 2;
+
+/*     AP(TFMAP(p)) := ARF(p), one cycle at a time. */
+
+    i__1 = (nt + 31) / 32;
+    for (k = 0; k < i__1; ++k) {
+	iwork[k] = 0;
+    }
+    for (s = 0; s < nt; ++s) {
+	if ((unsigned long) iwork[s / 32] >> s % 32 & 1) {
+	    continue;
+	}
+	TFMAP(s, q);
+	if (q == s) {
+	    continue;
+	}
+	temp = a[s];
+	p = s;
+	for (;;) {
+	    iwork[p / 32] = (integer) ((unsigned long) iwork[p / 32] | 1UL <<
+		    p % 32);
+	    TFMAP(p, q);
+	    work = a[q];
+	    a[q] = temp;
+	    temp = work;
+	    if (q == s) {
+		break;
+	    }
+	    p = q;
+	}
+/* L10: */
+    }
+
+    return 0;
+
+/*     End of DTFTTPI */
+
+} /* dtfttpi_ */
@@ -41,7 +41,7 @@ static integer c__0 = 0;
     integer i__, m;
     doublereal s[16]	/* was [4][4] */, t[16]	/* was [4][4] */, be[2], ai[2]
 	    , ar[2], sa, sb, li[16]	/* was [4][4] */, ir[16]	/* 
-	    was [4][4] */, ss, ws, eps;
+	    was [4][4] */, ss, eps;
     logical weak;
     doublereal ddum;
     integer idum;
@@ -58,7 +58,7 @@ static integer c__0 = 0;
 	    integer *, doublereal *, doublereal *, integer *);
     doublereal licop[16]	/* was [4][4] */;
     integer linfo;
-    doublereal ircop[16]	/* was [4][4] */, dnorm;
+    doublereal ircop[16]	/* was [4][4] */, dnorma, dnormb;
     integer iwork[4];
     extern /* Subroutine */ int dlagv2_(doublereal *, integer *, doublereal *, 
 	     integer *, doublereal *, doublereal *, doublereal *, doublereal *
@@ -87,7 +87,7 @@ static integer c__0 = 0;
 	     doublereal *, doublereal *, integer *), dlassq_(integer *
 , doublereal *, integer *, doublereal *, doublereal *);
     logical dtrong;
-    doublereal thresh, smlnum;
+    doublereal thresha, threshb, smlnum;
 
 
 /*  -- LAPACK auxiliary routine (version 3.2) -- */
@@ -276,7 +276,9 @@ static integer c__0 = 0;
     dlacpy_("Full", &m, &m, &a[*j1 + *j1 * a_dim1], lda, s, &c__4);
     dlacpy_("Full", &m, &m, &b[*j1 + *j1 * b_dim1], ldb, t, &c__4);
 
-/*     Compute threshold for testing acceptance of swapping. */
+/*     Compute thresholds for testing acceptance of swapping.  A and B */
+/*     are measured separately, so that for a badly scaled pencil the */
+/*     error allowed in the smaller of them is not set by the larger. */
 
     eps = dlamch_("P");
     smlnum = dlamch_("S") / eps;
@@ -285,13 +287,19 @@ static integer c__0 = 0;
     dlacpy_("Full", &m, &m, s, &c__4, &work[1], &m);
     i__1 = m * m;
     dlassq_(&i__1, &work[1], &c__1, &dscale, &dsum);
+    dnorma = dscale * sqrt(dsum);
+    dscale = 0.;
+    dsum = 1.;
     dlacpy_("Full", &m, &m, t, &c__4, &work[1], &m);
     i__1 = m * m;
     dlassq_(&i__1, &work[1], &c__1, &dscale, &dsum);
-    dnorm = dscale * sqrt(dsum);
+    dnormb = dscale * sqrt(dsum);
 /* Computing MAX */
-    d__1 = eps * 10. * dnorm;
-    thresh = max(d__1,smlnum);
+    d__1 = eps * 20. * dnorma;
+    thresha = max(d__1,smlnum);
+/* Computing MAX */
+    d__1 = eps * 20. * dnormb;
+    threshb = max(d__1,smlnum);
 
     if (m == 2) {
 
@@ -320,10 +328,9 @@ static integer c__0 = 0;
 	li[4] = -li[1];
 
 /*        Weak stability test: */
-/*           |S21| + |T21| <= O(EPS * F-norm((S, T))) */
+/*           |S21| <= O(EPS * F-norm(S)) and |T21| <= O(EPS * F-norm(T)) */
 
-	ws = abs(s[1]) + abs(t[1]);
-	weak = ws <= thresh;
+	weak = abs(s[1]) <= thresha && abs(t[1]) <= threshb;
 	if (! weak) {
 	    goto L70;
 	}
@@ -331,7 +338,8 @@ static integer c__0 = 0;
 	if (TRUE_) {
 
 /*           Strong stability test: */
-/*             F-norm((A-QL'*S*QR, B-QL'*T*QR)) <= O(EPS*F-norm((A,B))) */
+/*             F-norm(A-QL'*S*QR) <= O(EPS*F-norm(A)) and */
+/*             F-norm(B-QL'*T*QR) <= O(EPS*F-norm(B)) */
 
 	    dlacpy_("Full", &m, &m, &a[*j1 + *j1 * a_dim1], lda, &work[m * m 
 		    + 1], &m);
@@ -343,6 +351,11 @@ static integer c__0 = 0;
 	    dsum = 1.;
 	    i__1 = m * m;
 	    dlassq_(&i__1, &work[m * m + 1], &c__1, &dscale, &dsum);
+	    ss = dscale * sqrt(dsum);
+	    dtrong = ss <= thresha;
+	    if (! dtrong) {
+		goto L70;
+	    }
 
 	    dlacpy_("Full", &m, &m, &b[*j1 + *j1 * b_dim1], ldb, &work[m * m 
 		    + 1], &m);
@@ -350,10 +363,12 @@ static integer c__0 = 0;
 		    work[1], &m);
 	    dgemm_("N", "T", &m, &m, &m, &c_b48, &work[1], &m, ir, &c__4, &
 		    c_b42, &work[m * m + 1], &m);
+	    dscale = 0.;
+	    dsum = 1.;
 	    i__1 = m * m;
 	    dlassq_(&i__1, &work[m * m + 1], &c__1, &dscale, &dsum);
 	    ss = dscale * sqrt(dsum);
-	    dtrong = ss <= thresh;
+	    dtrong = ss <= threshb;
 	    if (! dtrong) {
 		goto L70;
 	    }
@@ -529,14 +544,14 @@ static integer c__0 = 0;
 
 /*        Decide which method to use. */
 /*          Weak stability test: */
-/*             F-norm(S21) <= O(EPS * F-norm((S, T))) */
+/*             F-norm(S21) <= O(EPS * F-norm(S)) */
 
-	if (bqra21 <= brqa21 && bqra21 <= thresh) {
+	if (bqra21 <= brqa21 && bqra21 <= thresha) {
 	    dlacpy_("F", &m, &m, scpy, &c__4, s, &c__4);
 	    dlacpy_("F", &m, &m, tcpy, &c__4, t, &c__4);
 	    dlacpy_("F", &m, &m, ircop, &c__4, ir, &c__4);
 	    dlacpy_("F", &m, &m, licop, &c__4, li, &c__4);
-	} else if (brqa21 >= thresh) {
+	} else if (brqa21 >= thresha) {
 	    goto L70;
 	}
 
@@ -549,7 +564,8 @@ static integer c__0 = 0;
 	if (TRUE_) {
 
 /*           Strong stability test: */
-/*              F-norm((A-QL*S*QR', B-QL*T*QR')) <= O(EPS*F-norm((A,B))) */
+/*              F-norm(A-QL*S*QR') <= O(EPS*F-norm(A)) and */
+/*              F-norm(B-QL*T*QR') <= O(EPS*F-norm(B)) */
 
 	    dlacpy_("Full", &m, &m, &a[*j1 + *j1 * a_dim1], lda, &work[m * m 
 		    + 1], &m);
@@ -561,6 +577,11 @@ static integer c__0 = 0;
 	    dsum = 1.;
 	    i__1 = m * m;
 	    dlassq_(&i__1, &work[m * m + 1], &c__1, &dscale, &dsum);
+	    ss = dscale * sqrt(dsum);
+	    dtrong = ss <= thresha;
+	    if (! dtrong) {
+		goto L70;
+	    }
 
 	    dlacpy_("Full", &m, &m, &b[*j1 + *j1 * b_dim1], ldb, &work[m * m 
 		    + 1], &m);
@@ -568,10 +589,12 @@ static integer c__0 = 0;
 		    work[1], &m);
 	    dgemm_("N", "N", &m, &m, &m, &c_b48, &work[1], &m, ir, &c__4, &
 		    c_b42, &work[m * m + 1], &m);
+	    dscale = 0.;
+	    dsum = 1.;
 	    i__1 = m * m;
 	    dlassq_(&i__1, &work[m * m + 1], &c__1, &dscale, &dsum);
 	    ss = dscale * sqrt(dsum);
-	    dtrong = ss <= thresh;
+	    dtrong = ss <= threshb;
 	    if (! dtrong) {
 		goto L70;
 	    }
@@ -0,0 +1,188 @@
+/* dtpttfi.c -- DTPTTFI, in-place standard packed to RFP conversion. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* TFMAP(P, Q) sets Q to the position in AP of the element that is */
+/* stored at position P of ARF (both counted from zero). */
+
+#define TFMAP(p, q) \
+	if (normaltransr) { \
+	    r__ = (p) % lda; \
+	    c__ = (p) / lda; \
+	} else { \
+	    r__ = (p) / nc; \
+	    c__ = (p) % nc; \
+	} \
+	if (lower) { \
+	    if (! nisodd) { \
+		--r__; \
+	    } \
+	    if (r__ < c__) { \
+		i__ = m + c__; \
+		j = m + 1 + r__; \
+	    } else { \
+		i__ = r__; \
+		j = c__; \
+	    } \
+	    (q) = i__ + j * ((*n << 1) - j - 1) / 2; \
+	} else { \
+	    if (r__ <= m + c__) { \
+		i__ = r__; \
+		j = m + c__; \
+	    } else { \
+		i__ = c__; \
+		j = r__ - m - 1; \
+	    } \
+	    (q) = i__ + j * (j + 1) / 2; \
+	}
+
+/* Subroutine */ int dtpttfi_(char *transr, char *uplo, integer *n, 
+	doublereal *a, integer *iwork, integer *info)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    integer i__, j, k, m, p, q, s, c__, r__, nc, nt, lda;
+    doublereal temp;
+    logical normaltransr;
+    extern logical lsame_(char *, char *);
+    logical lower;
+    extern /* Subroutine */ int xerbla_(char *, integer *);
+    logical nisodd;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. */
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DTPTTFI converts a triangular matrix A from standard packed format */
+/*  (TP) to rectangular full packed format (TF) in place.  The result is */
+/*  the same as that of DTPTTF, but no second array of N*(N+1)/2 */
+/*  elements is needed, so a symmetric matrix that only fits in memory */
+/*  in packed form can be factored by the Level 3 RFP routines. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  TRANSR   (input) CHARACTER */
+/*          = 'N':  ARF in Normal format is wanted; */
+/*          = 'T':  ARF in Conjugate-transpose format is wanted. */
+
+/*  UPLO    (input) CHARACTER */
+/*          = 'U':  A is upper triangular; */
+/*          = 'L':  A is lower triangular. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix A.  N >= 0. */
+
+/*  A       (input/output) DOUBLE PRECISION array, dimension */
+/*          ( N*(N+1)/2 ) */
+/*          On entry, the upper or lower triangular matrix A, packed */
+/*          columnwise as in DTPTTF. */
+/*          On exit, the same matrix stored in RFP format, as in DTPTTF. */
+
+/*  IWORK   (workspace) INTEGER array, dimension ((N*(N+1)/2+31)/32) */
+/*          Used as a bit map of the positions already moved. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0:  successful exit */
+/*          < 0:  if INFO = -i, the i-th argument had an illegal value */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The conversion is a permutation of the N*(N+1)/2 elements, which is */
+/*  applied one cycle at a time, each element being moved exactly once. */
+/*  The positions already moved are recorded in IWORK, one bit each, so */
+/*  the workspace is 1/64 of the storage of A on machines with 32-bit */
+/*  INTEGERs and 1/32 with 64-bit ones. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Test the input parameters. */
+
+    *info = 0;
+    normaltransr = lsame_(transr, "N");
+    lower = lsame_(uplo, "L");
+    if (! normaltransr && ! lsame_(transr, "T")) {
+	*info = -1;
+    } else if (! lower && ! lsame_(uplo, "U")) {
+	*info = -2;
+    } else if (*n < 0) {
+	*info = -3;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DTPTTFI", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    if (*n <= 1) {
+	return 0;
+    }
+
+/*     ARF is LDA-by-NC when TRANSR = 'N' and NC-by-LDA otherwise. */
+
+    nt = *n * (*n + 1) / 2;
+    m = *n / 2;
+    nisodd = *n % 2 == 1;
+    if (nisodd) {
+	lda = *n;
+    } else {
+	lda = *n + 1;
+    }
+    nc = (*n + 1) / 2;
+
+/*     ARF(p) := AP(TFMAP(p)), one cycle at a time. */
+
+    i__1 = (nt + 31) / 32;
+    for (k = 0; k < i__1; ++k) {
+	iwork[k] = 0;
+    }
+    for (s = 0; s < nt; ++s) {
+	if ((unsigned long) iwork[s / 32] >> s % 32 & 1) {
+	    continue;
+	}
+	TFMAP(s, q);
+	if (q == s) {
+	    continue;
+	}
+	temp = a[s];
+	p = s;
+	for (;;) {
+	    iwork[p / 32] = (integer) ((unsigned long) iwork[p / 32] | 1UL <<
+		    p % 32);
+	    TFMAP(p, q);
+	    if (q == s) {
+		break;
+	    }
+	    a[p] = a[q];
+	    p = q;
+	}
+	a[p] = temp;
+/* L10: */
+    }
+
+    return 0;
+
+/*     End of DTPTTFI */
+
+} /* dtpttfi_ */
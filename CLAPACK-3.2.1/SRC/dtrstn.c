@@ -0,0 +1,435 @@
+/* dtrstn.c -- DTRSTN, recursive triangular Stein equation solver. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__0 = 0;
+static integer c__4 = 4;
+static doublereal c_b10 = 0.;
+static doublereal c_b11 = 1.;
+static doublereal c_b12 = -1.;
+
+static int dtrstn_rec(char *, char *, integer *, integer *, doublereal *,
+	integer *, doublereal *, integer *, doublereal *, integer *,
+	doublereal *, doublereal *, integer *);
+
+/* Subroutine */ int dtrstn_(char *trana, char *tranb, integer *m, integer *
+	n, doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *c__, integer *ldc, doublereal *scale, doublereal *work,
+	integer *info)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    extern doublereal dlamch_(char *);
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int xerbla_(char *, integer *);
+    logical notrna, notrnb;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DTRSTN solves the real discrete-time Sylvester (Stein) matrix */
+/*  equation */
+
+/*     op(A)*X*op(B) - X = scale*C, */
+
+/*  where op(A) = A or A**T, and A and B are both upper quasi- */
+/*  triangular. A is M-by-M and B is N-by-N; the right hand side C and */
+/*  the solution X are M-by-N; and scale is an output scale factor, set */
+/*  <= 1 to avoid overflow in X.  The equation has a unique solution if */
+/*  and only if lambda*mu != 1 for all eigenvalues lambda of A and mu */
+/*  of B. */
+
+/*  The problem is solved recursively as in DTRSYLR: the larger of A and */
+/*  B is split in two (never through a 2-by-2 diagonal block) and the */
+/*  four subproblems are coupled through matrix-matrix products, down to */
+/*  pairs of diagonal blocks, which are solved as linear systems of order */
+/*  at most 4 by DGETC2 and DGESC2.  When the routine is compiled with */
+/*  OpenMP, the two independent off-diagonal subproblems of each level */
+/*  are solved as parallel tasks. */
+
+/*  A and B must be in Schur canonical form (as returned by DHSEQR), that */
+/*  is, block upper triangular with 1-by-1 and 2-by-2 diagonal blocks; */
+/*  each 2-by-2 diagonal block has its diagonal elements equal and its */
+/*  off-diagonal elements of opposite sign. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  TRANA   (input) CHARACTER*1 */
+/*          Specifies the option op(A): */
+/*          = 'N': op(A) = A    (No transpose) */
+/*          = 'T': op(A) = A**T (Transpose) */
+/*          = 'C': op(A) = A**H (Conjugate transpose = Transpose) */
+
+/*  TRANB   (input) CHARACTER*1 */
+/*          Specifies the option op(B): */
+/*          = 'N': op(B) = B    (No transpose) */
+/*          = 'T': op(B) = B**T (Transpose) */
+/*          = 'C': op(B) = B**H (Conjugate transpose = Transpose) */
+
+/*  M       (input) INTEGER */
+/*          The order of the matrix A, and the number of rows in the */
+/*          matrices X and C. M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix B, and the number of columns in the */
+/*          matrices X and C. N >= 0. */
+
+/*  A       (input) DOUBLE PRECISION array, dimension (LDA,M) */
+/*          The upper quasi-triangular matrix A, in Schur canonical form. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A. LDA >= max(1,M). */
+
+/*  B       (input) DOUBLE PRECISION array, dimension (LDB,N) */
+/*          The upper quasi-triangular matrix B, in Schur canonical form. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of the array B. LDB >= max(1,N). */
+
+/*  C       (input/output) DOUBLE PRECISION array, dimension (LDC,N) */
+/*          On entry, the M-by-N right hand side matrix C. */
+/*          On exit, C is overwritten by the solution matrix X. */
+
+/*  LDC     (input) INTEGER */
+/*          The leading dimension of the array C. LDC >= max(1,M) */
+
+/*  SCALE   (output) DOUBLE PRECISION */
+/*          The scale factor, scale, set <= 1 to avoid overflow in X. */
+
+/*  WORK    (workspace) DOUBLE PRECISION array, dimension (M*N) */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value */
+/*          = 1: A and B have eigenvalues lambda, mu with lambda*mu */
+/*               equal or very close to one; perturbed values were */
+/*               used to solve the equation (but the matrices A and B */
+/*               are unchanged). */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Decode and Test input parameters */
+
+    notrna = lsame_(trana, "N");
+    notrnb = lsame_(tranb, "N");
+
+    *info = 0;
+    if (! notrna && ! lsame_(trana, "T") && ! lsame_(
+	    trana, "C")) {
+	*info = -1;
+    } else if (! notrnb && ! lsame_(tranb, "T") && !
+	    lsame_(tranb, "C")) {
+	*info = -2;
+    } else if (*m < 0) {
+	*info = -3;
+    } else if (*n < 0) {
+	*info = -4;
+    } else if (*lda < max(1,*m)) {
+	*info = -6;
+    } else if (*ldb < max(1,*n)) {
+	*info = -8;
+    } else if (*ldc < max(1,*m)) {
+	*info = -10;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DTRSTN", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    *scale = 1.;
+    if (*m == 0 || *n == 0) {
+	return 0;
+    }
+
+/*     DLAMCH saves its values on the first call; make that call here */
+/*     rather than from concurrent subproblems */
+
+    dlamch_("P");
+
+#ifdef _OPENMP
+#pragma omp parallel if (*m > 64 || *n > 64)
+#pragma omp single
+#endif
+    dtrstn_rec(trana, tranb, m, n, &a[0], lda, &b[0], ldb, &c__[0], ldc,
+	    scale, &work[0], info);
+
+    return 0;
+
+/*     End of DTRSTN */
+
+} /* dtrstn_ */
+
+static int dtrstn_rec(char *trana, char *tranb, integer *m, integer *n,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb, doublereal *
+	c__, integer *ldc, doublereal *scale, doublereal *work, integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset, c_dim1, c_offset, i__1, i__2,
+	     i__3, i__4;
+    doublereal d__1;
+
+    /* Local variables */
+    integer i__, j, k, l, m1, m2, n1, n2, fa, oa, mf, mo, fb, ob, nf, no, ia,
+	     ib, ic, kz, ierr, ipiv[4], jpiv[4];
+    doublereal z__[16]	/* was [4][4] */, rhs[4], opa, opb, sa, sb, sc, smin;
+    logical notrna, notrnb;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dgesc2_(
+	    integer *, doublereal *, integer *, doublereal *, integer *,
+	    integer *, doublereal *), dgetc2_(integer *, doublereal *,
+	    integer *, integer *, integer *, integer *), dlascl_(char *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    integer *, doublereal *, integer *, integer *);
+
+
+/*     Recursive part of DTRSTN. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    c_dim1 = *ldc;
+    c_offset = 1 + c_dim1;
+    c__ -= c_offset;
+    --work;
+
+    /* Function Body */
+    *info = 0;
+    *scale = 1.;
+    notrna = lsame_(trana, "N");
+    notrnb = lsame_(tranb, "N");
+
+/*     Split A and B, keeping 2-by-2 diagonal blocks together */
+
+    m1 = *m;
+    if (*m > 1) {
+	m1 = *m / 2;
+	if (a[m1 + 1 + m1 * a_dim1] != 0.) {
+	    ++m1;
+	}
+    }
+    m2 = *m - m1;
+    n1 = *n;
+    if (*n > 1) {
+	n1 = *n / 2;
+	if (b[n1 + 1 + n1 * b_dim1] != 0.) {
+	    ++n1;
+	}
+    }
+    n2 = *n - n1;
+
+    if (m2 == 0 && n2 == 0) {
+
+/*        A and B are single diagonal blocks: solve the Kronecker */
+/*        system (op(B)**T kron op(A) - I) * vec(X) = scale*vec(C) */
+
+	kz = *m * *n;
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    i__2 = *m;
+	    for (i__ = 1; i__ <= i__2; ++i__) {
+		i__3 = *n;
+		for (l = 1; l <= i__3; ++l) {
+		    if (notrnb) {
+			opb = b[l + j * b_dim1];
+		    } else {
+			opb = b[j + l * b_dim1];
+		    }
+		    i__4 = *m;
+		    for (k = 1; k <= i__4; ++k) {
+			if (notrna) {
+			    opa = a[i__ + k * a_dim1];
+			} else {
+			    opa = a[k + i__ * a_dim1];
+			}
+			z__[(j - 1) * *m + i__ + ((l - 1) * *m + k << 2) - 5]
+				= opb * opa;
+/* L10: */
+		    }
+/* L20: */
+		}
+		z__[(j - 1) * *m + i__ + ((j - 1) * *m + i__ << 2) - 5] +=
+			-1.;
+		rhs[(j - 1) * *m + i__ - 1] = c__[i__ + j * c_dim1];
+/* L30: */
+	    }
+/* L40: */
+	}
+	dgetc2_(&kz, z__, &c__4, ipiv, jpiv, &ierr);
+	if (ierr > 0) {
+	    *info = 1;
+	}
+	dgesc2_(&kz, z__, &c__4, rhs, ipiv, jpiv, scale);
+	i__1 = *n;
+	for (j = 1; j <= i__1; ++j) {
+	    i__2 = *m;
+	    for (i__ = 1; i__ <= i__2; ++i__) {
+		c__[i__ + j * c_dim1] = rhs[(j - 1) * *m + i__ - 1];
+/* L50: */
+	    }
+/* L60: */
+	}
+	return 0;
+    }
+
+/*     The row block FA of X is solved before the other row block OA: */
+/*     the bottom one if op(A) = A, the top one if op(A) = A**T. */
+/*     Likewise the column block FB before OB: the left one if */
+/*     op(B) = B, the right one if op(B) = B**T. */
+
+    if (notrna && m2 > 0) {
+	fa = m1 + 1;
+	mf = m2;
+	oa = 1;
+	mo = m1;
+    } else {
+	fa = 1;
+	mf = m1;
+	oa = m1 + 1;
+	mo = m2;
+    }
+    if (notrnb || n2 == 0) {
+	fb = 1;
+	nf = n1;
+	ob = n1 + 1;
+	no = n2;
+    } else {
+	fb = n1 + 1;
+	nf = n2;
+	ob = 1;
+	no = n1;
+    }
+
+/*     Solve for X(FA,FB) */
+
+    dtrstn_rec(trana, tranb, &mf, &nf, &a[fa + fa * a_dim1], lda, &b[fb +
+	    fb * b_dim1], ldb, &c__[fa + fb * c_dim1], ldc, scale, &work[1],
+	    info);
+
+/*     C(OA,FB) := scale*C(OA,FB) - op(A)(OA,FA)*X(FA,FB)*op(B)(FB,FB) */
+/*     C(FA,OB) := scale*C(FA,OB) - op(A)(FA,FA)*X(FA,FB)*op(B)(FB,OB) */
+
+    if (mo > 0) {
+	dgemm_("N", tranb, &mf, &nf, &nf, &c_b11, &c__[fa + fb * c_dim1],
+		ldc, &b[fb + fb * b_dim1], ldb, &c_b10, &work[1], &mf);
+	dgemm_(trana, "N", &mo, &nf, &mf, &c_b12, &a[(m1 + 1) * a_dim1 + 1],
+		lda, &work[1], &mf, scale, &c__[oa + fb * c_dim1], ldc);
+    }
+    if (no > 0) {
+	dgemm_("N", tranb, &mf, &no, &nf, &c_b11, &c__[fa + fb * c_dim1],
+		ldc, &b[(n1 + 1) * b_dim1 + 1], ldb, &c_b10, &work[1], &mf);
+	dgemm_(trana, "N", &mf, &no, &mf, &c_b12, &a[fa + fa * a_dim1], lda,
+		&work[1], &mf, scale, &c__[fa + ob * c_dim1], ldc);
+    }
+
+/*     Solve for X(OA,FB) and X(FA,OB), which are independent of each */
+/*     other, using disjoint parts of WORK */
+
+    sa = 1.;
+    sb = 1.;
+    ia = 0;
+    ib = 0;
+#ifdef _OPENMP
+#pragma omp task shared(sa, ia) if (mo > 32 && nf > 32)
+#endif
+    if (mo > 0) {
+	dtrstn_rec(trana, tranb, &mo, &nf, &a[oa + oa * a_dim1], lda, &b[fb
+		+ fb * b_dim1], ldb, &c__[oa + fb * c_dim1], ldc, &sa, &work[
+		1], &ia);
+    }
+#ifdef _OPENMP
+#pragma omp task shared(sb, ib) if (mf > 32 && no > 32)
+#endif
+    if (no > 0) {
+	dtrstn_rec(trana, tranb, &mf, &no, &a[fa + fa * a_dim1], lda, &b[ob
+		+ ob * b_dim1], ldb, &c__[fa + ob * c_dim1], ldc, &sb, &work[
+		mo * nf + 1], &ib);
+    }
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+    *info = max(*info,ia);
+    *info = max(*info,ib);
+    smin = min(sa,sb);
+    if (sa != smin) {
+	d__1 = smin / sa;
+	dlascl_("G", &c__0, &c__0, &c_b11, &d__1, &mo, &nf, &c__[oa + fb *
+		c_dim1], ldc, &ierr);
+    }
+    if (sb != smin) {
+	d__1 = smin / sb;
+	dlascl_("G", &c__0, &c__0, &c_b11, &d__1, &mf, &no, &c__[fa + ob *
+		c_dim1], ldc, &ierr);
+    }
+    if (smin != 1.) {
+	dlascl_("G", &c__0, &c__0, &c_b11, &smin, &mf, &nf, &c__[fa + fb *
+		c_dim1], ldc, &ierr);
+	*scale *= smin;
+    }
+
+/*     C(OA,OB) := scale*C(OA,OB) */
+/*                 - op(A)(OA,FA)*( X(FA,FB)*op(B)(FB,OB) */
+/*                                + X(FA,OB)*op(B)(OB,OB) ) */
+/*                 - op(A)(OA,OA)*X(OA,FB)*op(B)(FB,OB) */
+/*     and solve for X(OA,OB) */
+
+    if (mo > 0 && no > 0) {
+	dgemm_("N", tranb, &mf, &no, &nf, &c_b11, &c__[fa + fb * c_dim1],
+		ldc, &b[(n1 + 1) * b_dim1 + 1], ldb, &c_b10, &work[1], &mf);
+	dgemm_("N", tranb, &mf, &no, &no, &c_b11, &c__[fa + ob * c_dim1],
+		ldc, &b[ob + ob * b_dim1], ldb, &c_b11, &work[1], &mf);
+	dgemm_(trana, "N", &mo, &no, &mf, &c_b12, &a[(m1 + 1) * a_dim1 + 1],
+		lda, &work[1], &mf, scale, &c__[oa + ob * c_dim1], ldc);
+	dgemm_("N", tranb, &mo, &no, &nf, &c_b11, &c__[oa + fb * c_dim1],
+		ldc, &b[(n1 + 1) * b_dim1 + 1], ldb, &c_b10, &work[1], &mo);
+	dgemm_(trana, "N", &mo, &no, &mo, &c_b12, &a[oa + oa * a_dim1], lda,
+		&work[1], &mo, &c_b11, &c__[oa + ob * c_dim1], ldc);
+	dtrstn_rec(trana, tranb, &mo, &no, &a[oa + oa * a_dim1], lda, &b[ob
+		+ ob * b_dim1], ldb, &c__[oa + ob * c_dim1], ldc, &sc, &work[
+		1], &ic);
+	*info = max(*info,ic);
+	if (sc != 1.) {
+	    dlascl_("G", &c__0, &c__0, &c_b11, &sc, &mf, &nf, &c__[fa + fb *
+		    c_dim1], ldc, &ierr);
+	    dlascl_("G", &c__0, &c__0, &c_b11, &sc, &mo, &nf, &c__[oa + fb *
+		    c_dim1], ldc, &ierr);
+	    dlascl_("G", &c__0, &c__0, &c_b11, &sc, &mf, &no, &c__[fa + ob *
+		    c_dim1], ldc, &ierr);
+	    *scale *= sc;
+	}
+    }
+
+    return 0;
+} /* dtrstn_rec */
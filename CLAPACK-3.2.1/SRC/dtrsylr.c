@@ -0,0 +1,385 @@
+/* dtrsylr.c -- DTRSYLR, recursive triangular Sylvester equation solver. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__0 = 0;
+static integer c__1 = 1;
+static integer c_n1 = -1;
+static doublereal c_b11 = 1.;
+static doublereal c_b12 = -1.;
+
+static int dtrsylr_rec(char *, char *, integer *, integer *, integer *,
+	doublereal *, integer *, doublereal *, integer *, doublereal *,
+	integer *, integer *, doublereal *, integer *);
+
+/* Subroutine */ int dtrsylr_(char *trana, char *tranb, integer *isgn,
+	integer *m, integer *n, doublereal *a, integer *lda, doublereal *b,
+	integer *ldb, doublereal *c__, integer *ldc, doublereal *scale,
+	integer *info)
+{
+    /* System generated locals */
+    integer i__1;
+
+    /* Local variables */
+    integer nb;
+    extern doublereal dlamch_(char *);
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int xerbla_(char *, integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	    integer *, integer *);
+    logical notrna, notrnb;
+
+
+/*  -- LAPACK routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+/*     .. Array Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DTRSYLR solves the real Sylvester matrix equation: */
+
+/*     op(A)*X + X*op(B) = scale*C or */
+/*     op(A)*X - X*op(B) = scale*C, */
+
+/*  where op(A) = A or A**T, and  A and B are both upper quasi- */
+/*  triangular. A is M-by-M and B is N-by-N; the right hand side C and */
+/*  the solution X are M-by-N; and scale is an output scale factor, set */
+/*  <= 1 to avoid overflow in X. */
+
+/*  DTRSYLR has the same interface as DTRSYL.  It is a recursive */
+/*  blocked variant: the larger of A and B is split in two (never */
+/*  through a 2-by-2 diagonal block), giving four subproblems that are */
+/*  coupled through matrix-matrix products.  Subproblems of order at */
+/*  most NB = ILAENV( 1, 'DTRSYL', ... ) in both dimensions are solved */
+/*  by DTRSYL, so almost all of the work is done in DGEMM.  When the */
+/*  routine is compiled with OpenMP, the two off-diagonal subproblems of */
+/*  each level, which are independent, are solved as parallel tasks. */
+
+/*  A and B must be in Schur canonical form (as returned by DHSEQR), that */
+/*  is, block upper triangular with 1-by-1 and 2-by-2 diagonal blocks; */
+/*  each 2-by-2 diagonal block has its diagonal elements equal and its */
+/*  off-diagonal elements of opposite sign. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  TRANA   (input) CHARACTER*1 */
+/*          Specifies the option op(A): */
+/*          = 'N': op(A) = A    (No transpose) */
+/*          = 'T': op(A) = A**T (Transpose) */
+/*          = 'C': op(A) = A**H (Conjugate transpose = Transpose) */
+
+/*  TRANB   (input) CHARACTER*1 */
+/*          Specifies the option op(B): */
+/*          = 'N': op(B) = B    (No transpose) */
+/*          = 'T': op(B) = B**T (Transpose) */
+/*          = 'C': op(B) = B**H (Conjugate transpose = Transpose) */
+
+/*  ISGN    (input) INTEGER */
+/*          Specifies the sign in the equation: */
+/*          = +1: solve op(A)*X + X*op(B) = scale*C */
+/*          = -1: solve op(A)*X - X*op(B) = scale*C */
+
+/*  M       (input) INTEGER */
+/*          The order of the matrix A, and the number of rows in the */
+/*          matrices X and C. M >= 0. */
+
+/*  N       (input) INTEGER */
+/*          The order of the matrix B, and the number of columns in the */
+/*          matrices X and C. N >= 0. */
+
+/*  A       (input) DOUBLE PRECISION array, dimension (LDA,M) */
+/*          The upper quasi-triangular matrix A, in Schur canonical form. */
+
+/*  LDA     (input) INTEGER */
+/*          The leading dimension of the array A. LDA >= max(1,M). */
+
+/*  B       (input) DOUBLE PRECISION array, dimension (LDB,N) */
+/*          The upper quasi-triangular matrix B, in Schur canonical form. */
+
+/*  LDB     (input) INTEGER */
+/*          The leading dimension of the array B. LDB >= max(1,N). */
+
+/*  C       (input/output) DOUBLE PRECISION array, dimension (LDC,N) */
+/*          On entry, the M-by-N right hand side matrix C. */
+/*          On exit, C is overwritten by the solution matrix X. */
+
+/*  LDC     (input) INTEGER */
+/*          The leading dimension of the array C. LDC >= max(1,M) */
+
+/*  SCALE   (output) DOUBLE PRECISION */
+/*          The scale factor, scale, set <= 1 to avoid overflow in X. */
+
+/*  INFO    (output) INTEGER */
+/*          = 0: successful exit */
+/*          < 0: if INFO = -i, the i-th argument had an illegal value */
+/*          = 1: A and B have common or very close eigenvalues; perturbed */
+/*               values were used to solve the equation (but the matrices */
+/*               A and B are unchanged). */
+
+/*  Further Details */
+/*  =============== */
+
+/*  The scale factors returned by the subproblems are combined as in */
+/*  RECSY (I. Jonsson and B. Kagstrom, ACM TOMS 28, 2002): the blocks of */
+/*  X already computed are rescaled whenever a later subproblem returns */
+/*  a scale factor less than one, so the result is equivalent to DTRSYL */
+/*  up to rounding. */
+
+/*  ===================================================================== */
+
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+/*     Decode and Test input parameters */
+
+    notrna = lsame_(trana, "N");
+    notrnb = lsame_(tranb, "N");
+
+    *info = 0;
+    if (! notrna && ! lsame_(trana, "T") && ! lsame_(
+	    trana, "C")) {
+	*info = -1;
+    } else if (! notrnb && ! lsame_(tranb, "T") && !
+	    lsame_(tranb, "C")) {
+	*info = -2;
+    } else if (*isgn != 1 && *isgn != -1) {
+	*info = -3;
+    } else if (*m < 0) {
+	*info = -4;
+    } else if (*n < 0) {
+	*info = -5;
+    } else if (*lda < max(1,*m)) {
+	*info = -7;
+    } else if (*ldb < max(1,*n)) {
+	*info = -9;
+    } else if (*ldc < max(1,*m)) {
+	*info = -11;
+    }
+    if (*info != 0) {
+	i__1 = -(*info);
+	xerbla_("DTRSYLR", &i__1);
+	return 0;
+    }
+
+/*     Quick return if possible */
+
+    *scale = 1.;
+    if (*m == 0 || *n == 0) {
+	return 0;
+    }
+
+    nb = ilaenv_(&c__1, "DTRSYL", " ", m, n, &c_n1, &c_n1);
+    nb = max(nb,2);
+
+/*     DLAMCH saves its values on the first call; make that call here */
+/*     rather than from concurrent subproblems */
+
+    dlamch_("P");
+
+#ifdef _OPENMP
+#pragma omp parallel if (*m > nb << 1 || *n > nb << 1)
+#pragma omp single
+#endif
+    dtrsylr_rec(trana, tranb, isgn, m, n, &a[0], lda, &b[0], ldb, &c__[0],
+	    ldc, &nb, scale, info);
+
+    return 0;
+
+/*     End of DTRSYLR */
+
+} /* dtrsylr_ */
+
+static int dtrsylr_rec(char *trana, char *tranb, integer *isgn, integer *m,
+	integer *n, doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *c__, integer *ldc, integer *nb, doublereal *scale,
+	integer *info)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset, b_dim1, b_offset, c_dim1, c_offset;
+    doublereal d__1;
+
+    /* Local variables */
+    integer m1, m2, n1, n2, fa, oa, mf, mo, fb, ob, nf, no, ia, ib, ic, ierr;
+    doublereal sa, sb, sc, sgn, smin;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *), dtrsyl_(char *,
+	     char *, integer *, integer *, integer *, doublereal *, integer *,
+	     doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *), dlascl_(char *, integer *, integer *, doublereal *,
+	    doublereal *, integer *, integer *, doublereal *, integer *,
+	    integer *);
+
+
+/*     Recursive part of DTRSYLR. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+    b_dim1 = *ldb;
+    b_offset = 1 + b_dim1;
+    b -= b_offset;
+    c_dim1 = *ldc;
+    c_offset = 1 + c_dim1;
+    c__ -= c_offset;
+
+    /* Function Body */
+    *info = 0;
+    if (*m <= *nb && *n <= *nb) {
+	dtrsyl_(trana, tranb, isgn, m, n, &a[a_offset], lda, &b[b_offset],
+		ldb, &c__[c_offset], ldc, scale, info);
+	return 0;
+    }
+
+/*     Split A and B, keeping 2-by-2 diagonal blocks together */
+
+    m1 = *m;
+    if (*m > *nb) {
+	m1 = *m / 2;
+	if (a[m1 + 1 + m1 * a_dim1] != 0.) {
+	    ++m1;
+	}
+    }
+    m2 = *m - m1;
+    n1 = *n;
+    if (*n > *nb) {
+	n1 = *n / 2;
+	if (b[n1 + 1 + n1 * b_dim1] != 0.) {
+	    ++n1;
+	}
+    }
+    n2 = *n - n1;
+
+/*     The row block FA of X is solved before the other row block OA: */
+/*     the bottom one if op(A) = A, the top one if op(A) = A**T. */
+/*     Likewise the column block FB before OB: the left one if */
+/*     op(B) = B, the right one if op(B) = B**T. */
+
+    if (lsame_(trana, "N") && m2 > 0) {
+	fa = m1 + 1;
+	mf = m2;
+	oa = 1;
+	mo = m1;
+    } else {
+	fa = 1;
+	mf = m1;
+	oa = m1 + 1;
+	mo = m2;
+    }
+    if (lsame_(tranb, "N") || n2 == 0) {
+	fb = 1;
+	nf = n1;
+	ob = n1 + 1;
+	no = n2;
+    } else {
+	fb = n1 + 1;
+	nf = n2;
+	ob = 1;
+	no = n1;
+    }
+    sgn = (doublereal) (-(*isgn));
+
+/*     Solve for X(FA,FB) */
+
+    dtrsylr_rec(trana, tranb, isgn, &mf, &nf, &a[fa + fa * a_dim1], lda, &b[
+	    fb + fb * b_dim1], ldb, &c__[fa + fb * c_dim1], ldc, nb, scale,
+	    info);
+
+/*     Update C(OA,FB) and C(FA,OB) and solve for X(OA,FB) and X(FA,OB), */
+/*     which are independent of each other */
+
+    sa = 1.;
+    sb = 1.;
+    ia = 0;
+    ib = 0;
+    if (mo > 0) {
+	dgemm_(trana, "N", &mo, &nf, &mf, &c_b12, &a[(m1 + 1) * a_dim1 + 1],
+		lda, &c__[fa + fb * c_dim1], ldc, scale, &c__[oa + fb *
+		c_dim1], ldc);
+    }
+    if (no > 0) {
+	dgemm_("N", tranb, &mf, &no, &nf, &sgn, &c__[fa + fb * c_dim1], ldc,
+		&b[(n1 + 1) * b_dim1 + 1], ldb, scale, &c__[fa + ob * c_dim1],
+		 ldc);
+    }
+#ifdef _OPENMP
+#pragma omp task shared(sa, ia) if (mo > *nb && nf > *nb)
+#endif
+    if (mo > 0) {
+	dtrsylr_rec(trana, tranb, isgn, &mo, &nf, &a[oa + oa * a_dim1], lda,
+		&b[fb + fb * b_dim1], ldb, &c__[oa + fb * c_dim1], ldc, nb, &
+		sa, &ia);
+    }
+#ifdef _OPENMP
+#pragma omp task shared(sb, ib) if (mf > *nb && no > *nb)
+#endif
+    if (no > 0) {
+	dtrsylr_rec(trana, tranb, isgn, &mf, &no, &a[fa + fa * a_dim1], lda,
+		&b[ob + ob * b_dim1], ldb, &c__[fa + ob * c_dim1], ldc, nb, &
+		sb, &ib);
+    }
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+    *info = max(*info,ia);
+    *info = max(*info,ib);
+    smin = min(sa,sb);
+    if (sa != smin) {
+	d__1 = smin / sa;
+	dlascl_("G", &c__0, &c__0, &c_b11, &d__1, &mo, &nf, &c__[oa + fb *
+		c_dim1], ldc, &ierr);
+    }
+    if (sb != smin) {
+	d__1 = smin / sb;
+	dlascl_("G", &c__0, &c__0, &c_b11, &d__1, &mf, &no, &c__[fa + ob *
+		c_dim1], ldc, &ierr);
+    }
+    if (smin != 1.) {
+	dlascl_("G", &c__0, &c__0, &c_b11, &smin, &mf, &nf, &c__[fa + fb *
+		c_dim1], ldc, &ierr);
+	*scale *= smin;
+    }
+
+/*     Update C(OA,OB) and solve for X(OA,OB) */
+
+    if (mo > 0 && no > 0) {
+	dgemm_(trana, "N", &mo, &no, &mf, &c_b12, &a[(m1 + 1) * a_dim1 + 1],
+		lda, &c__[fa + ob * c_dim1], ldc, scale, &c__[oa + ob *
+		c_dim1], ldc);
+	dgemm_("N", tranb, &mo, &no, &nf, &sgn, &c__[oa + fb * c_dim1], ldc,
+		&b[(n1 + 1) * b_dim1 + 1], ldb, &c_b11, &c__[oa + ob * c_dim1]
+, ldc);
+	dtrsylr_rec(trana, tranb, isgn, &mo, &no, &a[oa + oa * a_dim1], lda,
+		&b[ob + ob * b_dim1], ldb, &c__[oa + ob * c_dim1], ldc, nb, &
+		sc, &ic);
+	*info = max(*info,ic);
+	if (sc != 1.) {
+	    dlascl_("G", &c__0, &c__0, &c_b11, &sc, &mf, &nf, &c__[fa + fb *
+		    c_dim1], ldc, &ierr);
+	    dlascl_("G", &c__0, &c__0, &c_b11, &sc, &mo, &nf, &c__[oa + fb *
+		    c_dim1], ldc, &ierr);
+	    dlascl_("G", &c__0, &c__0, &c_b11, &sc, &mf, &no, &c__[fa + ob *
+		    c_dim1], ldc, &ierr);
+	    *scale *= sc;
+	}
+    }
+
+    return 0;
+} /* dtrsylr_rec */
@@ -21,25 +21,23 @@ static integer c__2 = 2;
 static doublereal c_b18 = 1.;
 static doublereal c_b22 = -1.;
 
+static int dtrtri_rec(char *, char *, integer *, doublereal *, integer *,
+	integer *);
+
 /* Subroutine */ int dtrtri_(char *uplo, char *diag, integer *n, doublereal *
 	a, integer *lda, integer *info)
 {
     /* System generated locals */
     address a__1[2];
-    integer a_dim1, a_offset, i__1, i__2[2], i__3, i__4, i__5;
+    integer a_dim1, a_offset, i__1, i__2[2];
     char ch__1[2];
 
     /* Builtin functions */
     /* Subroutine */ int s_cat(char *, char **, integer *, integer *, ftnlen);
 
     /* Local variables */
-    integer j, jb, nb, nn;
+    integer nb;
     extern logical lsame_(char *, char *);
-    extern /* Subroutine */ int dtrmm_(char *, char *, char *, char *, 
-	    integer *, integer *, doublereal *, doublereal *, integer *, 
-	    doublereal *, integer *), dtrsm_(
-	    char *, char *, char *, char *, integer *, integer *, doublereal *
-, doublereal *, integer *, doublereal *, integer *);
     logical upper;
     extern /* Subroutine */ int dtrti2_(char *, char *, integer *, doublereal 
 	    *, integer *, integer *), xerbla_(char *, integer 
@@ -64,7 +62,10 @@ static doublereal c_b22 = -1.;
 /*  DTRTRI computes the inverse of a real upper or lower triangular */
 /*  matrix A. */
 
-/*  This is the Level 3 BLAS version of the algorithm. */
+/*  This is the Level 3 BLAS version of the algorithm.  A is split in */
+/*  halves recursively, so that almost all of the work is done by DTRMM */
+/*  and DTRSM on blocks of order N/2, N/4, ...; blocks of order at most */
+/*  NB are inverted by DTRTI2. */
 
 /*  Arguments */
 /*  ========= */
@@ -175,68 +176,72 @@ static doublereal c_b22 = -1.;
 	dtrti2_(uplo, diag, n, &a[a_offset], lda, info);
     } else {
 
-/*        Use blocked code */
+/*        Use recursive code */
 
-	if (upper) {
+	dtrtri_rec(uplo, diag, n, &a[a_offset], lda, &nb);
+    }
 
-/*           Compute inverse of upper triangular matrix */
+    return 0;
 
-	    i__1 = *n;
-	    i__3 = nb;
-	    for (j = 1; i__3 < 0 ? j >= i__1 : j <= i__1; j += i__3) {
-/* Computing MIN */
-		i__4 = nb, i__5 = *n - j + 1;
-		jb = min(i__4,i__5);
+/*     End of DTRTRI */
 
-/*              Compute rows 1:j-1 of current block column */
+} /* dtrtri_ */
 
-		i__4 = j - 1;
-		dtrmm_("Left", "Upper", "No transpose", diag, &i__4, &jb, &
-			c_b18, &a[a_offset], lda, &a[j * a_dim1 + 1], lda);
-		i__4 = j - 1;
-		dtrsm_("Right", "Upper", "No transpose", diag, &i__4, &jb, &
-			c_b22, &a[j + j * a_dim1], lda, &a[j * a_dim1 + 1], 
-			lda);
+static int dtrtri_rec(char *uplo, char *diag, integer *n, doublereal *a,
+	integer *lda, integer *nb)
+{
+    /* System generated locals */
+    integer a_dim1, a_offset;
 
-/*              Compute inverse of current diagonal block */
+    /* Local variables */
+    integer n1, n2, info;
+    extern logical lsame_(char *, char *);
+    extern /* Subroutine */ int dtrmm_(char *, char *, char *, char *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *), dtrsm_(char *, char *, char *, char *,
+	    integer *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *), dtrti2_(char *, char *, integer *,
+	    doublereal *, integer *, integer *);
 
-		dtrti2_("Upper", diag, &jb, &a[j + j * a_dim1], lda, info);
-/* L20: */
-	    }
-	} else {
-
-/*           Compute inverse of lower triangular matrix */
-
-	    nn = (*n - 1) / nb * nb + 1;
-	    i__3 = -nb;
-	    for (j = nn; i__3 < 0 ? j >= 1 : j <= 1; j += i__3) {
-/* Computing MIN */
-		i__1 = nb, i__4 = *n - j + 1;
-		jb = min(i__1,i__4);
-		if (j + jb <= *n) {
-
-/*                 Compute rows j+jb:n of current block column */
-
-		    i__1 = *n - j - jb + 1;
-		    dtrmm_("Left", "Lower", "No transpose", diag, &i__1, &jb, 
-			    &c_b18, &a[j + jb + (j + jb) * a_dim1], lda, &a[j 
-			    + jb + j * a_dim1], lda);
-		    i__1 = *n - j - jb + 1;
-		    dtrsm_("Right", "Lower", "No transpose", diag, &i__1, &jb, 
-			     &c_b22, &a[j + j * a_dim1], lda, &a[j + jb + j * 
-			    a_dim1], lda);
-		}
-
-/*              Compute inverse of current diagonal block */
-
-		dtrti2_("Lower", diag, &jb, &a[j + j * a_dim1], lda, info);
-/* L30: */
-	    }
-	}
+
+/*     Recursive part of DTRTRI. */
+
+    /* Parameter adjustments */
+    a_dim1 = *lda;
+    a_offset = 1 + a_dim1;
+    a -= a_offset;
+
+    /* Function Body */
+    if (*n <= *nb) {
+	dtrti2_(uplo, diag, n, &a[a_offset], lda, &info);
+	return 0;
     }
+    n1 = *n / 2;
+    n2 = *n - n1;
 
-    return 0;
+    if (lsame_(uplo, "U")) {
 
-/*     End of DTRTRI */
+/*        Invert A11, form A12 := -inv(A11)*A12*inv(A22) using the */
+/*        original A22, then invert A22 */
 
-} /* dtrtri_ */
+	dtrtri_rec(uplo, diag, &n1, &a[a_offset], lda, nb);
+	dtrmm_("Left", "Upper", "No transpose", diag, &n1, &n2, &c_b18, &a[
+		a_offset], lda, &a[(n1 + 1) * a_dim1 + 1], lda);
+	dtrsm_("Right", "Upper", "No transpose", diag, &n1, &n2, &c_b22, &a[
+		n1 + 1 + (n1 + 1) * a_dim1], lda, &a[(n1 + 1) * a_dim1 + 1],
+		lda);
+	dtrtri_rec(uplo, diag, &n2, &a[n1 + 1 + (n1 + 1) * a_dim1], lda, nb);
+    } else {
+
+/*        Invert A22, form A21 := -inv(A22)*A21*inv(A11) using the */
+/*        original A11, then invert A11 */
+
+	dtrtri_rec(uplo, diag, &n2, &a[n1 + 1 + (n1 + 1) * a_dim1], lda, nb);
+	dtrmm_("Left", "Lower", "No transpose", diag, &n2, &n1, &c_b18, &a[
+		n1 + 1 + (n1 + 1) * a_dim1], lda, &a[n1 + 1 + a_dim1], lda);
+	dtrsm_("Right", "Lower", "No transpose", diag, &n2, &n1, &c_b22, &a[
+		a_offset], lda, &a[n1 + 1 + a_dim1], lda);
+	dtrtri_rec(uplo, diag, &n1, &a[a_offset], lda, nb);
+    }
+    return 0;
+} /* dtrtri_rec */
@@ -0,0 +1,152 @@
+/* latime.c -- timing entries and report for the latime_ wrappers.
+
+   See INCLUDE/latime.h.  The wrappers themselves are in dlatime.c
+   (double precision) and zlatime.c (double complex).  Times come from
+   clock_gettime(LATIME_CLOCK), CLOCK_MONOTONIC by default; compile with
+   -DLATIME_CLOCK=CLOCK_THREAD_CPUTIME_ID to charge each call with the
+   CPU time of the calling thread instead.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "f2c.h"
+#include "latime.h"
+
+#ifndef LATIME_CLOCK
+#ifdef CLOCK_MONOTONIC
+#define LATIME_CLOCK CLOCK_MONOTONIC
+#endif
+#endif
+
+extern logical lsame_(char *, char *);
+
+static latime_ent *latime_first;
+static int latime_exit = 1, latime_registered;
+
+/* Seconds since an arbitrary origin, to nanoseconds where possible. */
+
+doublereal
+latime_now(void)
+{
+#ifdef LATIME_CLOCK
+	struct timespec ts;
+
+	if (clock_gettime(LATIME_CLOCK, &ts) == 0)
+		return (doublereal)ts.tv_sec + 1e-9 * (doublereal)ts.tv_nsec;
+#endif
+	return (doublereal)clock() / CLOCKS_PER_SEC;
+}
+
+static void
+latime_atexit_report(void)
+{
+	if (latime_exit)
+		latime_report(stderr);
+}
+
+/* Charge a call that started at time t0 and did flops operations
+   to entry e. */
+
+void
+latime_end(latime_ent *e, doublereal t0, doublereal flops)
+{
+	doublereal t = latime_now();
+
+	if (!e->listed) {
+		e->listed = 1;
+		e->next = latime_first;
+		latime_first = e;
+		if (!latime_registered) {
+			latime_registered = 1;
+			atexit(latime_atexit_report);
+		}
+	}
+	++e->calls;
+	e->secs += t - t0;
+	e->flops += flops;
+}
+
+static int
+latime_cmp(const void *a, const void *b)
+{
+	doublereal sa = (*(latime_ent **)a)->secs;
+	doublereal sb = (*(latime_ent **)b)->secs;
+
+	return sa < sb ? 1 : sa > sb ? -1 : 0;
+}
+
+void
+latime_report(FILE *f)
+{
+	latime_ent *e, **v;
+	doublereal tot = 0.;
+	long calls = 0;
+	int i, n = 0;
+
+	for (e = latime_first; e; e = e->next)
+		if (e->calls)
+			++n;
+	if (!n)
+		return;
+	if (!(v = (latime_ent **)malloc(n * sizeof(latime_ent *))))
+		return;
+	n = 0;
+	for (e = latime_first; e; e = e->next)
+		if (e->calls)
+			v[n++] = e;
+	qsort(v, n, sizeof(latime_ent *), latime_cmp);
+	fprintf(f, "\nTime in LAPACK and BLAS calls:\n");
+	fprintf(f, "%-10s %10s %12s %12s %10s %9s\n", "Routine",
+		"Calls", "Seconds", "Avg seconds", "Gflops", "Gflop/s");
+	for (i = 0; i < n; i++) {
+		e = v[i];
+		fprintf(f, "%-10s %10ld %12.6f %12.6g", e->name, e->calls,
+			e->secs, e->secs / e->calls);
+		if (e->flops > 0.)
+			fprintf(f, " %10.4g %9.3f\n", 1e-9 * e->flops,
+				e->secs > 0. ? 1e-9 * e->flops / e->secs : 0.);
+		else
+			fprintf(f, " %10s %9s\n", "-", "-");
+		tot += e->secs;
+		calls += e->calls;
+	}
+	fprintf(f, "%-10s %10ld %12.6f\n", "Total", calls, tot);
+	free(v);
+}
+
+void
+latime_reset(void)
+{
+	latime_ent *e;
+
+	for (e = latime_first; e; e = e->next) {
+		e->calls = 0;
+		e->secs = e->flops = 0.;
+	}
+}
+
+/* Whether to print the report on stderr at exit (the default). */
+
+void
+latime_atexit(int on)
+{
+	latime_exit = on;
+}
+
+/* Operation counts shared by dlatime.c and zlatime.c */
+
+doublereal
+latime_lu(integer m, integer n)
+{
+	doublereal p = (doublereal)min(m,n);
+
+	return 2. * m * n * p - (m + n) * p * p + 2. * p * p * p / 3;
+}
+
+doublereal
+latime_tr(char *side, integer m, integer n)
+{
+	return lsame_(side, "L") ? (doublereal)m * m * n
+		: (doublereal)m * n * n;
+}
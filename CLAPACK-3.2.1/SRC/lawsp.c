@@ -0,0 +1,327 @@
+/* lawsp.c -- reusable workspace pools for the LAPACK drivers.
+
+   See INCLUDE/lawsp.h.  Each lawsp_ driver entry point looks up the
+   optimal workspace for its (routine, job, m, n, k) shape in the pool,
+   performs the driver's LWORK = -1 query only on a miss, draws WORK
+   (and IWORK) from the pool and calls the driver.  Owned arrays come
+   from F77_malloc, so F77_set_aloc (f2c_alloc.h) governs them too.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "f2c.h"
+#include "f2c_alloc.h"
+#include "blaswrap.h"
+#include "lawsp.h"
+
+/* Table of constant values */
+
+static integer c_n1 = -1;
+static integer c__0 = 0;
+static integer c__9 = 9;
+static integer c__12 = 12;
+static integer c__13 = 13;
+static integer c__18 = 18;
+static integer c__20 = 20;
+
+extern /* Subroutine */ int xerbla_(char *, integer *);
+extern integer ilaenv_(integer *, char *, char *, integer *, integer *,
+	integer *, integer *);
+extern /* Subroutine */ int dgeev_(char *, char *, integer *, doublereal *,
+	integer *, doublereal *, doublereal *, doublereal *, integer *,
+	doublereal *, integer *, doublereal *, integer *, integer *);
+extern /* Subroutine */ int dgesdd_(char *, integer *, integer *,
+	doublereal *, integer *, doublereal *, doublereal *, integer *,
+	doublereal *, integer *, doublereal *, integer *, integer *,
+	integer *);
+extern /* Subroutine */ int dsyevr_(char *, char *, char *, integer *,
+	doublereal *, integer *, doublereal *, doublereal *, integer *,
+	integer *, doublereal *, integer *, doublereal *, doublereal *,
+	integer *, integer *, doublereal *, integer *, integer *, integer *,
+	integer *);
+extern /* Subroutine */ int dgelsd_(integer *, integer *, integer *,
+	doublereal *, integer *, doublereal *, integer *, doublereal *,
+	doublereal *, integer *, doublereal *, integer *, integer *,
+	integer *);
+
+/* Copy at most len-1 characters of s to d, upper-cased and padded. */
+
+static void
+lawsp_key(char *d, char *s, int len)
+{
+	int i;
+
+	for (i = 0; i < len - 1 && s[i]; i++)
+		d[i] = (s[i] >= 'a' && s[i] <= 'z') ? s[i] - 'a' + 'A' : s[i];
+	for (; i < len; i++)
+		d[i] = '\0';
+}
+
+lawsp *
+lawsp_create(doublereal *work, integer lwork, integer *iwork, integer liwork)
+{
+	lawsp *ws;
+
+	if (!(ws = (lawsp *)F77_malloc(sizeof(lawsp))))
+		return NULL;
+	memset(ws, 0, sizeof(lawsp));
+	if (work) {
+		ws->work = work;
+		ws->lwork = lwork;
+	} else
+		ws->ownw = 1;
+	if (iwork) {
+		ws->iwork = iwork;
+		ws->liwork = liwork;
+	} else
+		ws->owni = 1;
+	return ws;
+}
+
+void
+lawsp_destroy(lawsp *ws)
+{
+	if (!ws)
+		return;
+	if (ws->ownw && ws->work)
+		F77_free((char *)ws->work);
+	if (ws->owni && ws->iwork)
+		F77_free((char *)ws->iwork);
+	F77_free((char *)ws);
+}
+
+/* Return the cached LWORK for the given shape (and its LIWORK in
+   *liwork), or -1 if the shape has not been seen. */
+
+integer
+lawsp_lookup(lawsp *ws, char *name, char *job, integer m, integer n,
+	integer k, integer *liwork)
+{
+	char nm[8], jb[4];
+	lawsp_entry *e;
+	int i;
+
+	lawsp_key(nm, name, 8);
+	lawsp_key(jb, job, 4);
+	for (i = 0; i < ws->nent; i++) {
+		e = &ws->ent[i];
+		if (e->m == m && e->n == n && e->k == k
+		 && !memcmp(e->name, nm, 8) && !memcmp(e->job, jb, 4)) {
+			if (liwork)
+				*liwork = e->liwork;
+			return e->lwork;
+		}
+	}
+	return -1;
+}
+
+void
+lawsp_store(lawsp *ws, char *name, char *job, integer m, integer n,
+	integer k, integer lwork, integer liwork)
+{
+	lawsp_entry *e;
+
+	if (ws->nent < LAWSP_NCACHE)
+		e = &ws->ent[ws->nent++];
+	else {
+		e = &ws->ent[ws->next];
+		ws->next = (ws->next + 1) % LAWSP_NCACHE;
+	}
+	lawsp_key(e->name, name, 8);
+	lawsp_key(e->job, job, 4);
+	e->m = m;
+	e->n = n;
+	e->k = k;
+	e->lwork = lwork;
+	e->liwork = liwork;
+}
+
+/* Return at least lwork elements of double precision workspace, or
+   NULL if the pool wraps a caller array that is too small. */
+
+doublereal *
+lawsp_work(lawsp *ws, integer lwork)
+{
+	doublereal *w;
+
+	if (lwork <= ws->lwork && ws->work)
+		return ws->work;
+	if (!ws->ownw)
+		return NULL;
+	if (!(w = (doublereal *)F77_malloc(max(lwork,1) * sizeof(doublereal))))
+		return NULL;
+	if (ws->work)
+		F77_free((char *)ws->work);
+	ws->work = w;
+	ws->lwork = max(lwork,1);
+	return w;
+}
+
+integer *
+lawsp_iwork(lawsp *ws, integer liwork)
+{
+	integer *w;
+
+	if (liwork <= ws->liwork && ws->iwork)
+		return ws->iwork;
+	if (!ws->owni)
+		return NULL;
+	if (!(w = (integer *)F77_malloc(max(liwork,1) * sizeof(integer))))
+		return NULL;
+	if (ws->iwork)
+		F77_free((char *)ws->iwork);
+	ws->iwork = w;
+	ws->liwork = max(liwork,1);
+	return w;
+}
+
+int
+lawsp_dgeev(lawsp *ws, char *jobvl, char *jobvr, integer *n, doublereal *a,
+	integer *lda, doublereal *wr, doublereal *wi, doublereal *vl,
+	integer *ldvl, doublereal *vr, integer *ldvr, integer *info)
+{
+	char job[3];
+	doublereal q, *work;
+	integer lwork;
+
+	job[0] = *jobvl;
+	job[1] = *jobvr;
+	job[2] = '\0';
+	lwork = lawsp_lookup(ws, "DGEEV", job, *n, *n, 0, NULL);
+	if (lwork < 0) {
+		dgeev_(jobvl, jobvr, n, a, lda, wr, wi, vl, ldvl, vr, ldvr,
+			&q, &c_n1, info);
+		++ws->nquery;
+		if (*info != 0)
+			return 0;
+		lwork = max((integer)q,1);
+		lawsp_store(ws, "DGEEV", job, *n, *n, 0, lwork, 0);
+	}
+	if (!(work = lawsp_work(ws, lwork))) {
+		*info = -13;
+		xerbla_("DGEEV ", &c__13);
+		return 0;
+	}
+	dgeev_(jobvl, jobvr, n, a, lda, wr, wi, vl, ldvl, vr, ldvr,
+		work, &lwork, info);
+	return 0;
+}
+
+int
+lawsp_dgesdd(lawsp *ws, char *jobz, integer *m, integer *n, doublereal *a,
+	integer *lda, doublereal *s, doublereal *u, integer *ldu,
+	doublereal *vt, integer *ldvt, integer *info)
+{
+	char job[2];
+	doublereal q, *work;
+	integer lwork, liwork, idum, *iwork;
+
+	job[0] = *jobz;
+	job[1] = '\0';
+	lwork = lawsp_lookup(ws, "DGESDD", job, *m, *n, 0, &liwork);
+	if (lwork < 0) {
+		dgesdd_(jobz, m, n, a, lda, s, u, ldu, vt, ldvt, &q, &c_n1,
+			&idum, info);
+		++ws->nquery;
+		if (*info != 0)
+			return 0;
+		lwork = max((integer)q,1);
+		liwork = max(min(*m,*n) << 3,1);
+		lawsp_store(ws, "DGESDD", job, *m, *n, 0, lwork, liwork);
+	}
+
+/*	DGESDD has no LIWORK argument: a short IWORK is reported as an
+	LWORK error. */
+
+	if (!(work = lawsp_work(ws, lwork))
+	 || !(iwork = lawsp_iwork(ws, liwork))) {
+		*info = -12;
+		xerbla_("DGESDD", &c__12);
+		return 0;
+	}
+	dgesdd_(jobz, m, n, a, lda, s, u, ldu, vt, ldvt, work, &lwork,
+		iwork, info);
+	return 0;
+}
+
+int
+lawsp_dsyevr(lawsp *ws, char *jobz, char *range, char *uplo, integer *n,
+	doublereal *a, integer *lda, doublereal *vl, doublereal *vu,
+	integer *il, integer *iu, doublereal *abstol, integer *m,
+	doublereal *w, doublereal *z__, integer *ldz, integer *isuppz,
+	integer *info)
+{
+	char job[2];
+	doublereal q, *work;
+	integer lwork, liwork, iq, *iwork;
+
+	job[0] = *jobz;
+	job[1] = '\0';
+	lwork = lawsp_lookup(ws, "DSYEVR", job, *n, *n, 0, &liwork);
+	if (lwork < 0) {
+		dsyevr_(jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol,
+			m, w, z__, ldz, isuppz, &q, &c_n1, &iq, &c_n1, info);
+		++ws->nquery;
+		if (*info != 0)
+			return 0;
+		lwork = max((integer)q,1);
+		liwork = max(iq,1);
+		lawsp_store(ws, "DSYEVR", job, *n, *n, 0, lwork, liwork);
+	}
+	if (!(work = lawsp_work(ws, lwork))) {
+		*info = -18;
+		xerbla_("DSYEVR", &c__18);
+		return 0;
+	}
+	if (!(iwork = lawsp_iwork(ws, liwork))) {
+		*info = -20;
+		xerbla_("DSYEVR", &c__20);
+		return 0;
+	}
+	dsyevr_(jobz, range, uplo, n, a, lda, vl, vu, il, iu, abstol, m, w,
+		z__, ldz, isuppz, work, &lwork, iwork, &liwork, info);
+	return 0;
+}
+
+int
+lawsp_dgelsd(lawsp *ws, integer *m, integer *n, integer *nrhs,
+	doublereal *a, integer *lda, doublereal *b, integer *ldb,
+	doublereal *s, doublereal *rcond, integer *rank, integer *info)
+{
+	doublereal q, *work;
+	integer lwork, liwork, idum, minmn, smlsiz, nlvl, *iwork;
+
+	lwork = lawsp_lookup(ws, "DGELSD", "", *m, *n, *nrhs, &liwork);
+	if (lwork < 0) {
+		dgelsd_(m, n, nrhs, a, lda, b, ldb, s, rcond, rank, &q, &c_n1,
+			&idum, info);
+		++ws->nquery;
+		if (*info != 0)
+			return 0;
+		lwork = max((integer)q,1);
+
+/*		IWORK as documented in DGELSD */
+
+		minmn = max(min(*m,*n),1);
+		smlsiz = ilaenv_(&c__9, "DGELSD", " ", &c__0, &c__0, &c__0,
+			&c__0);
+		nlvl = max((integer)(log((doublereal)minmn /
+			(doublereal)(smlsiz + 1)) / log(2.)) + 1,0);
+		liwork = max(minmn * 3 * nlvl + minmn * 11,1);
+		lawsp_store(ws, "DGELSD", "", *m, *n, *nrhs, lwork, liwork);
+	}
+
+/*	DGELSD has no LIWORK argument: a short IWORK is reported as an
+	LWORK error. */
+
+	if (!(work = lawsp_work(ws, lwork))
+	 || !(iwork = lawsp_iwork(ws, liwork))) {
+		*info = -12;
+		xerbla_("DGELSD", &c__12);
+		return 0;
+	}
+	dgelsd_(m, n, nrhs, a, lda, b, ldb, s, rcond, rank, work, &lwork,
+		iwork, info);
+	return 0;
+}
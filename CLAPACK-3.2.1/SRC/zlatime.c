@@ -0,0 +1,230 @@
+/* zlatime.c -- timed wrappers of double complex LAPACK and BLAS routines.
+
+   See INCLUDE/latime.h and dlatime.c.  A complex operation counts as
+   four real ones.
+*/
+
+#include "f2c.h"
+#include "blaswrap.h"
+#undef LAPACK_TIMING
+#include "latime.h"
+
+extern /* Subroutine */ int zgemm_(char *transa, char *transb, integer *m,
+	integer *n, integer *k, doublecomplex *alpha, doublecomplex *a,
+	integer *lda, doublecomplex *b, integer *ldb, doublecomplex *beta,
+	doublecomplex *c__, integer *ldc);
+extern /* Subroutine */ int zherk_(char *uplo, char *trans, integer *n,
+	integer *k, doublereal *alpha, doublecomplex *a, integer *lda,
+	doublereal *beta, doublecomplex *c__, integer *ldc);
+extern /* Subroutine */ int ztrsm_(char *side, char *uplo, char *transa,
+	char *diag, integer *m, integer *n, doublecomplex *alpha,
+	doublecomplex *a, integer *lda, doublecomplex *b, integer *ldb);
+extern /* Subroutine */ int zgemv_(char *trans, integer *m, integer *n,
+	doublecomplex *alpha, doublecomplex *a, integer *lda,
+	doublecomplex *x, integer *incx, doublecomplex *beta,
+	doublecomplex *y, integer *incy);
+extern /* Subroutine */ int zgesv_(integer *n, integer *nrhs,
+	doublecomplex *a, integer *lda, integer *ipiv, doublecomplex *b,
+	integer *ldb, integer *info);
+extern /* Subroutine */ int zgetrf_(integer *m, integer *n,
+	doublecomplex *a, integer *lda, integer *ipiv, integer *info);
+extern /* Subroutine */ int zgetrs_(char *trans, integer *n, integer *nrhs,
+	doublecomplex *a, integer *lda, integer *ipiv, doublecomplex *b,
+	integer *ldb, integer *info);
+extern /* Subroutine */ int zposv_(char *uplo, integer *n, integer *nrhs,
+	doublecomplex *a, integer *lda, doublecomplex *b, integer *ldb,
+	integer *info);
+extern /* Subroutine */ int zpotrf_(char *uplo, integer *n,
+	doublecomplex *a, integer *lda, integer *info);
+extern /* Subroutine */ int zgeqrf_(integer *m, integer *n,
+	doublecomplex *a, integer *lda, doublecomplex *tau,
+	doublecomplex *work, integer *lwork, integer *info);
+extern /* Subroutine */ int zheev_(char *jobz, char *uplo, integer *n,
+	doublecomplex *a, integer *lda, doublereal *w, doublecomplex *work,
+	integer *lwork, doublereal *rwork, integer *info);
+extern /* Subroutine */ int zgesvd_(char *jobu, char *jobvt, integer *m,
+	integer *n, doublecomplex *a, integer *lda, doublereal *s,
+	doublecomplex *u, integer *ldu, doublecomplex *vt, integer *ldvt,
+	doublecomplex *work, integer *lwork, doublereal *rwork,
+	integer *info);
+extern /* Subroutine */ int zgeev_(char *jobvl, char *jobvr, integer *n,
+	doublecomplex *a, integer *lda, doublecomplex *w, doublecomplex *vl,
+	integer *ldvl, doublecomplex *vr, integer *ldvr,
+	doublecomplex *work, integer *lwork, doublereal *rwork,
+	integer *info);
+
+int
+latime_zgemm(char *transa, char *transb, integer *m, integer *n, integer *k,
+	doublecomplex *alpha, doublecomplex *a, integer *lda,
+	doublecomplex *b, integer *ldb, doublecomplex *beta,
+	doublecomplex *c__, integer *ldc)
+{
+	static latime_ent ent = LATIME_ENT("ZGEMM");
+	doublereal t = latime_now();
+
+	zgemm_(transa, transb, m, n, k, alpha, a, lda, b, ldb, beta, c__,
+		ldc);
+	latime_end(&ent, t, 8. * *m * *n * *k);
+	return 0;
+}
+
+int
+latime_zherk(char *uplo, char *trans, integer *n, integer *k,
+	doublereal *alpha, doublecomplex *a, integer *lda, doublereal *beta,
+	doublecomplex *c__, integer *ldc)
+{
+	static latime_ent ent = LATIME_ENT("ZHERK");
+	doublereal t = latime_now();
+
+	zherk_(uplo, trans, n, k, alpha, a, lda, beta, c__, ldc);
+	latime_end(&ent, t, 4. * *k * *n * (*n + 1));
+	return 0;
+}
+
+int
+latime_ztrsm(char *side, char *uplo, char *transa, char *diag, integer *m,
+	integer *n, doublecomplex *alpha, doublecomplex *a, integer *lda,
+	doublecomplex *b, integer *ldb)
+{
+	static latime_ent ent = LATIME_ENT("ZTRSM");
+	doublereal t = latime_now();
+
+	ztrsm_(side, uplo, transa, diag, m, n, alpha, a, lda, b, ldb);
+	latime_end(&ent, t, 4. * latime_tr(side, *m, *n));
+	return 0;
+}
+
+int
+latime_zgemv(char *trans, integer *m, integer *n, doublecomplex *alpha,
+	doublecomplex *a, integer *lda, doublecomplex *x, integer *incx,
+	doublecomplex *beta, doublecomplex *y, integer *incy)
+{
+	static latime_ent ent = LATIME_ENT("ZGEMV");
+	doublereal t = latime_now();
+
+	zgemv_(trans, m, n, alpha, a, lda, x, incx, beta, y, incy);
+	latime_end(&ent, t, 8. * *m * *n);
+	return 0;
+}
+
+int
+latime_zgesv(integer *n, integer *nrhs, doublecomplex *a, integer *lda,
+	integer *ipiv, doublecomplex *b, integer *ldb, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZGESV");
+	doublereal t = latime_now();
+
+	zgesv_(n, nrhs, a, lda, ipiv, b, ldb, info);
+	latime_end(&ent, t, 4. * (latime_lu(*n, *n) + 2. * *n * *n * *nrhs));
+	return 0;
+}
+
+int
+latime_zgetrf(integer *m, integer *n, doublecomplex *a, integer *lda,
+	integer *ipiv, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZGETRF");
+	doublereal t = latime_now();
+
+	zgetrf_(m, n, a, lda, ipiv, info);
+	latime_end(&ent, t, 4. * latime_lu(*m, *n));
+	return 0;
+}
+
+int
+latime_zgetrs(char *trans, integer *n, integer *nrhs, doublecomplex *a,
+	integer *lda, integer *ipiv, doublecomplex *b, integer *ldb,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZGETRS");
+	doublereal t = latime_now();
+
+	zgetrs_(trans, n, nrhs, a, lda, ipiv, b, ldb, info);
+	latime_end(&ent, t, 8. * *n * *n * *nrhs);
+	return 0;
+}
+
+int
+latime_zposv(char *uplo, integer *n, integer *nrhs, doublecomplex *a,
+	integer *lda, doublecomplex *b, integer *ldb, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZPOSV");
+	doublereal t = latime_now();
+
+	zposv_(uplo, n, nrhs, a, lda, b, ldb, info);
+	latime_end(&ent, t, 4. * ((doublereal)*n * *n * *n / 3
+		+ 2. * *n * *n * *nrhs));
+	return 0;
+}
+
+int
+latime_zpotrf(char *uplo, integer *n, doublecomplex *a, integer *lda,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZPOTRF");
+	doublereal t = latime_now();
+
+	zpotrf_(uplo, n, a, lda, info);
+	latime_end(&ent, t, 4. * *n * *n * *n / 3);
+	return 0;
+}
+
+int
+latime_zgeqrf(integer *m, integer *n, doublecomplex *a, integer *lda,
+	doublecomplex *tau, doublecomplex *work, integer *lwork,
+	integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZGEQRF");
+	doublereal t = latime_now();
+
+	zgeqrf_(m, n, a, lda, tau, work, lwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 8. * latime_lu(*m, *n));
+	return 0;
+}
+
+int
+latime_zheev(char *jobz, char *uplo, integer *n, doublecomplex *a,
+	integer *lda, doublereal *w, doublecomplex *work, integer *lwork,
+	doublereal *rwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZHEEV");
+	doublereal t = latime_now();
+
+	zheev_(jobz, uplo, n, a, lda, w, work, lwork, rwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_zgesvd(char *jobu, char *jobvt, integer *m, integer *n,
+	doublecomplex *a, integer *lda, doublereal *s, doublecomplex *u,
+	integer *ldu, doublecomplex *vt, integer *ldvt, doublecomplex *work,
+	integer *lwork, doublereal *rwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZGESVD");
+	doublereal t = latime_now();
+
+	zgesvd_(jobu, jobvt, m, n, a, lda, s, u, ldu, vt, ldvt, work, lwork,
+		rwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
+
+int
+latime_zgeev(char *jobvl, char *jobvr, integer *n, doublecomplex *a,
+	integer *lda, doublecomplex *w, doublecomplex *vl, integer *ldvl,
+	doublecomplex *vr, integer *ldvr, doublecomplex *work,
+	integer *lwork, doublereal *rwork, integer *info)
+{
+	static latime_ent ent = LATIME_ENT("ZGEEV");
+	doublereal t = latime_now();
+
+	zgeev_(jobvl, jobvr, n, a, lda, w, vl, ldvl, vr, ldvr, work, lwork,
+		rwork, info);
+	if (*lwork != -1)
+		latime_end(&ent, t, 0.);
+	return 0;
+}
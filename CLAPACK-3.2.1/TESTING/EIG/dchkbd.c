@@ -37,6 +37,8 @@ static doublereal c_b37 = 1.;
 static integer c__1 = 1;
 static integer c__2 = 2;
 static integer c__4 = 4;
+static integer c_n1 = -1;
+static doublereal c_b58 = -1.;
 
 /* Subroutine */ int dchkbd_(integer *nsizes, integer *mval, integer *nval, 
 	integer *ntypes, logical *dotype, integer *nrhs, integer *iseed, 
@@ -79,8 +81,9 @@ static integer c__4 = 4;
     char path[3];
     integer idum[1], mmax, nmax;
     doublereal unfl, ovfl;
+    integer nbw;
     char uplo[1];
-    doublereal temp1, temp2;
+    doublereal resid, temp1, temp2;
     extern /* Subroutine */ int dbdt01_(integer *, integer *, integer *, 
 	    doublereal *, integer *, doublereal *, integer *, doublereal *, 
 	    doublereal *, doublereal *, integer *, doublereal *, doublereal *)
@@ -97,6 +100,9 @@ static integer c__4 = 4;
 	    integer *, doublereal *, doublereal *, integer *, doublereal *, 
 	    integer *, doublereal *, doublereal *, integer *);
     integer imode;
+    extern /* Subroutine */ int dgebnd_(integer *, integer *, integer *, 
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *, 
+	     integer *, integer *);
     doublereal dumma[1];
     integer iinfo;
     extern /* Subroutine */ int dort01_(char *, integer *, integer *, 
@@ -115,7 +121,11 @@ static integer c__4 = 4;
 	     doublereal *, integer *, doublereal *, integer *, integer *), dgebrd_(integer *, integer *, doublereal *, 
 	    integer *, doublereal *, doublereal *, doublereal *, doublereal *, 
 	     doublereal *, integer *, integer *);
-    extern doublereal dlamch_(char *), dlarnd_(integer *, integer *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *, integer 
+	    *, doublereal *, integer *, doublereal *), dlarnd_(integer *, 
+	    integer *);
+    extern integer ilaenv_(integer *, char *, char *, integer *, integer *, 
+	    integer *, integer *);
     extern /* Subroutine */ int dlacpy_(char *, integer *, integer *, 
 	    doublereal *, integer *, doublereal *, integer *), 
 	    dlaset_(char *, integer *, integer *, doublereal *, doublereal *, 
@@ -126,7 +136,11 @@ static integer c__4 = 4;
 	     doublereal *, integer *, doublereal *, integer *, doublereal *, 
 	    integer *), dorgbr_(char *, integer *, integer *, integer 
 	    *, doublereal *, integer *, doublereal *, doublereal *, integer *, 
-	     integer *), xerbla_(char *, integer *), alasum_(
+	     integer *), dorglq_(integer *, integer *, integer *, 
+	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
+	    integer *), dorgqr_(integer *, integer *, integer *, doublereal *, 
+	     integer *, doublereal *, doublereal *, integer *, integer *), 
+	    xerbla_(char *, integer *), alasum_(
 	    char *, integer *, integer *, integer *, integer *), 
 	    dlatmr_(integer *, integer *, char *, integer *, char *, 
 	    doublereal *, integer *, doublereal *, doublereal *, char *, char 
@@ -139,7 +153,7 @@ static integer c__4 = 4;
 	    *);
     doublereal amninv;
     integer minwrk;
-    doublereal rtunfl, rtovfl, ulpinv, result[19];
+    doublereal rtunfl, rtovfl, ulpinv, result[22];
     integer mtypes;
 
     /* Fortran I/O blocks */
@@ -152,6 +166,7 @@ static integer c__4 = 4;
     static cilist io___51 = { 0, 0, 0, fmt_9998, 0 };
     static cilist io___52 = { 0, 0, 0, fmt_9998, 0 };
     static cilist io___53 = { 0, 0, 0, fmt_9999, 0 };
+    static cilist io___54 = { 0, 0, 0, fmt_9998, 0 };
 
 
 
@@ -197,6 +212,10 @@ static integer c__4 = 4;
 /*     2) Same as 1), but the singular values are stored in S2 and the */
 /*         singular vectors are not computed. */
 
+/*  DGEBND reduces A (m >= n) to upper band form W with bandwidth NB, */
+/*  the block size from ILAENV:  Q' * A * P = W.  Q and P' are formed */
+/*  with DORGQR and DORGLQ. */
+
 /*  For each pair of matrix dimensions (M,N) and each selected matrix */
 /*  type, an M by N matrix A and an M by NRHS matrix X are generated. */
 /*  The problem dimensions are as follows */
@@ -261,6 +280,14 @@ static integer c__4 = 4;
 
 /*  (19)  | S1 - S2 | / ( |S1| ulp ), where S2 is computed without */
 /*                                    computing U and V. */
+
+/*  Test DGEBND (only if M >= N; 0 otherwise) */
+
+/*  (20)  | A - Q W PT | / ( |A| max(M,N) ulp ), PT = P' */
+
+/*  (21)  | I - Q' Q | / ( M ulp ) */
+
+/*  (22)  | I - PT PT' | / ( N ulp ) */
 /*  The possible matrix types are */
 
 /*  (1)  The zero matrix. */
@@ -1227,10 +1254,110 @@ L140:
 
 	    result[18] = temp2;
 
+/*           Call DGEBND, DORGQR and DORGLQ to compute W, Q, and P', */
+/*           do tests 20--22.  W is copied to U and P' is formed in VT. */
+
+	    result[19] = 0.;
+	    result[20] = 0.;
+	    result[21] = 0.;
+	    if (! bidiag && m >= n && n > 0) {
+		nbw = ilaenv_(&c__1, "DGEBRD", " ", &m, &n, &c_n1, &c_n1);
+		nbw = max(1,min(nbw,n));
+		dlacpy_(" ", &m, &n, &a[a_offset], lda, &q[q_offset], ldq);
+		i__3 = *lwork - (n << 1);
+		dgebnd_(&m, &n, &nbw, &q[q_offset], ldq, &work[1], &work[n + 
+			1], &work[(n << 1) + 1], &i__3, &iinfo);
+
+/*              Check error code from DGEBND. */
+
+		if (iinfo != 0) {
+		    io___54.ciunit = *nout;
+		    s_wsfe(&io___54);
+		    do_fio(&c__1, "DGEBND", (ftnlen)6);
+		    do_fio(&c__1, (char *)&iinfo, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&jtype, (ftnlen)sizeof(integer));
+		    do_fio(&c__4, (char *)&ioldsd[0], (ftnlen)sizeof(integer))
+			    ;
+		    e_wsfe();
+		    *info = abs(iinfo);
+		    return 0;
+		}
+
+/*              Copy the band W, W(i,j) for i <= j <= i+NB, to U. */
+
+		dlaset_("Full", &n, &n, &c_b20, &c_b20, &u[u_offset], ldpt);
+		i__3 = n;
+		for (j = 1; j <= i__3; ++j) {
+/* Computing MAX */
+		    i__5 = 1, i__6 = j - nbw;
+		    i__4 = j;
+		    for (i__ = max(i__5,i__6); i__ <= i__4; ++i__) {
+			u[i__ + j * u_dim1] = q[i__ + j * q_dim1];
+/* L172: */
+		    }
+/* L174: */
+		}
+
+/*              Generate P' = diag( I, Z ) */
+
+		dlaset_("Full", &n, &n, &c_b20, &c_b37, &vt[vt_offset], ldpt);
+		if (n > nbw) {
+		    i__3 = n - nbw;
+		    dlacpy_(" ", &i__3, &i__3, &q[(nbw + 1) * q_dim1 + 1], ldq, 
+			    &vt[nbw + 1 + (nbw + 1) * vt_dim1], ldpt);
+		    i__4 = *lwork - (n << 1);
+		    dorglq_(&i__3, &i__3, &i__3, &vt[nbw + 1 + (nbw + 1) * 
+			    vt_dim1], ldpt, &work[n + 1], &work[(n << 1) + 1], &
+			    i__4, &iinfo);
+		}
+
+/*              Generate Q */
+
+		i__3 = *lwork - (n << 1);
+		dorgqr_(&m, &n, &n, &q[q_offset], ldq, &work[1], &work[(n << 1) 
+			+ 1], &i__3, &iinfo);
+
+/*              Test 20:  Check the decomposition A := Q * W * PT */
+/*                   21:  Check the orthogonality of Q */
+/*                   22:  Check the orthogonality of PT */
+
+		dgemm_("No transpose", "No transpose", &m, &n, &n, &c_b37, &q[
+			q_offset], ldq, &u[u_offset], ldpt, &c_b20, &work[1], &
+			m);
+		dlacpy_(" ", &m, &n, &a[a_offset], lda, &work[m * n + 1], &m);
+		dgemm_("No transpose", "No transpose", &m, &n, &n, &c_b58, &
+			work[1], &m, &vt[vt_offset], ldpt, &c_b37, &work[m * n + 
+			1], &m);
+		resid = dlange_("1", &m, &n, &work[m * n + 1], &m, dumma);
+		anorm = dlange_("1", &m, &n, &a[a_offset], lda, dumma);
+		if (anorm <= 0.) {
+		    if (resid != 0.) {
+			result[19] = ulpinv;
+		    }
+		} else if (anorm >= resid) {
+		    result[19] = resid / anorm / ((doublereal) m * ulp);
+		} else if (anorm < 1.) {
+/* Computing MIN */
+		    d__1 = resid, d__2 = (doublereal) m * anorm;
+		    result[19] = min(d__1,d__2) / anorm / ((doublereal) m * 
+			    ulp);
+		} else {
+/* Computing MIN */
+		    d__1 = resid / anorm, d__2 = (doublereal) m;
+		    result[19] = min(d__1,d__2) / ((doublereal) m * ulp);
+		}
+		dort01_("Columns", &m, &n, &q[q_offset], ldq, &work[1], lwork, 
+			 &result[20]);
+		dort01_("Rows", &n, &n, &vt[vt_offset], ldpt, &work[1], lwork, &
+			result[21]);
+	    }
+
 /*           End of Loop -- Check for RESULT(j) > THRESH */
 
 L170:
-	    for (j = 1; j <= 19; ++j) {
+	    for (j = 1; j <= 22; ++j) {
 		if (result[j - 1] >= *thresh) {
 		    if (nfail == 0) {
 			dlahd2_(nout, path);
@@ -1251,7 +1378,7 @@ L170:
 /* L180: */
 	    }
 	    if (! bidiag) {
-		ntest += 19;
+		ntest += 22;
 	    } else {
 		ntest += 5;
 	    }
@@ -212,7 +212,9 @@ static integer c__264 = 264;
 	     doublereal *, doublereal *, doublereal *, integer *, doublereal *
 , integer *, doublereal *, doublereal *, doublereal *, integer *, 
 	    integer *, integer *, integer *), dchkec_(doublereal *, logical *, 
-	     integer *, integer *), dchkbk_(integer *, integer *), dchkbl_(
+	     integer *, integer *), dchkws_(doublereal *, integer *, integer *
+	    ), dchkly_(doublereal *, integer *, integer *), dchkxp_(
+	    doublereal *, integer *, integer *), dchkbk_(integer *, integer *), dchkbl_(
 	    integer *, integer *);
     extern doublereal dlamch_(char *);
     extern /* Subroutine */ int dchkgg_(integer *, integer *, integer *, 
@@ -370,6 +372,8 @@ static integer c__264 = 264;
     static cilist io___45 = { 0, 6, 0, fmt_9969, 0 };
     static cilist io___46 = { 0, 6, 0, fmt_9968, 0 };
     static cilist io___47 = { 0, 5, 0, 0, 0 };
+    static cilist io___48 = { 0, 5, 0, 0, 0 };
+    static cilist io___49 = { 0, 5, 0, 0, 0 };
     static cilist io___50 = { 0, 6, 0, fmt_9992, 0 };
     static cilist io___54 = { 0, 6, 0, fmt_9972, 0 };
     static cilist io___55 = { 0, 6, 0, fmt_9984, 0 };
@@ -593,6 +597,15 @@ static integer c__264 = 264;
 /*      Test DLALN2, DLASY2, DLAEQU, DLAEXC, DTRSYL, DTREXC, DTRSNA, */
 /*      DTRSEN, and DLAQTR */
 
+/*  DWS (Workspace pools) */
+/*      Test LAWSP_DGESDD, LAWSP_DGEEV, LAWSP_DSYEVR, and LAWSP_DGELSD */
+
+/*  DLY (Sylvester, Stein and Lyapunov equations) */
+/*      Test DTRSYLR, DTRSTN, DGELYP, and DGESTN */
+
+/*  DXP (Matrix exponential and phi functions) */
+/*      Test DGEXPM and DGEPHI */
+
 /*  DBL (Balancing a general matrix) */
 /*      Test DGEBAL */
 
@@ -648,6 +661,9 @@ static integer c__264 = 264;
 /*  DSB             15     DCHKSB */
 /*  DBB             15     DCHKBB */
 /*  DEC              -     DCHKEC */
+/*  DWS             11     DCHKWS */
+/*  DLY              5     DCHKLY */
+/*  DXP              3     DCHKXP */
 /*  DBL              -     DCHKBL */
 /*  DBK              -     DCHKBK */
 /*  DGL              -     DCHKGL */
@@ -1298,6 +1314,51 @@ static integer c__264 = 264;
 
 /* ----------------------------------------------------------------------- */
 
+/*  DWS input file: */
+
+/*  line  2: THRESH, REAL */
+/*           Threshold value for the test ratios. */
+
+/*  line  3: NN, INTEGER */
+/*           Number of values of N (at most 12). */
+
+/*  line  4: NVAL, INTEGER array, dimension (NN) */
+/*           The values for the matrix dimension N (at most 32). */
+
+/* ----------------------------------------------------------------------- */
+
+/*  DLY input file: */
+
+/*  line  2: THRESH, REAL */
+/*           Threshold value for the test ratios. */
+
+/*  line  3: NN, INTEGER */
+/*           Number of values of N (at most 12). */
+
+/*  line  4: NVAL, INTEGER array, dimension (NN) */
+/*           The values for the matrix dimension N (at most 40). */
+
+/*  line  5: NNB, INTEGER */
+/*           Number of values of the block size NB (at most 12). */
+
+/*  line  6: NBVAL, INTEGER array, dimension (NNB) */
+/*           The values for the block size NB of DTRSYLR. */
+
+/* ----------------------------------------------------------------------- */
+
+/*  DXP input file: */
+
+/*  line  2: THRESH, REAL */
+/*           Threshold value for the test ratios. */
+
+/*  line  3: NN, INTEGER */
+/*           Number of values of N (at most 12). */
+
+/*  line  4: NVAL, INTEGER array, dimension (NN) */
+/*           The values for the matrix dimension N (at most 40). */
+
+/* ----------------------------------------------------------------------- */
+
 /*  DBL and DBK input files: */
 
 /*  line 1:  'DBL' in columns 1-3 to test SGEBAL, or 'DBK' in */
@@ -1669,6 +1730,45 @@ L10:
 	tsterr = TRUE_;
 	dchkec_(&thresh, &tsterr, &c__5, &c__6);
 	goto L10;
+    } else if (lsamen_(&c__3, path, "DWS")) {
+
+/*        DWS:  Workspace pools */
+
+	s_rsle(&io___48);
+	do_lio(&c__5, &c__1, (char *)&thresh, (ftnlen)sizeof(doublereal));
+	e_rsle();
+	xlaenv_(&c__1, &c__1);
+	xlaenv_(&c__9, &c__25);
+	xlaenv_(&c__12, &c__11);
+	xlaenv_(&c__13, &c__2);
+	xlaenv_(&c__14, &c__0);
+	xlaenv_(&c__15, &c__2);
+	xlaenv_(&c__16, &c__2);
+	dchkws_(&thresh, &c__5, &c__6);
+	goto L10;
+    } else if (lsamen_(&c__3, path, "DLY")) {
+
+/*        DLY:  Sylvester, Stein and Lyapunov equations */
+
+	s_rsle(&io___49);
+	do_lio(&c__5, &c__1, (char *)&thresh, (ftnlen)sizeof(doublereal));
+	e_rsle();
+	xlaenv_(&c__12, &c__11);
+	xlaenv_(&c__13, &c__2);
+	xlaenv_(&c__14, &c__0);
+	xlaenv_(&c__15, &c__2);
+	xlaenv_(&c__16, &c__2);
+	dchkly_(&thresh, &c__5, &c__6);
+	goto L10;
+    } else if (lsamen_(&c__3, path, "DXP")) {
+
+/*        DXP:  Matrix exponential and phi functions */
+
+	s_rsle(&io___49);
+	do_lio(&c__5, &c__1, (char *)&thresh, (ftnlen)sizeof(doublereal));
+	e_rsle();
+	dchkxp_(&thresh, &c__5, &c__6);
+	goto L10;
     } else {
 	s_wsfe(&io___50);
 	do_fio(&c__1, path, (ftnlen)3);
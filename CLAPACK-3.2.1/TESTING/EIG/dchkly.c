@@ -0,0 +1,543 @@
+/* dchkly.c -- DCHKLY, tests of the Sylvester, Stein and Lyapunov solvers. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__3 = 3;
+static integer c__1 = 1;
+static integer c__2 = 2;
+static integer c__40 = 40;
+static integer c__6400 = 6400;
+static doublereal c_b30 = 1.;
+static doublereal c_b31 = 0.;
+static doublereal c_b32 = -1.;
+
+/* Subroutine */ int dchkly_(doublereal *thresh, integer *nin, integer *nout)
+{
+    /* Initialized data */
+
+    static char transs[1*2] = "NT";
+
+    /* Format strings */
+    static char fmt_9999[] = "(/\002 Tests of the recursive Sylvester, Stei"
+	    "n and Lyapunov\002,\002 solvers\002,/\002 DTRSYLR, DTRSTN, DGELY"
+	    "P, DGESTN\002,/)";
+    static char fmt_9998[] = "(\002 Invalid input value: \002,a4,\002=\002,"
+	    "i6,\002; must be <=\002,i6)";
+    static char fmt_9997[] = "(1x,a7,\002 returned INFO=\002,i6,\002, NB="
+	    "\002,i4,\002, M=\002,i5,\002, N=\002,i5)";
+    static char fmt_9996[] = "(\002 NB=\002,i4,\002, M=\002,i5,\002, N=\002"
+	    ",i5,\002, test(\002,i2,\002) =\002,g13.6)";
+    static char fmt_9995[] = "(/1x,\002All tests for \002,a3,\002 routines p"
+	    "assed the thresh\002,\002old (\002,i6,\002 tests run)\002)";
+    static char fmt_9994[] = "(/1x,a3,\002 routines: \002,i6,\002 out of "
+	    "\002,i6,\002 tests failed to pass the threshold\002)";
+
+    /* System generated locals */
+    integer i__1, i__2, i__3;
+    doublereal d__1, d__2;
+
+    /* Builtin functions */
+    integer s_rsle(cilist *), do_lio(integer *, integer *, char *, ftnlen),
+	    e_rsle(void), s_wsfe(cilist *), e_wsfe(void), do_fio(integer *,
+	    char *, ftnlen);
+    double sqrt(doublereal);
+
+    /* Local variables */
+    static doublereal a[1600]	/* was [40][40] */, b[1600]	/* was [40][40]
+	    */, c__[1600]	/* was [40][40] */, r__[1600]	/* was [40][40] */,
+	     u[1600]	/* was [40][40] */, w[1600]	/* was [40][40] */, x[1600]
+	    	/* was [40][40] */, sa[1600]	/* was [40][40] */, sb[1600]
+	    /* was [40][40] */, al[1600]	/* was [40][40] */, as[1600]	/*
+	    was [40][40] */;
+    static doublereal work[6400];
+    integer i__, j, k, m, n, ia, ib, im, nb, is, nn, ifa, inb, nnb, info,
+	    isgn, nrun, sdim, nval[12], nbval[12];
+    doublereal anrm, bnrm, xnrm, rnrm, ulp, scale, shift, smlnum;
+    integer nfail, iseed[4];
+    doublereal wi[40], wr[40], result[5];
+    logical bwork[40];
+    char *fact;
+    extern /* Subroutine */ int dgees_(char *, char *, L_fp, integer *,
+	    doublereal *, integer *, integer *, doublereal *, doublereal *,
+	    doublereal *, integer *, doublereal *, integer *, logical *,
+	    integer *), dgemm_(char *, char *, integer *, integer *, integer *
+	    , doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, integer *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *), dlarnv_(
+	    integer *, integer *, integer *, doublereal *), dgelyp_(char *,
+	    char *, integer *, doublereal *, integer *, doublereal *, integer
+	    *, doublereal *, integer *, doublereal *, doublereal *,
+	    doublereal *, doublereal *, integer *, integer *), dgestn_(char *,
+	     char *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, integer *, doublereal *, doublereal *,
+	    doublereal *, doublereal *, integer *, integer *), dtrstn_(char *,
+	     char *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, integer *), xlaenv_(integer *, integer *),
+	    dtrsylr_(char *, char *, integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, integer *);
+
+    /* Fortran I/O blocks */
+    static cilist io___1 = { 0, 0, 0, 0, 0 };
+    static cilist io___3 = { 0, 0, 0, 0, 0 };
+    static cilist io___5 = { 0, 0, 0, 0, 0 };
+    static cilist io___7 = { 0, 0, 0, 0, 0 };
+    static cilist io___8 = { 0, 0, 0, fmt_9998, 0 };
+    static cilist io___9 = { 0, 0, 0, fmt_9998, 0 };
+    static cilist io___10 = { 0, 0, 0, fmt_9999, 0 };
+    static cilist io___20 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___30 = { 0, 0, 0, fmt_9996, 0 };
+    static cilist io___31 = { 0, 0, 0, fmt_9995, 0 };
+    static cilist io___32 = { 0, 0, 0, fmt_9994, 0 };
+
+
+
+/*  Purpose */
+/*  ======= */
+
+/*  DCHKLY tests the recursive blocked solvers DTRSYLR (Sylvester) and */
+/*  DTRSTN (Stein) and the Lyapunov drivers DGELYP and DGESTN. */
+
+/*  For each block size NB (set through XLAENV for ILAENV(1,'DTRSYL')), */
+/*  each N and M = N or N/2+1, random matrices are reduced to real */
+/*  Schur form by DGEES and the following ratios are computed, each */
+/*  the largest over all options TRANA, TRANB (and ISGN): */
+
+/*  (1)   | op(A)*X + ISGN*X*op(B) - scale*C | /              (DTRSYLR) */
+/*           ( (|A|+|B|) |X| max(M,N) ulp ) */
+/*  (2)   | op(A)*X*op(B) - X - scale*C | /                   (DTRSTN) */
+/*           ( (|A||B|+1) |X| max(M,N) ulp ) */
+
+/*  and, when M = N, for a random symmetric C, FACT = 'N' and 'F', */
+
+/*  (3)   | op(A)*X + X*op(A)' - scale*C | / ( |A| |X| N ulp )  (DGELYP) */
+/*  (4)   | op(A)*X*op(A)' - X - scale*C | /                  (DGESTN) */
+/*           ( (|A|**2+1) |X| N ulp ) */
+/*  (5)   | X - X' | / ( |X| N ulp ) for the solutions of (3) and (4). */
+
+/*  A and B are shifted so that A+B and A-B are nonsingular for (1) */
+/*  and (3), and scaled to spectral radius well below one for (2) and */
+/*  (4), so that the equations are well conditioned. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  THRESH  (input) DOUBLE PRECISION */
+/*          Threshold for residual tests.  A computed test ratio passes */
+/*          the threshold if it is less than THRESH. */
+
+/*  NIN     (input) INTEGER */
+/*          The logical unit number for input.  The next four lines give */
+/*          the number of values of N (at most 12), the values of N (at */
+/*          most 40), the number of values of NB (at most 12) and the */
+/*          values of NB. */
+
+/*  NOUT    (input) INTEGER */
+/*          The logical unit number for output. */
+
+/*  ===================================================================== */
+
+/*     .. Executable Statements .. */
+
+    io___1.ciunit = *nin;
+    s_rsle(&io___1);
+    do_lio(&c__3, &c__1, (char *)&nn, (ftnlen)sizeof(integer));
+    e_rsle();
+    io___3.ciunit = *nin;
+    s_rsle(&io___3);
+    i__1 = min(nn,12);
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	do_lio(&c__3, &c__1, (char *)&nval[i__ - 1], (ftnlen)sizeof(integer));
+    }
+    e_rsle();
+    io___5.ciunit = *nin;
+    s_rsle(&io___5);
+    do_lio(&c__3, &c__1, (char *)&nnb, (ftnlen)sizeof(integer));
+    e_rsle();
+    io___7.ciunit = *nin;
+    s_rsle(&io___7);
+    i__1 = min(nnb,12);
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	do_lio(&c__3, &c__1, (char *)&nbval[i__ - 1], (ftnlen)sizeof(integer))
+		;
+    }
+    e_rsle();
+    if (nn > 12 || nnb > 12) {
+	io___8.ciunit = *nout;
+	s_wsfe(&io___8);
+	do_fio(&c__1, nn > 12 ? "NN" : "NNB", nn > 12 ? (ftnlen)2 : (ftnlen)3);
+	i__1 = max(nn,nnb);
+	do_fio(&c__1, (char *)&i__1, (ftnlen)sizeof(integer));
+	i__2 = 12;
+	do_fio(&c__1, (char *)&i__2, (ftnlen)sizeof(integer));
+	e_wsfe();
+	return 0;
+    }
+
+    io___10.ciunit = *nout;
+    s_wsfe(&io___10);
+    e_wsfe();
+
+    ulp = dlamch_("Precision");
+    smlnum = dlamch_("Safe minimum") / ulp;
+    iseed[0] = 1988;
+    iseed[1] = 1989;
+    iseed[2] = 1990;
+    iseed[3] = 1991;
+    nrun = 0;
+    nfail = 0;
+
+    i__1 = nnb;
+    for (inb = 1; inb <= i__1; ++inb) {
+	nb = nbval[inb - 1];
+	xlaenv_(&c__1, &nb);
+
+	i__2 = nn;
+	for (j = 1; j <= i__2; ++j) {
+	    n = nval[j - 1];
+	    if (n < 0 || n > 40) {
+		io___9.ciunit = *nout;
+		s_wsfe(&io___9);
+		do_fio(&c__1, "N", (ftnlen)1);
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&c__40, (ftnlen)sizeof(integer));
+		e_wsfe();
+		goto L200;
+	    }
+
+	    for (im = 1; im <= 2; ++im) {
+		m = im == 1 ? n : n / 2 + 1;
+		for (i__ = 1; i__ <= 5; ++i__) {
+		    result[i__ - 1] = 0.;
+		}
+
+/*              Random A (M-by-M), B (N-by-N) and C (M-by-N).  For the */
+/*              Sylvester tests A and B are shifted by 2*SHIFT and */
+/*              SHIFT, which exceed their spectral radii; for the Stein */
+/*              tests they are scaled to spectral radius below 1/2. */
+
+		i__3 = m;
+		for (k = 1; k <= i__3; ++k) {
+		    dlarnv_(&c__2, iseed, &m, &a[k * 40 - 40]);
+		}
+		i__3 = n;
+		for (k = 1; k <= i__3; ++k) {
+		    dlarnv_(&c__2, iseed, &n, &b[k * 40 - 40]);
+		    dlarnv_(&c__2, iseed, &m, &c__[k * 40 - 40]);
+		}
+		shift = sqrt((doublereal) m) + sqrt((doublereal) n) + 1.;
+		i__3 = m;
+		for (k = 1; k <= i__3; ++k) {
+		    for (i__ = 1; i__ <= i__3; ++i__) {
+			sa[i__ + k * 40 - 41] = a[i__ + k * 40 - 41] / (sqrt((
+				doublereal) m) * 2. + 1.);
+		    }
+		    a[k + k * 40 - 41] += shift * 2.;
+		}
+		i__3 = n;
+		for (k = 1; k <= i__3; ++k) {
+		    for (i__ = 1; i__ <= i__3; ++i__) {
+			sb[i__ + k * 40 - 41] = b[i__ + k * 40 - 41] / (sqrt((
+				doublereal) n) * 2. + 1.);
+		    }
+		    b[k + k * 40 - 41] += shift;
+		}
+		dgees_("N", "N", (L_fp)0, &m, a, &c__40, &sdim, wr, wi, u, &
+			c__1, work, &c__6400, bwork, &info);
+		if (info == 0) {
+		    dgees_("N", "N", (L_fp)0, &n, b, &c__40, &sdim, wr, wi, u,
+			     &c__1, work, &c__6400, bwork, &info);
+		}
+		if (info == 0) {
+		    dgees_("N", "N", (L_fp)0, &m, sa, &c__40, &sdim, wr, wi, u,
+			     &c__1, work, &c__6400, bwork, &info);
+		}
+		if (info == 0) {
+		    dgees_("N", "N", (L_fp)0, &n, sb, &c__40, &sdim, wr, wi, u,
+			     &c__1, work, &c__6400, bwork, &info);
+		}
+		if (info != 0) {
+		    io___20.ciunit = *nout;
+		    s_wsfe(&io___20);
+		    do_fio(&c__1, "DGEES  ", (ftnlen)7);
+		    do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		    e_wsfe();
+		    goto L190;
+		}
+
+/*              Test 1:  DTRSYLR */
+
+		anrm = dlange_("1", &m, &m, a, &c__40, work);
+		bnrm = dlange_("1", &n, &n, b, &c__40, work);
+		for (is = 1; is <= 2; ++is) {
+		    isgn = 3 - (is << 1);
+		    for (ia = 1; ia <= 2; ++ia) {
+			for (ib = 1; ib <= 2; ++ib) {
+			    dlacpy_("Full", &m, &n, c__, &c__40, x, &c__40);
+			    dtrsylr_(transs + (ia - 1), transs + (ib - 1), &
+				    isgn, &m, &n, a, &c__40, b, &c__40, x, &
+				    c__40, &scale, &info);
+			    if (info != 0) {
+				io___20.ciunit = *nout;
+				s_wsfe(&io___20);
+				do_fio(&c__1, "DTRSYLR", (ftnlen)7);
+				do_fio(&c__1, (char *)&info, (ftnlen)sizeof(
+					integer));
+				do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(
+					integer));
+				do_fio(&c__1, (char *)&m, (ftnlen)sizeof(
+					integer));
+				do_fio(&c__1, (char *)&n, (ftnlen)sizeof(
+					integer));
+				e_wsfe();
+				result[0] = 1. / ulp;
+			    }
+
+/*                       R = op(A)*X + ISGN*X*op(B) - scale*C */
+
+			    dlacpy_("Full", &m, &n, c__, &c__40, r__, &c__40);
+			    d__1 = -scale;
+			    dgemm_(transs + (ia - 1), "N", &m, &n, &m, &c_b30,
+				     a, &c__40, x, &c__40, &d__1, r__, &c__40);
+			    d__1 = (doublereal) isgn;
+			    dgemm_("N", transs + (ib - 1), &m, &n, &n, &d__1,
+				    x, &c__40, b, &c__40, &c_b30, r__, &c__40);
+			    xnrm = dlange_("1", &m, &n, x, &c__40, work);
+			    rnrm = dlange_("1", &m, &n, r__, &c__40, work);
+/* Computing MAX */
+			    d__1 = smlnum, d__2 = (anrm + bnrm) * xnrm;
+			    d__1 = rnrm / max(d__1,d__2) / ((doublereal) max(
+				    m,n) * ulp);
+			    result[0] = max(result[0],d__1);
+			}
+		    }
+		}
+
+/*              Test 2:  DTRSTN */
+
+		anrm = dlange_("1", &m, &m, sa, &c__40, work);
+		bnrm = dlange_("1", &n, &n, sb, &c__40, work);
+		for (ia = 1; ia <= 2; ++ia) {
+		    for (ib = 1; ib <= 2; ++ib) {
+			dlacpy_("Full", &m, &n, c__, &c__40, x, &c__40);
+			dtrstn_(transs + (ia - 1), transs + (ib - 1), &m, &n,
+				sa, &c__40, sb, &c__40, x, &c__40, &scale,
+				work, &info);
+			if (info != 0) {
+			    io___20.ciunit = *nout;
+			    s_wsfe(&io___20);
+			    do_fio(&c__1, "DTRSTN ", (ftnlen)7);
+			    do_fio(&c__1, (char *)&info, (ftnlen)sizeof(
+				    integer));
+			    do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer)
+				    );
+			    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer))
+				    ;
+			    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer))
+				    ;
+			    e_wsfe();
+			    result[1] = 1. / ulp;
+			}
+
+/*                    R = op(A)*X*op(B) - X - scale*C */
+
+			dlacpy_("Full", &m, &n, x, &c__40, r__, &c__40);
+			i__3 = n;
+			for (k = 1; k <= i__3; ++k) {
+			    for (i__ = 1; i__ <= m; ++i__) {
+				r__[i__ + k * 40 - 41] += scale * c__[i__ + k
+					* 40 - 41];
+			    }
+			}
+			dgemm_(transs + (ia - 1), "N", &m, &n, &m, &c_b30, sa,
+				 &c__40, x, &c__40, &c_b31, w, &c__40);
+			dgemm_("N", transs + (ib - 1), &m, &n, &n, &c_b30, w,
+				&c__40, sb, &c__40, &c_b32, r__, &c__40);
+			xnrm = dlange_("1", &m, &n, x, &c__40, work);
+			rnrm = dlange_("1", &m, &n, r__, &c__40, work);
+/* Computing MAX */
+			d__1 = smlnum, d__2 = (anrm * bnrm + 1.) * xnrm;
+			d__1 = rnrm / max(d__1,d__2) / ((doublereal) max(m,n)
+				* ulp);
+			result[1] = max(result[1],d__1);
+		    }
+		}
+
+/*              Tests 3 to 5:  DGELYP and DGESTN with symmetric C */
+
+		if (m != n) {
+		    goto L150;
+		}
+		i__3 = n;
+		for (k = 1; k <= i__3; ++k) {
+		    dlarnv_(&c__2, iseed, &n, &al[k * 40 - 40]);
+		    for (i__ = 1; i__ <= i__3; ++i__) {
+			as[i__ + k * 40 - 41] = al[i__ + k * 40 - 41] / (sqrt(
+				(doublereal) n) * 2. + 1.);
+		    }
+		    al[k + k * 40 - 41] -= shift;
+		}
+		for (k = 1; k <= i__3; ++k) {
+		    for (i__ = k; i__ <= i__3; ++i__) {
+			c__[i__ + k * 40 - 41] += c__[k + i__ * 40 - 41];
+			c__[k + i__ * 40 - 41] = c__[i__ + k * 40 - 41];
+		    }
+		}
+
+/*              IFA = 1: FACT = 'N', op(A) = A;  IFA = 2: FACT = 'F' */
+/*              with the factorization of IFA = 1;  IFA = 3: FACT = */
+/*              'N', op(A) = A'. */
+
+		for (k = 3; k <= 4; ++k) {
+		    if (k == 3) {
+			dlacpy_("Full", &n, &n, al, &c__40, sa, &c__40);
+		    } else {
+			dlacpy_("Full", &n, &n, as, &c__40, sa, &c__40);
+		    }
+		    anrm = dlange_("1", &n, &n, sa, &c__40, work);
+		    for (ifa = 1; ifa <= 3; ++ifa) {
+			ia = ifa == 3 ? 2 : 1;
+			fact = ifa == 2 ? "F" : "N";
+			if (ifa != 2) {
+			    dlacpy_("Full", &n, &n, sa, &c__40, b, &c__40);
+			}
+			dlacpy_("Full", &n, &n, c__, &c__40, x, &c__40);
+			if (k == 3) {
+			    dgelyp_(fact, transs + (ia - 1), &n, b, &c__40, u,
+				     &c__40, x, &c__40, &scale, wr, wi, work, &
+				    c__6400, &info);
+			} else {
+			    dgestn_(fact, transs + (ia - 1), &n, b, &c__40, u,
+				     &c__40, x, &c__40, &scale, wr, wi, work, &
+				    c__6400, &info);
+			}
+			if (info != 0) {
+			    io___20.ciunit = *nout;
+			    s_wsfe(&io___20);
+			    do_fio(&c__1, k == 3 ? "DGELYP " : "DGESTN ", (
+				    ftnlen)7);
+			    do_fio(&c__1, (char *)&info, (ftnlen)sizeof(
+				    integer));
+			    do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer)
+				    );
+			    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer))
+				    ;
+			    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer))
+				    ;
+			    e_wsfe();
+			    result[k - 1] = 1. / ulp;
+			}
+
+/*                    Lyapunov:  R = op(A)*X + X*op(A)' - scale*C */
+/*                    Stein:     R = op(A)*X*op(A)' - X - scale*C */
+
+			xnrm = dlange_("1", &n, &n, x, &c__40, work);
+			if (k == 3) {
+			    dlacpy_("Full", &n, &n, c__, &c__40, r__, &c__40);
+			    d__1 = -scale;
+			    dgemm_(transs + (ia - 1), "N", &n, &n, &n, &c_b30,
+				     sa, &c__40, x, &c__40, &d__1, r__, &
+				    c__40);
+			    dgemm_("N", transs + (2 - ia), &n, &n, &n, &c_b30,
+				     x, &c__40, sa, &c__40, &c_b30, r__, &
+				    c__40);
+/* Computing MAX */
+			    d__1 = smlnum, d__2 = anrm * xnrm;
+			    d__2 = max(d__1,d__2);
+			} else {
+			    dlacpy_("Full", &n, &n, x, &c__40, r__, &c__40);
+			    for (is = 1; is <= i__3; ++is) {
+				for (i__ = 1; i__ <= i__3; ++i__) {
+				    r__[i__ + is * 40 - 41] += scale * c__[
+					    i__ + is * 40 - 41];
+				}
+			    }
+			    dgemm_(transs + (ia - 1), "N", &n, &n, &n, &c_b30,
+				     sa, &c__40, x, &c__40, &c_b31, w, &c__40);
+			    dgemm_("N", transs + (2 - ia), &n, &n, &n, &c_b30,
+				     w, &c__40, sa, &c__40, &c_b32, r__, &
+				    c__40);
+/* Computing MAX */
+			    d__1 = smlnum, d__2 = (anrm * anrm + 1.) * xnrm;
+			    d__2 = max(d__1,d__2);
+			}
+			rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+			d__1 = rnrm / d__2 / ((doublereal) n * ulp);
+			result[k - 1] = max(result[k - 1],d__1);
+
+/*                    Test 5:  symmetry of X */
+
+			for (is = 1; is <= i__3; ++is) {
+			    for (i__ = 1; i__ <= i__3; ++i__) {
+				r__[i__ + is * 40 - 41] = x[i__ + is * 40 -
+					41] - x[is + i__ * 40 - 41];
+			    }
+			}
+			rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+/* Computing MAX */
+			d__1 = smlnum, d__2 = xnrm;
+			d__1 = rnrm / max(d__1,d__2) / ((doublereal) n * ulp);
+			result[4] = max(result[4],d__1);
+		    }
+		}
+
+/*              Print information about the tests that did not pass */
+
+L150:
+		for (k = 1; k <= 5; ++k) {
+		    if (k >= 3 && m != n) {
+			goto L180;
+		    }
+		    ++nrun;
+		    if (result[k - 1] >= *thresh) {
+			++nfail;
+			io___30.ciunit = *nout;
+			s_wsfe(&io___30);
+			do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&k, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&result[k - 1], (ftnlen)sizeof(
+				doublereal));
+			e_wsfe();
+		    }
+L180:
+		    ;
+		}
+L190:
+		;
+	    }
+L200:
+	    ;
+	}
+    }
+
+    if (nfail == 0) {
+	io___31.ciunit = *nout;
+	s_wsfe(&io___31);
+	do_fio(&c__1, "DLY", (ftnlen)3);
+	do_fio(&c__1, (char *)&nrun, (ftnlen)sizeof(integer));
+	e_wsfe();
+    } else {
+	io___32.ciunit = *nout;
+	s_wsfe(&io___32);
+	do_fio(&c__1, "DLY", (ftnlen)3);
+	do_fio(&c__1, (char *)&nfail, (ftnlen)sizeof(integer));
+	do_fio(&c__1, (char *)&nrun, (ftnlen)sizeof(integer));
+	e_wsfe();
+    }
+    return 0;
+
+/*     End of DCHKLY */
+
+} /* dchkly_ */
@@ -0,0 +1,455 @@
+/* dchkws.c -- DCHKWS, tests of the LAWSP workspace pools. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+#include "lawsp.h"
+
+/* Common Block Declarations */
+
+struct {
+    integer infot, nunit;
+    logical ok, lerr;
+} infoc_;
+
+#define infoc_1 infoc_
+
+struct {
+    char srnamt[32];
+} srnamc_;
+
+#define srnamc_1 srnamc_
+
+/* Table of constant values */
+
+static integer c__3 = 3;
+static integer c__1 = 1;
+static integer c__32 = 32;
+static integer c__40 = 40;
+static integer c__0 = 0;
+static integer c__2 = 2;
+static integer c__6400 = 6400;
+static doublereal c_b30 = 1.;
+static doublereal c_b31 = 0.;
+
+/* Subroutine */ int dchkws_(doublereal *thresh, integer *nin, integer *nout)
+{
+    /* Format strings */
+    static char fmt_9999[] = "(/\002 Tests of the LAWSP workspace pools\002,"
+	    "/\002 LAWSP_DGESDD, LAWSP_DGEEV, LAWSP_DSYEVR, LAWSP_DGELSD\002,"
+	    "/)";
+    static char fmt_9998[] = "(\002 Invalid input value: \002,a4,\002=\002,"
+	    "i6,\002; must be <=\002,i6)";
+    static char fmt_9997[] = "(\002 LAWSP_\002,a6,\002 returned INFO=\002,"
+	    "i6,\002, M=\002,i5,\002, N=\002,i5,\002, ROUND=\002,i2)";
+    static char fmt_9996[] = "(\002 M=\002,i5,\002, N=\002,i5,\002, test("
+	    "\002,i2,\002) =\002,g13.6)";
+    static char fmt_9995[] = "(/1x,\002All tests for \002,a3,\002 routines p"
+	    "assed the thresh\002,\002old (\002,i6,\002 tests run)\002)";
+    static char fmt_9994[] = "(/1x,a3,\002 routines: \002,i6,\002 out of "
+	    "\002,i6,\002 tests failed to pass the threshold\002)";
+
+    /* System generated locals */
+    integer i__1, i__2;
+
+    /* Builtin functions */
+    integer s_rsle(cilist *), do_lio(integer *, integer *, char *, ftnlen),
+	    e_rsle(void), s_wsfe(cilist *), e_wsfe(void), do_fio(integer *,
+	    char *, ftnlen);
+    /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
+
+    /* Local variables */
+    static doublereal a[1600]	/* was [40][40] */, h__[1600]	/* was [40][
+	    40] */, u[1600]	/* was [40][40] */, vt[1600]	/* was [40][40] */,
+	     vl[1600]	/* was [40][40] */, vr[1600]	/* was [40][40] */, z__[
+	    1600]	/* was [40][40] */, asav[1600]	/* was [40][40] */;
+    static doublereal work[6400], wrk[40000];
+    static integer iwrk[2000];
+    doublereal b[80]	/* was [40][2] */, x[80]	/* was [40][2] */, bsav[80]
+	    	/* was [40][2] */;
+    integer i__, j, k, m, n;
+    doublereal s[40], w[40], s1[40], w1[40], x1[80]	/* was [40][2] */, wi[40],
+	     wr[40], wi1[40], wr1[40], vu, dum[1];
+    integer nn, il, iu, nq, mout, info, rank, nrun, nval[12], idum[1];
+    doublereal vl1, ulp, res[2];
+    integer nfail;
+    logical mism;
+    lawsp *ws, *pool, *wpool;
+    integer iseed[4], isuppz[80], iround;
+    doublereal rcond, unfl, abstol, result[11], ulpinv;
+    extern /* Subroutine */ int dget02_(char *, integer *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *), dget22_(
+	    char *, char *, char *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
+	     doublereal *), dbdt01_(integer *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, doublereal *, integer *, doublereal *, doublereal *)
+	    , dort01_(char *, integer *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *), dsyt21_(integer *, char *,
+	     integer *, integer *, doublereal *, integer *, doublereal *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, doublereal *);
+    extern doublereal dlamch_(char *);
+    extern /* Subroutine */ int dcopy_(integer *, doublereal *, integer *,
+	    doublereal *, integer *), dlacpy_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *), dlarnv_(
+	    integer *, integer *, integer *, doublereal *), dgemm_(char *,
+	    char *, integer *, integer *, integer *, doublereal *, doublereal
+	    *, integer *, doublereal *, integer *, doublereal *, doublereal *,
+	     integer *);
+
+    /* Fortran I/O blocks */
+    static cilist io___1 = { 0, 0, 0, 0, 0 };
+    static cilist io___3 = { 0, 0, 0, 0, 0 };
+    static cilist io___6 = { 0, 0, 0, fmt_9998, 0 };
+    static cilist io___8 = { 0, 0, 0, fmt_9998, 0 };
+    static cilist io___9 = { 0, 0, 0, fmt_9999, 0 };
+    static cilist io___20 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___21 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___22 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___23 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___30 = { 0, 0, 0, fmt_9996, 0 };
+    static cilist io___31 = { 0, 0, 0, fmt_9995, 0 };
+    static cilist io___32 = { 0, 0, 0, fmt_9994, 0 };
+
+
+
+/*  Purpose */
+/*  ======= */
+
+/*  DCHKWS tests the LAWSP workspace pools (INCLUDE/lawsp.h) through */
+/*  the entry points LAWSP_DGESDD, LAWSP_DGEEV, LAWSP_DSYEVR and */
+/*  LAWSP_DGELSD. */
+
+/*  For each N read from unit NIN, an M-by-N matrix A (M = N+4), an */
+/*  N-by-N symmetric matrix H and an M-by-2 right hand side B = A*X0 */
+/*  are generated with random entries, and the four drivers are run */
+/*  three times: twice through a pool that owns its workspace and once */
+/*  through a pool that wraps fixed arrays.  The following ratios are */
+/*  computed on the first round: */
+
+/*  (1)   | A - U S VT | / ( |A| max(M,N) ulp )           (LAWSP_DGESDD) */
+/*  (2)   | I - U'U | / ( M ulp ) */
+/*  (3)   | I - VT VT' | / ( N ulp ) */
+/*  (4)   | A VR - VR W | / ( N |A| ulp )                 (LAWSP_DGEEV) */
+/*  (5)   | A'VL - VL W' | / ( N |A| ulp ) */
+/*  (6)   | H - Z D Z' | / ( N |H| ulp )                  (LAWSP_DSYEVR) */
+/*  (7)   | I - Z Z' | / ( N ulp ) */
+/*  (8)   | B - A X | / ( |A| |X| max(M,N) ulp )          (LAWSP_DGELSD) */
+
+/*  and from the later rounds */
+
+/*  (9)   0 if the second round made no workspace query and reproduced */
+/*        the results of the first bit for bit, 1/ulp otherwise. */
+/*  (10)  0 if the wrapped pool reproduced the results of the first */
+/*        round bit for bit, 1/ulp otherwise. */
+/*  (11)  0 if a pool wrapping a one-element WORK reports INFO = -12 */
+/*        through XERBLA for LAWSP_DGESDD, 1/ulp otherwise (N > 0). */
+
+/*  Arguments */
+/*  ========= */
+
+/*  THRESH  (input) DOUBLE PRECISION */
+/*          Threshold for residual tests.  A computed test ratio passes */
+/*          the threshold if it is less than THRESH. */
+
+/*  NIN     (input) INTEGER */
+/*          The logical unit number for input.  The next two lines give */
+/*          the number of values of N (at most 12) and the values of N */
+/*          (at most 32). */
+
+/*  NOUT    (input) INTEGER */
+/*          The logical unit number for output. */
+
+/*  ===================================================================== */
+
+/*     .. Executable Statements .. */
+
+    io___1.ciunit = *nin;
+    s_rsle(&io___1);
+    do_lio(&c__3, &c__1, (char *)&nn, (ftnlen)sizeof(integer));
+    e_rsle();
+    if (nn > 12) {
+	io___6.ciunit = *nout;
+	s_wsfe(&io___6);
+	do_fio(&c__1, "NN", (ftnlen)2);
+	do_fio(&c__1, (char *)&nn, (ftnlen)sizeof(integer));
+	i__1 = 12;
+	do_fio(&c__1, (char *)&i__1, (ftnlen)sizeof(integer));
+	e_wsfe();
+	return 0;
+    }
+    io___3.ciunit = *nin;
+    s_rsle(&io___3);
+    i__1 = nn;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	do_lio(&c__3, &c__1, (char *)&nval[i__ - 1], (ftnlen)sizeof(integer));
+    }
+    e_rsle();
+
+    io___9.ciunit = *nout;
+    s_wsfe(&io___9);
+    e_wsfe();
+
+    ulp = dlamch_("Precision");
+    ulpinv = 1. / ulp;
+    unfl = dlamch_("Safe minimum");
+    abstol = unfl + unfl;
+    rcond = -1.;
+    vl1 = 0.;
+    vu = 0.;
+    il = 0;
+    iu = 0;
+    iseed[0] = 1988;
+    iseed[1] = 1989;
+    iseed[2] = 1990;
+    iseed[3] = 1991;
+    nrun = 0;
+    nfail = 0;
+
+    pool = lawsp_create((doublereal *)0, 0, (integer *)0, 0);
+    wpool = lawsp_create(wrk, 40000, iwrk, 2000);
+
+    i__1 = nn;
+    for (j = 1; j <= i__1; ++j) {
+	n = nval[j - 1];
+	if (n < 0 || n > 32) {
+	    io___8.ciunit = *nout;
+	    s_wsfe(&io___8);
+	    do_fio(&c__1, "N", (ftnlen)1);
+	    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+	    do_fio(&c__1, (char *)&c__32, (ftnlen)sizeof(integer));
+	    e_wsfe();
+	    goto L100;
+	}
+	m = n + 4;
+
+/*        Generate A, H = S + S' and B = A*X0. */
+
+	i__2 = n;
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    dlarnv_(&c__2, iseed, &m, &asav[i__ * 40 - 40]);
+	    dlarnv_(&c__2, iseed, &n, &h__[i__ * 40 - 40]);
+	}
+	for (i__ = 1; i__ <= i__2; ++i__) {
+	    for (k = i__; k <= i__2; ++k) {
+		h__[k + i__ * 40 - 41] += h__[i__ + k * 40 - 41];
+		h__[i__ + k * 40 - 41] = h__[k + i__ * 40 - 41];
+	    }
+	}
+	dlarnv_(&c__2, iseed, &n, x);
+	dlarnv_(&c__2, iseed, &n, &x[40]);
+	dgemm_("No transpose", "No transpose", &m, &c__2, &n, &c_b30, asav, &
+		c__40, x, &c__40, &c_b31, bsav, &c__40);
+
+	for (i__ = 1; i__ <= 11; ++i__) {
+	    result[i__ - 1] = 0.;
+	}
+
+	for (iround = 1; iround <= 3; ++iround) {
+	    ws = iround <= 2 ? pool : wpool;
+	    nq = ws->nquery;
+	    mism = FALSE_;
+
+/*           LAWSP_DGESDD */
+
+	    dlacpy_("Full", &m, &n, asav, &c__40, a, &c__40);
+	    lawsp_dgesdd(ws, "A", &m, &n, a, &c__40, s, u, &c__40, vt, &c__40,
+		     &info);
+	    if (info != 0) {
+		io___20.ciunit = *nout;
+		s_wsfe(&io___20);
+		do_fio(&c__1, "DGESDD", (ftnlen)6);
+		do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&iround, (ftnlen)sizeof(integer));
+		e_wsfe();
+		result[iround == 1 ? 0 : iround + 6] = ulpinv;
+	    } else if (iround == 1) {
+		dbdt01_(&m, &n, &c__0, asav, &c__40, u, &c__40, s, dum, vt, &
+			c__40, work, result);
+
+/*              DGESDD does not reference U when N = 0. */
+
+		if (n > 0) {
+		    dort01_("Columns", &m, &m, u, &c__40, work, &c__6400, &
+			    result[1]);
+		}
+		dort01_("Rows", &n, &n, vt, &c__40, work, &c__6400, &result[2]);
+		dcopy_(&n, s, &c__1, s1, &c__1);
+	    } else {
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (s[i__ - 1] != s1[i__ - 1]) {
+			mism = TRUE_;
+		    }
+		}
+	    }
+
+/*           LAWSP_DGEEV */
+
+	    dlacpy_("Full", &n, &n, asav, &c__40, a, &c__40);
+	    lawsp_dgeev(ws, "V", "V", &n, a, &c__40, wr, wi, vl, &c__40, vr, &
+		    c__40, &info);
+	    if (info != 0) {
+		io___21.ciunit = *nout;
+		s_wsfe(&io___21);
+		do_fio(&c__1, "DGEEV ", (ftnlen)6);
+		do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&iround, (ftnlen)sizeof(integer));
+		e_wsfe();
+		result[iround == 1 ? 3 : iround + 6] = ulpinv;
+	    } else if (iround == 1) {
+		dget22_("N", "N", "N", &n, asav, &c__40, vr, &c__40, wr, wi,
+			work, res);
+		result[3] = res[0];
+		dget22_("T", "N", "T", &n, asav, &c__40, vl, &c__40, wr, wi,
+			work, res);
+		result[4] = res[0];
+		dcopy_(&n, wr, &c__1, wr1, &c__1);
+		dcopy_(&n, wi, &c__1, wi1, &c__1);
+	    } else {
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (wr[i__ - 1] != wr1[i__ - 1] || wi[i__ - 1] != wi1[i__
+			    - 1]) {
+			mism = TRUE_;
+		    }
+		}
+	    }
+
+/*           LAWSP_DSYEVR */
+
+	    dlacpy_("Full", &n, &n, h__, &c__40, a, &c__40);
+	    lawsp_dsyevr(ws, "V", "A", "L", &n, a, &c__40, &vl1, &vu, &il, &
+		    iu, &abstol, &mout, w, z__, &c__40, isuppz, &info);
+	    if (info != 0) {
+		io___22.ciunit = *nout;
+		s_wsfe(&io___22);
+		do_fio(&c__1, "DSYEVR", (ftnlen)6);
+		do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&iround, (ftnlen)sizeof(integer));
+		e_wsfe();
+		result[iround == 1 ? 5 : iround + 6] = ulpinv;
+	    } else if (iround == 1) {
+		dsyt21_(&c__1, "L", &n, &c__0, h__, &c__40, w, dum, z__, &
+			c__40, dum, &c__1, dum, work, &result[5]);
+		dcopy_(&n, w, &c__1, w1, &c__1);
+	    } else {
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (w[i__ - 1] != w1[i__ - 1]) {
+			mism = TRUE_;
+		    }
+		}
+	    }
+
+/*           LAWSP_DGELSD on the consistent system A*X = B */
+
+	    dlacpy_("Full", &m, &n, asav, &c__40, a, &c__40);
+	    dlacpy_("Full", &m, &c__2, bsav, &c__40, b, &c__40);
+	    lawsp_dgelsd(ws, &m, &n, &c__2, a, &c__40, b, &c__40, s, &rcond, &
+		    rank, &info);
+	    if (info != 0) {
+		io___23.ciunit = *nout;
+		s_wsfe(&io___23);
+		do_fio(&c__1, "DGELSD", (ftnlen)6);
+		do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&iround, (ftnlen)sizeof(integer));
+		e_wsfe();
+		result[iround == 1 ? 7 : iround + 6] = ulpinv;
+	    } else if (iround == 1) {
+		dlacpy_("Full", &m, &c__2, bsav, &c__40, x, &c__40);
+		dget02_("No transpose", &m, &n, &c__2, asav, &c__40, b, &
+			c__40, x, &c__40, work, &result[7]);
+		result[7] /= (doublereal) max(m,n);
+		dlacpy_("Full", &n, &c__2, b, &c__40, x1, &c__40);
+	    } else {
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (b[i__ - 1] != x1[i__ - 1] || b[i__ + 39] != x1[i__ +
+			    39]) {
+			mism = TRUE_;
+		    }
+		}
+	    }
+
+/*           The second round must hit the cache of the first. */
+
+	    if (iround == 2 && ws->nquery != nq) {
+		mism = TRUE_;
+	    }
+	    if (iround >= 2 && mism) {
+		result[iround + 6] = ulpinv;
+	    }
+	}
+
+/*        Error exit of a pool that is too small */
+
+	if (n > 0) {
+	    ws = lawsp_create(dum, 1, idum, 1);
+	    infoc_1.nunit = *nout;
+	    infoc_1.ok = TRUE_;
+	    infoc_1.lerr = FALSE_;
+	    infoc_1.infot = 12;
+	    s_copy(srnamc_1.srnamt, "DGESDD", (ftnlen)32, (ftnlen)6);
+	    dlacpy_("Full", &m, &n, asav, &c__40, a, &c__40);
+	    lawsp_dgesdd(ws, "A", &m, &n, a, &c__40, s, u, &c__40, vt, &c__40,
+		     &info);
+	    if (info != -12 || ! infoc_1.lerr || ! infoc_1.ok) {
+		result[10] = ulpinv;
+	    }
+	    infoc_1.infot = 0;
+	    lawsp_destroy(ws);
+	}
+
+/*        Print information about the tests that did not pass */
+
+	for (i__ = 1; i__ <= 11; ++i__) {
+	    if (i__ == 11 && n == 0) {
+		goto L90;
+	    }
+	    ++nrun;
+	    if (result[i__ - 1] >= *thresh) {
+		++nfail;
+		io___30.ciunit = *nout;
+		s_wsfe(&io___30);
+		do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&i__, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&result[i__ - 1], (ftnlen)sizeof(
+			doublereal));
+		e_wsfe();
+	    }
+L90:
+	    ;
+	}
+L100:
+	;
+    }
+
+    lawsp_destroy(pool);
+    lawsp_destroy(wpool);
+
+    if (nfail == 0) {
+	io___31.ciunit = *nout;
+	s_wsfe(&io___31);
+	do_fio(&c__1, "DWS", (ftnlen)3);
+	do_fio(&c__1, (char *)&nrun, (ftnlen)sizeof(integer));
+	e_wsfe();
+    } else {
+	io___32.ciunit = *nout;
+	s_wsfe(&io___32);
+	do_fio(&c__1, "DWS", (ftnlen)3);
+	do_fio(&c__1, (char *)&nfail, (ftnlen)sizeof(integer));
+	do_fio(&c__1, (char *)&nrun, (ftnlen)sizeof(integer));
+	e_wsfe();
+    }
+    return 0;
+
+/*     End of DCHKWS */
+
+} /* dchkws_ */
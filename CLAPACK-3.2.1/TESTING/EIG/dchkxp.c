@@ -0,0 +1,399 @@
+/* dchkxp.c -- DCHKXP, tests of the matrix exponential drivers. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__3 = 3;
+static integer c__1 = 1;
+static integer c__2 = 2;
+static integer c__40 = 40;
+static integer c__10000 = 10000;
+static doublereal c_b10 = 10.;
+static doublereal c_b20 = 1.;
+static doublereal c_b21 = 0.;
+static doublereal c_b22 = -1.;
+
+/* Subroutine */ int dchkxp_(doublereal *thresh, integer *nin, integer *nout)
+{
+    /* Initialized data */
+
+    static doublereal tval[4] = { .01,1.,-8.,30. };
+    static char balancs[1*3] = "NBS";
+
+    /* Format strings */
+    static char fmt_9999[] = "(/\002 Tests of the matrix exponential and p"
+	    "hi function\002,\002 drivers\002,/\002 DGEXPM, DGEPHI\002,/)";
+    static char fmt_9998[] = "(\002 Invalid input value: \002,a4,\002=\002,"
+	    "i6,\002; must be <=\002,i6)";
+    static char fmt_9997[] = "(1x,a6,\002 returned INFO=\002,i6,\002, N="
+	    "\002,i5,\002, type \002,i2,\002, T=\002,g11.4)";
+    static char fmt_9996[] = "(\002 N=\002,i5,\002, type \002,i2,\002, T="
+	    "\002,g11.4,\002, test(\002,i2,\002) =\002,g13.6)";
+    static char fmt_9995[] = "(/1x,\002All tests for \002,a3,\002 routines p"
+	    "assed the thresh\002,\002old (\002,i6,\002 tests run)\002)";
+    static char fmt_9994[] = "(/1x,a3,\002 routines: \002,i6,\002 out of "
+	    "\002,i6,\002 tests failed to pass the threshold\002)";
+
+    /* System generated locals */
+    integer i__1, i__2;
+    doublereal d__1, d__2;
+
+    /* Builtin functions */
+    integer s_rsle(cilist *), do_lio(integer *, integer *, char *, ftnlen),
+	    e_rsle(void), s_wsfe(cilist *), e_wsfe(void), do_fio(integer *,
+	    char *, ftnlen);
+    double pow_dd(doublereal *, doublereal *);
+
+    /* Local variables */
+    static doublereal a[1600]	/* was [40][40] */, ab[1600]	/* was
+	    [40][40] */, e1[1600]	/* was [40][40] */, e2[1600]	/* was
+	    [40][40] */, e3[1600]	/* was [40][40] */, r__[1600]	/* was
+	    [40][40] */, phi[6400]	/* was [40][40][4] */;
+    static doublereal work[10000];
+    integer i__, j, k, n, in, is, nn, it, ip, ip1, info, iwork[43], itype, 
+	    nrun, nval[12];
+    doublereal t, ts, ulp, fact, cnd, anrm, enrm, fnrm, rnrm, smlnum;
+    integer nfail, iseed[4];
+    doublereal result[5];
+    extern /* Subroutine */ int dgemm_(char *, char *, integer *, integer *,
+	    integer *, doublereal *, doublereal *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, integer *);
+    extern doublereal dlamch_(char *), dlange_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *);
+    extern /* Subroutine */ int dlacpy_(char *, integer *, integer *,
+	    doublereal *, integer *, doublereal *, integer *), dlarnv_(
+	    integer *, integer *, integer *, doublereal *), dgexpm_(char *,
+	    char *, integer *, doublereal *, doublereal *, integer *,
+	    doublereal *, integer *, doublereal *, integer *, integer *,
+	    integer *), dgephi_(char *, char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, integer *, integer *, integer *);
+
+    /* Fortran I/O blocks */
+    static cilist io___1 = { 0, 0, 0, 0, 0 };
+    static cilist io___3 = { 0, 0, 0, 0, 0 };
+    static cilist io___5 = { 0, 0, 0, fmt_9998, 0 };
+    static cilist io___6 = { 0, 0, 0, fmt_9998, 0 };
+    static cilist io___7 = { 0, 0, 0, fmt_9999, 0 };
+    static cilist io___20 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___30 = { 0, 0, 0, fmt_9996, 0 };
+    static cilist io___31 = { 0, 0, 0, fmt_9995, 0 };
+    static cilist io___32 = { 0, 0, 0, fmt_9994, 0 };
+
+
+
+/*  Purpose */
+/*  ======= */
+
+/*  DCHKXP tests the matrix exponential driver DGEXPM and the phi */
+/*  function driver DGEPHI. */
+
+/*  For each N, three types of N-by-N matrices A, scaled to */
+/*  ||A||_1 = 1, and each T in TVAL, the following ratios are computed, */
+/*  where E = exp(T*A) from DGEXPM, CND = max(1,|T|) and */
+/*  PHI_k = phi_k(T*A) from DGEPHI, k = 0, ..., 3: */
+
+/*  (1)   | E * exp(-T*A) - I | / ( |E| |exp(-T*A)| N ulp CND ) */
+/*  (2)   | E - E_F | / ( |E| ulp ), E_F from a second call with */
+/*        FACT = 'F' after computing exp(-T*A) */
+/*  (3)   | A*E - E*A | / ( |A| |E| N ulp CND ) */
+/*  (4)   | PHI_0 - E | / ( |E| N ulp CND ), also for -T with */
+/*        FACT = 'F' */
+/*  (5)   max_k | T*A*PHI_(k+1) - PHI_k + I/k! | / */
+/*           ( ( |T*A| |PHI_(k+1)| + |PHI_k| + 1/k! ) N ulp CND ) */
+
+/*  Matrix types: */
+/*  1.  Random entries, BALANC = 'N'. */
+/*  2.  Random upper triangular (nonnormal), BALANC = 'B'. */
+/*  3.  Random entries with row i scaled by 10**(4*(2i-N-1)/N) and */
+/*      column j by the inverse, BALANC = 'S'. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  THRESH  (input) DOUBLE PRECISION */
+/*          Threshold for residual tests.  A computed test ratio passes */
+/*          the threshold if it is less than THRESH. */
+
+/*  NIN     (input) INTEGER */
+/*          The logical unit number for input.  The next two lines give */
+/*          the number of values of N (at most 12) and the values of N */
+/*          (at most 40). */
+
+/*  NOUT    (input) INTEGER */
+/*          The logical unit number for output. */
+
+/*  ===================================================================== */
+
+/*     .. Executable Statements .. */
+
+    io___1.ciunit = *nin;
+    s_rsle(&io___1);
+    do_lio(&c__3, &c__1, (char *)&nn, (ftnlen)sizeof(integer));
+    e_rsle();
+    if (nn > 12) {
+	io___5.ciunit = *nout;
+	s_wsfe(&io___5);
+	do_fio(&c__1, "NN", (ftnlen)2);
+	do_fio(&c__1, (char *)&nn, (ftnlen)sizeof(integer));
+	i__1 = 12;
+	do_fio(&c__1, (char *)&i__1, (ftnlen)sizeof(integer));
+	e_wsfe();
+	return 0;
+    }
+    io___3.ciunit = *nin;
+    s_rsle(&io___3);
+    i__1 = nn;
+    for (i__ = 1; i__ <= i__1; ++i__) {
+	do_lio(&c__3, &c__1, (char *)&nval[i__ - 1], (ftnlen)sizeof(integer));
+    }
+    e_rsle();
+
+    io___7.ciunit = *nout;
+    s_wsfe(&io___7);
+    e_wsfe();
+
+    ulp = dlamch_("Precision");
+    smlnum = dlamch_("Safe minimum") / ulp;
+    iseed[0] = 1988;
+    iseed[1] = 1989;
+    iseed[2] = 1990;
+    iseed[3] = 1991;
+    nrun = 0;
+    nfail = 0;
+
+    i__1 = nn;
+    for (in = 1; in <= i__1; ++in) {
+	n = nval[in - 1];
+	if (n < 0 || n > 40) {
+	    io___6.ciunit = *nout;
+	    s_wsfe(&io___6);
+	    do_fio(&c__1, "N", (ftnlen)1);
+	    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+	    do_fio(&c__1, (char *)&c__40, (ftnlen)sizeof(integer));
+	    e_wsfe();
+	    goto L200;
+	}
+
+	for (itype = 1; itype <= 3; ++itype) {
+
+/*           Generate A and scale it to unit 1-norm. */
+
+	    i__2 = n;
+	    for (j = 1; j <= i__2; ++j) {
+		dlarnv_(&c__2, iseed, &n, &a[j * 40 - 40]);
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (itype == 2 && i__ > j) {
+			a[i__ + j * 40 - 41] = 0.;
+		    } else if (itype == 3) {
+			d__1 = (doublereal) ((i__ - j) << 3) / (doublereal) 
+				n;
+			a[i__ + j * 40 - 41] *= pow_dd(&c_b10, &d__1);
+		    }
+		}
+	    }
+	    anrm = dlange_("1", &n, &n, a, &c__40, work);
+	    if (anrm > 0.) {
+		for (j = 1; j <= i__2; ++j) {
+		    for (i__ = 1; i__ <= i__2; ++i__) {
+			a[i__ + j * 40 - 41] /= anrm;
+		    }
+		}
+		anrm = dlange_("1", &n, &n, a, &c__40, work);
+	    }
+
+	    for (it = 1; it <= 4; ++it) {
+		t = tval[it - 1];
+		cnd = max(1.,abs(t));
+		for (k = 1; k <= 5; ++k) {
+		    result[k - 1] = 0.;
+		}
+
+/*              Tests 1 to 3:  DGEXPM with FACT = 'N', then FACT = 'F' */
+/*              for -T and again for T. */
+
+		dlacpy_("Full", &n, &n, a, &c__40, ab, &c__40);
+		dgexpm_("N", balancs + (itype - 1), &n, &t, ab, &c__40, e1, &
+			c__40, work, &c__10000, iwork, &info);
+		if (info == 0) {
+		    d__1 = -t;
+		    dgexpm_("F", balancs + (itype - 1), &n, &d__1, ab, &c__40,
+			     e2, &c__40, work, &c__10000, iwork, &info);
+		}
+		if (info == 0) {
+		    dgexpm_("F", balancs + (itype - 1), &n, &t, ab, &c__40,
+			    e3, &c__40, work, &c__10000, iwork, &info);
+		}
+		if (info != 0) {
+		    io___20.ciunit = *nout;
+		    s_wsfe(&io___20);
+		    do_fio(&c__1, "DGEXPM", (ftnlen)6);
+		    do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&itype, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&t, (ftnlen)sizeof(doublereal));
+		    e_wsfe();
+		    for (k = 1; k <= 3; ++k) {
+			result[k - 1] = 1. / ulp;
+		    }
+		    goto L100;
+		}
+
+/*              R = E * exp(-T*A) - I */
+
+		dgemm_("N", "N", &n, &n, &n, &c_b20, e1, &c__40, e2, &c__40, &
+			c_b21, r__, &c__40);
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    r__[i__ + i__ * 40 - 41] += -1.;
+		}
+		enrm = dlange_("1", &n, &n, e1, &c__40, work);
+		fnrm = dlange_("1", &n, &n, e2, &c__40, work);
+		rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+/* Computing MAX */
+		d__1 = smlnum, d__2 = enrm * fnrm;
+		result[0] = rnrm / max(d__1,d__2) / ((doublereal) max(n,1) *
+			ulp * cnd);
+
+/*              R = E - E_F */
+
+		for (j = 1; j <= i__2; ++j) {
+		    for (i__ = 1; i__ <= i__2; ++i__) {
+			r__[i__ + j * 40 - 41] = e1[i__ + j * 40 - 41] - e3[
+				i__ + j * 40 - 41];
+		    }
+		}
+		rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+		result[1] = rnrm / max(smlnum,enrm) / ulp;
+
+/*              R = A*E - E*A */
+
+		dgemm_("N", "N", &n, &n, &n, &c_b20, a, &c__40, e1, &c__40, &
+			c_b21, r__, &c__40);
+		dgemm_("N", "N", &n, &n, &n, &c_b22, e1, &c__40, a, &c__40, &
+			c_b20, r__, &c__40);
+		rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+/* Computing MAX */
+		d__1 = smlnum, d__2 = anrm * enrm;
+		result[2] = rnrm / max(d__1,d__2) / ((doublereal) max(n,1) *
+			ulp * cnd);
+
+/*              Tests 4 and 5:  DGEPHI with P = 3, FACT = 'N' for T */
+/*              and FACT = 'F' for -T. */
+
+L100:
+		dlacpy_("Full", &n, &n, a, &c__40, ab, &c__40);
+		for (is = 1; is <= 2; ++is) {
+		    if (is == 1) {
+			ts = t;
+			dgephi_("N", balancs + (itype - 1), &n, &c__3, &ts, 
+				ab, &c__40, phi, &c__40, work, &c__10000, 
+				iwork, &info);
+		    } else {
+			ts = -t;
+			dgephi_("F", balancs + (itype - 1), &n, &c__3, &ts, 
+				ab, &c__40, phi, &c__40, work, &c__10000, 
+				iwork, &info);
+		    }
+		    if (info != 0) {
+			io___20.ciunit = *nout;
+			s_wsfe(&io___20);
+			do_fio(&c__1, "DGEPHI", (ftnlen)6);
+			do_fio(&c__1, (char *)&info, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&itype, (ftnlen)sizeof(integer))
+				;
+			do_fio(&c__1, (char *)&ts, (ftnlen)sizeof(doublereal))
+				;
+			e_wsfe();
+			result[3] = 1. / ulp;
+			result[4] = 1. / ulp;
+			goto L150;
+		    }
+
+/*                 R = PHI_0 - exp(T*A) */
+
+		    enrm = dlange_("1", &n, &n, is == 1 ? e1 : e2, &c__40,
+			    work);
+		    for (j = 1; j <= i__2; ++j) {
+			for (i__ = 1; i__ <= i__2; ++i__) {
+			    r__[i__ + j * 40 - 41] = phi[i__ + j * 40 - 41] - (
+				    is == 1 ? e1 : e2)[i__ + j * 40 - 41];
+			}
+		    }
+		    rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+		    d__1 = rnrm / max(smlnum,enrm) / ((doublereal) max(n,1) *
+			    ulp * cnd);
+		    result[3] = max(result[3],d__1);
+
+/*                 R = T*A*PHI_(k+1) - PHI_k + I/k!.  PHI_k starts at */
+/*                 PHI(1,1,k), that is at offset k*40*N. */
+
+		    fact = 1.;
+		    for (k = 0; k <= 2; ++k) {
+			if (k > 0) {
+			    fact *= (doublereal) k;
+			}
+			ip = k * 40 * n;
+			ip1 = ip + 40 * n;
+			dlacpy_("Full", &n, &n, &phi[ip], &c__40, r__, &c__40);
+			for (i__ = 1; i__ <= i__2; ++i__) {
+			    r__[i__ + i__ * 40 - 41] -= 1. / fact;
+			}
+			dgemm_("N", "N", &n, &n, &n, &ts, a, &c__40, &phi[ip1],
+				 &c__40, &c_b22, r__, &c__40);
+			rnrm = dlange_("1", &n, &n, r__, &c__40, work);
+			enrm = dlange_("1", &n, &n, &phi[ip], &c__40, work);
+			fnrm = dlange_("1", &n, &n, &phi[ip1], &c__40, work);
+			d__1 = abs(ts) * anrm * fnrm + enrm + 1. / fact;
+			d__1 = rnrm / d__1 / ((doublereal) max(n,1) * ulp *
+				cnd);
+			result[4] = max(result[4],d__1);
+		    }
+		}
+
+/*              Print information about the tests that did not pass */
+
+L150:
+		for (k = 1; k <= 5; ++k) {
+		    ++nrun;
+		    if (result[k - 1] >= *thresh) {
+			++nfail;
+			io___30.ciunit = *nout;
+			s_wsfe(&io___30);
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&itype, (ftnlen)sizeof(integer))
+				;
+			do_fio(&c__1, (char *)&t, (ftnlen)sizeof(doublereal));
+			do_fio(&c__1, (char *)&k, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&result[k - 1], (ftnlen)sizeof(
+				doublereal));
+			e_wsfe();
+		    }
+		}
+	    }
+	}
+L200:
+	;
+    }
+
+    if (nfail == 0) {
+	io___31.ciunit = *nout;
+	s_wsfe(&io___31);
+	do_fio(&c__1, "DXP", (ftnlen)3);
+	do_fio(&c__1, (char *)&nrun, (ftnlen)sizeof(integer));
+	e_wsfe();
+    } else {
+	io___32.ciunit = *nout;
+	s_wsfe(&io___32);
+	do_fio(&c__1, "DXP", (ftnlen)3);
+	do_fio(&c__1, (char *)&nfail, (ftnlen)sizeof(integer));
+	do_fio(&c__1, (char *)&nrun, (ftnlen)sizeof(integer));
+	e_wsfe();
+    }
+    return 0;
+
+/*     End of DCHKXP */
+
+} /* dchkxp_ */
@@ -35,6 +35,7 @@ static doublereal c_b17 = 1.;
 static integer c__4 = 4;
 static integer c__1 = 1;
 static integer c__0 = 0;
+static integer c_n1 = -1;
 
 /* Subroutine */ int ddrvbd_(integer *nsizes, integer *mm, integer *nn, 
 	integer *ntypes, logical *dotype, integer *iseed, doublereal *thresh, 
@@ -82,7 +83,19 @@ static integer c__0 = 0;
 	    "min(M,N) nonnegative values in\002,\002 decreasing order, else 1"
 	    "/ulp\002,/\00219 = | U - Upartial | / ( M ulp )\002,/\00220 = | "
 	    "VT - VTpartial | / ( N ulp )\002,/\00221 = | S - Spartial | / ( "
-	    "min(M,N) ulp |S| )\002,//)";
+	    "min(M,N) ulp |S| )\002,/\00223 = | A - U diag(S) VT | / ( |A| "
+	    "max(M,N) ulp ) \002,/\00224 = | I - U**T U | / ( M ulp ) \002,/"
+	    "\00225 = | I - VT VT**T | / ( N ulp ) \002,/\00226 = 0 if S con"
+	    "tains min(M,N) nonnegative values in\002,\002 decreasing order, "
+	    "else 1/ulp\002,/\00227 = | A - U diag(S) VT | / ( |A| max(M,N) "
+	    "ulp ) \002,/\00228 = | I - U**T U | / ( M ulp ) \002,/\00229 = "
+	    "| I - VT VT**T | / ( N ulp ) \002,/\00230 = 0 if S contains min"
+	    "(M,N) nonnegative values in\002,\002 decreasing order, else 1/ulp"
+	    "\002,/\00231 = | A - U diag(S) VT | / ( |A| max(M,N) ulp ) \002,/"
+	    "\00232 = | I - U**T U | / ( M ulp ) \002,/\00233 = | I - VT VT**"
+	    "T | / ( N ulp ) \002,/\00234 = 0 if S contains min(M,N) nonnega"
+	    "tive values in\002,\002 decreasing order, else 1/ulp\002,/\00235"
+	    " = | S - Spartial | / ( min(M,N) ulp |S| )\002,//)";
     static char fmt_9997[] = "(\002 M=\002,i5,\002, N=\002,i5,\002, type "
 	    "\002,i1,\002, IWS=\002,i1,\002, seed=\002,4(i4,\002,\002),\002 t"
 	    "est(\002,i2,\002)=\002,g11.4)";
@@ -144,9 +157,22 @@ static integer c__0 = 0;
 	    doublereal *, integer *, doublereal *, integer *), dgejsv_(char *, char *, char *, char *, char *, char *, 
 	    integer *, integer *, doublereal *, integer *, doublereal *, 
 	    doublereal *, integer *, doublereal *, integer *, doublereal *, 
-	    integer *, integer *, integer *);
+	    integer *, integer *, integer *), dgesvjb_(char *, char *, 
+	    integer *, integer *, integer *, doublereal *, integer *, 
+	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
+	    integer *);
+    extern /* Subroutine */ int dgesdd2_(char *, integer *, integer *, 
+	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
+	    doublereal *, integer *, doublereal *, integer *, integer *, 
+	    integer *), dgesvdr_(char *, integer *, integer *, 
+	    integer *, integer *, integer *, doublereal *, integer *, 
+	    doublereal *, doublereal *, integer *, doublereal *, integer *, 
+	    integer *, doublereal *, doublereal *, integer *, integer *, 
+	    integer *);
     integer minwrk;
-    doublereal ulpinv, result[22];
+    doublereal dum[1], errest;
+    integer iseedr[4];
+    doublereal ulpinv, result[35];
     integer lswork, mtypes;
 
     /* Fortran I/O blocks */
@@ -158,6 +184,9 @@ static integer c__0 = 0;
     static cilist io___43 = { 0, 0, 0, fmt_9999, 0 };
     static cilist io___44 = { 0, 0, 0, fmt_9998, 0 };
     static cilist io___45 = { 0, 0, 0, fmt_9997, 0 };
+    static cilist io___46 = { 0, 0, 0, fmt_9995, 0 };
+    static cilist io___47 = { 0, 0, 0, fmt_9995, 0 };
+    static cilist io___48 = { 0, 0, 0, fmt_9995, 0 };
 
 
 
@@ -174,7 +203,7 @@ static integer c__0 = 0;
 /*  ======= */
 
 /*  DDRVBD checks the singular value decomposition (SVD) drivers */
-/*  DGESVD, DGESDD, DGESVJ, and DGEJSV. */
+/*  DGESVD, DGESDD, DGESVJ, DGEJSV, DGESVDR, DGESVJB and DGESDD2. */
 
 /*  Both DGESVD and DGESDD factor A = U diag(S) VT, where U and VT are */
 /*  orthogonal and diag(S) is diagonal with the entries of the array S */
@@ -254,6 +283,43 @@ static integer c__0 = 0;
 /*  (22)   S contains MNMIN nonnegative values in decreasing order. */
 /*         (Return 0 if true, 1/ULP if false.) */
 
+/*  Test for DGESVDR, with K = MNMIN, so that the randomized range */
+/*  finder must capture the whole range of A: */
+
+/*  (23)    | A - U diag(S) VT | / ( |A| max(M,N) ulp ) */
+
+/*  (24)    | I - U'U | / ( M ulp ) */
+
+/*  (25)   | I - VT VT' | / ( N ulp ) */
+
+/*  (26)   S contains MNMIN nonnegative values in decreasing order. */
+/*         (Return 0 if true, 1/ULP if false.) */
+
+/*  Test for DGESVJB: */
+
+/*  (27)    | A - U diag(S) VT | / ( |A| max(M,N) ulp ) */
+
+/*  (28)    | I - U'U | / ( M ulp ) */
+
+/*  (29)   | I - VT VT' | / ( N ulp ) */
+
+/*  (30)   S contains MNMIN nonnegative values in decreasing order. */
+/*         (Return 0 if true, 1/ULP if false.) */
+
+/*  Test for DGESDD2 (two-stage reduction through DGEBND): */
+
+/*  (31)    | A - U diag(S) VT | / ( |A| max(M,N) ulp ), with JOBZ='S' */
+
+/*  (32)    | I - U'U | / ( M ulp ) */
+
+/*  (33)   | I - VT VT' | / ( N ulp ) */
+
+/*  (34)   S contains MNMIN nonnegative values in decreasing order. */
+/*         (Return 0 if true, 1/ULP if false.) */
+
+/*  (35)   | S - Spartial | / ( MNMIN ulp |S| ) where Spartial is the */
+/*         vector of singular values computed with JOBZ='N' */
+
 /*  The "sizes" are specified by the arrays MM(1:NSIZES) and */
 /*  NN(1:NSIZES); the value of each element pair (MM(j),NN(j)) */
 /*  specifies one size.  The "types" are specified by a logical array */
@@ -350,6 +416,8 @@ static integer c__0 = 0;
 /*          The number of entries in WORK.  This must be at least */
 /*          max(3*MN+MX,5*MN-4)+2*MN**2 for all pairs */
 /*          pairs  (MN,MX)=( min(MM(j),NN(j), max(MM(j),NN(j)) ) */
+/*          DGESVDR is run with its optimal workspace, which must */
+/*          also fit in LWORK. */
 
 /*  IWORK   (workspace) INTEGER array, dimension at least 8*min(M,N) */
 
@@ -1059,9 +1127,251 @@ L70:
 		    }
 		}
 
+/*              Test DGESVDR: K = MNMIN singular triplets, with one */
+/*              power iteration.  The sketching matrix is drawn from a */
+/*              copy of the seed, so the test matrices do not change. */
+
+		result[22] = 0.;
+		result[23] = 0.;
+		result[24] = 0.;
+		result[25] = 0.;
+		for (j = 1; j <= 4; ++j) {
+		    iseedr[j - 1] = ioldsd[j - 1];
+		}
+		dgesvdr_("V", &m, &n, &mnmin, &c__0, &c__1, &asav[asav_offset]
+			, lda, &ssav[1], &usav[usav_offset], ldu, &vtsav[
+			vtsav_offset], ldvt, iseedr, &errest, &work[1], &c_n1, &
+			iwork[1], &iinfo);
+		lswork = (integer) work[1];
+		lswork = min(lswork,*lwork);
+		s_copy(srnamc_1.srnamt, "DGESVDR", (ftnlen)32, (ftnlen)7);
+		dgesvdr_("V", &m, &n, &mnmin, &c__0, &c__1, &asav[asav_offset]
+			, lda, &ssav[1], &usav[usav_offset], ldu, &vtsav[
+			vtsav_offset], ldvt, iseedr, &errest, &work[1], &lswork, 
+			&iwork[1], &iinfo);
+		if (iinfo != 0) {
+		    io___46.ciunit = *nout;
+		    s_wsfe(&io___46);
+		    do_fio(&c__1, "GESVDR", (ftnlen)6);
+		    do_fio(&c__1, (char *)&iinfo, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&jtype, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&lswork, (ftnlen)sizeof(integer));
+		    do_fio(&c__4, (char *)&ioldsd[0], (ftnlen)sizeof(integer))
+			    ;
+		    e_wsfe();
+		    *info = abs(iinfo);
+		    return 0;
+		}
+
+/*              Do tests 23--26 */
+
+		dbdt01_(&m, &n, &c__0, &asav[asav_offset], lda, &usav[
+			usav_offset], ldu, &ssav[1], &e[1], &vtsav[
+			vtsav_offset], ldvt, &work[1], &result[22]);
+		if (m != 0 && n != 0) {
+		    dort01_("Columns", &m, &mnmin, &usav[usav_offset], ldu, &
+			    work[1], lwork, &result[23]);
+		    dort01_("Rows", &mnmin, &n, &vtsav[vtsav_offset], ldvt, &
+			    work[1], lwork, &result[24]);
+		}
+		i__3 = mnmin - 1;
+		for (i__ = 1; i__ <= i__3; ++i__) {
+		    if (ssav[i__] < ssav[i__ + 1]) {
+			result[25] = ulpinv;
+		    }
+		    if (ssav[i__] < 0.) {
+			result[25] = ulpinv;
+		    }
+/* L310: */
+		}
+		if (mnmin >= 1) {
+		    if (ssav[mnmin] < 0.) {
+			result[25] = ulpinv;
+		    }
+		}
+
+/*              Test DGESVJB: Factorize A, with the block size from */
+/*              ILAENV.  DGESVJB must converge (INFO = 0). */
+/*              Note: DGESVJB does not work for M < N */
+
+		result[26] = 0.;
+		result[27] = 0.;
+		result[28] = 0.;
+		result[29] = 0.;
+		if (m >= n) {
+		    dgesvjb_("U", "V", &m, &n, &c__0, &usav[usav_offset], lda, &
+			    ssav[1], &a[a_offset], ldvt, &work[1], &c_n1, &
+			    iinfo);
+		    lswork = (integer) work[1];
+		    lswork = min(lswork,*lwork);
+
+		    dlacpy_("F", &m, &n, &asav[asav_offset], lda, &usav[
+			    usav_offset], lda);
+		    s_copy(srnamc_1.srnamt, "DGESVJB", (ftnlen)32, (ftnlen)7);
+		    dgesvjb_("U", "V", &m, &n, &c__0, &usav[usav_offset], lda, &
+			    ssav[1], &a[a_offset], ldvt, &work[1], &lswork, &
+			    iinfo);
+
+/*                 DGESVJB returns V not VT, so we transpose to use the */
+/*                 same test suite. */
+
+		    i__3 = n;
+		    for (j = 1; j <= i__3; ++j) {
+			i__4 = n;
+			for (i__ = 1; i__ <= i__4; ++i__) {
+			    vtsav[j + i__ * vtsav_dim1] = a[i__ + j * a_dim1];
+			}
+		    }
+
+		    if (iinfo != 0) {
+			io___47.ciunit = *nout;
+			s_wsfe(&io___47);
+			do_fio(&c__1, "GESVJB", (ftnlen)6);
+			do_fio(&c__1, (char *)&iinfo, (ftnlen)sizeof(integer))
+				;
+			do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&jtype, (ftnlen)sizeof(integer))
+				;
+			do_fio(&c__1, (char *)&lswork, (ftnlen)sizeof(integer)
+				);
+			do_fio(&c__4, (char *)&ioldsd[0], (ftnlen)sizeof(
+				integer));
+			e_wsfe();
+			*info = abs(iinfo);
+			return 0;
+		    }
+
+/*                 Do tests 27--30 */
+
+		    dbdt01_(&m, &n, &c__0, &asav[asav_offset], lda, &usav[
+			    usav_offset], ldu, &ssav[1], &e[1], &vtsav[
+			    vtsav_offset], ldvt, &work[1], &result[26]);
+		    if (m != 0 && n != 0) {
+			dort01_("Columns", &m, &m, &usav[usav_offset], ldu, &
+				work[1], lwork, &result[27]);
+			dort01_("Rows", &n, &n, &vtsav[vtsav_offset], ldvt, &
+				work[1], lwork, &result[28]);
+		    }
+		    result[29] = 0.;
+		    i__3 = mnmin - 1;
+		    for (i__ = 1; i__ <= i__3; ++i__) {
+			if (ssav[i__] < ssav[i__ + 1]) {
+			    result[29] = ulpinv;
+			}
+			if (ssav[i__] < 0.) {
+			    result[29] = ulpinv;
+			}
+/* L320: */
+		    }
+		    if (mnmin >= 1) {
+			if (ssav[mnmin] < 0.) {
+			    result[29] = ulpinv;
+			}
+		    }
+		}
+
+/*              Test DGESDD2: Factorize A with JOBZ = 'S', then compute */
+/*              the singular values alone with JOBZ = 'N'. */
+
+		result[30] = 0.;
+		result[31] = 0.;
+		result[32] = 0.;
+		result[33] = 0.;
+		result[34] = 0.;
+		dgesdd2_("S", &m, &n, &a[a_offset], lda, &ssav[1], &usav[
+			usav_offset], ldu, &vtsav[vtsav_offset], ldvt, &work[1], 
+			&c_n1, &iwork[1], &iinfo);
+		lswork = (integer) work[1];
+		lswork = min(lswork,*lwork);
+
+		dlacpy_("F", &m, &n, &asav[asav_offset], lda, &a[a_offset], 
+			lda);
+		s_copy(srnamc_1.srnamt, "DGESDD2", (ftnlen)32, (ftnlen)7);
+		dgesdd2_("S", &m, &n, &a[a_offset], lda, &ssav[1], &usav[
+			usav_offset], ldu, &vtsav[vtsav_offset], ldvt, &work[1], 
+			&lswork, &iwork[1], &iinfo);
+		if (iinfo != 0) {
+		    io___48.ciunit = *nout;
+		    s_wsfe(&io___48);
+		    do_fio(&c__1, "GESDD2", (ftnlen)6);
+		    do_fio(&c__1, (char *)&iinfo, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&jtype, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&lswork, (ftnlen)sizeof(integer));
+		    do_fio(&c__4, (char *)&ioldsd[0], (ftnlen)sizeof(integer))
+			    ;
+		    e_wsfe();
+		    *info = abs(iinfo);
+		    return 0;
+		}
+
+/*              Do tests 31--34 */
+
+		dbdt01_(&m, &n, &c__0, &asav[asav_offset], lda, &usav[
+			usav_offset], ldu, &ssav[1], &e[1], &vtsav[
+			vtsav_offset], ldvt, &work[1], &result[30]);
+		if (m != 0 && n != 0) {
+		    dort01_("Columns", &m, &mnmin, &usav[usav_offset], ldu, &
+			    work[1], lwork, &result[31]);
+		    dort01_("Rows", &mnmin, &n, &vtsav[vtsav_offset], ldvt, &
+			    work[1], lwork, &result[32]);
+		}
+		i__3 = mnmin - 1;
+		for (i__ = 1; i__ <= i__3; ++i__) {
+		    if (ssav[i__] < ssav[i__ + 1]) {
+			result[33] = ulpinv;
+		    }
+		    if (ssav[i__] < 0.) {
+			result[33] = ulpinv;
+		    }
+/* L330: */
+		}
+		if (mnmin >= 1) {
+		    if (ssav[mnmin] < 0.) {
+			result[33] = ulpinv;
+		    }
+		}
+
+/*              Do test 35:  compare S with the values from JOBZ = 'N' */
+
+		dlacpy_("F", &m, &n, &asav[asav_offset], lda, &a[a_offset], 
+			lda);
+		dgesdd2_("N", &m, &n, &a[a_offset], lda, &s[1], dum, &c__1, 
+			dum, &c__1, &work[1], &lswork, &iwork[1], &iinfo);
+		if (iinfo != 0) {
+		    io___48.ciunit = *nout;
+		    s_wsfe(&io___48);
+		    do_fio(&c__1, "GESDD2", (ftnlen)6);
+		    do_fio(&c__1, (char *)&iinfo, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&jtype, (ftnlen)sizeof(integer));
+		    do_fio(&c__1, (char *)&lswork, (ftnlen)sizeof(integer));
+		    do_fio(&c__4, (char *)&ioldsd[0], (ftnlen)sizeof(integer))
+			    ;
+		    e_wsfe();
+		    *info = abs(iinfo);
+		    return 0;
+		}
+/* Computing MAX */
+		d__1 = (doublereal) mnmin * ulp * ssav[1];
+		div = max(d__1,unfl);
+		i__3 = mnmin;
+		for (i__ = 1; i__ <= i__3; ++i__) {
+/* Computing MAX */
+		    d__2 = result[34], d__3 = (d__1 = ssav[i__] - s[i__], abs(
+			    d__1)) / div;
+		    result[34] = max(d__2,d__3);
+/* L340: */
+		}
+
 /*              End of Loop -- Check for RESULT(j) > THRESH */
 
-		for (j = 1; j <= 22; ++j) {
+		for (j = 1; j <= 35; ++j) {
 		    if (result[j - 1] >= *thresh) {
 			if (nfail == 0) {
 			    io___43.ciunit = *nout;
@@ -1088,7 +1398,7 @@ L70:
 		    }
 /* L120: */
 		}
-		ntest += 22;
+		ntest += 35;
 
 /* L130: */
 	    }
@@ -49,6 +49,11 @@ static integer c__8 = 8;
 	    "orm(XACT) * (error bound) )\002)";
     static char fmt_9956[] = "(3x,i2,\002: (backward error)   / EPS\002)";
     static char fmt_9955[] = "(3x,i2,\002: RCOND * CNDNUM - 1.0\002)";
+    static char fmt_9919[] = "(3x,\002 9-10: same as 8 for DGECONB and DGETRF"
+	    "C\002,/3x,\002   11: same as 1 for DGETRFC\002,/3x,\002   12: "
+	    "|LOGDET(A) - LOGDET(A**T)| * RCOND / ( N * EPS )\002)";
+    static char fmt_9918[] = "(3x,\002 9: |LOGDET(A) - LOGDET(A, by DGELDE"
+	    "T)| * RCOND / ( N * EPS )\002)";
     static char fmt_9998[] = "(/1x,a3,\002:  General band matrices\002)";
     static char fmt_9978[] = "(4x,\0021. Random, CNDNUM = 2\002,14x,\0025. R"
 	    "andom, CNDNUM = sqrt(0.1/EPS)\002,/4x,\0022. First column zer"
@@ -234,7 +239,9 @@ static integer c__8 = 8;
 	    "flow\002)";
     static char fmt_9921[] = "(\002 Test ratios:\002,/\002    (1-2: \002,a1"
 	    ",\002GELS, 3-6: \002,a1,\002GELSX, 7-10: \002,a1,\002GELSY, 11-1"
-	    "4: \002,a1,\002GELSS, 15-18: \002,a1,\002GELSD)\002)";
+	    "4: \002,a1,\002GELSS, 15-18: \002,a1,\002GELSD,\002,/\002    "
+	    "  19-22: \002,a1,\002GELSYF/S, 23-26: \002,a1,\002GELSDF/S, 27-28"
+	    ": \002,a1,\002GELSQS)\002)";
     static char fmt_9935[] = "(3x,i2,\002: norm( B - A * X )   / \002,\002( "
 	    "max(M,N) * norm(A) * norm(X) * EPS )\002)";
     static char fmt_9931[] = "(3x,i2,\002: norm( (A*X-B)' *A ) / \002,\002( "
@@ -249,7 +256,9 @@ static integer c__8 = 8;
     static char fmt_9932[] = "(3x,i2,\002: Check if X is in the row space of"
 	    " A or A'\002)";
     static char fmt_9920[] = "(3x,\002 7-10: same as 3-6\002,3x,\002 11-14: "
-	    "same as 3-6\002,3x,\002 15-18: same as 3-6\002)";
+	    "same as 3-6\002,3x,\002 15-18: same as 3-6\002,/3x,\002 19-22"
+	    ": same as 3-6\002,3x,\002 23-26: same as 3-6\002,3x,\002 27-28: "
+	    "same as 1-2\002)";
     static char fmt_9983[] = "(/1x,a3,\002:  LU factorization variants\002)";
     static char fmt_9982[] = "(/1x,a3,\002:  Cholesky factorization variant"
 	    "s\002)";
@@ -461,6 +470,8 @@ static integer c__8 = 8;
     static cilist io___184 = { 0, 0, 0, fmt_9981, 0 };
     static cilist io___185 = { 0, 0, 0, fmt_9970, 0 };
     static cilist io___186 = { 0, 0, 0, fmt_9980, 0 };
+    static cilist io___187 = { 0, 0, 0, fmt_9919, 0 };
+    static cilist io___188 = { 0, 0, 0, fmt_9918, 0 };
 
 
 
@@ -589,6 +600,9 @@ static integer c__8 = 8;
 	s_wsfe(&io___15);
 	do_fio(&c__1, (char *)&c__8, (ftnlen)sizeof(integer));
 	e_wsfe();
+	io___187.ciunit = *iounit;
+	s_wsfe(&io___187);
+	e_wsfe();
 	ci__1.cierr = 0;
 	ci__1.ciunit = *iounit;
 	ci__1.cifmt = "( ' Messages:' )";
@@ -770,6 +784,11 @@ static integer c__8 = 8;
 	s_wsfe(&io___45);
 	do_fio(&c__1, (char *)&c__8, (ftnlen)sizeof(integer));
 	e_wsfe();
+	if (lsame_(c3, "O")) {
+	    io___188.ciunit = *iounit;
+	    s_wsfe(&io___188);
+	    e_wsfe();
+	}
 	ci__1.cierr = 0;
 	ci__1.ciunit = *iounit;
 	ci__1.cifmt = "( ' Messages:' )";
@@ -1567,7 +1586,7 @@ static integer c__8 = 8;
     } else if (lsamen_(&c__2, p2, "LS")) {
 
 /*        LS:  Least Squares driver routines for */
-/*             LS, LSD, LSS, LSX and LSY. */
+/*             LS, LSD, LSS, LSX, LSY, LSYF/S, LSDF/S and LSQS. */
 
 	io___168.ciunit = *iounit;
 	s_wsfe(&io___168);
@@ -1583,6 +1602,9 @@ static integer c__8 = 8;
 	do_fio(&c__1, c1, (ftnlen)1);
 	do_fio(&c__1, c1, (ftnlen)1);
 	do_fio(&c__1, c1, (ftnlen)1);
+	do_fio(&c__1, c1, (ftnlen)1);
+	do_fio(&c__1, c1, (ftnlen)1);
+	do_fio(&c__1, c1, (ftnlen)1);
 	e_wsfe();
 	io___171.ciunit = *iounit;
 	s_wsfe(&io___171);
@@ -106,7 +106,7 @@ static integer c__6 = 6;
     integer nns, piv[132], nnb2;
     char path[3];
     integer mval[12], nval[12], nrhs;
-    doublereal work[23496]	/* was [132][178] */;
+    doublereal work[108240]	/* was [132][820] */;
     integer lafac;
     logical fatal;
     char aline[72];
@@ -132,7 +132,8 @@ static integer c__6 = 6;
 	    integer *, integer *, integer *, integer *, doublereal *, logical 
 	    *, integer *, doublereal *, doublereal *, doublereal *, 
 	    doublereal *, doublereal *, doublereal *, doublereal *, 
-	    doublereal *, integer *, integer *), dchkeq_(doublereal *, 
+	    doublereal *, integer *, integer *), dchkrd_(doublereal *, 
+	    integer *), dchkrn_(doublereal *, integer *), dchkeq_(doublereal *, 
 	    integer *);
     extern doublereal dsecnd_(void);
     extern /* Subroutine */ int dchktb_(logical *, integer *, integer *, 
@@ -392,6 +393,8 @@ static integer c__6 = 6;
 /*  DTZ    3               List types on next line if 0 < NTYPES <  3 */
 /*  DLS    6               List types on next line if 0 < NTYPES <  6 */
 /*  DEQ */
+/*  DRD */
+/*  DRN */
 
 /*  Internal Parameters */
 /*  =================== */
@@ -1352,6 +1355,31 @@ L130:
 	    e_wsfe();
 	}
 
+    } else if (lsamen_(&c__2, c2, "RD")) {
+
+/*        RD:  Double-double residual kernels of the extra precise */
+/*             iterative refinement routines */
+
+	if (tstchk) {
+	    dchkrd_(&thresh, &c__6);
+	} else {
+	    s_wsfe(&io___129);
+	    do_fio(&c__1, path, (ftnlen)3);
+	    e_wsfe();
+	}
+
+    } else if (lsamen_(&c__2, c2, "RN")) {
+
+/*        RN:  Random number generator DLARUV, DLARSK and DLARNV */
+
+	if (tstchk) {
+	    dchkrn_(&thresh, &c__6);
+	} else {
+	    s_wsfe(&io___129);
+	    do_fio(&c__1, path, (ftnlen)3);
+	    e_wsfe();
+	}
+
     } else {
 
 	s_wsfe(&io___130);
@@ -36,7 +36,8 @@ static integer c__0 = 0;
 static integer c_n1 = -1;
 static doublereal c_b23 = 0.;
 static logical c_true = TRUE_;
-static integer c__8 = 8;
+static integer c__11 = 11;
+static integer c__12 = 12;
 
 /* Subroutine */ int dchkge_(logical *dotype, integer *nm, integer *mval, 
 	integer *nn, integer *nval, integer *nnb, integer *nbval, integer *
@@ -63,14 +64,16 @@ static integer c__8 = 8;
 
     /* System generated locals */
     integer i__1, i__2, i__3, i__4, i__5;
+    doublereal d__1;
 
     /* Builtin functions */
     /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
     integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
 
     /* Local variables */
-    integer i__, k, m, n, nb, im, in, kl, ku, nt, lda, inb, ioff, mode, imat, 
-	    info;
+    integer i__, j, k, m, n, nb, im, in, kl, ku, nt, lda, inb, ioff, mode, 
+	    imat, info;
+    doublereal sgn, sgnt, logdet, logdtt;
     char path[3], dist[1];
     integer irhs, nrhs;
     char norm[1], type__[1];
@@ -139,7 +142,14 @@ static integer c__8 = 8;
     logical trfcon;
     doublereal anormo;
     extern /* Subroutine */ int xlaenv_(integer *, integer *);
-    doublereal result[8];
+    extern /* Subroutine */ int dgeconb_(char *, integer *, doublereal *, 
+	    integer *, doublereal *, doublereal *, doublereal *, integer *, 
+	    integer *), dgetrfc_(char *, integer *, doublereal *, integer *, 
+	    integer *, doublereal *, doublereal *, integer *, integer *);
+    extern /* Subroutine */ int dgeldet_(char *, integer *, doublereal *, 
+	    integer *, integer *, doublereal *, doublereal *, integer *);
+    extern doublereal dlamch_(char *);
+    doublereal result[12];
 
     /* Fortran I/O blocks */
     static cilist io___41 = { 0, 0, 0, fmt_9999, 0 };
@@ -160,7 +170,8 @@ static integer c__8 = 8;
 /*  Purpose */
 /*  ======= */
 
-/*  DCHKGE tests DGETRF, -TRI, -TRS, -RFS, and -CON. */
+/*  DCHKGE tests DGETRF, -TRI, -TRS, -RFS, and -CON, the block */
+/*  condition estimators DGECONB and DGETRFC, and DGELDET. */
 
 /*  Arguments */
 /*  ========= */
@@ -220,12 +231,12 @@ static integer c__8 = 8;
 /*  XACT    (workspace) DOUBLE PRECISION array, dimension (NMAX*NSMAX) */
 
 /*  WORK    (workspace) DOUBLE PRECISION array, dimension */
-/*                      (NMAX*max(3,NSMAX)) */
+/*                      (NMAX*max(6,NSMAX)) */
 
 /*  RWORK   (workspace) DOUBLE PRECISION array, dimension */
 /*                      (max(2*NMAX,2*NSMAX+NWORK)) */
 
-/*  IWORK   (workspace) INTEGER array, dimension (2*NMAX) */
+/*  IWORK   (workspace) INTEGER array, dimension (4*NMAX) */
 
 /*  NOUT    (input) INTEGER */
 /*          The unit number for output. */
@@ -606,8 +617,9 @@ static integer c__8 = 8;
 /* L60: */
 		    }
 
-/* +    TEST 8 */
-/*                    Get an estimate of RCOND = 1/CNDNUM. */
+/* +    TESTS 8, 9 and 10 */
+/*                    Get an estimate of RCOND = 1/CNDNUM with DGECON, */
+/*                    DGECONB and DGETRFC. */
 
 L70:
 		    for (itran = 1; itran <= 2; ++itran) {
@@ -639,30 +651,135 @@ L70:
 
 			result[7] = dget06_(&rcond, &rcondc);
 
+			s_copy(srnamc_1.srnamt, "DGECONB", (ftnlen)32, (
+				ftnlen)7);
+			dgeconb_(norm, &n, &afac[1], &lda, &anorm, &rcond, &
+				work[1], &iwork[n + 1], &info);
+			if (info != 0) {
+			    alaerh_(path, "DGECONB", &info, &c__0, norm, &n, &
+				    n, &c_n1, &c_n1, &c_n1, &imat, &nfail, &
+				    nerrs, nout);
+			}
+			result[8] = dget06_(&rcond, &rcondc);
+
+/*                       DGETRFC factors a copy of A; the factors are */
+/*                       checked in test 11. */
+
+			dlacpy_("Full", &n, &n, &a[1], &lda, &ainv[1], &lda);
+			s_copy(srnamc_1.srnamt, "DGETRFC", (ftnlen)32, (
+				ftnlen)7);
+			dgetrfc_(norm, &n, &ainv[1], &lda, &iwork[n + 1], &
+				rcond, &work[1], &iwork[(n << 1) + 1], &info);
+			if (info != izero) {
+			    alaerh_(path, "DGETRFC", &info, &izero, norm, &n, 
+				    &n, &c_n1, &c_n1, &c_n1, &imat, &nfail, &
+				    nerrs, nout);
+			}
+			result[9] = dget06_(&rcond, &rcondc);
+
 /*                    Print information about the tests that did not pass */
 /*                    the threshold. */
 
-			if (result[7] >= *thresh) {
-			    if (nfail == 0 && nerrs == 0) {
-				alahd_(nout, path);
+			for (k = 8; k <= 10; ++k) {
+			    if (result[k - 1] >= *thresh) {
+				if (nfail == 0 && nerrs == 0) {
+				    alahd_(nout, path);
+				}
+				io___50.ciunit = *nout;
+				s_wsfe(&io___50);
+				do_fio(&c__1, norm, (ftnlen)1);
+				do_fio(&c__1, (char *)&n, (ftnlen)sizeof(
+					integer));
+				do_fio(&c__1, (char *)&imat, (ftnlen)sizeof(
+					integer));
+				do_fio(&c__1, (char *)&k, (ftnlen)sizeof(
+					integer));
+				do_fio(&c__1, (char *)&result[k - 1], (ftnlen)
+					sizeof(doublereal));
+				e_wsfe();
+				++nfail;
 			    }
-			    io___50.ciunit = *nout;
-			    s_wsfe(&io___50);
-			    do_fio(&c__1, norm, (ftnlen)1);
-			    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer))
-				    ;
-			    do_fio(&c__1, (char *)&imat, (ftnlen)sizeof(
-				    integer));
-			    do_fio(&c__1, (char *)&c__8, (ftnlen)sizeof(
-				    integer));
-			    do_fio(&c__1, (char *)&result[7], (ftnlen)sizeof(
-				    doublereal));
-			    e_wsfe();
-			    ++nfail;
+/* L75: */
 			}
-			++nrun;
+			nrun += 3;
 /* L80: */
 		    }
+
+/* +    TEST 11 */
+/*                    Reconstruct A from the factors of the last DGETRFC */
+/*                    call and compute the residual. */
+
+		    dget01_(&n, &n, &a[1], &lda, &ainv[1], &lda, &iwork[n + 
+			    1], &rwork[1], &result[10]);
+		    if (result[10] >= *thresh) {
+			if (nfail == 0 && nerrs == 0) {
+			    alahd_(nout, path);
+			}
+			io___41.ciunit = *nout;
+			s_wsfe(&io___41);
+			do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&imat, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&c__11, (ftnlen)sizeof(integer))
+				;
+			do_fio(&c__1, (char *)&result[10], (ftnlen)sizeof(
+				doublereal));
+			e_wsfe();
+			++nfail;
+		    }
+		    ++nrun;
+
+/* +    TEST 12 */
+/*                    Compare the log-determinant from the DGETRF factors */
+/*                    with that of A**T, relative to N*EPS*CNDNUM. */
+
+		    s_copy(srnamc_1.srnamt, "DGELDET", (ftnlen)32, (ftnlen)7);
+		    dgeldet_("F", &n, &afac[1], &lda, &iwork[1], &sgn, &logdet, 
+			    &info);
+		    if (info != izero) {
+			alaerh_(path, "DGELDET", &info, &izero, "F", &n, &n, &
+				c_n1, &c_n1, &c_n1, &imat, &nfail, &nerrs, 
+				nout);
+		    }
+		    i__5 = n;
+		    for (j = 1; j <= i__5; ++j) {
+			i__3 = n;
+			for (i__ = 1; i__ <= i__3; ++i__) {
+			    ainv[j + (i__ - 1) * lda] = a[i__ + (j - 1) * lda];
+/* L82: */
+			}
+/* L84: */
+		    }
+		    dgeldet_("N", &n, &ainv[1], &lda, &iwork[n + 1], &sgnt, &
+			    logdtt, &info);
+		    if (sgn != sgnt) {
+			result[11] = 1. / dlamch_("Epsilon");
+		    } else if (sgn == 0. || n == 0) {
+			result[11] = 0.;
+		    } else {
+			result[11] = (d__1 = logdet - logdtt, abs(d__1)) * 
+				rcondo / (n * dlamch_("Epsilon") * (rcondo * 
+				abs(logdet) + 1.));
+		    }
+		    if (result[11] >= *thresh) {
+			if (nfail == 0 && nerrs == 0) {
+			    alahd_(nout, path);
+			}
+			io___41.ciunit = *nout;
+			s_wsfe(&io___41);
+			do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&imat, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&c__12, (ftnlen)sizeof(integer))
+				;
+			do_fio(&c__1, (char *)&result[11], (ftnlen)sizeof(
+				doublereal));
+			e_wsfe();
+			++nfail;
+		    }
+		    ++nrun;
 L90:
 		    ;
 		}
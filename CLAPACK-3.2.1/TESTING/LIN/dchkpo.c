@@ -35,6 +35,7 @@ static integer c__0 = 0;
 static integer c_n1 = -1;
 static integer c__1 = 1;
 static integer c__8 = 8;
+static integer c__9 = 9;
 
 /* Subroutine */ int dchkpo_(logical *dotype, integer *nn, integer *nval, 
 	integer *nnb, integer *nbval, integer *nns, integer *nsval, 
@@ -61,13 +62,15 @@ static integer c__8 = 8;
 
     /* System generated locals */
     integer i__1, i__2, i__3, i__4;
+    doublereal d__1;
 
     /* Builtin functions */
     /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
     integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
 
     /* Local variables */
-    integer i__, k, n, nb, in, kl, ku, lda, inb, ioff, mode, imat, info;
+    integer i__, j, k, n, nb, in, kl, ku, lda, inb, ioff, mode, imat, info;
+    doublereal sgn, logdet, logdtg;
     char path[3], dist[1];
     integer irhs, nrhs;
     char uplo[1], type__[1];
@@ -123,7 +126,12 @@ static integer c__8 = 8;
 	     integer *, doublereal *, integer *, integer *), dpotrs_(
 	    char *, integer *, integer *, doublereal *, integer *, doublereal 
 	    *, integer *, integer *);
-    doublereal result[8];
+    extern /* Subroutine */ int dgeldet_(char *, integer *, doublereal *, 
+	    integer *, integer *, doublereal *, doublereal *, integer *), 
+	    dpoldet_(char *, char *, integer *, doublereal *, integer *, 
+	    doublereal *, integer *);
+    extern doublereal dlamch_(char *);
+    doublereal result[9];
 
     /* Fortran I/O blocks */
     static cilist io___33 = { 0, 0, 0, fmt_9999, 0 };
@@ -144,7 +152,7 @@ static integer c__8 = 8;
 /*  Purpose */
 /*  ======= */
 
-/*  DCHKPO tests DPOTRF, -TRI, -TRS, -RFS, and -CON */
+/*  DCHKPO tests DPOTRF, -TRI, -TRS, -RFS, -CON and -LDET */
 
 /*  Arguments */
 /*  ========= */
@@ -580,6 +588,62 @@ static integer c__8 = 8;
 			++nfail;
 		    }
 		    ++nrun;
+
+/* +    TEST 9 */
+/*                 Compare the log-determinant from the Cholesky factor */
+/*                 with the one from the LU factorization of the full */
+/*                 symmetric matrix, relative to N*EPS*CNDNUM. */
+
+		    s_copy(srnamc_1.srnamt, "DPOLDET", (ftnlen)32, (ftnlen)7);
+		    dpoldet_("F", uplo, &n, &afac[1], &lda, &logdet, &info);
+		    if (info != 0) {
+			alaerh_(path, "DPOLDET", &info, &c__0, uplo, &n, &n, &
+				c_n1, &c_n1, &c_n1, &imat, &nfail, &nerrs, 
+				nout);
+		    }
+		    i__4 = n;
+		    for (j = 1; j <= i__4; ++j) {
+			i__2 = n;
+			for (i__ = 1; i__ <= i__2; ++i__) {
+			    if (*(unsigned char *)uplo == 'U' && i__ <= j || *(
+				    unsigned char *)uplo == 'L' && i__ >= j) {
+				ainv[i__ + (j - 1) * lda] = a[i__ + (j - 1) * 
+					lda];
+			    } else {
+				ainv[i__ + (j - 1) * lda] = a[j + (i__ - 1) * 
+					lda];
+			    }
+/* L82: */
+			}
+/* L84: */
+		    }
+		    dgeldet_("N", &n, &ainv[1], &lda, &iwork[1], &sgn, &logdtg, &
+			    info);
+		    if (sgn != 1.) {
+			result[8] = 1. / dlamch_("Epsilon");
+		    } else if (n == 0) {
+			result[8] = 0.;
+		    } else {
+			result[8] = (d__1 = logdet - logdtg, abs(d__1)) * 
+				rcondc / (n * dlamch_("Epsilon") * (rcondc * 
+				abs(logdet) + 1.));
+		    }
+		    if (result[8] >= *thresh) {
+			if (nfail == 0 && nerrs == 0) {
+			    alahd_(nout, path);
+			}
+			io___38.ciunit = *nout;
+			s_wsfe(&io___38);
+			do_fio(&c__1, uplo, (ftnlen)1);
+			do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&imat, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&c__9, (ftnlen)sizeof(integer));
+			do_fio(&c__1, (char *)&result[8], (ftnlen)sizeof(
+				doublereal));
+			e_wsfe();
+			++nfail;
+		    }
+		    ++nrun;
 L90:
 		    ;
 		}
@@ -34,6 +34,7 @@ static doublereal c_b11 = 0.;
 static doublereal c_b16 = 1.;
 static integer c__1 = 1;
 static integer c__3 = 3;
+static integer c_n1 = -1;
 
 /* Subroutine */ int dchkq3_(logical *dotype, integer *nm, integer *mval, 
 	integer *nn, integer *nval, integer *nnb, integer *nbval, integer *
@@ -57,6 +58,7 @@ static integer c__3 = 3;
     /* Builtin functions */
     /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
     integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
+    double sqrt(doublereal);
 
     /* Local variables */
     integer i__, k, m, n, nb, im, in, lw, nx, lda, inb;
@@ -89,7 +91,12 @@ static integer c__3 = 3;
 	    integer *, char *, integer *, char *, doublereal *, integer *, 
 	    doublereal *, doublereal *, integer *, integer *, char *, 
 	    doublereal *, integer *, doublereal *, integer *), xlaenv_(integer *, integer *);
-    doublereal result[3];
+    doublereal result[7];
+    extern /* Subroutine */ int dgeqpr_(integer *, integer *, doublereal *, 
+	    integer *, integer *, doublereal *, doublereal *, integer *, 
+	    integer *, doublereal *, integer *, integer *, integer *);
+    integer rank, iseedr[4];
+    doublereal tol;
 
     /* Fortran I/O blocks */
     static cilist io___28 = { 0, 0, 0, fmt_9999, 0 };
@@ -108,7 +115,13 @@ static integer c__3 = 3;
 /*  Purpose */
 /*  ======= */
 
-/*  DCHKQ3 tests DGEQP3. */
+/*  DCHKQ3 tests DGEQP3 and DGEQPR. */
+
+/*  Tests 1-3 check DGEQP3 and tests 4-6 the complete factorization */
+/*  computed by DGEQPR (TOL = 0) in the same way.  Test 7 checks the */
+/*  truncated mode of DGEQPR with TOL = sqrt(EPS): */
+/*     norm( A*P - Q*R ) / ( norm(A) * max(M,N) * TOL ), */
+/*  where R is the partial factor left in A, which must not exceed 1. */
 
 /*  Arguments */
 /*  ========= */
@@ -163,7 +176,7 @@ static integer c__3 = 3;
 /*  WORK    (workspace) DOUBLE PRECISION array, dimension */
 /*                      (MMAX*NMAX + 4*NMAX + MMAX) */
 
-/*  IWORK   (workspace) INTEGER array, dimension (2*NMAX) */
+/*  IWORK   (workspace) INTEGER array, dimension (5*NMAX) */
 
 /*  NOUT    (input) INTEGER */
 /*          The unit number for output. */
@@ -377,7 +390,68 @@ static integer c__3 = 3;
 			}
 /* L50: */
 		    }
-		    nrun += 3;
+
+/*                 Compute the complete DGEQPR factorization of A */
+
+		    dlacpy_("All", &m, &n, &copya[1], &lda, &a[1], &lda);
+		    for (i__ = 1; i__ <= 4; ++i__) {
+			iseedr[i__ - 1] = iseedy[i__ - 1];
+		    }
+		    tol = 0.;
+		    dgeqpr_(&m, &n, &a[1], &lda, &iwork[n + 1], &tau[1], &tol, &
+			    rank, iseedr, &work[1], &c_n1, &iwork[(n << 1) + 1], 
+			    &info);
+		    lw = (integer) work[1];
+		    s_copy(srnamc_1.srnamt, "DGEQPR", (ftnlen)32, (ftnlen)6);
+		    dgeqpr_(&m, &n, &a[1], &lda, &iwork[n + 1], &tau[1], &tol, &
+			    rank, iseedr, &work[1], &lw, &iwork[(n << 1) + 1], &
+			    info);
+
+		    result[3] = dqrt12_(&m, &n, &a[1], &lda, &copys[1], &work[
+			    1], &lwork);
+		    result[4] = dqpt01_(&m, &n, &mnmin, &copya[1], &a[1], &
+			    lda, &tau[1], &iwork[n + 1], &work[1], &lwork);
+		    result[5] = dqrt11_(&m, &mnmin, &a[1], &lda, &tau[1], &
+			    work[1], &lwork);
+
+/*                 Compute the truncated DGEQPR factorization of A. */
+/*                 The reflectors that were not computed have TAU = 0, */
+/*                 so DQPT01 measures the truncation error. */
+
+		    dlacpy_("All", &m, &n, &copya[1], &lda, &a[1], &lda);
+		    tol = sqrt(eps);
+		    dgeqpr_(&m, &n, &a[1], &lda, &iwork[n + 1], &tau[1], &tol, &
+			    rank, iseedr, &work[1], &lw, &iwork[(n << 1) + 1], &
+			    info);
+		    result[6] = dqpt01_(&m, &n, &mnmin, &copya[1], &a[1], &
+			    lda, &tau[1], &iwork[n + 1], &work[1], &lwork) * 
+			    eps / tol;
+
+		    for (k = 4; k <= 7; ++k) {
+			if (result[k - 1] >= *thresh) {
+			    if (nfail == 0 && nerrs == 0) {
+				alahd_(nout, path);
+			    }
+			    io___28.ciunit = *nout;
+			    s_wsfe(&io___28);
+			    do_fio(&c__1, "DGEQPR", (ftnlen)6);
+			    do_fio(&c__1, (char *)&m, (ftnlen)sizeof(integer))
+				    ;
+			    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer))
+				    ;
+			    do_fio(&c__1, (char *)&nb, (ftnlen)sizeof(integer)
+				    );
+			    do_fio(&c__1, (char *)&imode, (ftnlen)sizeof(
+				    integer));
+			    do_fio(&c__1, (char *)&k, (ftnlen)sizeof(integer))
+				    ;
+			    do_fio(&c__1, (char *)&result[k - 1], (ftnlen)
+				    sizeof(doublereal));
+			    e_wsfe();
+			    ++nfail;
+			}
+		    }
+		    nrun += 7;
 
 /* L60: */
 		}
@@ -0,0 +1,302 @@
+/* dchkrd.c -- DCHKRD, tests of the double-double residual kernels. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__2 = 2;
+static integer c__64 = 64;
+static integer c__0 = 0;
+static doublereal c_b12 = 1.;
+static doublereal c_b13 = 0.;
+
+/* Subroutine */ int dchkrd_(doublereal *thresh, integer *nout)
+{
+    /* Initialized data */
+
+    static integer nval[7] = { 1,2,3,7,16,33,64 };
+    static integer iseedy[4] = { 1988,1989,1990,1991 };
+    static char names[11*3] = "DLA_GERESDD" "DLA_GBRESDD" "DLA_SYRESDD";
+
+    /* Format strings */
+    static char fmt_9999[] = "(1x,a11,\002, \002,a5,\002 = \002,a1,\002, "
+	    "N =\002,i3,\002, KL =\002,i3,\002, KU =\002,i3,\002, test r"
+	    "atio =\002,g12.5)";
+
+    /* System generated locals */
+    integer i__1, i__2;
+    doublereal d__1;
+
+    /* Builtin functions */
+    /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
+    double d_nint(doublereal *);
+    integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
+
+    /* Local variables */
+    doublereal a[4096]	/* was [64][64] */, e[4096]	/* was [64][64] */,
+	     b[64], c__, p, r__[64], s, t, w[64], y[64], z__, ab[8192]	/*
+	    was [128][64] */, yt[64];
+    integer i__, j, k, n, kl, ku, in, iv;
+    doublereal eps, gam, ref, aij, asum;
+    char path[3], opt[1], optn[5];
+    integer nrun, ldab, nfail, iseed[4];
+    doublereal ratio, result;
+    extern /* Subroutine */ int dgemv_(char *, integer *, integer *,
+	    doublereal *, doublereal *, integer *, doublereal *, integer *,
+	    doublereal *, doublereal *, integer *), dcopy_(integer *,
+	    doublereal *, integer *, doublereal *, integer *);
+    extern doublereal dlamch_(char *);
+    extern integer ilauplo_(char *), ilatrans_(char *);
+    extern /* Subroutine */ int alasum_(char *, integer *, integer *,
+	    integer *, integer *), dlarnv_(integer *, integer *, integer *,
+	    doublereal *), dla_gbresdd__(integer *, integer *, integer *,
+	    integer *, doublereal *, integer *, doublereal *, doublereal *,
+	    doublereal *, doublereal *), dla_geresdd__(integer *, integer *,
+	    doublereal *, integer *, doublereal *, doublereal *, doublereal *,
+	    doublereal *), dla_syresdd__(integer *, integer *, doublereal *,
+	    integer *, doublereal *, doublereal *, doublereal *, doublereal *)
+	    ;
+
+    /* Fortran I/O blocks */
+    static cilist io___30 = { 0, 0, 0, fmt_9999, 0 };
+
+
+
+/*  -- LAPACK test routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DCHKRD tests the double-double residual kernels DLA_GERESDD, */
+/*  DLA_GBRESDD and DLA_SYRESDD used by the extra precise iterative */
+/*  refinement routines, and through them DLA_DDAXPY and DLA_DDDOT. */
+
+/*  The entries of A and Y have at most 27 significant bits, so every */
+/*  product A(i,j)*Y(j) is exact.  B is set to the rounded product */
+/*  op(A)*Y, which makes B - op(A)*(Y+Y_TAIL) suffer complete */
+/*  cancellation in working precision.  The reference residual is formed */
+/*  from the exact products by compensated summation, and the test ratio */
+
+/*     | R(i) - REF(i) | / ( EPS*|REF(i)| + ((2N+1)*EPS)**2 * ASUM(i) ), */
+/*     ASUM(i) = |B(i)| + sum_j |op(A)(i,j)| * ( |Y(j)| + |Y_TAIL(j)| ), */
+
+/*  is O(1) for a residual accurate to twice the working precision.  A */
+/*  residual computed in working precision gives a ratio of about 1/EPS. */
+
+/*  Each kernel is run for the orders in NVAL, for both TRANS options */
+/*  (GE and GB, the latter with a narrow and a full band) and both UPLO */
+/*  options (SY).  The triangle of A not referenced by DLA_SYRESDD */
+/*  holds unrelated values. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  THRESH  (input) DOUBLE PRECISION */
+/*          The threshold value for the test ratios. */
+
+/*  NOUT    (input) INTEGER */
+/*          The unit number for output. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Intrinsic Functions .. */
+/*     .. */
+/*     .. Data statements .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    s_copy(path, "Double precision", (ftnlen)1, (ftnlen)16);
+    s_copy(path + 1, "RD", (ftnlen)2, (ftnlen)2);
+    eps = dlamch_("Epsilon");
+    for (i__ = 1; i__ <= 4; ++i__) {
+	iseed[i__ - 1] = iseedy[i__ - 1];
+/* L10: */
+    }
+    nrun = 0;
+    nfail = 0;
+
+    for (in = 1; in <= 7; ++in) {
+	n = nval[in - 1];
+
+/*        Generate A and Y with entries of at most 27 significant bits, */
+/*        and a tail Y_TAIL of order EPS*|Y|. */
+
+	i__1 = n;
+	for (j = 1; j <= i__1; ++j) {
+	    dlarnv_(&c__2, iseed, &n, &a[(j << 6) - 64]);
+	    i__2 = n;
+	    for (i__ = 1; i__ <= i__2; ++i__) {
+		d__1 = a[i__ + (j << 6) - 65] * 67108864.;
+		a[i__ + (j << 6) - 65] = d_nint(&d__1) / 67108864.;
+/* L20: */
+	    }
+/* L30: */
+	}
+	dlarnv_(&c__2, iseed, &n, y);
+	dlarnv_(&c__2, iseed, &n, yt);
+	i__1 = n;
+	for (j = 1; j <= i__1; ++j) {
+	    d__1 = y[j - 1] * 67108864.;
+	    y[j - 1] = d_nint(&d__1) / 67108864.;
+	    d__1 = yt[j - 1] * 67108864.;
+	    yt[j - 1] = d_nint(&d__1) / 67108864. * eps;
+/* L40: */
+	}
+
+	gam = (doublereal) ((n << 1) + 1) * eps;
+	for (iv = 1; iv <= 8; ++iv) {
+
+/*           Set the kernel (K), the option, the band and the */
+/*           effective matrix E = op(A). */
+
+	    kl = n - 1;
+	    ku = n - 1;
+	    if (iv <= 2) {
+		k = 1;
+		s_copy(optn, "TRANS", (ftnlen)5, (ftnlen)5);
+		*(unsigned char *)opt = *(unsigned char *)&"NT"[iv - 1];
+	    } else if (iv <= 6) {
+		k = 2;
+		s_copy(optn, "TRANS", (ftnlen)5, (ftnlen)5);
+		*(unsigned char *)opt = *(unsigned char *)&"NT"[(iv - 1) % 2];
+		if (iv <= 4) {
+		    kl = min(1,kl);
+		    ku = min(2,ku);
+		}
+	    } else {
+		k = 3;
+		s_copy(optn, "UPLO", (ftnlen)5, (ftnlen)4);
+		*(unsigned char *)opt = *(unsigned char *)&"UL"[iv - 7];
+	    }
+	    i__1 = n;
+	    for (j = 1; j <= i__1; ++j) {
+		i__2 = n;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (k == 3) {
+			if (*(unsigned char *)opt == 'U') {
+			    aij = a[min(i__,j) + (max(i__,j) << 6) - 65];
+			} else {
+			    aij = a[max(i__,j) + (min(i__,j) << 6) - 65];
+			}
+		    } else if (i__ - j > kl || j - i__ > ku) {
+			aij = 0.;
+		    } else {
+			aij = a[i__ + (j << 6) - 65];
+		    }
+		    if (*(unsigned char *)opt == 'T') {
+			e[j + (i__ << 6) - 65] = aij;
+		    } else {
+			e[i__ + (j << 6) - 65] = aij;
+		    }
+/* L50: */
+		}
+/* L60: */
+	    }
+
+/*           Band storage of A for DLA_GBRESDD. */
+
+	    ldab = kl + ku + 1;
+	    if (k == 2) {
+		i__1 = n;
+		for (j = 1; j <= i__1; ++j) {
+		    i__2 = min(n,j + kl);
+		    for (i__ = max(1,j - ku); i__ <= i__2; ++i__) {
+			ab[ku + 1 + i__ - j + (j - 1) * ldab - 1] = a[i__ + (
+				j << 6) - 65];
+/* L70: */
+		    }
+/* L80: */
+		}
+	    }
+
+/*           B = op(A)*Y rounded to working precision. */
+
+	    dgemv_("No transpose", &n, &n, &c_b12, e, &c__64, y, &c__1, &
+		    c_b13, b, &c__1);
+	    dcopy_(&n, b, &c__1, r__, &c__1);
+
+	    if (k == 1) {
+		i__1 = ilatrans_(opt);
+		dla_geresdd__(&i__1, &n, a, &c__64, y, yt, r__, w);
+	    } else if (k == 2) {
+		i__1 = ilatrans_(opt);
+		dla_gbresdd__(&i__1, &n, &kl, &ku, ab, &ldab, y, yt, r__, w);
+	    } else {
+		i__1 = ilauplo_(opt);
+		dla_syresdd__(&i__1, &n, a, &c__64, y, yt, r__, w);
+	    }
+
+/*           Compare with the compensated sum of the exact products. */
+
+	    result = 0.;
+	    i__1 = n;
+	    for (i__ = 1; i__ <= i__1; ++i__) {
+		s = b[i__ - 1];
+		c__ = 0.;
+		asum = abs(s);
+		i__2 = n;
+		for (j = 1; j <= i__2; ++j) {
+		    aij = e[i__ + (j << 6) - 65];
+		    p = -aij * y[j - 1];
+		    t = s + p;
+		    z__ = t - s;
+		    c__ += s - (t - z__) + (p - z__);
+		    s = t;
+		    p = -aij * yt[j - 1];
+		    t = s + p;
+		    z__ = t - s;
+		    c__ += s - (t - z__) + (p - z__);
+		    s = t;
+		    asum += abs(aij) * (abs(y[j - 1]) + abs(yt[j - 1]));
+/* L90: */
+		}
+		ref = s + c__;
+		ratio = (d__1 = r__[i__ - 1] - ref, abs(d__1)) / (eps * abs(
+			ref) + gam * gam * asum);
+		result = max(result,ratio);
+/* L100: */
+	    }
+
+	    if (result >= *thresh) {
+		io___30.ciunit = *nout;
+		s_wsfe(&io___30);
+		do_fio(&c__1, names + (k - 1) * 11, (ftnlen)11);
+		do_fio(&c__1, optn, (ftnlen)5);
+		do_fio(&c__1, opt, (ftnlen)1);
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&kl, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&ku, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&result, (ftnlen)sizeof(doublereal));
+		e_wsfe();
+		++nfail;
+	    }
+	    ++nrun;
+/* L110: */
+	}
+/* L120: */
+    }
+
+/*     Print a summary of the results. */
+
+    alasum_(path, nout, &nfail, &nrun, &c__0);
+
+    return 0;
+
+/*     End of DCHKRD */
+
+} /* dchkrd_ */
@@ -85,7 +85,8 @@ static integer c__6 = 6;
     extern /* Subroutine */ int ddrvrf1_(integer *, integer *, integer *, 
 	    doublereal *, doublereal *, integer *, doublereal *, doublereal *)
 	    , ddrvrf2_(integer *, integer *, integer *, doublereal *, integer 
-	    *, doublereal *, doublereal *, doublereal *), ddrvrf3_(integer *, 
+	    *, doublereal *, doublereal *, doublereal *, integer *), 
+	    ddrvrf3_(integer *, 
 	    integer *, integer *, doublereal *, doublereal *, integer *, 
 	    doublereal *, doublereal *, doublereal *, doublereal *, 
 	    doublereal *, doublereal *), ddrvrf4_(integer *, integer *, 
@@ -96,8 +97,9 @@ static integer c__6 = 6;
 	    doublereal *, doublereal *, doublereal *, doublereal *, 
 	    doublereal *, doublereal *, doublereal *, doublereal *, 
 	    doublereal *, doublereal *, doublereal *, doublereal *, 
-	    doublereal *, doublereal *, doublereal *, doublereal *);
+	    doublereal *, doublereal *, doublereal *, doublereal *, integer *);
     doublereal workarf[1275];
+    integer d_work_dtpttfi__[40];
 
     /* Fortran I/O blocks */
     static cilist io___3 = { 0, 5, 0, 0, 0 };
@@ -426,14 +428,15 @@ static integer c__6 = 6;
 	derrrfp_(&c__6);
     }
 
-/*     Test the routines: dpftrf, dpftri, dpftrs (as in DDRVPO). */
-/*     This also tests the routines: dtfsm, dtftri, dtfttr, dtrttf. */
+/*     Test the routines: dpftrf, dpftri, dpftrs (as in DDRVPO), dpfsv. */
+/*     This also tests the routines: dtfsm, dtftri, dtfttr, dtrttf, */
+/*     dtpttfi and dtfttpi. */
 
     ddrvrfp_(&c__6, &nn, nval, &nns, nsval, &nnt, ntval, &thresh, worka, 
 	    workasav, workafac, workainv, workb, workbsav, workxact, workx, 
 	    workarf, workarfinv, d_work_dlatms__, d_work_dpot01__, 
 	    d_temp_dpot02__, d_temp_dpot03__, d_work_dlansy__, 
-	    d_work_dpot02__, d_work_dpot03__);
+	    d_work_dpot02__, d_work_dpot03__, d_work_dtpttfi__);
 
 /*     Test the routine: dlansf */
 
@@ -441,9 +444,11 @@ static integer c__6 = 6;
 	    d_work_dlansy__);
 
 /*     Test the convertion routines: */
-/*       dtfttp, dtpttf, dtfttr, dtrttf, dtrttp and dtpttr. */
+/*       dtfttp, dtpttf, dtfttr, dtrttf, dtrttp, dtpttr, dtfttpi and */
+/*       dtpttfi. */
 
-    ddrvrf2_(&c__6, &nn, nval, worka, &c__50, workarf, workap, workasav);
+    ddrvrf2_(&c__6, &nn, nval, worka, &c__50, workarf, workap, workasav, 
+	    d_work_dtpttfi__);
 
 /*     Test the routine: dtfsm */
 
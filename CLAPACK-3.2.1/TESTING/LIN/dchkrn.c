@@ -0,0 +1,196 @@
+/* dchkrn.c -- DCHKRN, tests of the random number generator. */
+
+#include "f2c.h"
+#include "blaswrap.h"
+
+/* Table of constant values */
+
+static integer c__1 = 1;
+static integer c__0 = 0;
+
+/* Subroutine */ int dchkrn_(doublereal *thresh, integer *nout)
+{
+    /* Initialized data */
+
+    static integer nval[9] = { 1,2,63,64,65,127,128,129,1000 };
+    static integer iseedy[4] = { 1988,1989,1990,1991 };
+
+    /* Format strings */
+    static char fmt_9999[] = "(1x,a6,\002, N =\002,i5,\002, IDIST =\002,i"
+	    "2,\002, test(\002,i1,\002) =\002,g12.5)";
+
+    /* System generated locals */
+    integer i__1;
+
+    /* Builtin functions */
+    /* Subroutine */ int s_copy(char *, char *, ftnlen, ftnlen);
+    integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
+
+    /* Local variables */
+    integer i__, k, n, n1, in, nk;
+    doublereal x[1000], y[1000];
+    integer idist;
+    doublereal ovfl;
+    char path[3];
+    integer nrun, nfail, iseed[4], jseed[4], kseed[4];
+    doublereal result;
+    logical same;
+    extern doublereal dlamch_(char *);
+    extern /* Subroutine */ int alasum_(char *, integer *, integer *,
+	    integer *, integer *), dlarnv_(integer *, integer *, integer *,
+	    doublereal *), dlarsk_(integer *, integer *), dlaruv_(integer *,
+	    integer *, doublereal *);
+
+    /* Fortran I/O blocks */
+    static cilist io___20 = { 0, 0, 0, fmt_9999, 0 };
+
+
+
+/*  -- LAPACK test routine (version 3.2) -- */
+
+/*     .. Scalar Arguments .. */
+/*     .. */
+
+/*  Purpose */
+/*  ======= */
+
+/*  DCHKRN tests the counter-based random number generator DLARUV, the */
+/*  skip-ahead routine DLARSK, and DLARNV. */
+
+/*  For each N in NVAL the following tests are run: */
+
+/*  1-3: DLARNV with IDIST = 1, 2, 3 generates the same numbers, and */
+/*       leaves the same seed, whether the N numbers are requested in */
+/*       one call or in two calls of N1 and N-N1 numbers. */
+/*  4:   DLARSK( ISEED, N ) gives the same seed as generating N numbers */
+/*       with DLARUV and discarding them. */
+/*  5:   DLARSK( ISEED, -N ) moves the seed of test 4 back to ISEED. */
+
+/*  The random numbers must agree bit for bit, so the test ratio is */
+/*  0 if they do and 1/EPS otherwise. */
+
+/*  Arguments */
+/*  ========= */
+
+/*  THRESH  (input) DOUBLE PRECISION */
+/*          The threshold value for the test ratios. */
+
+/*  NOUT    (input) INTEGER */
+/*          The unit number for output. */
+
+/*  ===================================================================== */
+
+/*     .. Parameters .. */
+/*     .. */
+/*     .. Local Scalars .. */
+/*     .. */
+/*     .. Local Arrays .. */
+/*     .. */
+/*     .. External Functions .. */
+/*     .. */
+/*     .. External Subroutines .. */
+/*     .. */
+/*     .. Data statements .. */
+/*     .. */
+/*     .. Executable Statements .. */
+
+    s_copy(path, "Double precision", (ftnlen)1, (ftnlen)16);
+    s_copy(path + 1, "RN", (ftnlen)2, (ftnlen)2);
+    ovfl = 1. / dlamch_("Epsilon");
+    for (i__ = 1; i__ <= 4; ++i__) {
+	iseed[i__ - 1] = iseedy[i__ - 1];
+/* L10: */
+    }
+    nrun = 0;
+    nfail = 0;
+
+    for (in = 1; in <= 9; ++in) {
+	n = nval[in - 1];
+	n1 = (n << 1) / 3;
+
+	for (k = 1; k <= 5; ++k) {
+	    for (i__ = 1; i__ <= 4; ++i__) {
+		jseed[i__ - 1] = iseed[i__ - 1];
+		kseed[i__ - 1] = iseed[i__ - 1];
+/* L20: */
+	    }
+	    same = TRUE_;
+	    if (k <= 3) {
+
+/*              Tests 1-3: one call against two calls of DLARNV. */
+
+		idist = k;
+		dlarnv_(&idist, jseed, &n, x);
+		dlarnv_(&idist, kseed, &n1, y);
+		i__1 = n - n1;
+		dlarnv_(&idist, kseed, &i__1, &y[n1]);
+		i__1 = n;
+		for (i__ = 1; i__ <= i__1; ++i__) {
+		    if (x[i__ - 1] != y[i__ - 1]) {
+			same = FALSE_;
+		    }
+/* L30: */
+		}
+	    } else {
+
+/*              Tests 4-5: skip ahead against generate-and-discard, */
+/*              and skip back. */
+
+		idist = 0;
+		dlaruv_(jseed, &n, x);
+		dlarsk_(kseed, &n);
+		if (k == 5) {
+		    nk = -n;
+		    dlarsk_(kseed, &nk);
+		    for (i__ = 1; i__ <= 4; ++i__) {
+			jseed[i__ - 1] = iseed[i__ - 1];
+/* L40: */
+		    }
+		}
+	    }
+	    for (i__ = 1; i__ <= 4; ++i__) {
+		if (jseed[i__ - 1] != kseed[i__ - 1]) {
+		    same = FALSE_;
+		}
+/* L50: */
+	    }
+	    if (same) {
+		result = 0.;
+	    } else {
+		result = ovfl;
+	    }
+
+	    if (result >= *thresh) {
+		io___20.ciunit = *nout;
+		s_wsfe(&io___20);
+		if (k <= 3) {
+		    do_fio(&c__1, "DLARNV", (ftnlen)6);
+		} else {
+		    do_fio(&c__1, "DLARSK", (ftnlen)6);
+		}
+		do_fio(&c__1, (char *)&n, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&idist, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&k, (ftnlen)sizeof(integer));
+		do_fio(&c__1, (char *)&result, (ftnlen)sizeof(doublereal));
+		e_wsfe();
+		++nfail;
+	    }
+	    ++nrun;
+/* L60: */
+	}
+
+/*        Use a different seed for the next N. */
+
+	dlarnv_(&c__1, iseed, &c__1, x);
+/* L70: */
+    }
+
+/*     Print a summary of the results. */
+
+    alasum_(path, nout, &nfail, &nrun, &c__0);
+
+    return 0;
+
+/*     End of DCHKRN */
+
+} /* dchkrn_ */
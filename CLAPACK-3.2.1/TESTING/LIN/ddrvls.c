@@ -132,8 +132,26 @@ static doublereal c_b96 = -1.;
 	    doublereal *, integer *, integer *), dlarnv_(integer *, integer *, 
 	     integer *, doublereal *), derrls_(char *, integer *), 
 	    xlaenv_(integer *, integer *);
-    integer ldwork;
-    doublereal result[18];
+    integer ldwork, lwlsd, nrhs1;
+    extern /* Subroutine */ int dgelqf_(integer *, integer *, doublereal *, 
+	    integer *, doublereal *, doublereal *, integer *, integer *), 
+	    dgeqrf_(integer *, integer *, doublereal *, integer *, doublereal 
+	    *, doublereal *, integer *, integer *), dgelsqs_(char *, integer *
+	    , integer *, integer *, doublereal *, integer *, doublereal *, 
+	    doublereal *, integer *, doublereal *, integer *, integer *), 
+	    dgelsyf_(integer *, integer *, doublereal *, integer *, integer *, 
+	    doublereal *, integer *, doublereal *, doublereal *, integer *, 
+	    integer *), dgelsys_(integer *, integer *, integer *, doublereal *
+	    , integer *, integer *, integer *, doublereal *, doublereal *, 
+	    integer *, doublereal *, integer *, integer *), dgelsdf_(integer *
+	    , integer *, doublereal *, integer *, doublereal *, integer *, 
+	    doublereal *, doublereal *, doublereal *, integer *, doublereal *, 
+	    integer *, doublereal *, integer *, integer *, integer *), 
+	    dgelsds_(integer *, integer *, integer *, doublereal *, integer *, 
+	    integer *, doublereal *, doublereal *, doublereal *, integer *, 
+	    doublereal *, integer *, doublereal *, integer *, doublereal *, 
+	    integer *, integer *);
+    doublereal result[28];
 
     /* Fortran I/O blocks */
     static cilist io___35 = { 0, 0, 0, fmt_9999, 0 };
@@ -155,7 +173,10 @@ static doublereal c_b96 = -1.;
 /*  ======= */
 
 /*  DDRVLS tests the least squares driver routines DGELS, DGELSS, DGELSX, */
-/*  DGELSY and DGELSD. */
+/*  DGELSY and DGELSD, and the factor-once/solve-many pairs DGELSQS */
+/*  (after DGEQRF or DGELQF), DGELSYF/DGELSYS and DGELSDF/DGELSDS, whose */
+/*  solve routines are called twice to handle the right hand sides in */
+/*  two batches. */
 
 /*  Arguments */
 /*  ========= */
@@ -234,8 +255,10 @@ static doublereal c_b96 = -1.;
 /*  COPYS   (workspace) DOUBLE PRECISION array, dimension */
 /*                      (min(MMAX,NMAX)) */
 
-/*  WORK    (workspace) DOUBLE PRECISION array, */
-/*                      dimension (MMAX*NMAX + 4*NMAX + MMAX). */
+/*  WORK    (workspace) DOUBLE PRECISION array, dimension */
+/*                      max( MMAX*NMAX + 4*NMAX + MMAX, */
+/*                           6*K*K + 8*K + (K+1)*NSMAX ), */
+/*                      where K = min(MMAX,NMAX). */
 
 /*  IWORK   (workspace) INTEGER array, dimension (15*NMAX) */
 
@@ -477,6 +500,101 @@ static doublereal c_b96 = -1.;
 /* L20: */
 				    }
 				    nrun += 2;
+
+/*                             Test DGELSQS */
+
+/*                             Factor A once with DGEQRF (M >= N) or */
+/*                             DGELQF (M < N) and solve for the right */
+/*                             hand sides in two batches. */
+
+				    if (m > 0 && n > 0) {
+					dlacpy_("Full", &m, &n, &copya[1], &
+						lda, &a[1], &lda);
+					dlacpy_("Full", &nrows, &nrhs, &copyb[
+						1], &ldb, &b[1], &ldb);
+				    }
+				    i__5 = lwork - mnmin;
+				    if (m >= n) {
+					dgeqrf_(&m, &n, &a[1], &lda, &work[1], &
+						work[mnmin + 1], &i__5, &info);
+				    } else {
+					dgelqf_(&m, &n, &a[1], &lda, &work[1], &
+						work[mnmin + 1], &i__5, &info);
+				    }
+				    nrhs1 = nrhs / 2;
+				    s_copy(srnamc_1.srnamt, "DGELSQS", (ftnlen)
+					    32, (ftnlen)7);
+				    dgelsqs_(trans, &m, &n, &nrhs1, &a[1], &lda, 
+					    &work[1], &b[1], &ldb, &work[mnmin + 
+					    1], &i__5, &info);
+				    if (info == 0) {
+					i__6 = nrhs - nrhs1;
+					dgelsqs_(trans, &m, &n, &i__6, &a[1], &
+						lda, &work[1], &b[nrhs1 * ldb + 1]
+						, &ldb, &work[mnmin + 1], &i__5, &
+						info);
+				    }
+				    if (info != 0) {
+					alaerh_(path, "DGELSQS", &info, &c__0, 
+						trans, &m, &n, &nrhs, &c_n1, &
+						nb, &itype, &nfail, &nerrs, 
+						nout);
+				    }
+
+/*                             Test 27:  Compute error in solution */
+
+				    if (nrows > 0 && nrhs > 0) {
+					dlacpy_("Full", &nrows, &nrhs, &copyb[
+						1], &ldb, &c__[1], &ldb);
+				    }
+				    dqrt16_(trans, &m, &n, &nrhs, &copya[1], &
+					    lda, &b[1], &ldb, &c__[1], &ldb, &
+					    work[1], &result[26]);
+
+/*                             Test 28:  Check norm of r'*A or if x is */
+/*                                       in the row space of A */
+
+				    if (itran == 1 && m >= n || itran == 2 && 
+					    m < n) {
+					result[27] = dqrt17_(trans, &c__1, &m, 
+						&n, &nrhs, &copya[1], &lda, &
+						b[1], &ldb, &copyb[1], &ldb, &
+						c__[1], &work[1], &lwork);
+				    } else {
+					result[27] = dqrt14_(trans, &m, &n, &
+						nrhs, &copya[1], &lda, &b[1], 
+						&ldb, &work[1], &lwork);
+				    }
+
+				    for (k = 27; k <= 28; ++k) {
+					if (result[k - 1] >= *thresh) {
+					    if (nfail == 0 && nerrs == 0) {
+						alahd_(nout, path);
+					    }
+					    io___35.ciunit = *nout;
+					    s_wsfe(&io___35);
+					    do_fio(&c__1, trans, (ftnlen)1);
+					    do_fio(&c__1, (char *)&m, (ftnlen)
+						    sizeof(integer));
+					    do_fio(&c__1, (char *)&n, (ftnlen)
+						    sizeof(integer));
+					    do_fio(&c__1, (char *)&nrhs, (
+						    ftnlen)sizeof(integer));
+					    do_fio(&c__1, (char *)&nb, (ftnlen)
+						    sizeof(integer));
+					    do_fio(&c__1, (char *)&itype, (
+						    ftnlen)sizeof(integer));
+					    do_fio(&c__1, (char *)&k, (ftnlen)
+						    sizeof(integer));
+					    do_fio(&c__1, (char *)&result[k - 
+						    1], (ftnlen)sizeof(
+						    doublereal));
+					    e_wsfe();
+					    ++nfail;
+					}
+/* L25: */
+				    }
+				    nrun += 2;
 /* L30: */
 				}
 /* L40: */
@@ -806,10 +924,180 @@ static doublereal c_b96 = -1.;
 					work[1], &lwork);
 			    }
 
+/*                       Test DGELSYF and DGELSYS */
+
+/*                       Factor A once with DGELSYF and solve for the */
+/*                       right hand sides in two batches with DGELSYS. */
+/*                       TAU is kept in WORK(1:2*MNMIN). */
+
+			    i__5 = n;
+			    for (j = 1; j <= i__5; ++j) {
+				iwork[j] = 0;
+/* L82: */
+			    }
+			    dlacpy_("Full", &m, &n, &copya[1], &lda, &a[1], &
+				    lda);
+			    dlacpy_("Full", &m, &nrhs, &copyb[1], &ldb, &b[1], 
+				     &ldb);
+
+			    s_copy(srnamc_1.srnamt, "DGELSYF", (ftnlen)32, (
+				    ftnlen)7);
+			    dgelsyf_(&m, &n, &a[1], &lda, &iwork[1], &rcond, &
+				    crank, &work[1], &work[(mnmin << 1) + 1], &
+				    lwlsy, &info);
+			    if (info != 0) {
+				alaerh_(path, "DGELSYF", &info, &c__0, " ", &m, 
+					 &n, &nrhs, &c_n1, &nb, &itype, &
+					nfail, &nerrs, nout);
+			    }
+			    nrhs1 = nrhs / 2;
+			    s_copy(srnamc_1.srnamt, "DGELSYS", (ftnlen)32, (
+				    ftnlen)7);
+			    dgelsys_(&m, &n, &nrhs1, &a[1], &lda, &iwork[1], &
+				    crank, &work[1], &b[1], &ldb, &work[(mnmin 
+				    << 1) + 1], &lwlsy, &info);
+			    if (info == 0) {
+				i__5 = nrhs - nrhs1;
+				dgelsys_(&m, &n, &i__5, &a[1], &lda, &iwork[1],
+					 &crank, &work[1], &b[nrhs1 * ldb + 1]
+					, &ldb, &work[(mnmin << 1) + 1], &
+					lwlsy, &info);
+			    }
+			    if (info != 0) {
+				alaerh_(path, "DGELSYS", &info, &c__0, " ", &m, 
+					 &n, &nrhs, &c_n1, &nb, &itype, &
+					nfail, &nerrs, nout);
+			    }
+
+/*                       Test 19:  Compute relative error in svd */
+
+			    result[18] = dqrt12_(&crank, &crank, &a[1], &lda, &
+				    copys[1], &work[1], &lwork);
+
+/*                       Test 20:  Compute error in solution */
+
+			    dlacpy_("Full", &m, &nrhs, &copyb[1], &ldb, &work[
+				    1], &ldwork);
+			    dqrt16_("No transpose", &m, &n, &nrhs, &copya[1], 
+				    &lda, &b[1], &ldb, &work[1], &ldwork, &
+				    work[m * nrhs + 1], &result[19]);
+
+/*                       Test 21:  Check norm of r'*A */
+
+			    result[20] = 0.;
+			    if (m > crank) {
+				result[20] = dqrt17_("No transpose", &c__1, &
+					m, &n, &nrhs, &copya[1], &lda, &b[1], 
+					&ldb, &copyb[1], &ldb, &c__[1], &work[
+					1], &lwork);
+			    }
+
+/*                       Test 22:  Check if x is in the rowspace of A */
+
+			    result[21] = 0.;
+			    if (n > crank) {
+				result[21] = dqrt14_("No transpose", &m, &n, &
+					nrhs, &copya[1], &lda, &b[1], &ldb, &
+					work[1], &lwork);
+			    }
+
+/*                       Test DGELSDF and DGELSDS */
+
+/*                       Factor A once with DGELSDF and solve for the */
+/*                       right hand sides in two batches with DGELSDS. */
+/*                       U, VT and TAU are kept in the leading */
+/*                       2*MNMIN*MNMIN + MNMIN entries of WORK. */
+
+/* Computing MAX */
+			    i__5 = 1, i__6 = (mnmin << 2) * mnmin + mnmin * 7,
+				     i__5 = max(i__5,i__6), i__6 = (mnmin + 1) 
+				    * nrhs;
+			    lwlsd = max(i__5,i__6);
+			    ldwork = max(1,mnmin);
+
+			    dlacpy_("Full", &m, &n, &copya[1], &lda, &a[1], &
+				    lda);
+			    dlacpy_("Full", &m, &nrhs, &copyb[1], &ldb, &b[1], 
+				     &ldb);
+
+			    s_copy(srnamc_1.srnamt, "DGELSDF", (ftnlen)32, (
+				    ftnlen)7);
+			    dgelsdf_(&m, &n, &a[1], &lda, &rcond, &crank, &work[
+				    (mnmin << 1) * mnmin + 1], &s[1], &work[1], 
+				    &ldwork, &work[mnmin * mnmin + 1], &ldwork, 
+				    &work[(mnmin << 1) * mnmin + mnmin + 1], &
+				    lwlsd, &iwork[1], &info);
+			    if (info != 0) {
+				alaerh_(path, "DGELSDF", &info, &c__0, " ", &m, 
+					 &n, &nrhs, &c_n1, &nb, &itype, &
+					nfail, &nerrs, nout);
+			    }
+			    s_copy(srnamc_1.srnamt, "DGELSDS", (ftnlen)32, (
+				    ftnlen)7);
+			    dgelsds_(&m, &n, &nrhs1, &a[1], &lda, &crank, &work[
+				    (mnmin << 1) * mnmin + 1], &s[1], &work[1], 
+				    &ldwork, &work[mnmin * mnmin + 1], &ldwork, 
+				    &b[1], &ldb, &work[(mnmin << 1) * mnmin + 
+				    mnmin + 1], &lwlsd, &info);
+			    if (info == 0) {
+				i__5 = nrhs - nrhs1;
+				dgelsds_(&m, &n, &i__5, &a[1], &lda, &crank, &
+					work[(mnmin << 1) * mnmin + 1], &s[1],
+					 &work[1], &ldwork, &work[mnmin * 
+					mnmin + 1], &ldwork, &b[nrhs1 * ldb + 
+					1], &ldb, &work[(mnmin << 1) * mnmin + 
+					mnmin + 1], &lwlsd, &info);
+			    }
+			    if (info != 0) {
+				alaerh_(path, "DGELSDS", &info, &c__0, " ", &m, 
+					 &n, &nrhs, &c_n1, &nb, &itype, &
+					nfail, &nerrs, nout);
+			    }
+			    ldwork = max(1,m);
+
+/*                       Test 23:  Compute relative error in svd */
+
+			    if (rank > 0) {
+				daxpy_(&mnmin, &c_b96, &copys[1], &c__1, &s[1]
+, &c__1);
+				result[22] = dasum_(&mnmin, &s[1], &c__1) / 
+					dasum_(&mnmin, &copys[1], &c__1) / (
+					eps * (doublereal) mnmin);
+			    } else {
+				result[22] = 0.;
+			    }
+
+/*                       Test 24:  Compute error in solution */
+
+			    dlacpy_("Full", &m, &nrhs, &copyb[1], &ldb, &work[
+				    1], &ldwork);
+			    dqrt16_("No transpose", &m, &n, &nrhs, &copya[1], 
+				    &lda, &b[1], &ldb, &work[1], &ldwork, &
+				    work[m * nrhs + 1], &result[23]);
+
+/*                       Test 25:  Check norm of r'*A */
+
+			    result[24] = 0.;
+			    if (m > crank) {
+				result[24] = dqrt17_("No transpose", &c__1, &
+					m, &n, &nrhs, &copya[1], &lda, &b[1], 
+					&ldb, &copyb[1], &ldb, &c__[1], &work[
+					1], &lwork);
+			    }
+
+/*                       Test 26:  Check if x is in the rowspace of A */
+
+			    result[25] = 0.;
+			    if (n > crank) {
+				result[25] = dqrt14_("No transpose", &m, &n, &
+					nrhs, &copya[1], &lda, &b[1], &ldb, &
+					work[1], &lwork);
+			    }
+
 /*                       Print information about the tests that did not */
 /*                       pass the threshold. */
 
-			    for (k = 7; k <= 18; ++k) {
+			    for (k = 7; k <= 26; ++k) {
 				if (result[k - 1] >= *thresh) {
 				    if (nfail == 0 && nerrs == 0) {
 					alahd_(nout, path);
@@ -835,7 +1123,7 @@ static doublereal c_b96 = -1.;
 				}
 /* L90: */
 			    }
-			    nrun += 12;
+			    nrun += 20;
 
 /* L100: */
 			}
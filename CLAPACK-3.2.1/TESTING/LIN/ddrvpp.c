@@ -100,6 +100,9 @@ static integer c__2 = 2;
     integer iuplo, izero, nerrs;
     extern /* Subroutine */ int dppsv_(char *, integer *, integer *, 
 	    doublereal *, doublereal *, integer *, integer *);
+    extern /* Subroutine */ int dppsvf_(char *, integer *, integer *, 
+	    doublereal *, doublereal *, integer *, integer *, integer *), 
+	    xlaenv_(integer *, integer *);
     logical zerot;
     char xtype[1];
     extern /* Subroutine */ int dlatb4_(char *, integer *, integer *, integer 
@@ -163,7 +166,8 @@ static integer c__2 = 2;
 /*  Purpose */
 /*  ======= */
 
-/*  DDRVPP tests the driver routines DPPSV and -SVX. */
+/*  DDRVPP tests the driver routines DPPSV, -SVX and -SVF.  The block */
+/*  size is set to 2 so that DPPSVF takes its RFP path for N > 2. */
 
 /*  Arguments */
 /*  ========= */
@@ -219,7 +223,8 @@ static integer c__2 = 2;
 
 /*  RWORK   (workspace) DOUBLE PRECISION array, dimension (NMAX+2*NRHS) */
 
-/*  IWORK   (workspace) INTEGER array, dimension (NMAX) */
+/*  IWORK   (workspace) INTEGER array, dimension */
+/*                      (max(NMAX,(NMAX*(NMAX+1)/2+31)/32)) */
 
 /*  NOUT    (input) INTEGER */
 /*          The unit number for output. */
@@ -281,6 +286,10 @@ static integer c__2 = 2;
     }
     infoc_1.infot = 0;
 
+/*     Set the block size for DPPSVF. */
+
+    xlaenv_(&c__1, &c__2);
+
 /*     Do for each value of N in NVAL */
 
     i__1 = *nn;
@@ -558,6 +567,67 @@ static integer c__2 = 2;
 			    }
 			    nrun += nt;
 L70:
+
+/*                       --- Test DPPSVF --- */
+
+			    dcopy_(&npp, &a[1], &c__1, &afac[1], &c__1);
+			    dlacpy_("Full", &n, nrhs, &b[1], &lda, &x[1], &
+				    lda);
+
+			    s_copy(srnamc_1.srnamt, "DPPSVF", (ftnlen)32, (
+				    ftnlen)6);
+			    dppsvf_(uplo, &n, nrhs, &afac[1], &x[1], &lda, &
+				    iwork[1], &info);
+
+/*                       Check error code from DPPSVF. */
+
+			    if (info != izero) {
+				alaerh_(path, "DPPSVF", &info, &izero, uplo, &
+					n, &n, &c_n1, &c_n1, nrhs, &imat, &
+					nfail, &nerrs, nout);
+				goto L76;
+			    } else if (info != 0) {
+				goto L76;
+			    }
+
+/*                       Check the factor, the residual and the */
+/*                       solution as for DPPSV. */
+
+			    dppt01_(uplo, &n, &a[1], &afac[1], &rwork[1], 
+				    result);
+			    dlacpy_("Full", &n, nrhs, &b[1], &lda, &work[1], &
+				    lda);
+			    dppt02_(uplo, &n, nrhs, &a[1], &x[1], &lda, &work[
+				    1], &lda, &rwork[1], &result[1]);
+			    dget04_(&n, nrhs, &x[1], &lda, &xact[1], &lda, &
+				    rcondc, &result[2]);
+			    nt = 3;
+
+			    i__4 = nt;
+			    for (k = 1; k <= i__4; ++k) {
+				if (result[k - 1] >= *thresh) {
+				    if (nfail == 0 && nerrs == 0) {
+					aladhd_(nout, path);
+				    }
+				    io___49.ciunit = *nout;
+				    s_wsfe(&io___49);
+				    do_fio(&c__1, "DPPSVF", (ftnlen)6);
+				    do_fio(&c__1, uplo, (ftnlen)1);
+				    do_fio(&c__1, (char *)&n, (ftnlen)sizeof(
+					    integer));
+				    do_fio(&c__1, (char *)&imat, (ftnlen)
+					    sizeof(integer));
+				    do_fio(&c__1, (char *)&k, (ftnlen)sizeof(
+					    integer));
+				    do_fio(&c__1, (char *)&result[k - 1], (
+					    ftnlen)sizeof(doublereal));
+				    e_wsfe();
+				    ++nfail;
+				}
+/* L74: */
+			    }
+			    nrun += nt;
+L76:
 			    ;
 			}
 
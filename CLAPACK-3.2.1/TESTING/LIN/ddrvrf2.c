@@ -28,7 +28,7 @@ static integer c__1 = 1;
 
 /* Subroutine */ int ddrvrf2_(integer *nout, integer *nn, integer *nval, 
 	doublereal *a, integer *lda, doublereal *arf, doublereal *ap, 
-	doublereal *asav)
+	doublereal *asav, integer *iwork)
 {
     /* Initialized data */
 
@@ -56,7 +56,7 @@ static integer c__1 = 1;
 
     /* Local variables */
     integer i__, j, n;
-    logical ok1, ok2;
+    logical ok1, ok2, ok3;
     integer iin, info;
     char uplo[1];
     integer nrun, iseed[4];
@@ -72,7 +72,11 @@ static integer c__1 = 1;
 	    *, char *, integer *, doublereal *, integer *, doublereal *, 
 	    integer *), dtrttp_(char *, integer *, doublereal 
 	    *, integer *, doublereal *, integer *), dtpttr_(char *, 
-	    integer *, doublereal *, doublereal *, integer *, integer *);
+	    integer *, doublereal *, doublereal *, integer *, integer *), 
+	    dtfttpi_(char *, char *, integer *, doublereal *, integer *, 
+	    integer *), dtpttfi_(char *, char *, integer *, doublereal *, 
+	    integer *, integer *), dcopy_(integer *, doublereal *, integer *, 
+	    doublereal *, integer *);
 
     /* Fortran I/O blocks */
     static cilist io___19 = { 0, 0, 0, 0, 0 };
@@ -95,7 +99,9 @@ static integer c__1 = 1;
 /*  Purpose */
 /*  ======= */
 
-/*  DDRVRF2 tests the LAPACK RFP convertion routines. */
+/*  DDRVRF2 tests the LAPACK RFP convertion routines.  The in-place */
+/*  routines DTPTTFI and DTFTTPI must give exactly the results of */
+/*  DTPTTF and DTFTTP. */
 
 /*  Arguments */
 /*  ========= */
@@ -120,6 +126,9 @@ static integer c__1 = 1;
 
 /*  A2            (workspace) DOUBLE PRECISION array, dimension (LDA,NMAX) */
 
+/*  IWORK         (workspace) INTEGER array, dimension */
+/*                ((NMAX*(NMAX+1)/2+31)/32) */
+
 /*  ===================================================================== */
 /*     .. */
 /*     .. Local Scalars .. */
@@ -145,6 +154,7 @@ static integer c__1 = 1;
     a -= a_offset;
     --arf;
     --ap;
+    --iwork;
 
     /* Function Body */
 /*     .. */
@@ -263,7 +273,36 @@ static integer c__1 = 1;
 		    }
 		}
 
-		if (! ok1 || ! ok2) {
+		++nrun;
+
+/*              Convert AP to RFP format in place in A2 and back, and */
+/*              compare with the results of DTPTTF and DTFTTP. */
+
+		i__2 = n * (n + 1) / 2;
+		dcopy_(&i__2, &ap[1], &c__1, &asav[asav_offset], &c__1);
+
+		s_copy(srnamc_1.srnamt, "DTPTTFI", (ftnlen)32, (ftnlen)7);
+		dtpttfi_(cform, uplo, &n, &asav[asav_offset], &iwork[1], &info);
+
+		ok3 = TRUE_;
+		i__2 = n * (n + 1) / 2;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (asav[asav_offset + i__ - 1] != arf[i__]) {
+			ok3 = FALSE_;
+		    }
+		}
+
+		s_copy(srnamc_1.srnamt, "DTFTTPI", (ftnlen)32, (ftnlen)7);
+		dtfttpi_(cform, uplo, &n, &asav[asav_offset], &iwork[1], &info);
+
+		i__2 = n * (n + 1) / 2;
+		for (i__ = 1; i__ <= i__2; ++i__) {
+		    if (asav[asav_offset + i__ - 1] != ap[i__]) {
+			ok3 = FALSE_;
+		    }
+		}
+
+		if (! ok1 || ! ok2 || ! ok3) {
 		    if (nerrs == 0) {
 			io___19.ciunit = *nout;
 			s_wsle(&io___19);
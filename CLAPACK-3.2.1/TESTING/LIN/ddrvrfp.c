@@ -35,7 +35,7 @@ static integer c__1 = 1;
 	d_work_dlatms__, doublereal *d_work_dpot01__, doublereal *
 	d_temp_dpot02__, doublereal *d_temp_dpot03__, doublereal *
 	d_work_dlansy__, doublereal *d_work_dpot02__, doublereal *
-	d_work_dpot03__)
+	d_work_dpot03__, integer *d_work_dtpttfi__)
 {
     /* Initialized data */
 
@@ -108,8 +108,14 @@ static integer c__1 = 1;
 	    integer *), dtfttr_(char *, char *, integer *, 
 	    doublereal *, doublereal *, integer *, integer *),
 	     dtrttf_(char *, char *, integer *, doublereal *, integer *, 
-	    doublereal *, integer *);
-    doublereal result[4];
+	    doublereal *, integer *), dpfsv_(char *, char *, integer *, 
+	    integer *, doublereal *, doublereal *, integer *, integer *), 
+	    dtfttpi_(char *, char *, integer *, doublereal *, integer *, 
+	    integer *), dtpttfi_(char *, char *, integer *, doublereal *, 
+	    integer *, integer *), dtpttr_(char *, integer *, doublereal *, 
+	    doublereal *, integer *, integer *), dtrttp_(char *, integer *, 
+	    doublereal *, integer *, doublereal *, integer *);
+    doublereal result[7];
 
     /* Fortran I/O blocks */
     static cilist io___37 = { 0, 0, 0, fmt_9999, 0 };
@@ -129,7 +135,7 @@ static integer c__1 = 1;
 /*  ======= */
 
 /*  DDRVRFP tests the LAPACK RFP routines: */
-/*      DPFTRF, DPFTRS, and DPFTRI. */
+/*      DPFTRF, DPFTRS, DPFTRI and DPFSV. */
 
 /*  This testing routine follow the same tests as DDRVPO (test for the full */
 /*  format Symmetric Positive Definite solver). */
@@ -158,6 +164,10 @@ static integer c__1 = 1;
 /*  (4) ( norm(X-XACT) * RCOND ) / ( norm(XACT) * EPS ), */
 /*  where EPS is the machine precision, RCOND the condition number of A, and */
 /*  norm( . ) the 1-norm for (1,2,3) and the inf-norm for (4). */
+/*  Then A is packed with DTRTTP, converted in place to RFP format by */
+/*  DTPTTFI and the system is solved by DPFSV.  The factor is converted */
+/*  back in place by DTFTTPI and unpacked with DTPTTR, and tests (1), */
+/*  (2) and (4) are repeated as tests (5), (6) and (7). */
 /*  Errors occur when INFO parameter is not as expected. Failures occur when */
 /*  a test ratios is greater than THRES. */
 
@@ -226,6 +236,9 @@ static integer c__1 = 1;
 
 /*  D_WORK_DPOT03 (workspace) DOUBLE PRECISION array, dimension ( NMAX ) */
 
+/*  D_WORK_DTPTTFI (workspace) INTEGER array, dimension */
+/*                ( (NMAX*(NMAX+1)/2+31)/32 ) */
+
 /*  ===================================================================== */
 
 /*     .. Parameters .. */
@@ -264,6 +277,7 @@ static integer c__1 = 1;
     --d_work_dlansy__;
     --d_work_dpot02__;
     --d_work_dpot03__;
+    --d_work_dtpttfi__;
 
     /* Function Body */
 /*     .. */
@@ -536,7 +550,45 @@ static integer c__1 = 1;
 /*                    Check solution from generated exact solution. */
 			dget04_(&n, &nrhs, &x[1], &lda, &xact[1], &lda, &
 				rcondc, &result[3]);
-			nt = 4;
+
+/*                    Solve again with DPFSV from packed storage */
+/*                    converted in place, using ARFINV. */
+
+			s_copy(srnamc_1.srnamt, "DTRTTP", (ftnlen)32, (ftnlen)
+				6);
+			dtrttp_(uplo, &n, &a[1], &lda, &arfinv[1], &info);
+			s_copy(srnamc_1.srnamt, "DTPTTFI", (ftnlen)32, (ftnlen)
+				7);
+			dtpttfi_(cform, uplo, &n, &arfinv[1], &
+				d_work_dtpttfi__[1], &info);
+			dlacpy_("Full", &n, &nrhs, &b[1], &ldb, &x[1], &ldb);
+			s_copy(srnamc_1.srnamt, "DPFSV", (ftnlen)32, (ftnlen)
+				5);
+			dpfsv_(cform, uplo, &n, &nrhs, &arfinv[1], &x[1], &ldb, 
+				&info);
+			if (info != 0) {
+			    alaerh_("DPF", "DPFSV ", &info, &c__0, uplo, &n, &
+				    n, &c_n1, &c_n1, &nrhs, &iit, &nfail, &
+				    nerrs, nout);
+			}
+			s_copy(srnamc_1.srnamt, "DTFTTPI", (ftnlen)32, (ftnlen)
+				7);
+			dtfttpi_(cform, uplo, &n, &arfinv[1], &
+				d_work_dtpttfi__[1], &info);
+			s_copy(srnamc_1.srnamt, "DTPTTR", (ftnlen)32, (ftnlen)
+				6);
+			dtpttr_(uplo, &n, &arfinv[1], &afac[1], &lda, &info);
+
+			dpot01_(uplo, &n, &a[1], &lda, &afac[1], &lda, &
+				d_work_dpot01__[1], &result[4]);
+			dlacpy_("Full", &n, &nrhs, &b[1], &lda, &
+				d_temp_dpot02__[1], &lda);
+			dpot02_(uplo, &n, &nrhs, &a[1], &lda, &x[1], &lda, &
+				d_temp_dpot02__[1], &lda, &d_work_dpot02__[1], 
+				 &result[5]);
+			dget04_(&n, &nrhs, &x[1], &lda, &xact[1], &lda, &
+				rcondc, &result[6]);
+			nt = 7;
 
 /*                    Print information about the tests that did not */
 /*                    pass the threshold. */